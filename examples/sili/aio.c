@@ -0,0 +1,124 @@
+#define SI_IMPLEMENTATION 1
+#include <sili.h>
+
+
+#define BLOCK_LEN SI_KILO(4)
+#define BLOCK_COUNT 4096
+#define QUEUE_DEPTH 64
+
+/* Writes the file in blocks, syncs it and then reads every block back in a
+ * random order, keeping 'QUEUE_DEPTH' requests in flight. */
+void example_aio(siAio* aio, siArena* arena);
+
+
+int main(void) {
+	siArena arena = si_arenaMake(si_allocatorHeap(), QUEUE_DEPTH * BLOCK_LEN + SI_KILO(4));
+
+	{
+		siAio aio;
+		si_aioMake(QUEUE_DEPTH, si_allocatorHeap(), &aio);
+		si_printfLn("Default backend (%s):", (aio.backend == siAioBackend_IoUring) ? SI_STR("io_uring") : SI_STR("threads"));
+
+		/* NOTE(EimaMei): The buffers are all allocated from the arena, meaning
+		 * registering its memory lets io_uring skip mapping them on every request. */
+		siArray(u8) buffers[] = {SI_ARR_LEN(arena.ptr, arena.capacity)};
+		si_aioRegisterBuffers(&aio, SI_ARR_LEN(buffers, countof(buffers)));
+
+		example_aio(&aio, &arena);
+		si_aioDestroy(&aio);
+	}
+
+	{
+		siAio aio;
+		si_aioMakeEx(QUEUE_DEPTH, siAioBackend_Threads, 4, si_allocatorHeap(), &aio);
+		si_printLn("Thread pool:");
+
+		example_aio(&aio, &arena);
+		si_aioDestroy(&aio);
+	}
+
+	si_arenaFree(&arena);
+	si_pathRemove(SI_STR("examples/aio.bin"));
+}
+
+void example_aio(siAio* aio, siArena* arena) {
+	siArenaTmp tmp = si_arenaTmpStart(arena);
+	siAllocator alloc = si_allocatorArena(arena);
+
+	siFile file = si_fileCreate(SI_STR("examples/aio.bin"));
+	u8* blocks[QUEUE_DEPTH];
+	for_range (i, 0, QUEUE_DEPTH) {
+		blocks[i] = si_allocArrayNonZeroed(alloc, u8, BLOCK_LEN);
+	}
+	bool registered = (aio->backend == siAioBackend_IoUring);
+
+	siAioCompletion completions[QUEUE_DEPTH];
+	siArray(siAioCompletion) out = SI_ARR_LEN(completions, countof(completions));
+
+	siTime start = si_clock();
+	for (isize block = 0; block < BLOCK_COUNT; block += QUEUE_DEPTH) {
+		siAioRequest requests[QUEUE_DEPTH];
+		for_range (i, 0, QUEUE_DEPTH) {
+			si_memset(blocks[i], (u8)(block + i), BLOCK_LEN);
+			requests[i] = si_aioWrite(&file, (block + i) * BLOCK_LEN, SI_ARR_LEN(blocks[i], BLOCK_LEN), nil);
+			requests[i].bufferIndex = registered ? 0 : -1;
+		}
+
+		si_aioSubmit(aio, SI_ARR_LEN(requests, countof(requests)));
+		while (aio->inFlight != 0) {
+			si_aioPoll(aio, out, aio->inFlight);
+		}
+	}
+
+	siAioRequest sync = si_aioSync(&file, false, nil);
+	si_aioSubmit(aio, SI_ARR_LEN(&sync, 1));
+	si_aioPoll(aio, out, 1);
+	siTime writing = si_clock() - start;
+
+	/* NOTE(EimaMei): Every finished read immediately gets replaced by a new one,
+	 * so the device always has 'QUEUE_DEPTH' requests to work on. The request's
+	 * user data is the index of the buffer it reads into. */
+	siRandom rng = si_randomMake((u64)si_clock());
+	isize freeBlocks[QUEUE_DEPTH], reads[QUEUE_DEPTH];
+	for_range (i, 0, QUEUE_DEPTH) {
+		freeBlocks[i] = i;
+	}
+
+	isize freeLen = QUEUE_DEPTH, submitted = 0, completed = 0, failed = 0;
+	start = si_clock();
+	while (completed < BLOCK_COUNT) {
+		while (submitted < BLOCK_COUNT && freeLen != 0) {
+			freeLen -= 1;
+			isize index = freeBlocks[freeLen];
+			reads[index] = (isize)si_randomBounded(&rng, BLOCK_COUNT);
+
+			siAioRequest req = si_aioRead(
+				&file, reads[index] * BLOCK_LEN, SI_ARR_LEN(blocks[index], BLOCK_LEN),
+				(void*)index
+			);
+			req.bufferIndex = registered ? 0 : -1;
+			si_aioSubmit(aio, SI_ARR_LEN(&req, 1));
+			submitted += 1;
+		}
+
+		isize len = si_aioPoll(aio, out, 1);
+		for_range (i, 0, len) {
+			isize index = (isize)completions[i].userData;
+			failed += (completions[i].len != BLOCK_LEN || blocks[index][BLOCK_LEN - 1] != (u8)reads[index]);
+
+			freeBlocks[freeLen] = index;
+			freeLen += 1;
+			completed += 1;
+		}
+	}
+	siTime reading = si_clock() - start;
+
+	si_printfLn(
+		"\tWrote %zi KiB in %.2f ms, %zi random reads took %.2f ms (%zi failed), the file is %zi bytes long.",
+		BLOCK_COUNT * BLOCK_LEN / SI_KILO(1), (f64)writing / (f64)SI_MILLISECOND,
+		completed, (f64)reading / (f64)SI_MILLISECOND, failed, si_fileSize(file)
+	);
+
+	si_fileClose(&file);
+	si_arenaTmpEnd(tmp);
+}
@@ -13,6 +13,21 @@ void example3(void);
 void example4(void);
 /* Showcases standard and sili ways of using the library's printf function. */
 void example5(siAllocator* alloc);
+/* Showcases vectored file writes and reads. */
+void example6(void);
+/* Showcases direct file I/O, which bypasses the system's page cache. */
+void example7(void);
+/* Showcases copying files and folders, as well as reporting the copy's progress. */
+void example8(void);
+/* Showcases walking through every item inside a folder and its subfolders. */
+void example9(void);
+
+/* Prints how much of the file has been copied so far. */
+SI_PATH_COPY_PROC(copy_progress);
+/* Counts every file and folder, except for the contents of the 'sili' folder. */
+SI_DIRECTORY_WALK_PROC(walk_count);
+/* Accepts every item without doing anything. */
+SI_DIRECTORY_WALK_PROC(walk_nothing);
 
 
 int main(void) {
@@ -24,6 +39,10 @@ int main(void) {
 	example3();
 	example4();
 	example5(&alloc);
+	example6();
+	example7();
+	example8();
+	example9();
 
 	si_arenaFree(&aData);
 }
@@ -69,6 +88,15 @@ void example1(siAllocator alloc) {
 			file.size
 		);
 
+		/* NOTE(EimaMei): The file gets hashed 256 bytes at a time, yet the result
+		 * is identical to hashing the entire contents at once. */
+		siString contents = si_fileReadContents(file, alloc);
+		si_printfLn(
+			"\tHash - '%#lx' (one-shot: '%#lx')",
+			si_optionalGetOrDefault(si_fileHash64(file, SI_ARR_STACK(256)), 0),
+			si_wyhash64(contents.data, contents.len)
+		);
+
 		siArray(siString) lines = si_fileReadlines(file, alloc);
 		si_printfLn(
 			"Contents of '%s' ('%zd' lines in total):",
@@ -258,3 +286,186 @@ void example5(siAllocator* alloc) {
 		si_printColor3bit(siPrintColor3bit_Yellow)
 	);
 }
+
+void example6(void) {
+	si_printLn("==============\n\n==============\nExample 6:");
+
+	siFile file = si_fileCreate(SI_STR("records.bin"));
+
+	/* Each record consists of a header, a payload and a trailer, which get
+	 * written together without first copying them into one buffer. */
+	siString payloads[] = {SI_STRC("first record"), SI_STRC("second"), SI_STRC("the third and final record")};
+	for_range (i, 0, countof(payloads)) {
+		u32 header = (u32)payloads[i].len,
+			trailer = si_crc32c(payloads[i].data, payloads[i].len);
+
+		siArray(u8) record[] = {
+			SI_ARR_LEN((u8*)&header, si_sizeof(header)),
+			SI_ARR_LEN((u8*)payloads[i].data, payloads[i].len),
+			SI_ARR_LEN((u8*)&trailer, si_sizeof(trailer)),
+		};
+		isize len = si_fileWriteVec(&file, SI_ARR_LEN(record, countof(record)));
+		si_printfLn("Wrote record %zi (%zi bytes).", i, len);
+	}
+	si_printfLn("The file is now %zi bytes long.", si_fileSize(file));
+
+	/* The second record starts after the first one's header, payload and trailer. */
+	{
+		u32 header, trailer;
+		u8 payload[64];
+
+		isize offset = si_sizeof(header) + payloads[0].len + si_sizeof(trailer);
+		siArray(u8) record[] = {
+			SI_ARR_LEN((u8*)&header, si_sizeof(header)),
+			SI_ARR_LEN(payload, (isize)payloads[1].len),
+			SI_ARR_LEN((u8*)&trailer, si_sizeof(trailer)),
+		};
+		siResult(isize) res = si_fileReadVec(file, offset, SI_ARR_LEN(record, countof(record)));
+
+		si_printfLn(
+			"Read %zi bytes: header - %u, payload - '%s', trailer matches - %t",
+			res.data.value, header, SI_STR_LEN(payload, header),
+			trailer == si_crc32c(payload, header)
+		);
+	}
+
+	si_fileClose(&file);
+	si_pathRemove(SI_STR("records.bin"));
+}
+
+void example7(void) {
+	si_printLn("==============\n\n==============\nExample 7:");
+
+	/* Buffers for direct I/O must be aligned, which an arena with the right
+	 * alignment guarantees for every allocation. */
+	siArena arena = si_arenaMakeEx(si_allocatorHeap(), SI_KILO(64), SI_FILE_DIRECT_ALIGNMENT);
+	siAllocator alloc = si_allocatorArena(&arena);
+
+	u8* block = si_allocArrayNonZeroed(alloc, u8, SI_KILO(32));
+	si_printfLn("Is the buffer aligned: %t", ((usize)block % SI_FILE_DIRECT_ALIGNMENT) == 0);
+
+	siFile file = si_fileOpenMode(SI_STR("direct.bin"), siFileMode_Write | siFileMode_Plus | siFileMode_Direct | siFileMode_Sync);
+	if (file.error.code != 0) {
+		si_printLn("The file system doesn't support direct I/O.");
+		si_arenaFree(&arena);
+		return;
+	}
+
+	for_range (i, 0, 8) {
+		si_memset(block, (u8)('a' + i), SI_KILO(32));
+		si_fileWriteAt(&file, SI_ARR_LEN(block, SI_KILO(32)), i * SI_KILO(32));
+	}
+	si_printfLn("Wrote %zi bytes without going through the page cache.", si_fileSize(file));
+
+	/* A large sequential scan, which doesn't evict anything else from the cache. */
+	isize checksum = 0;
+	for (isize offset = 0; offset < si_fileSize(file); offset += SI_KILO(32)) {
+		siResult(siArray(u8)) res = si_fileReadEx(file, offset, SI_KILO(32), block);
+		SI_STOPIF(!res.hasValue, break);
+		checksum += block[0];
+	}
+	si_printfLn("Scanned the file, the sum of every block's first byte is %zi.", checksum);
+
+	si_fileClose(&file);
+	si_pathRemove(SI_STR("direct.bin"));
+	si_arenaFree(&arena);
+}
+
+void example8(void) {
+	si_printLn("==============\n\n==============\nExample 8:");
+
+	siFile file = si_fileCreate(SI_STR("copy.bin"));
+	{
+		static u8 block[SI_MEGA(1)];
+		for_range (i, 0, 20) {
+			si_memset(block, (u8)i, countof(block));
+			si_fileWrite(&file, SI_ARR_LEN(block, countof(block)));
+		}
+	}
+	si_fileClose(&file);
+
+	/* The copy gets done inside the kernel whenever possible, meaning the data
+	 * never passes through the program's own memory. */
+	isize calls = 0;
+	siResult(isize) res = si_pathCopyEx(SI_STR("copy.bin"), SI_STR("copy2.bin"), copy_progress, &calls);
+	si_printfLn("Copied %zi bytes, the progress got reported %zi times.", si_optionalGetOrDefault(res, -1), calls);
+
+	/* Copying over an existing file replaces its contents. */
+	file = si_fileCreate(SI_STR("small.txt"));
+	si_fileWriteStr(&file, SI_STR("A much smaller file."));
+	si_fileClose(&file);
+
+	res = si_pathCopy(SI_STR("small.txt"), SI_STR("copy2.bin"));
+	file = si_fileOpen(SI_STR("copy2.bin"));
+	si_printfLn("Copied %zi bytes over 'copy2.bin', which is now %zi bytes long.", si_optionalGetOrDefault(res, -1), si_fileSize(file));
+	si_fileClose(&file);
+
+	/* Every file inside the folder gets copied at the same time. */
+	si_pathCreateFolder(SI_STR("copy_src"));
+	si_pathCreateFolder(SI_STR("copy_src/inner"));
+	si_pathCopy(SI_STR("copy.bin"), SI_STR("copy_src/a.bin"));
+	si_pathCopy(SI_STR("copy2.bin"), SI_STR("copy_src/inner/b.bin"));
+	si_pathCreateFolder(SI_STR("copy_dst"));
+
+	siResult(i32) count = si_pathItemsCopy(SI_STR("copy_src"), SI_STR("copy_dst"));
+	si_printfLn(
+		"Copied %i files from 'copy_src', does 'copy_dst/inner/b.bin' exist: %t",
+		si_optionalGetOrDefault(count, -1), si_pathExists(SI_STR("copy_dst/inner/b.bin"))
+	);
+
+	si_pathRemove(SI_STR("copy.bin"));
+	si_pathRemove(SI_STR("copy2.bin"));
+	si_pathRemove(SI_STR("small.txt"));
+	si_pathRemove(SI_STR("copy_src"));
+	si_pathRemove(SI_STR("copy_dst"));
+}
+
+SI_PATH_COPY_PROC(copy_progress) {
+	isize* calls = (isize*)data;
+	*calls += 1;
+	si_printfLn("\t%zi/%zi KiB", copied / SI_KILO(1), total / SI_KILO(1));
+}
+
+typedef struct walkCount {
+	isize files;
+	isize folders;
+	i32 maxDepth;
+} walkCount;
+
+void example9(void) {
+	si_printLn("==============\n\n==============\nExample 9:");
+
+	walkCount count = SI_STRUCT_ZERO;
+	siResult(isize) res = si_directoryWalk(SI_STR("examples"), walk_count, &count);
+	si_printfLn(
+		"Walked %zi items: %zi files and %zi folders, with the deepest one being %i folders deep.",
+		si_optionalGetOrDefault(res, -1), count.files, count.folders, count.maxDepth
+	);
+
+	/* The folders get spread across the threads, meaning the callback must be
+	 * thread-safe. */
+	siTime start = si_clock();
+	res = si_directoryWalkEx(SI_STR("."), 4, walk_nothing, nil);
+	si_printfLn(
+		"Walked %zi items inside the repository with 4 threads in %.2f ms.",
+		si_optionalGetOrDefault(res, -1), (f64)(si_clock() - start) / (f64)SI_MILLISECOND
+	);
+}
+
+SI_DIRECTORY_WALK_PROC(walk_count) {
+	walkCount* count = (walkCount*)data;
+	count->maxDepth = si_max(i32, count->maxDepth, entry->depth);
+
+	if (entry->type != siIoType_Directory) {
+		count->files += 1;
+		return siWalkAction_Continue;
+	}
+
+	count->folders += 1;
+	return si_stringEqual(entry->name, SI_STR("sili")) ? siWalkAction_Skip : siWalkAction_Continue;
+}
+
+SI_DIRECTORY_WALK_PROC(walk_nothing) {
+	SI_UNUSED(entry); SI_UNUSED(data);
+	return siWalkAction_Continue;
+}
@@ -0,0 +1,78 @@
+#define SI_IMPLEMENTATION 1
+#include <sili.h>
+
+
+typedef u64 hashProc(const void* data, isize len);
+
+typedef struct hashFunction {
+	siString name;
+	hashProc* proc;
+} hashFunction;
+
+siIntern u64 hash_fnv32a(const void* data, isize len) { return si_fnv32a(data, len); }
+siIntern u64 hash_fnv64a(const void* data, isize len) { return si_fnv64a(data, len); }
+siIntern u64 hash_murmur32(const void* data, isize len) { return si_murmur32(data, len); }
+siIntern u64 hash_murmur64(const void* data, isize len) { return si_murmur64(data, len); }
+siIntern u64 hash_wyhash64(const void* data, isize len) { return si_wyhash64(data, len); }
+siIntern u64 hash_wyhash128(const void* data, isize len) { return si_wyhash128(data, len).high; }
+siIntern u64 hash_crc32c(const void* data, isize len) { return si_crc32c(data, len); }
+siIntern u64 hash_adler32(const void* data, isize len) { return si_adler32(data, len); }
+
+/* Hashes roughly 64 MiB worth of 'len' sized inputs and returns the throughput
+ * in GiB/s. */
+f64 benchmark_hash(hashProc* proc, const u8* data, isize len);
+
+
+int main(void) {
+	hashFunction functions[] = {
+		{SI_STRC("si_fnv32a"), hash_fnv32a},
+		{SI_STRC("si_fnv64a"), hash_fnv64a},
+		{SI_STRC("si_murmur32"), hash_murmur32},
+		{SI_STRC("si_murmur64"), hash_murmur64},
+		{SI_STRC("si_wyhash64"), hash_wyhash64},
+		{SI_STRC("si_wyhash128"), hash_wyhash128},
+		{SI_STRC("si_crc32c"), hash_crc32c},
+		{SI_STRC("si_adler32"), hash_adler32},
+	};
+	isize sizes[] = {8, 64, 512, SI_KILO(4), SI_KILO(64), SI_MEGA(1)};
+
+	/* NOTE(EimaMei): The input starts a few bytes into the buffer, as a misaligned
+	 * key is the common case for strings. */
+	siArray(u8) buffer = si_arrayMakeReserve(u8, SI_MEGA(1) + 16, si_allocatorHeap());
+	u8* data = (u8*)buffer.data;
+	for_range (i, 0, buffer.len) {
+		data[i] = (u8)(i * 31);
+	}
+	const u8* input = &data[3];
+
+	si_printf("%-14S", "GiB/s");
+	for_range (i, 0, countof(sizes)) {
+		si_printf("%12zi", sizes[i]);
+	}
+	si_printLn("");
+
+	for_range (i, 0, countof(functions)) {
+		si_printf("%-14s", functions[i].name);
+		for_range (j, 0, countof(sizes)) {
+			si_printf("%12.2f", benchmark_hash(functions[i].proc, input, sizes[j]));
+		}
+		si_printLn("");
+	}
+
+	si_arrayFree(buffer, si_allocatorHeap());
+}
+
+f64 benchmark_hash(hashProc* proc, const u8* data, isize len) {
+	isize count = SI_MEGA(64) / len;
+	volatile u64 sink = 0;
+
+	siTime start = si_clock();
+	for_range (i, 0, count) {
+		sink ^= proc(data, len);
+	}
+	siTime end = si_clock();
+	SI_UNUSED(sink);
+
+	f64 seconds = (f64)(end - start) / (f64)SI_SECOND;
+	return (f64)(count * len) / (f64)SI_GIGA(1) / seconds;
+}
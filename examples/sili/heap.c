@@ -0,0 +1,124 @@
+#define SI_IMPLEMENTATION 1
+#include <sili.h>
+
+
+typedef struct task {
+	i32 priority;
+	siString name;
+} task;
+
+/* Returns true if the first task's priority is smaller than the second one's. */
+SI_HEAP_COMPARE_PROC(task_compare);
+/* Returns true if the first integer is smaller than the second one. */
+SI_HEAP_COMPARE_PROC(i64_compare);
+
+/* Pushes and pops every element through a generic 'siHeap(i64)'. */
+void benchmark_heapGeneric(siArray(i64) keys);
+/* Pushes and pops every element through the specialized 'siHeapNodeI64' heap. */
+void benchmark_heapI64(siArray(i64) keys);
+
+
+int main(void) {
+	si_printLn("Scope 1:");
+	{
+		siHeap(task) heap = si_heapMakeReserve(task, 4, task_compare, nil, si_allocatorHeap());
+
+		task tasks[] = {
+			{3, SI_STRC("compile")}, {5, SI_STRC("deploy")},
+			{1, SI_STRC("checkout")}, {4, SI_STRC("test")}
+		};
+
+		isize handles[countof(tasks)];
+		for_range (i, 0, countof(tasks)) {
+			handles[i] = si_heapPush(&heap, &tasks[i]);
+		}
+
+		/* NOTE(EimaMei): 'deploy' suddenly became urgent, so its priority is
+		 * decreased through its handle. */
+		task urgent = {0, SI_STRC("deploy")};
+		si_heapUpdate(&heap, handles[1], &urgent);
+
+		task* top = (task*)si_heapTop(heap);
+		si_printfLn("\ttop: '%s' (priority %i), len: '%zi'", top->name, top->priority, heap.array.len);
+
+		task t;
+		while (si_heapPop(&heap, &t)) {
+			si_printfLn("\tpopped '%s' (priority %i)", t.name, t.priority);
+		}
+
+		si_heapFree(heap);
+	}
+
+	si_printLn("Scope 2:");
+	{
+		siDynamicArray(siHeapNodeI64) timers = si_dynamicArrayMakeReserve(siHeapNodeI64, 8, si_allocatorHeap());
+		si_heapPushI64(&timers, 250, 1);
+		si_heapPushI64(&timers, -10, 2);
+		si_heapPushI64(&timers, 100, 3);
+		si_heapPushI64(&timers, 1000, 4);
+
+		siHeapNodeI64 node;
+		while (si_heapPopI64(&timers, &node)) {
+			si_printfLn("\ttimer %lu fires at %li", node.value, node.key);
+		}
+
+		si_dynamicArrayFree(timers);
+	}
+
+	si_printLn("Scope 3:");
+	{
+		siArray(i64) keys = si_arrayMakeReserve(i64, 10000000, si_allocatorHeap());
+
+		u64 state = 0x9E3779B97F4A7C15;
+		i64* key;
+		for_eachRefArr (key, keys) {
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			*key = (i64)state;
+		}
+
+		si_printfLn("\tPushing and popping %zi elements:", keys.len);
+		si_benchmarkRunsPerLoop(1, benchmark_heapGeneric(keys));
+		si_benchmarkRunsPerLoop(1, benchmark_heapI64(keys));
+
+		si_arrayFree(keys, si_allocatorHeap());
+	}
+}
+
+SI_HEAP_COMPARE_PROC(task_compare) {
+	SI_UNUSED(userData);
+	return ((const task*)lhs)->priority < ((const task*)rhs)->priority;
+}
+
+SI_HEAP_COMPARE_PROC(i64_compare) {
+	SI_UNUSED(userData);
+	return *(const i64*)lhs < *(const i64*)rhs;
+}
+
+void benchmark_heapGeneric(siArray(i64) keys) {
+	siHeap(i64) heap = si_heapMakeReserve(i64, keys.len, i64_compare, nil, si_allocatorHeap());
+
+	i64 key;
+	for_eachArr (key, keys) {
+		si_heapPush(&heap, &key);
+	}
+
+	while (si_heapPop(&heap, &key)) {}
+
+	si_heapFree(heap);
+}
+
+void benchmark_heapI64(siArray(i64) keys) {
+	siDynamicArray(siHeapNodeI64) heap = si_dynamicArrayMakeReserve(siHeapNodeI64, keys.len, si_allocatorHeap());
+
+	i64 key;
+	for_eachArr (key, keys) {
+		si_heapPushI64(&heap, key, 0);
+	}
+
+	siHeapNodeI64 node;
+	while (si_heapPopI64(&heap, &node)) {}
+
+	si_dynamicArrayFree(heap);
+}
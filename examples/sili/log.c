@@ -0,0 +1,95 @@
+#define SI_IMPLEMENTATION 1
+#include <sili.h>
+
+
+#define THREAD_COUNT 4
+#define RECORD_COUNT 100000
+
+/* Logs 'RECORD_COUNT' records from the thread. */
+SIDEF SI_THREAD_PROC(thread_log);
+
+/* Logs from 'THREAD_COUNT' threads into the file and prints how long it took. */
+void example_log(siString path, siLogFormat format);
+
+
+int main(void) {
+	si_printLn("Text log:");
+	example_log(SI_STR("examples/log.txt"), siLogFormat_Text);
+
+	si_printLn("Binary log:");
+	example_log(SI_STR("examples/log.bin"), siLogFormat_Binary);
+
+	/* NOTE(EimaMei): The binary log only becomes readable after decoding it,
+	 * which can be done anywhere else and at any time (see 'log_decode.c'). */
+	{
+		siFile file = si_fileOpen(SI_STR("examples/log.bin"));
+		siArray(u8) data = si_fileReadContentsArr(file, si_allocatorHeap());
+		siFile decoded = si_fileCreate(SI_STR("examples/log_decoded.txt"));
+
+		siTime start = si_clock();
+		bool res = si_logDecode(data, &decoded, si_allocatorHeap());
+		siTime end = si_clock();
+
+		si_fileSizeUpdate(&decoded);
+		si_printfLn(
+			"\tDecoding returned '%t' and took %.2f ms, the decoded file is %zi bytes long.",
+			res, (f64)(end - start) / (f64)SI_MILLISECOND, si_fileSize(decoded)
+		);
+
+		si_arrayFree(data, si_allocatorHeap());
+		si_fileClose(&decoded);
+		si_fileClose(&file);
+	}
+
+	si_pathRemove(SI_STR("examples/log.txt"));
+	si_pathRemove(SI_STR("examples/log.bin"));
+	si_pathRemove(SI_STR("examples/log_decoded.txt"));
+}
+
+void example_log(siString path, siLogFormat format) {
+	siFile file = si_fileCreate(path);
+
+	siLogger logger = si_loggerMake(&file, siLogLevel_Debug, si_allocatorHeap());
+	logger.policy = siLogPolicy_Block;
+	logger.format = format;
+	si_loggerStart(&logger);
+
+	si_logTrace(&logger, "This record is below the logger's level and gets ignored.");
+	si_logInfo(&logger, "Starting %i threads, each logging %i records.", THREAD_COUNT, RECORD_COUNT);
+
+	siThread threads[THREAD_COUNT];
+	siTime start = si_clock();
+	for_range (i, 0, THREAD_COUNT) {
+		si_threadMakeAndRun(thread_log, &logger, &threads[i]);
+	}
+	for_range (i, 0, THREAD_COUNT) {
+		si_threadJoin(&threads[i]);
+		si_threadDestroy(&threads[i]);
+	}
+	siTime logging = si_clock() - start;
+
+	si_logWarn(&logger, "Done.");
+	si_loggerFlush(&logger);
+	siTime total = si_clock() - start;
+
+	si_printfLn(
+		"\tLogging took %.2f ms, writing everything out took %.2f ms, %zi records were dropped.",
+		(f64)logging / (f64)SI_MILLISECOND, (f64)total / (f64)SI_MILLISECOND, logger.dropped
+	);
+
+	si_loggerDestroy(&logger);
+	si_fileSizeUpdate(&file);
+	si_printfLn("\tThe log file is %zi bytes long.", si_fileSize(file));
+
+	si_fileClose(&file);
+}
+
+SI_THREAD_PROC(thread_log) {
+	siLogger* logger = (siLogger*)data;
+
+	for_range (i, 0, RECORD_COUNT) {
+		si_logDebug(logger, "Record %i: %f (%s)", i, (f64)i * 0.5, SI_STR("sili"));
+	}
+
+	return nil;
+}
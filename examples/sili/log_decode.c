@@ -0,0 +1,39 @@
+#define SI_IMPLEMENTATION 1
+#include <sili.h>
+
+
+/* Renders a binary log written by a 'siLogFormat_Binary' logger into text. The
+ * text gets printed to stdout unless an output file is specified. */
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		si_printLn("Usage: log_decode <binary log> [output file]");
+		return 0;
+	}
+
+	siFile file = si_fileOpen(SI_CSTR(argv[1]));
+	if (file.error.code != 0) {
+		si_printfLn("Failed to open '%S'.", argv[1]);
+		return 1;
+	}
+	siArray(u8) data = si_fileReadContentsArr(file, si_allocatorHeap());
+	si_fileClose(&file);
+
+	siFile out;
+	siFile* output = si_stdout;
+	if (argc >= 3) {
+		out = si_fileCreate(SI_CSTR(argv[2]));
+		output = &out;
+	}
+
+	bool res = si_logDecode(data, output, si_allocatorHeap());
+	if (!res) {
+		si_fprintfLn(si_stderr, SI_STR("'%S' isn't a valid binary log."), argv[1]);
+	}
+
+	if (output != si_stdout) {
+		si_fileClose(output);
+	}
+	si_arrayFree(data, si_allocatorHeap());
+
+	return !res;
+}
@@ -73,11 +73,11 @@ void example2(void) {
 
 
 	/* Fill out both matrix A and B with random data. */
-	srand((u32)(si_clock() / SI_MILLISECOND));
+	siRandom rng = si_randomMakeSystem(siRandomType_Xoshiro256);
 	for_range (i, 0, SIZE) {
 		for_range (j, 0, SIZE) {
-			A[i * SIZE + j] = (f32)(rand() % 10);
-			B[i * SIZE + j] = (f32)(rand() % 10);
+			A[i * SIZE + j] = (f32)si_randomBounded(&rng, 10);
+			B[i * SIZE + j] = (f32)si_randomBounded(&rng, 10);
 		}
 	}
 
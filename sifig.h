@@ -130,7 +130,14 @@ siIniFile sifig_iniMakeStr(siString content, siAllocator alloc) {
 
 SIDEF
 siIniFile sifig_iniMakeEx(siString content, siIniOptions options, siAllocator alloc) {
+	/* NOTE(EimaMei): Section and key names come from the file, so the maps are
+	 * keyed to stop crafted files from degrading lookups. Every section reuses
+	 * the file's key to avoid asking the OS for new entropy each time. */
+#ifndef SI_NO_HASHING
+	siIniFile ini = si_mapMakeReserveKeyed(siIniSection, 16, alloc);
+#else
 	siIniFile ini = si_mapMakeReserve(siIniSection, 16, alloc);
+#endif
 	siIniSection* curIni = nil;
 
 	siString curSection = SI_STR_EMPTY;
@@ -139,7 +146,11 @@ siIniFile sifig_iniMakeEx(siString content, siIniOptions options, siAllocator al
 	while (sifig_iniIterateEx(&it, options.comment)) {
 		if (curSection.data != it.section.data) { /* NOTE(EimaMei): This always equals true on first runs. */
 			curIni = si_mapSetItem(&ini, si_stringCopy(it.section, alloc), SI_STRUCT_ZERO, siIniSection);
+#ifndef SI_NO_HASHING
+			*curIni = si_mapReserveKeyedEx(si_sizeof(siString), 32, ini.key, alloc);
+#else
 			*curIni = si_mapMakeReserve(siString, 32, alloc);
+#endif
 
 			curSection = it.section;
 		}
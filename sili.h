@@ -26,10 +26,13 @@ sili.h - v0.3.0 - a general-purpose programming library to replace the C/C++ sta
 		- #define SI_NO_BIT
 		- #define SI_NO_PRINT
 		- #define SI_NO_MATH
+		- #define SI_NO_RANDOM
 		- #define SI_NO_SYSTEM
 		- #define SI_NO_VIRTUAL_MEMORY
 		- #define SI_NO_IO
 		- #define SI_NO_THREAD
+		- #define SI_NO_LOG
+		- #define SI_NO_AIO
 		- #define SI_NO_CPU
 		- #define SI_NO_DLL
 		- #define SI_NO_BENCHMARK
@@ -533,18 +536,31 @@ extern "C" {
 
 	#ifndef SI_NO_SYSTEM
 		#include <errno.h>
+		#if SI_SYSTEM_IS_APPLE
+			#include <sys/random.h>
+		#endif
 	#endif
 
 	#ifndef SI_NO_IO
 		#include <fcntl.h>
 		#include <sys/stat.h>
+		#include <sys/uio.h>
 		#include <dirent.h>
+		#if SI_SYSTEM_LINUX
+			#include <sys/syscall.h>
+		#endif
 	#endif
 
 	#ifndef SI_NO_THREAD
 		#include <pthread.h>
 	#endif
 
+	#if !defined(SI_NO_AIO) && defined(SI_SYSTEM_LINUX)
+		#include <sys/mman.h>
+		#include <sys/syscall.h>
+		#include <linux/io_uring.h>
+	#endif
+
 	#ifndef SI_NO_PRINT
 		#include <stdarg.h>
 	#endif
@@ -586,6 +602,7 @@ extern "C" {
 
 #elif SI_SYSTEM_IS_UNIX
 	#include <sys/sendfile.h>
+	#include <sys/ioctl.h>
 
 #elif SI_SYSTEM_EMSCRIPTEN
 	#include <emscripten/emscripten.h>
@@ -598,6 +615,15 @@ extern "C" {
 	#include <wasi/api.h>
 #endif
 
+/* NOTE(EimaMei): Defining 'SI_NO_SIMD' forces every vectorized code path to use
+ * its scalar equivalent. */
+#if SI_ARCH_IS_X86 && !defined(SI_NO_SIMD)
+	#if defined(__SSE2__) || defined(SI_ARCH_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#include <emmintrin.h>
+		#define SI_SIMD_SSE2 1
+	#endif
+#endif
+
 
 #if defined(SI_RELEASE_MODE) || defined(NDEBUG)
 	#undef SI_NO_ASSERTIONS
@@ -759,6 +785,25 @@ SI_STATIC_ASSERT(false == 0);
 	#endif
 #endif
 
+#ifndef siThreadLocal
+	#if SI_LANGUAGE_IS_CPP
+		/* Specifies that every thread gets its own copy of the variable. */
+		#define siThreadLocal thread_local
+
+	#elif SI_STANDARD_CHECK_MIN(C, C11)
+		/* Specifies that every thread gets its own copy of the variable. */
+		#define siThreadLocal _Thread_local
+
+	#elif SI_COMPILER_MSVC
+		/* Specifies that every thread gets its own copy of the variable. */
+		#define siThreadLocal __declspec(thread)
+
+	#else
+		/* Specifies that every thread gets its own copy of the variable. */
+		#define siThreadLocal __thread
+	#endif
+#endif
+
 #ifndef siNoreturn
 	#if SI_STANDARD_CHECK_MIN(C, C23) || SI_LANGUAGE_IS_CPP
 		/* Specifies that the function will not return anything. */
@@ -1028,6 +1073,20 @@ SI_STATIC_ASSERT(countof_str("abcd") == 4);
 	#define SI_UNLIKELY(x) (x)
 #endif
 
+#if SI_COMPILER_GCC || SI_COMPILER_CLANG
+	/* ptr - const void*
+	 * Hints the CPU to start loading the memory into the cache before it's used. */
+	#define SI_PREFETCH(ptr) __builtin_prefetch(ptr)
+#elif SI_COMPILER_MSVC && (defined(_M_IX86) || defined(_M_X64))
+	/* ptr - const void*
+	 * Hints the CPU to start loading the memory into the cache before it's used. */
+	#define SI_PREFETCH(ptr) _mm_prefetch((const char*)(ptr), _MM_HINT_T0)
+#else
+	/* ptr - const void*
+	 * Hints the CPU to start loading the memory into the cache before it's used. */
+	#define SI_PREFETCH(ptr) SI_UNUSED(ptr)
+#endif
+
 #ifndef SI_DEBUG_TRAP
 	#ifdef SI_COMPILER_MSVC
 	 	#if SI_COMPILER_VERSION < SI_VERSION(7, 0, 0)
@@ -1334,7 +1393,7 @@ SIDEF bool si_pointerBetween(const void* ptr, const void* start, const void* end
 SIDEF isize si_memcopy(void* restrict dst, const void* restrict src, isize size);
 /* Copies the given amount of bytes from the provided source into the specified
  * destination. The memory blocks can overlap each other. */
-SIDEF isize si_memmove(void* restrict dst, const void* restrict src, isize size);
+SIDEF isize si_memmove(void* dst, const void* src, isize size);
 /* Sets the given amount of bytes from the provided data source to the specified
  * value. */
 SIDEF isize si_memset(void* data, u8 value, isize size);
@@ -1356,7 +1415,7 @@ SIDEF isize si_memmoveRight(void* src, isize size, isize moveBy);
 /* Same functionality as 'memcpy' where the destination is returned. */
 SIDEF void* si_memcopy_ptr(void* restrict dst, const void* restrict src, isize size);
 /* Same functionality as 'memmove' where the destination is returned. */
-SIDEF void* si_memmove_ptr(void* restrict dst, const void* restrict src, isize size);
+SIDEF void* si_memmove_ptr(void* dst, const void* src, isize size);
 /* Same functionality as 'memset' where the destination is returned. */
 SIDEF void* si_memset_ptr(void* data, u8 value, isize size);
 
@@ -1599,6 +1658,9 @@ SIDEF SI_ALLOCATOR_PROC(si_allocatorArena_proc);
 
 /* Creates an arena allocator. */
 SIDEF siArena si_arenaMake(siAllocator alloc, isize capacity);
+/* Creates an arena allocator, where every allocation is aligned to 'alignment'.
+ * Using 'SI_FILE_DIRECT_ALIGNMENT' makes the allocations usable as buffers for
+ * 'siFileMode_Direct' files. */
 SIDEF siArena si_arenaMakeEx(siAllocator alloc, isize capacity, i32 alignment);
 SIDEF siArena si_arenaMakePtr(void* ptr, isize capacity, i32 alignment);
 
@@ -1998,7 +2060,9 @@ SIDEF bool si_arrayAtFront(siArrayAny array, void* out);
 SIDEF bool si_arrayAtBack(siArrayAny array, void* out);
 
 /* Searches for the specified pointer's content in the array (from the beginning).
- * If found, the value's array index is returned, otherwise '-1' is returned. */
+ * If found, the value's array index is returned, otherwise '-1' is returned.
+ * NOTE: Elements that are 1, 2, 4, 8 or 16 bytes large get compared directly
+ * (16 bytes at a time if SIMD is available) for all of the 'si_arrayFind' functions. */
 SIDEF isize si_arrayFind(siArrayAny array, const void* data);
 /* Searches for the specified pointer's content in the array (from the end). If
  * found, the value's array index is returned, otherwise '-1' is returned. */
@@ -2052,6 +2116,9 @@ typedef struct siDynamicArrayAny {
 	siAllocator alloc;
 	isize capacity;
 	isize grow;
+	/* Caller-provided storage (usually on the stack) that 'data' points to until
+	 * the array outgrows it and spills onto the allocator. Nil if unused. */
+	void* buffer;
 
 	#if SI_LANGUAGE_IS_CPP
 	/* Sets/gets a specific element in the array with array and bound checking. */
@@ -2087,6 +2154,12 @@ typedef struct siDynamicArrayAny {
  * Allocates an empty, non-zeroed array with a specified length and capacity. */
 #define si_dynamicArrayMakeReserveNonZeroed(type, capacity, alloc) \
 	si_dynamicArrayReserveNonZeroed(si_sizeof(type), capacity, alloc)
+/* type - TYPE | count - CONSTANT isize | alloc - siAllocator
+ * Creates an empty dynamic array that stores its first 'count' elements on the
+ * stack and only allocates from 'alloc' once it needs more space. The array must
+ * not outlive the scope it was made in. */
+#define si_dynamicArrayMakeSmall(type, count, alloc) \
+	si_dynamicArrayMakeBuffer(SI_ARR_STACK_EX(type, count), si_sizeof(type), alloc)
 
 /* Allocates 'count * typeSize' amount of bytes to make an array and copies the
  * same amount of bytes from the specified list to it, whilst setting the length
@@ -2101,8 +2174,13 @@ SIDEF siDynamicArrayAny si_dynamicArrayReserveNonZeroed(isize typeSize, isize ca
 		siAllocator alloc);
 /* Creates a new dynamic array from a regular array. */
 SIDEF siDynamicArrayAny si_dynamicArrayCopy(siArrayAny array, siAllocator alloc);
+/* Creates an empty dynamic array that uses the specified buffer as its storage.
+ * The allocator only gets used once the array outgrows the buffer, at which point
+ * the contents are copied over and the buffer is no longer touched. */
+SIDEF siDynamicArrayAny si_dynamicArrayMakeBuffer(siArrayAny buffer, isize typeSize,
+		siAllocator alloc);
 
-/* Frees the allocated array. */
+/* Frees the allocated array. Does nothing if the array still uses its buffer. */
 SIDEF void si_dynamicArrayFree(siDynamicArrayAny array);
 
 
@@ -2232,6 +2310,194 @@ SIDEF bool si_dynamicArrayMakeSpaceFor(siDynamicArrayAny* array, isize addLen);
 #define si_dynamicArrayReplaceItem(array, valueOld, valueNew, amount, type) si_dynamicArrayReplace(array, SI_PTR(type, valueOld), SI_PTR(type, valueNew), amount)
 
 
+#if 1
+/*
+	========================
+	| siDeque              |
+	========================
+*/
+
+typedef struct siDequeAny {
+	isize len;
+	void* data;
+	isize typeSize;
+
+	siAllocator alloc;
+	/* NOTE: Always zero or a power of two. */
+	isize capacity;
+	/* Index of the first element inside 'data'. */
+	isize head;
+} siDequeAny;
+
+/* type - TYPE
+ * Represents a double-ended queue with a specific type. */
+#define siDeque(type) siDequeAny
+
+
+/* name - NAME | deque - siDequeAny
+ * Loops through the elements of the deque from front to back, writes the element
+ * to 'name'. */
+#define for_eachDeque(name, deque) for_eachDequeEx(name, si__i, deque)
+#define for_eachDequeEx(name, indexName, deque) \
+	for (isize indexName = 0; si__forEachDeque(indexName, deque, &(name)); indexName += 1)
+
+/* name - NAME | deque - siDequeAny
+ * Loops through the elements of the deque from front to back, writes the element
+ * pointer to 'name'. */
+#define for_eachRefDeque(name, deque) for_eachRefDequeEx(name, si__i, deque)
+#define for_eachRefDequeEx(name, indexName, deque) \
+	for (isize indexName = 0; si__forEachRefDeque(indexName, deque, &(name)); indexName += 1)
+
+
+/* type - TYPE | capacity - isize | alloc - siAllocator
+ * Allocates an empty deque that can hold at least 'capacity' elements. */
+#define si_dequeMakeReserve(type, capacity, alloc) \
+	si_dequeReserve(si_sizeof(type), capacity, alloc)
+
+/* Allocates an empty deque that can hold at least 'capacity' elements. The
+ * capacity gets rounded up to the next power of two. */
+SIDEF siDequeAny si_dequeReserve(isize typeSize, isize capacity, siAllocator alloc);
+/* Frees the allocated deque. */
+SIDEF void si_dequeFree(siDequeAny deque);
+
+/* Returns a pointer to the specified element, where '0' is the front. */
+SIDEF void* si_dequeGet(siDequeAny deque, isize index);
+/* Returns a pointer to the first element or nil if the deque is empty. */
+SIDEF void* si_dequeFront(siDequeAny deque);
+/* Returns a pointer to the last element or nil if the deque is empty. */
+SIDEF void* si_dequeBack(siDequeAny deque);
+
+/* Appends the specified pointer's value to the back of the deque and returns
+ * the element's pointer. */
+SIDEF void* si_dequePushBack(siDequeAny* deque, const void* data);
+/* Prepends the specified pointer's value to the front of the deque and returns
+ * the element's pointer. */
+SIDEF void* si_dequePushFront(siDequeAny* deque, const void* data);
+/* Removes the last element and copies it into 'out' (if it isn't nil). Returns
+ * false if the deque was empty. */
+SIDEF bool si_dequePopBack(siDequeAny* deque, void* out);
+/* Removes the first element and copies it into 'out' (if it isn't nil). Returns
+ * false if the deque was empty. */
+SIDEF bool si_dequePopFront(siDequeAny* deque, void* out);
+/* Sets the deque's length to zero. */
+SIDEF void si_dequeClear(siDequeAny* deque);
+
+/* If needed, reallocates the deque for the added space. Returns true if the
+ * deque was reallocated. Unlike 'si_dynamicArrayMakeSpaceFor', the length isn't
+ * changed. Used internally. */
+SIDEF bool si_dequeMakeSpaceFor(siDequeAny* deque, isize addLen);
+
+
+/* deque - siDequeAny* | value - ANYTHING | type - TYPE
+ * Appends the given value to the back of the deque and returns the element's pointer. */
+#define si_dequePushBackItem(deque, value, type) (type*)si_dequePushBack(deque, SI_PTR(type, value))
+/* deque - siDequeAny* | value - ANYTHING | type - TYPE
+ * Prepends the given value to the front of the deque and returns the element's pointer. */
+#define si_dequePushFrontItem(deque, value, type) (type*)si_dequePushFront(deque, SI_PTR(type, value))
+
+#endif
+
+#if 1
+/*
+	========================
+	| siHeap               |
+	========================
+*/
+
+#ifndef SI_HEAP_ARITY
+	/* The amount of children each heap node has. A 4-ary tree is half as deep
+	 * as a binary one and keeps all of the siblings next to each other in memory. */
+	#define SI_HEAP_ARITY 4
+#endif
+
+/* lhs, rhs - const void* | userData - void*
+ * Returns true if 'lhs' must be closer to the top of the heap than 'rhs'. */
+#define SI_HEAP_COMPARE_PROC(name) bool name(const void* lhs, const void* rhs, void* userData)
+typedef SI_HEAP_COMPARE_PROC(siHeapCompareProc);
+
+typedef struct siHeapAny {
+	/* The elements, stored as an implicit SI_HEAP_ARITY-ary tree. */
+	siDynamicArrayAny array;
+	/* Array slot to handle mapping. */
+	siDynamicArray(isize) slots;
+	/* Handle to array slot mapping. Erased handles form a free list. */
+	siDynamicArray(isize) positions;
+	isize freeHandle;
+
+	siHeapCompareProc* compare;
+	void* userData;
+	/* Temporary storage for one element, used while sifting. */
+	void* scratch;
+} siHeapAny;
+
+/* type - TYPE
+ * Represents a priority queue with a specific type. */
+#define siHeap(type) siHeapAny
+
+/* An element of the specialized key + value min-heaps. */
+typedef struct siHeapNodeI64 { i64 key; u64 value; } siHeapNodeI64;
+typedef struct siHeapNodeU64 { u64 key; u64 value; } siHeapNodeU64;
+typedef struct siHeapNodeF64 { f64 key; u64 value; } siHeapNodeF64;
+
+
+/* type - TYPE | capacity - isize | compare - siHeapCompareProc* | userData - void* | alloc - siAllocator
+ * Allocates an empty heap with the specified type and capacity. */
+#define si_heapMakeReserve(type, capacity, compare, userData, alloc) \
+	si_heapReserve(si_sizeof(type), capacity, compare, userData, alloc)
+
+/* Allocates an empty heap that can hold 'capacity' elements before reallocating. */
+SIDEF siHeapAny si_heapReserve(isize typeSize, isize capacity, siHeapCompareProc* compare,
+		void* userData, siAllocator alloc);
+/* Creates a heap out of the specified list in O(n) time. The handle of every
+ * element is equal to its index in the list. */
+SIDEF siHeapAny si_heapMakeEx(const void* list, isize typeSize, isize count,
+		siHeapCompareProc* compare, void* userData, siAllocator alloc);
+/* Frees the allocated heap. */
+SIDEF void si_heapFree(siHeapAny heap);
+
+/* Returns a pointer to the top element or nil if the heap is empty. */
+SIDEF void* si_heapTop(siHeapAny heap);
+/* Returns a pointer to the element of the specified handle. */
+SIDEF void* si_heapGet(siHeapAny heap, isize handle);
+
+/* Pushes the specified pointer's value into the heap and returns its handle.
+ * The handle stays valid until the element gets popped or erased. */
+SIDEF isize si_heapPush(siHeapAny* heap, const void* data);
+/* Removes the top element and copies it into 'out' (if it isn't nil). Returns
+ * false if the heap was empty. */
+SIDEF bool si_heapPop(siHeapAny* heap, void* out);
+/* Replaces the element of the specified handle and restores the heap order. Used
+ * for decrease-key (or increase-key) operations. */
+SIDEF void si_heapUpdate(siHeapAny* heap, isize handle, const void* data);
+/* Removes the element of the specified handle from the heap. */
+SIDEF void si_heapErase(siHeapAny* heap, isize handle);
+/* Removes every element from the heap. */
+SIDEF void si_heapClear(siHeapAny* heap);
+
+/* Pushes the key and its value into a key + value min-heap. */
+SIDEF void si_heapPushI64(siDynamicArray(siHeapNodeI64)* heap, i64 key, u64 value);
+SIDEF void si_heapPushU64(siDynamicArray(siHeapNodeU64)* heap, u64 key, u64 value);
+SIDEF void si_heapPushF64(siDynamicArray(siHeapNodeF64)* heap, f64 key, u64 value);
+/* Removes the node with the smallest key and copies it into 'out' (if it isn't
+ * nil). Returns false if the heap was empty. The top node is always at index 0. */
+SIDEF bool si_heapPopI64(siDynamicArray(siHeapNodeI64)* heap, siHeapNodeI64* out);
+SIDEF bool si_heapPopU64(siDynamicArray(siHeapNodeU64)* heap, siHeapNodeU64* out);
+SIDEF bool si_heapPopF64(siDynamicArray(siHeapNodeF64)* heap, siHeapNodeF64* out);
+/* Reorders an arbitrary array of nodes into a valid min-heap in O(n) time. */
+SIDEF void si_heapifyI64(siDynamicArray(siHeapNodeI64) heap);
+SIDEF void si_heapifyU64(siDynamicArray(siHeapNodeU64) heap);
+SIDEF void si_heapifyF64(siDynamicArray(siHeapNodeF64) heap);
+
+
+/* heap - siHeapAny* | value - ANYTHING | type - TYPE
+ * Pushes the given value into the heap and returns its handle. */
+#define si_heapPushItem(heap, value, type) si_heapPush(heap, SI_PTR(type, value))
+/* heap - siHeapAny* | handle - isize | value - ANYTHING | type - TYPE
+ * Replaces the element of the specified handle with the given value. */
+#define si_heapUpdateItem(heap, handle, value, type) si_heapUpdate(heap, handle, SI_PTR(type, value))
+
+#endif
+
 
 #endif /* SI_NO_ARRAY */
 
@@ -2515,6 +2781,12 @@ SIDEF siAllocationError si_builderWriteUInt(siBuilder* b, u64 num);
 SIDEF siAllocationError si_builderWriteUIntEx(siBuilder* b, u64 num, i32 base);
 /* Converts a float into a string and writes it to the builder. */
 SIDEF siAllocationError si_builderWriteFloat(siBuilder* b, f64 num);
+/* Converts a float into its shortest round-trip string and writes it to the
+ * builder. */
+SIDEF siAllocationError si_builderWriteFloatShortest(siBuilder* b, f64 num);
+/* Converts a 32-bit float into its shortest round-trip string and writes it to
+ * the builder. */
+SIDEF siAllocationError si_builderWriteFloat32Shortest(siBuilder* b, f32 num);
 /* Converts a specified-base and afterPoint float into a string and writes it
  * to the builder. */
 SIDEF siAllocationError si_builderWriteFloatEx(siBuilder* b, f64 num, i32 base,
@@ -2526,6 +2798,8 @@ SIDEF void si_builderClear(siBuilder* b);
 SIDEF void si_builderPopByte(siBuilder* b);
 /* Decrements the length by the last character's length in UTF-8, if possible. */
 SIDEF void si_builderPopRune(siBuilder* b);
+/* Frees the builder's data and sets its length and capacity to zero. */
+SIDEF void si_builderFree(siBuilder* b);
 
 /* Checks if the current builder's capacity can hold the added length. If not,
  * the builder will reallocate the current data buffer, in which case the capacity
@@ -2571,6 +2845,14 @@ SIDEF i64 si_stringToIntEx(siString str, isize* outInvalidIndex);
  * if not then '-1'. The prefix list: 0x (16), 0z (12), 0d (10), 0o (8), 0b (2). */
 SIDEF i64 si_stringToIntBase(siString str, i32 base, isize* outInvalidIndex);
 
+/* Converts a string into a 64-bit float. Accepts decimal and scientific
+ * notation ("-1.5e-3"), as well as "inf", "infinity" and "nan". The result is
+ * always the closest float to the written out number. */
+SIDEF f64 si_stringToFloat(siString str);
+/* Converts a string into a 64-bit float. If an invalid character is found, its
+ * index gets written into the specified pointer; if not then '-1'. */
+SIDEF f64 si_stringToFloatEx(siString str, isize* outInvalidIndex);
+
 /* Returns either 'true', 'false' or UINT32_MAX from a string. 'UINT32_MAX'
  * is returned if the given str cannot be converted into a boolean. */
 SIDEF b32 si_stringToBool(siString str);
@@ -2588,8 +2870,16 @@ SIDEF siString si_stringFromUIntEx(u64 num, i32 base, siArray(u8) out);
 
 /* Allocates a string from a float with 6 digits after the decimal point in base 10. */
 SIDEF siString si_stringFromFloat(f64 num, siArray(u8) out);
-/* Allocates a string from a float with the given amount of digits after the
- * decimal point in the specified base. */
+/* Makes a string from the float with the least amount of digits that still
+ * convert back into the exact same float. Numbers from 1e-6 to 1e21 are written
+ * out fully (e.g. "3.14", "100"), the rest in scientific notation ("1e+21"). */
+SIDEF siString si_stringFromFloatShortest(f64 num, siArray(u8) out);
+/* Makes a string from the 32-bit float with the least amount of digits that
+ * still convert back into the exact same 32-bit float. */
+SIDEF siString si_stringFromFloat32Shortest(f32 num, siArray(u8) out);
+/* Makes a string from a float with the given amount of digits after the decimal
+ * point in the specified base. In base 10 the digits are exact and the last one
+ * is rounded half to even. */
 SIDEF siString si_stringFromFloatEx(f64 num, i32 base, i32 afterPoint, siArray(u8) out);
 
 /* Returns a 'true'/'false' string from a boolean. */
@@ -3084,11 +3374,163 @@ SIDEF u32 si_murmur32(const void* data, isize len);
 /* Creates a 32-bit MurmurHash3 hash with a custom seed. */
 SIDEF u32 si_murmur32Ex(const void* data, isize len, u32 seed);
 
-/* Creates a 64-bit MurmurHash3 hash. */
+/* Creates a 64-bit MurmurHash2 (64A on 64-bit targets, 64B on 32-bit ones) hash. */
 SIDEF u64 si_murmur64(const void* data, isize len);
-/* Creates a 64-bit MurmurHash3 hash with a custom seed. */
+/* Creates a 64-bit MurmurHash2 hash with a custom seed. */
 SIDEF u64 si_murmur64Ex(const void* data, isize len, u64 seed);
 
+
+/* A 128-bit hash value. */
+typedef struct siHash128 { u64 low, high; } siHash128;
+
+/* Creates a 64-bit wyhash hash. Processes 48 bytes per iteration, making it
+ * much faster than FNV and MurmurHash3 on anything but the shortest inputs. */
+SIDEF u64 si_wyhash64(const void* data, isize len);
+/* Creates a 64-bit wyhash hash with a custom seed. */
+SIDEF u64 si_wyhash64Ex(const void* data, isize len, u64 seed);
+
+/* Creates a 128-bit hash from the same pass as 'si_wyhash64'. The lower half
+ * is equal to the 64-bit hash. */
+SIDEF siHash128 si_wyhash128(const void* data, isize len);
+/* Creates a 128-bit hash with a custom seed from the same pass as 'si_wyhash64Ex'. */
+SIDEF siHash128 si_wyhash128Ex(const void* data, isize len, u64 seed);
+
+/* Creates a 64-bit wyhash hash for every string and writes them to 'out'. Keys
+ * are hashed in groups of four with each step done for the whole group at once,
+ * letting the final multiplications of different keys overlap. */
+SIDEF void si_wyhash64Batch(siArray(siString) keys, u64* out);
+/* Creates a 64-bit wyhash hash with a custom seed for every string. */
+SIDEF void si_wyhash64BatchEx(siArray(siString) keys, u64 seed, u64* out);
+
+/* Creates a 64-bit SipHash-1-3 hash with a secret 128-bit key. Slower than
+ * wyhash, but the output cannot be predicted without knowing the key, making it
+ * suitable for hash tables that store untrusted keys. */
+SIDEF u64 si_siphash13(const void* data, isize len, siHash128 key);
+/* Creates a 64-bit SipHash-2-4 hash with a secret 128-bit key. */
+SIDEF u64 si_siphash24(const void* data, isize len, siHash128 key);
+
+
+/*
+	========================
+	| Streaming            |
+	========================
+*/
+
+/* Each hash has an 'Init' function that creates the state, an 'Update' function
+ * that hashes the next chunk of the input and a 'Final' function that returns
+ * the hash. Splitting the input into chunks of any size produces the same hash
+ * as the one-shot functions. */
+
+typedef struct siFnv32State {
+	u32 hash;
+	/* Set to true for the FNV-a variant. */
+	bool alternate;
+} siFnv32State;
+
+typedef struct siFnv64State {
+	u64 hash;
+	/* Set to true for the FNV-a variant. */
+	bool alternate;
+} siFnv64State;
+
+typedef struct siMurmur32State {
+	u32 hash;
+	isize len;
+	u8 buffer[4];
+	isize bufferLen;
+} siMurmur32State;
+
+typedef struct siMurmur64State {
+#if SI_ARCH_IS_64BIT
+	u64 hash;
+#else
+	u32 hash[2];
+#endif
+	/* The total length specified in 'si_murmur64Init'. */
+	isize len;
+	/* The amount of bytes hashed so far. */
+	isize processed;
+	u8 buffer[8];
+	isize bufferLen;
+} siMurmur64State;
+
+typedef struct siWyhashState {
+	u64 seed, see1, see2;
+	isize len;
+	/* The last 16 bytes of the previous block, followed by the unprocessed data. */
+	u8 buffer[16 + 48];
+	isize bufferLen;
+} siWyhashState;
+
+
+/* Starts a 32-bit FNV hash. */
+SIDEF siFnv32State si_fnv32Init(void);
+/* Starts a 32-bit FNV-a hash. */
+SIDEF siFnv32State si_fnv32aInit(void);
+/* Hashes the next chunk of the input. */
+SIDEF void si_fnv32Update(siFnv32State* state, const void* data, isize len);
+/* Returns the final 32-bit FNV/FNV-a hash. */
+SIDEF u32 si_fnv32Final(siFnv32State state);
+
+/* Starts a 64-bit FNV hash. */
+SIDEF siFnv64State si_fnv64Init(void);
+/* Starts a 64-bit FNV-a hash. */
+SIDEF siFnv64State si_fnv64aInit(void);
+/* Hashes the next chunk of the input. */
+SIDEF void si_fnv64Update(siFnv64State* state, const void* data, isize len);
+/* Returns the final 64-bit FNV/FNV-a hash. */
+SIDEF u64 si_fnv64Final(siFnv64State state);
+
+/* Starts a 32-bit MurmurHash3 hash. */
+SIDEF siMurmur32State si_murmur32Init(void);
+/* Starts a 32-bit MurmurHash3 hash with a custom seed. */
+SIDEF siMurmur32State si_murmur32InitEx(u32 seed);
+/* Hashes the next chunk of the input. */
+SIDEF void si_murmur32Update(siMurmur32State* state, const void* data, isize len);
+/* Returns the final 32-bit MurmurHash3 hash. */
+SIDEF u32 si_murmur32Final(siMurmur32State state);
+
+/* Starts a 64-bit MurmurHash2 hash.
+ * NOTE: The algorithm mixes the length into the hash before anything else, so
+ * the total length of the input must be known beforehand. */
+SIDEF siMurmur64State si_murmur64Init(isize len);
+/* Starts a 64-bit MurmurHash2 hash with a custom seed. */
+SIDEF siMurmur64State si_murmur64InitEx(isize len, u64 seed);
+/* Hashes the next chunk of the input. */
+SIDEF void si_murmur64Update(siMurmur64State* state, const void* data, isize len);
+/* Returns the final 64-bit MurmurHash2 hash. */
+SIDEF u64 si_murmur64Final(siMurmur64State state);
+
+/* Starts a wyhash hash. */
+SIDEF siWyhashState si_wyhashInit(void);
+/* Starts a wyhash hash with a custom seed. */
+SIDEF siWyhashState si_wyhashInitEx(u64 seed);
+/* Hashes the next chunk of the input. */
+SIDEF void si_wyhashUpdate(siWyhashState* state, const void* data, isize len);
+/* Returns the final 64-bit wyhash hash. */
+SIDEF u64 si_wyhash64Final(siWyhashState state);
+/* Returns the final 128-bit hash, same as 'si_wyhash128'. */
+SIDEF siHash128 si_wyhash128Final(siWyhashState state);
+
+
+/*
+	========================
+	| Checksums            |
+	========================
+*/
+
+/* Creates a CRC-32C (Castagnoli) checksum. Uses the SSE4.2 or ARMv8 CRC
+ * instructions when available, otherwise a slice-by-8 table. */
+SIDEF u32 si_crc32c(const void* data, isize len);
+/* Continues a CRC-32C checksum from a previous result ('0' for the first block),
+ * making it possible to checksum data in chunks. */
+SIDEF u32 si_crc32cEx(const void* data, isize len, u32 crc);
+
+/* Creates an Adler-32 checksum. */
+SIDEF u32 si_adler32(const void* data, isize len);
+/* Continues an Adler-32 checksum from a previous result ('1' for the first block). */
+SIDEF u32 si_adler32Ex(const void* data, isize len, u32 adler);
+
 #endif /* SI_NO_HASHING */
 
 #ifndef SI_NO_MAP
@@ -3112,6 +3554,19 @@ SIDEF u64 si_murmur64Ex(const void* data, isize len, u64 seed);
 	========================
 */
 
+#ifndef SI_MAP_HASH
+	/* data - const void* | len - isize
+	 * The hash function used for map keys, only the lower 31 bits get used. Can
+	 * be redefined before including the header (e.g. to 'si_fnv32a'). Without the
+	 * hashing module it falls back to an internal FNV-1a. */
+	#ifndef SI_NO_HASHING
+		#define SI_MAP_HASH(data, len) si_wyhash64(data, len)
+		#define SI__MAP_HASH_IS_WYHASH 1
+	#else
+		#define SI_MAP_HASH(data, len) si__mapFnv32a(data, len)
+	#endif
+#endif
+
 typedef struct siMapEntry {
 	siString key;
 	u32 hash;
@@ -3126,6 +3581,12 @@ typedef struct siMapAny {
 	siMapEntry* entries;
 	void* values;
 	u32* hashes;
+#ifndef SI_NO_HASHING
+	/* The secret SipHash key of the map, only used if 'keyed' is true. */
+	siHash128 key;
+	/* Keyed maps hash their keys with 'si_siphash13' instead of 'SI_MAP_HASH'. */
+	b32 keyed;
+#endif
 } siMapAny;
 
 /* type - TYPE
@@ -3160,6 +3621,23 @@ typedef struct siMapAny {
 /* Reserves a map with the specified type size and capacity. */
 SIDEF siMapAny si_mapReserve(isize typeSize, isize capacity, siAllocator alloc);
 
+#ifndef SI_NO_HASHING
+/* type - TYPE | capacity - isize | alloc - siAllocator
+ * Reserves a keyed map with the specified type and capacity. */
+#define si_mapMakeReserveKeyed(type, capacity, alloc) si_mapReserveKeyed(si_sizeof(type), capacity, alloc)
+/* Reserves a map that hashes its keys with SipHash-1-3 under a random key from
+ * 'si_systemRandomBytes'. Lookups are slower than with 'si_mapReserve', but an
+ * attacker can't craft keys that collide, so it should be used for maps that
+ * store untrusted keys (e.g. parsed from files or network requests). */
+SIDEF siMapAny si_mapReserveKeyed(isize typeSize, isize capacity, siAllocator alloc);
+/* Reserves a keyed map with a specific SipHash key. */
+SIDEF siMapAny si_mapReserveKeyedEx(isize typeSize, isize capacity, siHash128 key,
+		siAllocator alloc);
+#endif
+
+/* Returns the 31-bit hash of the key that the map uses for its buckets. */
+SIDEF u32 si_mapHash(siMapAny map, siString name);
+
 
 /* Returns the pointer of an existing key's value, other 'nil' is returned. */
 SIDEF void* si_mapGet(siMapAny map, siString name);
@@ -3171,6 +3649,17 @@ SIDEF void* si_mapSet(siMapAny* map, siString name, const void* value);
 SIDEF void* si_mapSetHash(siMapAny* map, siString name, const void* value,
 		u32 hash);
 
+/* Hashes every key the same way the map does and writes the results to 'out'. */
+SIDEF void si_mapHashBatch(siMapAny map, siArray(siString) names, u32* out);
+/* Gets the value pointers of every key and writes them to 'out' ('nil' if the
+ * key doesn't exist). Keys are hashed in batches and their buckets get prefetched
+ * ahead of the lookups. */
+SIDEF void si_mapGetBatch(siMapAny map, siArray(siString) names, void** out);
+/* Sets every key to its value from 'values', which contains 'names.len' values
+ * of the map's type. Keys are hashed in batches and their buckets get prefetched
+ * ahead of the insertions. */
+SIDEF void si_mapSetBatch(siMapAny* map, siArray(siString) names, const void* values);
+
 /* Removes the specified key from the map. */
 SIDEF void si_mapErase(siMapAny* map, siString name);
 SIDEF void si_mapEraseHash(siMapAny* map, siString name, u32 hash);
@@ -3318,6 +3807,116 @@ SIDEF isize si_numLenUintEx(u64 num, i32 base);
 #define si_checkMul(type, a, b, res) SI_CHECK_ARITHMETIC_FUNC(type, Mul, a, b, res)
 
 
+#if 1
+/*
+	========================
+	| siBitset             |
+	========================
+*/
+
+/* Number of bits stored in a single word of a bitset. */
+#define SI_BITSET_WORD_BITS 64
+/* bits - isize
+ * Returns the amount of 'u64' words needed to store the specified amount of bits. */
+#define SI_BITSET_WORDS(bits) (((bits) + SI_BITSET_WORD_BITS - 1) / SI_BITSET_WORD_BITS)
+
+typedef struct siBitset {
+	/* The bits, 64 per word starting from the least significant bit. Unused bits
+	 * of the last word are always kept unset. */
+	u64* data;
+	/* Number of bits inside the set. */
+	isize len;
+	/* Number of allocated words. */
+	isize capacity;
+	/* Allocator used for growing the set. A nil procedure marks a fixed-size set
+	 * that uses caller-provided storage. */
+	siAllocator alloc;
+} siBitset;
+
+/* Rank/select support structure of a bitset. It must be rebuilt after the
+ * contents of the set change. */
+typedef struct siBitsetRank {
+	/* The number of set bits before each 512-bit block, with the total at the end. */
+	isize* blocks;
+	/* Number of elements in 'blocks'. */
+	isize len;
+	siAllocator alloc;
+} siBitsetRank;
+
+
+/* index - NAME | set - siBitset
+ * Loops through every set bit in ascending order, writes its index to 'index'.
+ * Bits must not be set past the current index while iterating. */
+#define for_eachBit(index, set) \
+	for (isize index = si_bitsetFindFirst(set, 0); index != -1; index = si_bitsetFindFirst(set, index + 1))
+
+/* bits - CONSTANT isize
+ * Creates a fixed-size bitset on the stack. The set must not outlive the scope
+ * it was made in. */
+#define si_bitsetMakeFixed(bits) \
+	si_bitsetMakeBuffer(SI_ARR_STACK_EX(u64, SI_BITSET_WORDS(bits)), bits)
+
+
+/* Allocates a growable bitset with the specified amount of unset bits. */
+SIDEF siBitset si_bitsetMake(isize bits, siAllocator alloc);
+/* Creates a fixed-size bitset with the specified amount of unset bits that uses
+ * the given 'u64' array as its storage. */
+SIDEF siBitset si_bitsetMakeBuffer(siArray(u64) buffer, isize bits);
+/* Frees the bitset. Does nothing for fixed-size sets. */
+SIDEF void si_bitsetFree(siBitset set);
+
+/* Resizes the bitset to the specified amount of bits, new bits are unset. Returns
+ * false if the set is fixed-size and the storage is too small, or if the allocation
+ * failed. */
+SIDEF bool si_bitsetResize(siBitset* set, isize bits);
+
+/* Returns true if the bit at the specified index is set. */
+SIDEF bool si_bitsetTest(siBitset set, isize index);
+/* Sets the bit at the specified index. */
+SIDEF void si_bitsetSet(siBitset set, isize index);
+/* Unsets the bit at the specified index. */
+SIDEF void si_bitsetClear(siBitset set, isize index);
+/* Flips the bit at the specified index. */
+SIDEF void si_bitsetFlip(siBitset set, isize index);
+/* Sets or unsets the bit at the specified index. */
+SIDEF void si_bitsetSetValue(siBitset set, isize index, bool value);
+/* Sets or unsets every bit in the set. */
+SIDEF void si_bitsetFill(siBitset set, bool value);
+
+/* Performs a bitwise AND on the first set with the second one. Only the bits
+ * both sets have are affected. */
+SIDEF void si_bitsetAnd(siBitset set, siBitset other);
+/* Performs a bitwise OR on the first set with the second one. Only the bits
+ * both sets have are affected. */
+SIDEF void si_bitsetOr(siBitset set, siBitset other);
+/* Performs a bitwise XOR on the first set with the second one. Only the bits
+ * both sets have are affected. */
+SIDEF void si_bitsetXor(siBitset set, siBitset other);
+/* Inverts every bit in the set. */
+SIDEF void si_bitsetNot(siBitset set);
+
+/* Returns the number of set bits. */
+SIDEF isize si_bitsetCount(siBitset set);
+/* Returns the index of the first set bit starting from 'start', or -1 if there
+ * isn't one. */
+SIDEF isize si_bitsetFindFirst(siBitset set, isize start);
+/* Returns the index of the first unset bit starting from 'start', or -1 if there
+ * isn't one. */
+SIDEF isize si_bitsetFindFirstZero(siBitset set, isize start);
+
+/* Builds the rank/select support structure of the bitset. */
+SIDEF siBitsetRank si_bitsetRankMake(siBitset set, siAllocator alloc);
+/* Frees the rank/select support structure. */
+SIDEF void si_bitsetRankFree(siBitsetRank rank);
+/* Returns the number of set bits before the specified index. */
+SIDEF isize si_bitsetRank(siBitset set, siBitsetRank rank, isize index);
+/* Returns the index of the n-th set bit (starting from 0), or -1 if the set has
+ * fewer set bits. */
+SIDEF isize si_bitsetSelect(siBitset set, siBitsetRank rank, isize n);
+
+#endif
+
+
 #endif /* SI_NO_BIT */
 
 #ifndef SI_NO_TIME
@@ -3540,7 +4139,14 @@ SIDEF isize si_fprint(siFile* file, siString str);
 /* Writes a string with a newline to a file. Returns the amount of written bytes. */
 SIDEF isize si_fprintLn(siFile* file, siString str);
 
-/* Writes a formatted string to a file. Returns the amount of written bytes. */
+/* The size of the stack buffer used by the file printing functions. Longer output
+ * gets written out in multiple chunks of this size. */
+#ifndef SI_PRINT_CHUNK_SIZE
+	#define SI_PRINT_CHUNK_SIZE SI_KILO(1)
+#endif
+
+/* Writes a formatted string to a file. Output of any length is written out in
+ * chunks. Returns the amount of written bytes. */
 SIDEF isize si_fprintf(siFile* file, siString fmt, ...);
 SIDEF isize si_fprintfVa(siFile* file, siString fmt, va_list va);
 
@@ -3556,6 +4162,60 @@ SIDEF siString si_bprintfVa(siArray(u8) out, siString fmt, va_list va);
 /* Writes a formatted C-string to a buffer. */
 SIDEF siString si_bprintfLn(siArray(u8) out, siString fmt, ...);
 SIDEF siString si_bprintfLnVa(siArray(u8) out, siString fmt, va_list va);
+/* Writes a formatted string to a buffer and sets 'outRequiredLen' to the length
+ * of the entire output. If the output got truncated, the required length is
+ * larger than 'out.len'. */
+SIDEF siString si_bprintfEx(siArray(u8) out, isize* outRequiredLen, siString fmt, ...);
+SIDEF siString si_bprintfExVa(siArray(u8) out, isize* outRequiredLen, siString fmt,
+		va_list va);
+
+/* Writes a formatted string to the end of the builder, growing it only when the
+ * output doesn't fit. */
+SIDEF siAllocationError si_builderPrintf(siBuilder* b, siString fmt, ...);
+SIDEF siAllocationError si_builderPrintfVa(siBuilder* b, siString fmt, va_list va);
+
+
+/* Marks that the width or precision of a specifier is given as an argument ('*'). */
+#define SI_FORMAT_ARG INT32_MIN
+
+/* A single specifier of a parsed format string. */
+typedef struct siFormatSpec {
+	/* The text that gets written before the specifier. */
+	siString literal;
+	/* The conversion character (e.g. 'i' or 's'), zero if the spec only holds
+	 * text. */
+	siRune specifier;
+	/* The argument size in bytes given by 'h', 'hh', 'l', 'z' or 'j', zero if
+	 * none were given. */
+	u8 typeSize;
+	/* Either ' ' or '0'. */
+	u8 padLetter;
+	/* The ' ', '+', '-' and '#' flags in the order they were written. */
+	u8 prefixLen;
+	u8 prefix[4];
+	/* States if the precision was explicitly given. */
+	bool hasPrecision;
+	/* The minimum width of the value, negative if it's left-justified. */
+	i32 width;
+	/* The precision of the value, 6 by default. */
+	i32 precision;
+} siFormatSpec;
+
+/* A format string that was parsed ahead of time. */
+typedef siArray(siFormatSpec) siFormat;
+
+/* Parses a format string into an array of specifiers, so that printing it later
+ * doesn't have to parse it again. The specifiers point into 'fmt', meaning it
+ * must outlive the returned object. Free it with 'si_arrayFree'. */
+SIDEF siFormat si_formatMake(siString fmt, siAllocator alloc);
+
+/* Writes a preparsed formatted string to a buffer. */
+SIDEF siString si_bprintfFormat(siArray(u8) out, siFormat format, ...);
+SIDEF siString si_bprintfFormatVa(siArray(u8) out, siFormat format, va_list va);
+/* Writes a preparsed formatted string to a file. Returns the amount of written
+ * bytes. */
+SIDEF isize si_fprintfFormat(siFile* file, siFormat format, ...);
+SIDEF isize si_fprintfFormatVa(siFile* file, siFormat format, va_list va);
 
 /* Helper function to print each byte of a pointer in hexdecimal format. */
 SIDEF void si_printMemory(const void* ptr, isize amount);
@@ -3689,6 +4349,90 @@ SIDEF i32 si_float64IsInf(f64 num);
 
 #endif /* SI_NO_MATH */
 
+#ifndef SI_NO_RANDOM
+/*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+	========================
+	| siRandom             |
+	========================
+*/
+
+SI_ENUM(i32, siRandomType) {
+	/* xoshiro256**: a 256-bit state generator, the fastest option on 64-bit CPUs. */
+	siRandomType_Xoshiro256 = 0,
+	/* PCG64 (XSL-RR 128/64): a 128-bit LCG with 2^63 selectable streams. */
+	siRandomType_Pcg64,
+};
+
+/* A pseudo-random number generator. It's not thread-safe, every thread is expected
+ * to hold its own generator, which can be created with 'si_randomJump'. None
+ * of the generators are cryptographically secure. */
+typedef struct siRandom {
+	siRandomType type;
+	union {
+		/* The state of xoshiro256**. */
+		u64 xoshiro[4];
+		/* The 128-bit state and stream increment of PCG64 ([0] - low, [1] - high). */
+		struct { u64 state[2], increment[2]; } pcg;
+	} state;
+} siRandom;
+
+
+/* Creates a xoshiro256** generator with its state expanded from the seed. */
+SIDEF siRandom si_randomMake(u64 seed);
+/* Creates a PCG64 generator from the seed and the selected stream. Generators
+ * with different streams output different sequences, even with the same seed. */
+SIDEF siRandom si_randomMakePcg(u64 seed, u64 stream);
+/* Creates a generator of the specified type that's seeded with 'si_systemRandomBytes'
+ * (or the timestamp counter if it isn't available). */
+SIDEF siRandom si_randomMakeSystem(siRandomType type);
+
+/* Returns the next random 64-bit number. */
+SIDEF u64 si_randomNext(siRandom* rng);
+/* Returns the next random 32-bit number. */
+SIDEF u32 si_randomNextU32(siRandom* rng);
+
+/* Returns an unbiased random number in the '[0, bound)' range. 'bound' must be
+ * more than 0. */
+SIDEF u64 si_randomBounded(siRandom* rng, u64 bound);
+/* Returns an unbiased random number in the '[lower, upper]' range. */
+SIDEF i64 si_randomRange(siRandom* rng, i64 lower, i64 upper);
+
+/* Returns a random 64-bit float in the '[0, 1)' range. */
+SIDEF f64 si_randomF64(siRandom* rng);
+/* Returns a random 32-bit float in the '[0, 1)' range. */
+SIDEF f32 si_randomF32(siRandom* rng);
+/* Returns a random 64-bit float in the '[lower, upper)' range. */
+SIDEF f64 si_randomRangeF64(siRandom* rng, f64 lower, f64 upper);
+
+/* Fills the buffer with random bytes. Large xoshiro256** fills run several
+ * independent generators side by side, so the output isn't the same as calling
+ * 'si_randomNext' repeatedly. */
+SIDEF void si_randomFill(siRandom* rng, void* out, isize len);
+
+/* Advances the generator by 2^128 steps for xoshiro256** and 2^64 steps for
+ * PCG64. Jumping a copy of a generator once per thread creates sequences that
+ * never overlap in practice. */
+SIDEF void si_randomJump(siRandom* rng);
+/* Advances the generator by 2^192 steps for xoshiro256** and 2^96 steps for
+ * PCG64, which allows a 'si_randomJump' sized sub-stream for each long jump. */
+SIDEF void si_randomLongJump(siRandom* rng);
+
+#endif /* SI_NO_RANDOM */
+
 #ifndef SI_NO_BENCHMARK
 /*
 *
@@ -3936,6 +4680,11 @@ SIDEF isize si_envVarGetLength(siString name);
 SIDEF siString si_envVarGetData(siString name, siArray(u8) out);
 
 
+/* Fills the buffer with cryptographically secure random bytes from the operating
+ * system. Returns false if the system has no such source. */
+SIDEF bool si_systemRandomBytes(void* out, isize len);
+
+
 /* Returns the current running Windows OS version. Returns '0' if the version is
  * older than XP. */
 SIDEF siWindowsVersion si_windowsGetVersion(void);
@@ -4019,10 +4768,23 @@ SI_ENUM(u32, siFileMode) {
 	siFileMode_Write = SI_BIT(1),
 	siFileMode_Append = SI_BIT(2),
 	siFileMode_Plus = SI_BIT(3),
+	/* Reads and writes bypass the system's page cache. The buffers, offsets and
+	 * lengths must be multiples of 'SI_FILE_DIRECT_ALIGNMENT' (see 'si_arenaMakeEx'
+	 * for getting aligned buffers). */
+	siFileMode_Direct = SI_BIT(4),
+	/* Writes only return once the data has reached the storage device. */
+	siFileMode_Sync = SI_BIT(5),
 
 	siFileMode_All = siFileMode_Read | siFileMode_Write | siFileMode_Append | siFileMode_Plus
+		| siFileMode_Direct | siFileMode_Sync
 };
 
+/* The alignment that satisfies 'siFileMode_Direct' for every common sector and
+ * page size. */
+#ifndef SI_FILE_DIRECT_ALIGNMENT
+	#define SI_FILE_DIRECT_ALIGNMENT SI_KILO(4)
+#endif
+
 #ifdef SI_NO_PRINT
 typedef struct siFile {
 	siError error;
@@ -4068,10 +4830,29 @@ SI_EXTERN const u8 SI_PATH_SEPARATOR;
 SIDEF bool si_pathExists(siString path);
 SIDEF bool si_pathExistsOS(siOsString path);
 
-/* Copies the specified source path to the destination. Returns the size of the
- * file if the copy was succesful. */
+/* copied - isize | total - isize | data - rawptr
+ * Defines a valid progress callback prototype for 'si_pathCopyEx'. 'total' is the
+ * size of the source file when the copy started. */
+#define SI_PATH_COPY_PROC(name) void name(isize copied, isize total, void* data)
+/* Represents a progress callback for 'si_pathCopyEx'. */
+typedef SI_PATH_COPY_PROC(siPathCopyProc);
+
+/* The maximum amount of threads 'si_pathItemsCopy' copies files with. */
+#ifndef SI_PATH_COPY_THREAD_COUNT
+	#define SI_PATH_COPY_THREAD_COUNT 4
+#endif
+
+/* Copies the specified source path to the destination, overwriting the destination
+ * if it exists. Returns the size of the file if the copy was succesful. */
 SIDEF siResult(isize) si_pathCopy(siString pathSrc, siString pathDst);
-/* Copies every file and folder from the specified source to the given destination.
+/* Copies the specified source path to the destination, calling 'progress' (if
+ * it isn't nil) every time a part of the file gets copied. On Linux the file is
+ * first attempted to be cloned (a reflink), then copied by the kernel with
+ * 'copy_file_range' or 'sendfile' and lastly with a regular buffered loop. */
+SIDEF siResult(isize) si_pathCopyEx(siString pathSrc, siString pathDst,
+		siPathCopyProc* progress, void* data);
+/* Copies every file and folder from the specified source to the given destination,
+ * with the files being copied by up to 'SI_PATH_COPY_THREAD_COUNT' threads.
  * Returns the amount of files copied, otherwise an error if the function failed. */
 SIDEF siResult(i32) si_pathItemsCopy(siString pathSrc, siString pathDst);
 /* Moves the specified source path to the given detination. Returns an error if failed. */
@@ -4173,6 +4954,13 @@ SIDEF siArray(u8) si_fileReadAtBuf(siFile file, isize offset, isize len,
  * pointer has enough space to contain the read buffer. */
 SIDEF siResult(siArray(u8)) si_fileReadEx(siFile file, isize offset, isize len, void* out);
 
+/* Reads the file from the specified offset into multiple buffers, filling each
+ * one before moving onto the next. On Unix this is done with as few 'preadv'
+ * calls as possible. Returns the amount of bytes read, which is less than the
+ * buffers' total length only if the end of the file was reached. Otherwise an
+ * error is returned if the function failed. */
+SIDEF siResult(isize) si_fileReadVec(siFile file, isize offset, siArray(siArray(u8)) buffers);
+
 /* Allocates 'file.size' bytes, reads said amount (if possible) from the file's
  * beginning and writes it to the buffer before returning it. _File seek offset
  * does not get changed when calling the function._ */
@@ -4187,6 +4975,23 @@ SIDEF siArray(u8) si_fileReadContentsArrBuf(siFile file, siArray(u8) out);
  * _File seek offset does not get changed when calling the function._ */
 SIDEF siArray(siString) si_fileReadlines(siFile file, siAllocator alloc);
 
+/* name - NAME
+ * Defines a procedure that receives every chunk read by 'si_fileReadChunks'. */
+#define SI_FILE_CHUNK_PROC(name) void name(siArray(u8) chunk, void* userData)
+typedef SI_FILE_CHUNK_PROC(siFileChunkProc);
+
+/* Reads the file from the specified offset until the end in chunks the size of
+ * the buffer and calls the procedure for each one, keeping memory usage constant
+ * regardless of the file's size. Returns the amount of bytes read, otherwise an
+ * error if reading failed. */
+SIDEF siResult(isize) si_fileReadChunks(siFile file, isize offset, siArray(u8) buffer,
+		siFileChunkProc* proc, void* userData);
+#ifndef SI_NO_HASHING
+/* Hashes the file's entire contents with 'si_wyhash64' by reading it in chunks
+ * the size of the buffer. Returns an error if reading failed. */
+SIDEF siResult(u64) si_fileHash64(siFile file, siArray(u8) buffer);
+#endif
+
 
 /* Writes a buffer into the file at the current offset. Returns the written bytes. */
 SIDEF isize si_fileWrite(siFile* file, siArray(u8) data);
@@ -4198,6 +5003,14 @@ SIDEF isize si_fileWriteByte(siFile* file, u8 byte);
 SIDEF isize si_fileWritePtr(siFile* file, const void* ptr, isize len);
 /* Writes a string into the file. Returns the written bytes. */
 SIDEF isize si_fileWriteStr(siFile* file, siString str);
+/* Writes multiple buffers into the file at the current offset as if they were
+ * one continuous buffer. On Unix this is done with as few 'writev' calls as
+ * possible, with partial writes being resumed until everything is written.
+ * Returns the written bytes or -1 if the function failed. */
+SIDEF isize si_fileWriteVec(siFile* file, siArray(siArray(u8)) buffers);
+/* Writes multiple buffers into the file at the specified offset using 'pwritev'
+ * on Unix. Returns the written bytes or -1 if the function failed. */
+SIDEF isize si_fileWriteVecAt(siFile* file, siArray(siArray(u8)) buffers, isize offset);
 
 
 /* Returns the current offset of the file stream. */
@@ -4212,6 +5025,10 @@ SIDEF bool si_fileSeekBack(siFile file);
 
 /* Truncates the file to the specified size and returns 'true' if it succeded. */
 SIDEF bool si_fileTruncate(siFile* file, isize size);
+/* Flushes the written data of the file to the storage device and returns 'true'
+ * if it succeeded. If 'dataOnly' is set, metadata that isn't needed to read the
+ * data back (e.g. the last write time) might not get flushed. */
+SIDEF bool si_fileSync(siFile* file, bool dataOnly);
 /* Returns the last time the file was written. */
 SIDEF siTime si_fileLastWriteTime(siFile file);
 
@@ -4277,6 +5094,50 @@ SIDEF bool si_directoryIterateEx(siDirectory* dir, bool fullPath, siDirectoryIte
 SIDEF void si_directoryClose(siDirectory* dir);
 
 
+SI_ENUM(i32, siWalkAction) {
+	/* Keeps walking. If the entry is a folder, its contents get walked too. */
+	siWalkAction_Continue = 0,
+	/* Keeps walking, but doesn't enter the folder. */
+	siWalkAction_Skip,
+	/* Stops the whole walk as soon as possible. */
+	siWalkAction_Stop,
+};
+
+typedef struct siDirectoryEntry {
+	/* The full path of the entry, which is only valid during the callback. */
+	siString path;
+	/* The base name of the entry, pointing inside 'path'. */
+	siString name;
+	siIoType type;
+	/* How many folders deep the entry is, the walked folder's items being 0. */
+	i32 depth;
+} siDirectoryEntry;
+
+/* entry - const siDirectoryEntry* | data - void*
+ * A function that gets called for every item found by the directory walker. The
+ * returned action decides whether the walk continues and if folders get entered. */
+#define SI_DIRECTORY_WALK_PROC(name) siWalkAction name(const siDirectoryEntry* entry, void* data)
+/* Represents a callback for 'si_directoryWalk'. */
+typedef SI_DIRECTORY_WALK_PROC(siDirectoryWalkProc);
+
+/* Walks through every item inside the folder and its subfolders breadth-first,
+ * calling 'proc' for each one on the calling thread. Returns the amount of items
+ * visited, otherwise the first error that stopped the walk.
+ *
+ * NOTE: On Linux the folders are read with 'getdents64' in large batches, with
+ * the item's type coming from the directory entry itself instead of a 'stat'. */
+SIDEF siResult(isize) si_directoryWalk(siString path, siDirectoryWalkProc* proc, void* data);
+/* Walks through every item inside the folder and its subfolders breadth-first,
+ * with the folders of each level being spread across 'threadCount' threads (the
+ * calling thread included). Returns the amount of items visited, otherwise the
+ * first error that stopped the walk.
+ *
+ * NOTE: 'proc' gets called from multiple threads at the same time, meaning it
+ * must be thread-safe when 'threadCount' is larger than 1. */
+SIDEF siResult(isize) si_directoryWalkEx(siString path, isize threadCount,
+		siDirectoryWalkProc* proc, void* data);
+
+
 #endif /* SI_NO_IO */
 
 #ifndef SI_NO_THREAD
@@ -4353,6 +5214,305 @@ SIDEF siError si_threadDestroy(siThread* thread);
 
 #endif /* SI_NO_THREAD */
 
+#ifndef SI_NO_LOG
+/*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+	========================
+	| siLogger             |
+	========================
+*/
+
+SI_ENUM(u8, siLogLevel) {
+	siLogLevel_Trace = 0,
+	siLogLevel_Debug,
+	siLogLevel_Info,
+	siLogLevel_Warn,
+	siLogLevel_Error,
+	siLogLevel_Fatal,
+
+	siLogLevel_Len
+};
+
+SI_ENUM(u8, siLogPolicy) {
+	/* The record gets discarded and counted in 'siLogger.dropped'. */
+	siLogPolicy_Drop = 0,
+	/* The producer waits until the flusher thread frees up enough space. */
+	siLogPolicy_Block,
+};
+
+SI_ENUM(u8, siLogFormat) {
+	/* Producers format the message, which gets written into the file as text. */
+	siLogFormat_Text = 0,
+	/* Producers only copy the raw arguments, which get written into the file
+	 * along with the ID of the call site. Every call site's format is written
+	 * once. The file must be rendered into text with 'si_logDecode'. Records
+	 * logged with 'si_logf' carry a copy of their format instead, and get
+	 * dropped if it's longer than 'SI_LOG_MESSAGE_MAX'. */
+	siLogFormat_Binary,
+};
+
+/* The default byte size of every thread's ring. Must be a power of two. */
+#ifndef SI_LOG_RING_SIZE
+	#define SI_LOG_RING_SIZE SI_KILO(64)
+#endif
+
+/* The maximum length of a formatted message. Longer messages get truncated. */
+#ifndef SI_LOG_MESSAGE_MAX
+	#define SI_LOG_MESSAGE_MAX 512
+#endif
+
+/* The size of the flusher thread's output buffer, which is written into the
+ * file with a single call once it fills up or the rings become empty. */
+#ifndef SI_LOG_BATCH_SIZE
+	#define SI_LOG_BATCH_SIZE SI_KILO(64)
+#endif
+
+typedef struct si__logIdTable {
+	struct si__logIdEntry* entries;
+	isize len;
+	isize capacity;
+} si__logIdTable;
+
+typedef struct siLogger {
+	/* The file that the records get written to. */
+	siFile* file;
+	/* Records below this level are ignored. */
+	siLogLevel level;
+	/* What happens when a thread's ring is full. */
+	siLogPolicy policy;
+	/* How the records are stored in the file. */
+	siLogFormat format;
+	/* Byte size of every thread's ring. Must be a power of two. */
+	isize ringSize;
+	/* How long the flusher thread sleeps when there's nothing to write. */
+	siTime flushInterval;
+	/* The allocator used for the rings and the batch buffer. Must be thread-safe. */
+	siAllocator alloc;
+
+	/* The amount of records that were dropped because of a full ring. */
+	volatile isize dropped;
+
+	isize id;
+	volatile isize running;
+#ifndef SI_NO_THREAD
+	siThread thread;
+#endif
+	struct si__logRing* volatile rings;
+
+	u8* batch;
+	isize droppedReported;
+	siFormat prefix;
+	si__logIdTable ids;
+	u64 lastId;
+} siLogger;
+
+/* A call site of the logging macros. It gets an ID the first time it's used,
+ * which binary loggers write in place of its location and format. */
+typedef struct siLogSite {
+	volatile isize id;
+	siString filename;
+	i32 line;
+	siString format;
+} siLogSite;
+
+
+/* logger - siLogger* | fmt - string literal | ...VALUES - VARIADIC
+ * Logs a formatted message with the caller's location at a specific level. */
+#define si_logTrace(logger, .../* fmt, VALUES */) SI__LOG_SITE(logger, siLogLevel_Trace, __VA_ARGS__)
+#define si_logDebug(logger, .../* fmt, VALUES */) SI__LOG_SITE(logger, siLogLevel_Debug, __VA_ARGS__)
+#define si_logInfo(logger, .../* fmt, VALUES */)  SI__LOG_SITE(logger, siLogLevel_Info, __VA_ARGS__)
+#define si_logWarn(logger, .../* fmt, VALUES */)  SI__LOG_SITE(logger, siLogLevel_Warn, __VA_ARGS__)
+#define si_logError(logger, .../* fmt, VALUES */) SI__LOG_SITE(logger, siLogLevel_Error, __VA_ARGS__)
+#define si_logFatal(logger, .../* fmt, VALUES */) SI__LOG_SITE(logger, siLogLevel_Fatal, __VA_ARGS__)
+
+
+/* Creates a logger that writes into the specified file. Nothing gets written
+ * until 'si_loggerStart' is called. */
+SIDEF siLogger si_loggerMake(siFile* file, siLogLevel level, siAllocator alloc);
+/* Starts the flusher thread. The logger must not be moved afterwards. With
+ * 'SI_NO_THREAD' no thread is started, and the records get written by the
+ * logging thread once its ring fills up, as well as by 'si_loggerFlush' and
+ * 'si_loggerDestroy'. */
+SIDEF siError si_loggerStart(siLogger* logger);
+/* Blocks until every record that was logged before the call gets written. */
+SIDEF void si_loggerFlush(siLogger* logger);
+/* Stops the flusher thread, writes the remaining records and frees the rings. */
+SIDEF void si_loggerDestroy(siLogger* logger);
+
+/* Formats a record into the calling thread's ring, which the flusher thread
+ * later writes into the file. Returns false if the record was filtered out or
+ * dropped. */
+SIDEF bool si_logf(siLogger* logger, siLogLevel level, siCallerLoc loc, cstring fmt, ...);
+SIDEF bool si_logfVa(siLogger* logger, siLogLevel level, siCallerLoc loc, cstring fmt,
+		va_list va);
+SIDEF bool si_logfVaStr(siLogger* logger, siLogLevel level, siCallerLoc loc,
+		siString fmt, va_list va);
+/* Logs a record from a call site, whose format must equal 'fmt'. Used by the
+ * 'si_logTrace'..'si_logFatal' macros. */
+SIDEF bool si_logfSite(siLogger* logger, siLogLevel level, siLogSite* site, cstring fmt, ...);
+
+/* Returns the name of the level. */
+SIDEF siString si_logLevelStr(siLogLevel level);
+
+/* Renders the contents of a file written by a 'siLogFormat_Binary' logger into
+ * the same text that a 'siLogFormat_Text' logger would've written. Returns false
+ * if the data isn't a valid binary log. */
+SIDEF bool si_logDecode(siArray(u8) data, siFile* out, siAllocator alloc);
+
+
+/* NOTE(EimaMei): The '""' makes sure that the format is a string literal, as
+ * the site keeps pointing to it. */
+#define SI__LOG_SITE(logger, level, ...) do { \
+		static siLogSite si__logSite = { \
+			0, SI_STRC(__FILE__), __LINE__, SI_STRC("" SI__LOG_FMT(__VA_ARGS__, 0)) \
+		}; \
+		si_logfSite(logger, level, &si__logSite, __VA_ARGS__); \
+	} while (0)
+#define SI__LOG_FMT(fmt, ...) fmt
+
+#endif /* SI_NO_LOG */
+
+#ifndef SI_NO_AIO
+/*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+	========================
+	| siAio                |
+	========================
+*/
+
+SI_ENUM(u8, siAioOp) {
+	/* Reads 'buffer.len' bytes from the offset into the buffer. */
+	siAioOp_Read = 0,
+	/* Writes the buffer into the file at the offset. */
+	siAioOp_Write,
+	/* Same as 'si_fileSync(file, false)'. */
+	siAioOp_Sync,
+	/* Same as 'si_fileSync(file, true)'. */
+	siAioOp_SyncData,
+};
+
+SI_ENUM(u8, siAioBackend) {
+	/* The requests are executed with blocking calls by a pool of worker threads.
+	 * Available on every system. With 'SI_NO_THREAD' no threads are started
+	 * and the requests get executed inside 'si_aioSubmit'. */
+	siAioBackend_Threads = 0,
+	/* The requests are submitted to the kernel through an io_uring instance.
+	 * Only available on Linux 5.6 and newer. */
+	siAioBackend_IoUring,
+};
+
+/* The amount of worker threads 'si_aioMake' uses if io_uring isn't available. */
+#ifndef SI_AIO_THREAD_COUNT
+	#define SI_AIO_THREAD_COUNT 4
+#endif
+
+typedef struct siAioRequest {
+	siAioOp op;
+	/* The index of the registered buffer (see 'si_aioRegisterBuffers') that
+	 * contains 'buffer'. Set to -1 if 'buffer' isn't registered. */
+	i32 bufferIndex;
+	siFile* file;
+	isize offset;
+	/* The destination of a read or the contents of a write. Must stay valid
+	 * until the request's completion gets polled. */
+	siArray(u8) buffer;
+	/* Passed as is to the request's completion. */
+	void* userData;
+} siAioRequest;
+
+typedef struct siAioCompletion {
+	void* userData;
+	siFile* file;
+	siAioOp op;
+	/* The amount of transferred bytes or -1 if the request failed. Like with
+	 * 'pread'/'pwrite', a transfer can be shorter than requested (e.g. a read
+	 * that reaches the end of the file). */
+	isize len;
+	/* The reason the request failed. */
+	siErrorSystem error;
+} siAioCompletion;
+
+typedef struct siAio {
+	/* What executes the requests. */
+	siAioBackend backend;
+	/* The maximum amount of requests that can be in flight at once. */
+	isize capacity;
+	/* The amount of submitted requests whose completions haven't been polled yet. */
+	isize inFlight;
+	siAllocator alloc;
+
+	siAioRequest* slots;
+	/* A copy of each slot's file taken at submission, which is the only one the
+	 * workers read. */
+	siFile* files;
+	isize* freeSlots;
+	struct si__aioRing* ring;
+	struct si__aioPool* pool;
+} siAio;
+
+
+/* Creates a request that reads 'buffer.len' bytes from the offset of the file. */
+SIDEF siAioRequest si_aioRead(siFile* file, isize offset, siArray(u8) buffer, void* userData);
+/* Creates a request that writes the buffer into the file at the offset. */
+SIDEF siAioRequest si_aioWrite(siFile* file, isize offset, siArray(u8) buffer, void* userData);
+/* Creates a request that flushes the file's written data to the storage device. */
+SIDEF siAioRequest si_aioSync(siFile* file, bool dataOnly, void* userData);
+
+/* Creates an engine that can keep up to 'capacity' requests in flight. io_uring
+ * gets used if it's available, otherwise 'SI_AIO_THREAD_COUNT' worker threads
+ * are started. */
+SIDEF siError si_aioMake(isize capacity, siAllocator alloc, siAio* out);
+/* Creates an engine with the specified backend, returning an error if it isn't
+ * available. 'threadCount' is only used by 'siAioBackend_Threads', with zero
+ * meaning that the requests get executed inside 'si_aioSubmit'. */
+SIDEF siError si_aioMakeEx(isize capacity, siAioBackend backend, isize threadCount,
+		siAllocator alloc, siAio* out);
+/* Registers the buffers with the kernel, so that requests using them don't have
+ * to map the memory on every transfer. The memory of an arena can be registered
+ * as a single buffer with 'SI_ARR_LEN(arena.ptr, arena.capacity)'. Must be called
+ * when no requests are in flight. Does nothing for 'siAioBackend_Threads'. */
+SIDEF siError si_aioRegisterBuffers(siAio* aio, siArray(siArray(u8)) buffers);
+
+/* Submits the requests in a single batch. Returns the amount of submitted
+ * requests, which is less than 'requests.len' if there's not enough room for
+ * all of them to be in flight. */
+SIDEF isize si_aioSubmit(siAio* aio, siArray(siAioRequest) requests);
+/* Writes the completions of finished requests into 'out', waiting until at least
+ * 'minCount' of them are available (capped to the amount of requests in flight).
+ * Completed writes update the size of their file. Returns the amount of written
+ * completions or -1 if waiting failed. */
+SIDEF isize si_aioPoll(siAio* aio, siArray(siAioCompletion) out, isize minCount);
+/* Waits for the requests in flight to finish and frees the engine. */
+SIDEF void si_aioDestroy(siAio* aio);
+
+#endif /* SI_NO_AIO */
+
 #ifndef SI_NO_CPU
 /*
 *
@@ -4520,6 +5680,9 @@ SIDEF siString si_dllError(void);
 	#ifndef SI_NO_MATH
 		#define SI_IMPLEMENTATION_MATH 1
 	#endif
+	#ifndef SI_NO_RANDOM
+		#define SI_IMPLEMENTATION_RANDOM 1
+	#endif
 	#ifndef SI_NO_BENCHMARK
 		#define SI_IMPLEMENTATION_BENCHMARK 1
 	#endif
@@ -4536,6 +5699,12 @@ SIDEF siString si_dllError(void);
 	#ifndef SI_NO_THREAD
 		#define SI_IMPLEMENTATION_THREAD 1
 	#endif
+	#ifndef SI_NO_LOG
+		#define SI_IMPLEMENTATION_LOG 1
+	#endif
+	#ifndef SI_NO_AIO
+		#define SI_IMPLEMENTATION_AIO 1
+	#endif
 	#ifndef SI_NO_BIT
 		#define SI_IMPLEMENTATION_BIT 1
 	#endif
@@ -4554,10 +5723,81 @@ SIDEF siString si_dllError(void);
  * old languages more usable and pretty... Do not enjoy. */
 #if 1
 
-#ifndef SI_NO_ARRAY
-
-#if SI_LANGUAGE_IS_C
-	#define SI__ARR_IMPL(type, ...) SI_ARR_LEN(((type[]){__VA_ARGS__}), countof((type[]){__VA_ARGS__}))
+/* Multiplies two 64-bit numbers, returns the lower half of the 128-bit result
+ * and writes the upper half to 'high'. */
+force_inline
+u64 si__mul128(u64 a, u64 b, u64* high) {
+#if defined(__SIZEOF_INT128__)
+	__extension__ typedef unsigned __int128 u128;
+	u128 res = (u128)a * b;
+	*high = (u64)(res >> 64);
+	return (u64)res;
+#elif SI_COMPILER_MSVC && SI_ARCH_AMD64
+	return _umul128(a, b, high);
+#else
+	u64 aHigh = a >> 32, aLow = (u32)a,
+		bHigh = b >> 32, bLow = (u32)b;
+	u64 hh = aHigh * bHigh, hl = aHigh * bLow,
+		lh = aLow * bHigh, ll = aLow * bLow;
+
+	u64 t = ll + (hl << 32);
+	u64 low = t + (lh << 32);
+	u64 carry = (u64)(t < ll) + (u64)(low < t);
+	*high = hh + (hl >> 32) + (lh >> 32) + carry;
+	return low;
+#endif
+}
+
+/* Returns the amount of leading zero bits in a non-zero 64-bit number. */
+force_inline
+i32 si__clz64(u64 x) {
+#if SI_COMPILER_GCC || SI_COMPILER_CLANG
+	return __builtin_clzll(x);
+#else
+	i32 count = 0;
+	while ((x & SI_BIT(63)) == 0) { x <<= 1; count += 1; }
+	return count;
+#endif
+}
+
+siIntern const u64 SI__NUM_POW10[20] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+	10000000000, 100000000000, 1000000000000, 10000000000000, 100000000000000,
+	1000000000000000, 10000000000000000, 100000000000000000,
+	1000000000000000000, 10000000000000000000U
+};
+
+/* Returns the amount of digits needed to write the number in the given base. */
+force_inline
+isize si__numLen(u64 num, u32 base) {
+	/* NOTE(EimaMei): 'num | 1' never crosses a power of the base, but makes
+	 * zero a single digit number. */
+	i32 bits = 64 - si__clz64(num | 1);
+
+	if (base == 10) {
+		/* NOTE(EimaMei): 1233 / 4096 is log10(2), which gives the digit count
+		 * either exactly or one too many. */
+		i32 guess = (bits * 1233) >> 12;
+		return guess + 1 - (isize)((num | 1) < SI__NUM_POW10[guess]);
+	}
+	else if ((base & (base - 1)) == 0) {
+		i32 shift = 63 - si__clz64(base);
+		return (bits + shift - 1) / shift;
+	}
+
+	isize count = 0;
+	do {
+		count += 1;
+		num /= base;
+	} while (num != 0);
+
+	return count;
+}
+
+#ifndef SI_NO_ARRAY
+
+#if SI_LANGUAGE_IS_C
+	#define SI__ARR_IMPL(type, ...) SI_ARR_LEN(((type[]){__VA_ARGS__}), countof((type[]){__VA_ARGS__}))
 	#define SI__ARR_ALLOC_IMPL(type, alloc, ...) si__arrayMake(si_sizeof(type), (type[]){__VA_ARGS__}, countof((type[]){__VA_ARGS__}), alloc)
 	#define SI__DYNARR_ALLOC_IMPL(type, alloc, ...) si_dynamicArrayMakeEx((type[]){__VA_ARGS__}, si_sizeof(type), countof((type[]){__VA_ARGS__}), alloc)
 
@@ -4651,6 +5891,26 @@ bool si__forEachRevRefBuf(isize i, siArrayAny array, void* value) {
 	return false;
 }
 
+force_inline
+bool si__forEachDeque(isize i, siDequeAny deque, void* value) {
+	if (i < deque.len) {
+		si_memcopy(value, si_dequeGet(deque, i), deque.typeSize);
+		return true;
+	}
+
+	return false;
+}
+
+force_inline
+bool si__forEachRefDeque(isize i, siDequeAny deque, void* value) {
+	if (i < deque.len) {
+		*(void**)value = si_dequeGet(deque, i);
+		return true;
+	}
+
+	return false;
+}
+
 force_inline
 siArrayAny si__arrayMake(isize typeSizeof, void* ptr, isize len, siAllocator alloc) {
 	void* dst = si_allocNonZeroed(alloc, typeSizeof * len);
@@ -4956,7 +6216,7 @@ isize si_memcopy(void* restrict dst, const void* restrict src, isize size) {
 }
 
 SIDEF
-isize si_memmove(void* restrict dst, const void* restrict src, isize size) {
+isize si_memmove(void* dst, const void* src, isize size) {
 	SI_ASSERT_NOT_NIL(dst);
 	SI_ASSERT_NOT_NIL(src);
 	SI_ASSERT_NOT_NEG(size);
@@ -5071,7 +6331,7 @@ isize si_memmoveRight(void* src, isize length, isize moveBy) {
 }
 
 inline void* si_memcopy_ptr(void* restrict dst, const void* restrict src, isize size) { si_memcopy(dst, src, size); return dst; }
-inline void* si_memmove_ptr(void* restrict dst, const void* restrict src, isize size) { si_memmove(dst, src, size); return dst; }
+inline void* si_memmove_ptr(void* dst, const void* src, isize size) { si_memmove(dst, src, size); return dst; }
 inline void* si_memset_ptr(void* data, u8 value, isize size)  { si_memset(data, value, size); return data; }
 
 
@@ -5266,6 +6526,12 @@ siArena si_arenaMakeEx(siAllocator alloc, isize capacity, i32 alignment) {
 	out.alloc = alloc;
 	out.alignment = alignment;
 	out.capacity = capacity;
+
+	/* NOTE(EimaMei): Extra room is reserved for aligning the first allocation,
+	 * so that the entire requested capacity stays usable. */
+	if (alignment > SI_DEFAULT_MEMORY_ALIGNMENT) {
+		out.capacity += alignment - SI_DEFAULT_MEMORY_ALIGNMENT;
+	}
 	out.ptr = si_allocArrayNonZeroed(out.alloc, u8, out.capacity);
 
 	return out;
@@ -5303,12 +6569,18 @@ void si_arenaFree(siArena* arena) {
 
 siIntern
 void* si__arenaAlloc(siArena* arena, isize size, siAllocationError* outError) {
+	/* NOTE(EimaMei): The address itself gets aligned, as the base pointer might
+	 * not be aligned to 'arena->alignment' (e.g. when it's larger than the
+	 * alignment of the backing allocator). */
+	usize address = (usize)&arena->ptr[arena->offset];
+	isize padding = (isize)(si_alignForwardU(address, arena->alignment) - address);
+
 	isize bytes = si_alignForward(size, arena->alignment);
-	isize newOffset = arena->offset + bytes;
+	isize newOffset = arena->offset + padding + bytes;
 
 	if (newOffset > arena->capacity) { *outError = siAllocationError_OutOfMem; return nil; }
 
-	void* out = &arena->ptr[arena->offset];
+	void* out = &arena->ptr[arena->offset + padding];
 	arena->offset = newOffset;
 	*outError = 0;
 	return out;
@@ -5948,12 +7220,144 @@ bool si_arrayAtBack(siArrayAny array, void* out) {
 	return true;
 }
 
+#if 1
+
+#define SI__ARRAY_FIND_DEC(type) \
+	siIntern \
+	isize si__arrayFind_##type(const type* data, isize start, isize end, type value) { \
+		for_range (i, start, end) { \
+			if (data[i] == value) { return i; } \
+		} \
+		return -1; \
+	} \
+	siIntern \
+	isize si__arrayFindLast_##type(const type* data, isize end, type value) { \
+		isize i; \
+		for (i = end - 1; i >= 0; i -= 1) { \
+			if (data[i] == value) { return i; } \
+		} \
+		return -1; \
+	} \
+	siIntern \
+	isize si__arrayFindCount_##type(const type* data, isize start, isize end, type value) { \
+		isize occurences = 0; \
+		for_range (i, start, end) { \
+			occurences += (data[i] == value); \
+		} \
+		return occurences; \
+	}
+
+SI__ARRAY_FIND_DEC(u8)
+SI__ARRAY_FIND_DEC(u16)
+SI__ARRAY_FIND_DEC(u32)
+SI__ARRAY_FIND_DEC(u64)
+
+#undef SI__ARRAY_FIND_DEC
+
+#if SI_SIMD_SSE2
+
+force_inline
+i32 si__arrayMaskFirst(u32 mask) {
+#if SI_COMPILER_GCC || SI_COMPILER_CLANG
+	return __builtin_ctz(mask);
+#else
+	i32 i = 0;
+	while ((mask & 1) == 0) { mask >>= 1; i += 1; }
+	return i;
+#endif
+}
+
+force_inline
+i32 si__arrayMaskLast(u32 mask) {
+#if SI_COMPILER_GCC || SI_COMPILER_CLANG
+	return 31 - __builtin_clz(mask);
+#else
+	i32 i = -1;
+	while (mask) { mask >>= 1; i += 1; }
+	return i;
+#endif
+}
+
+force_inline
+isize si__arrayMaskCount(u32 mask) {
+#if SI_COMPILER_GCC || SI_COMPILER_CLANG
+	return __builtin_popcount(mask);
+#else
+	isize count = 0;
+	while (mask) { mask &= mask - 1; count += 1; }
+	return count;
+#endif
+}
+
+/* Returns true if the type size can be searched 16 bytes at a time. */
+force_inline
+bool si__arraySimdSupported(isize typeSize) {
+	return typeSize == 1 || typeSize == 2 || typeSize == 4 || typeSize == 8 || typeSize == 16;
+}
+
+/* Fills a 16-byte vector with as many copies of the value as possible. */
+force_inline
+__m128i si__arraySimdSplat(const void* data, isize typeSize) {
+	u8 buf[16];
+	for (isize i = 0; i < si_sizeof(buf); i += typeSize) {
+		si_memcopy(&buf[i], data, typeSize);
+	}
+
+	return _mm_loadu_si128((const __m128i*)(const void*)buf);
+}
+
+/* Compares 16 bytes of the array against the splatted value and returns a mask
+ * where only the lowest byte's bit of every fully equal element is set. */
+force_inline
+u32 si__arraySimdMatch(const u8* ptr, __m128i value, isize typeSize) {
+	__m128i chunk = _mm_loadu_si128((const __m128i*)(const void*)ptr);
+	u32 mask = (u32)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, value));
+
+	switch (typeSize) {
+		case 2:  mask &= mask >> 1; mask &= 0x5555; break;
+		case 4:  mask &= mask >> 1; mask &= mask >> 2; mask &= 0x1111; break;
+		case 8:  mask &= mask >> 1; mask &= mask >> 2; mask &= mask >> 4; mask &= 0x0101; break;
+		case 16: mask = (mask == 0xFFFF); break;
+	}
+
+	return mask;
+}
+
+#endif
+
+#endif
+
 SIDEF
 isize si_arrayFind(siArrayAny array, const void* data) {
-	for_range (i, 0, array.len) {
-		void* dst = si_arrayGet(array, i);
-		if (si_memcompare(dst, data, array.typeSize) == 0) {
-			return i;
+	SI_ASSERT_NOT_NIL(data);
+
+	const u8* base = (const u8*)array.data;
+	isize i = 0;
+
+#if SI_SIMD_SSE2
+	if (si__arraySimdSupported(array.typeSize)) {
+		__m128i value = si__arraySimdSplat(data, array.typeSize);
+		isize step = 16 / array.typeSize;
+
+		for (; i + step <= array.len; i += step) {
+			u32 mask = si__arraySimdMatch(&base[i * array.typeSize], value, array.typeSize);
+			if (mask != 0) {
+				return i + si__arrayMaskFirst(mask) / array.typeSize;
+			}
+		}
+	}
+#endif
+
+	switch (array.typeSize) {
+		case 1: return si__arrayFind_u8(base, i, array.len, *(const u8*)data);
+		case 2: return si__arrayFind_u16((const u16*)array.data, i, array.len, *(const u16*)data);
+		case 4: return si__arrayFind_u32((const u32*)array.data, i, array.len, *(const u32*)data);
+		case 8: return si__arrayFind_u64((const u64*)array.data, i, array.len, *(const u64*)data);
+	}
+
+	for_range (j, i, array.len) {
+		if (si_memcompare(&base[j * array.typeSize], data, array.typeSize) == 0) {
+			return j;
 		}
 	}
 
@@ -5962,10 +7366,36 @@ isize si_arrayFind(siArrayAny array, const void* data) {
 
 SIDEF
 isize si_arrayFindLast(siArrayAny array, const void* data) {
+	SI_ASSERT_NOT_NIL(data);
+
+	const u8* base = (const u8*)array.data;
+	isize end = array.len;
+
+#if SI_SIMD_SSE2
+	if (si__arraySimdSupported(array.typeSize)) {
+		__m128i value = si__arraySimdSplat(data, array.typeSize);
+		isize step = 16 / array.typeSize;
+
+		for (; end - step >= 0; end -= step) {
+			isize start = end - step;
+			u32 mask = si__arraySimdMatch(&base[start * array.typeSize], value, array.typeSize);
+			if (mask != 0) {
+				return start + si__arrayMaskLast(mask) / array.typeSize;
+			}
+		}
+	}
+#endif
+
+	switch (array.typeSize) {
+		case 1: return si__arrayFindLast_u8(base, end, *(const u8*)data);
+		case 2: return si__arrayFindLast_u16((const u16*)array.data, end, *(const u16*)data);
+		case 4: return si__arrayFindLast_u32((const u32*)array.data, end, *(const u32*)data);
+		case 8: return si__arrayFindLast_u64((const u64*)array.data, end, *(const u64*)data);
+	}
+
 	isize i;
-	for (i = array.len - 1; i >= 0; i -= 1) {
-		void* dst = si_arrayGet(array, i);
-		if (si_memcompare(dst, data, array.typeSize) == 0) {
+	for (i = end - 1; i >= 0; i -= 1) {
+		if (si_memcompare(&base[i * array.typeSize], data, array.typeSize) == 0) {
 			return i;
 		}
 	}
@@ -5975,16 +7405,38 @@ isize si_arrayFindLast(siArrayAny array, const void* data) {
 
 SIDEF
 isize si_arrayFindCount(siArrayAny array, const void* data) {
+	SI_ASSERT_NOT_NIL(data);
+
+	const u8* base = (const u8*)array.data;
 	isize occurences = 0;
-	for_range (i, 0, array.len) {
-		void* element = si_arrayGet(array, i);
-		if (si_memcompare(element, data, array.typeSize) == 0) {
+	isize i = 0;
+
+#if SI_SIMD_SSE2
+	if (si__arraySimdSupported(array.typeSize)) {
+		__m128i value = si__arraySimdSplat(data, array.typeSize);
+		isize step = 16 / array.typeSize;
+
+		for (; i + step <= array.len; i += step) {
+			u32 mask = si__arraySimdMatch(&base[i * array.typeSize], value, array.typeSize);
+			occurences += si__arrayMaskCount(mask);
+		}
+	}
+#endif
+
+	switch (array.typeSize) {
+		case 1: return occurences + si__arrayFindCount_u8(base, i, array.len, *(const u8*)data);
+		case 2: return occurences + si__arrayFindCount_u16((const u16*)array.data, i, array.len, *(const u16*)data);
+		case 4: return occurences + si__arrayFindCount_u32((const u32*)array.data, i, array.len, *(const u32*)data);
+		case 8: return occurences + si__arrayFindCount_u64((const u64*)array.data, i, array.len, *(const u64*)data);
+	}
+
+	for_range (j, i, array.len) {
+		if (si_memcompare(&base[j * array.typeSize], data, array.typeSize) == 0) {
 			occurences += 1;
 		}
 	}
 
 	return occurences;
-
 }
 
 SIDEF
@@ -6027,6 +7479,7 @@ siDynamicArrayAny si_dynamicArrayReserveNonZeroed(isize typeSize, isize capacity
 	array.len = 0;
 	array.capacity = capacity;
 	array.grow = 0;
+	array.buffer = nil;
 
 	return array;
 }
@@ -6049,6 +7502,7 @@ siDynamicArrayAny si_dynamicArrayReserve(isize typeSize, isize capacity, siAlloc
 	array.len = 0;
 	array.capacity = capacity;
 	array.grow = 0;
+	array.buffer = nil;
 
 	return array;
 }
@@ -6058,8 +7512,27 @@ siDynamicArrayAny si_dynamicArrayCopy(siArrayAny array, siAllocator alloc) {
 	return si_dynamicArrayMakeEx(array.data, array.typeSize, array.len, alloc);
 }
 
+SIDEF
+siDynamicArrayAny si_dynamicArrayMakeBuffer(siArrayAny buffer, isize typeSize,
+		siAllocator alloc) {
+	SI_ASSERT_ARR(buffer);
+	SI_ASSERT(typeSize > 0);
+
+	siDynamicArrayAny array;
+	array.alloc = alloc;
+	array.data = buffer.data;
+	array.typeSize = typeSize;
+	array.len = 0;
+	array.capacity = (buffer.len * buffer.typeSize) / typeSize;
+	array.grow = 0;
+	array.buffer = buffer.data;
+
+	return array;
+}
+
 inline
 void si_dynamicArrayFree(siDynamicArrayAny array) {
+	SI_STOPIF(array.data == array.buffer, return);
 	si_free(array.alloc, array.data);
 }
 
@@ -6249,88 +7722,613 @@ bool si_dynamicArrayMakeSpaceFor(siDynamicArrayAny* array, isize addLen) {
 	isize newCapacity = (array->grow <= 0)
 		? SI_DYNAMIC_ARRAY_NEW_CAP(array, addLen)
 		: array->capacity + addLen + array->grow;
-	array->data = si_realloc(
-		array->alloc, array->data,
-		array->capacity * array->typeSize, newCapacity * array->typeSize
-	);
+
+	if (array->data != array->buffer || array->buffer == nil) {
+		array->data = si_realloc(
+			array->alloc, array->data,
+			array->capacity * array->typeSize, newCapacity * array->typeSize
+		);
+	}
+	else {
+		/* NOTE(EimaMei): The buffer isn't owned by the allocator, so the contents
+		 * get spilled into a fresh allocation instead. */
+		void* data = si_allocNonZeroed(array->alloc, newCapacity * array->typeSize);
+		si_memcopy(data, array->buffer, array->len * array->typeSize);
+		array->data = data;
+	}
 	array->len = newLength;
 	array->capacity = newCapacity;
 
 	return true;
 }
 
+
+SIDEF
+siDequeAny si_dequeReserve(isize typeSize, isize capacity, siAllocator alloc) {
+	SI_ASSERT_NOT_NEG(typeSize);
+	SI_ASSERT_NOT_NEG(capacity);
+
+	siDequeAny deque;
+	deque.alloc = alloc;
+	deque.typeSize = typeSize;
+	deque.len = 0;
+	deque.head = 0;
+	deque.capacity = si_nextPow2(capacity);
+	deque.data = nil;
+
+	if (deque.capacity != 0) {
+		deque.data = si_allocNonZeroed(alloc, typeSize * deque.capacity);
+		if (deque.data == nil) { deque.capacity = 0; }
+	}
+
+	return deque;
+}
+
 inline
-isize si_memcopy_s(siArrayAny dst, const void* src, isize sizeSrc) {
-	isize length = si_min(isize, dst.len, sizeSrc);
-	return si_memcopy(dst.data, src, length);
+void si_dequeFree(siDequeAny deque) {
+	si_free(deque.alloc, deque.data);
 }
 
 inline
-isize si_memmove_s(siArrayAny dst, const void* src, isize sizeSrc) {
-	isize length = si_min(isize, dst.len, sizeSrc);
-	return si_memmove(dst.data, src, length);
+void* si_dequeGet(siDequeAny deque, isize index) {
+	SI_ASSERT_NOT_NEG(index);
+	SI_ASSERT_MSG(index < deque.len, "Index is out of bounds.");
+
+	isize i = (deque.head + index) & (deque.capacity - 1);
+	return si_pointerAdd(deque.data, i * deque.typeSize);
 }
 
+inline
+void* si_dequeFront(siDequeAny deque) {
+	SI_STOPIF(deque.len == 0, return nil);
+	return si_dequeGet(deque, 0);
+}
 
-#endif /* SI_IMPLEMENTATION_ARRAY */
+inline
+void* si_dequeBack(siDequeAny deque) {
+	SI_STOPIF(deque.len == 0, return nil);
+	return si_dequeGet(deque, deque.len - 1);
+}
 
-#ifdef SI_IMPLEMENTATION_STRING
 
-#if SI_LANGUAGE_IS_CPP
-u8 siString::operator[](isize index) {
-	SI_ASSERT(index < len);
-	SI_ASSERT_NOT_NEG(index);
-	return this->data[index];
+SIDEF
+void* si_dequePushBack(siDequeAny* deque, const void* data) {
+	SI_ASSERT_NOT_NIL(deque);
+	SI_ASSERT_NOT_NIL(data);
+
+	si_dequeMakeSpaceFor(deque, 1);
+	deque->len += 1;
+
+	return si_memcopy_ptr(si_dequeGet(*deque, deque->len - 1), data, deque->typeSize);
 }
-siString siString::operator()(isize offset1, isize offset2) {
-	return si_substr(*this, offset1, offset2);
+
+SIDEF
+void* si_dequePushFront(siDequeAny* deque, const void* data) {
+	SI_ASSERT_NOT_NIL(deque);
+	SI_ASSERT_NOT_NIL(data);
+
+	si_dequeMakeSpaceFor(deque, 1);
+	deque->head = (deque->head - 1) & (deque->capacity - 1);
+	deque->len += 1;
+
+	return si_memcopy_ptr(si_dequeGet(*deque, 0), data, deque->typeSize);
 }
-siString siString::from(isize offset1) {
-	return si_substrFrom(*this, offset1);
+
+SIDEF
+bool si_dequePopBack(siDequeAny* deque, void* out) {
+	SI_ASSERT_NOT_NIL(deque);
+	SI_STOPIF(deque->len == 0, return false);
+
+	if (out != nil) {
+		si_memcopy(out, si_dequeGet(*deque, deque->len - 1), deque->typeSize);
+	}
+	deque->len -= 1;
+
+	return true;
 }
-siString siString::to(isize offset2) {
-	return si_substrTo(*this, offset2);
+
+SIDEF
+bool si_dequePopFront(siDequeAny* deque, void* out) {
+	SI_ASSERT_NOT_NIL(deque);
+	SI_STOPIF(deque->len == 0, return false);
+
+	if (out != nil) {
+		si_memcopy(out, si_dequeGet(*deque, 0), deque->typeSize);
+	}
+	deque->head = (deque->head + 1) & (deque->capacity - 1);
+	deque->len -= 1;
+
+	return true;
 }
-siString siString::substrLen(isize offset1, isize length) {
-	return si_substrLen(*this, offset1, length);
+
+inline
+void si_dequeClear(siDequeAny* deque) {
+	SI_ASSERT_NOT_NIL(deque);
+	deque->len = 0;
+	deque->head = 0;
 }
-#endif
 
 SIDEF
-siUtf32Char si__stringLastRune(siString str) {
-	SI_ASSERT_MSG(str.len > 0, "This function doesn't check for if the length is zero. Fix your function.");
+bool si_dequeMakeSpaceFor(siDequeAny* deque, isize addLen) {
+	SI_ASSERT_NOT_NIL(deque);
+	SI_ASSERT_NOT_NIL(deque->alloc.proc);
+	SI_ASSERT_NOT_NEG(addLen);
+
+	isize newLength = deque->len + addLen;
+	SI_STOPIF(newLength <= deque->capacity, return false);
+
+	isize oldCapacity = deque->capacity;
+	isize newCapacity = si_nextPow2(si_max(isize, newLength, 2 * oldCapacity));
+	u8* data = (u8*)si_realloc(
+		deque->alloc, deque->data,
+		oldCapacity * deque->typeSize, newCapacity * deque->typeSize
+	);
+	SI_ASSERT_NOT_NIL(data);
 
-	u8 lastChar = str.data[str.len - 1];
-	if (lastChar < 0x80) {
-		return SI_COMP_LIT(siUtf32Char, lastChar, 1);
+	/* NOTE(EimaMei): If the elements wrapped around the old buffer, the wrapped
+	 * part gets moved right after the old end. The new capacity is at least
+	 * double the old one, so there's always enough space for it. */
+	isize wrapped = deque->head + deque->len - oldCapacity;
+	if (wrapped > 0) {
+		si_memcopy(
+			&data[oldCapacity * deque->typeSize], data,
+			wrapped * deque->typeSize
+		);
 	}
 
-	isize end = si_max(isize, str.len - 4, 0);
-	isize i;
-	for (i = str.len - 1; i >= end; i -= 1) {
-		if ((str.data[i] & 0xC0) != 0x80) {
-			break;
-		}
-	}
+	deque->data = data;
+	deque->capacity = newCapacity;
 
-	i = si_max(isize, i, 0);
-	return si_utf8Decode(&str.data[i]);
+	return true;
+}
+
+
+force_inline
+void* si__heapElem(const siHeapAny* heap, isize slot) {
+	return si_pointerAdd(heap->array.data, slot * heap->array.typeSize);
+}
+
+/* Moves the element and its handle from slot 'src' to slot 'dst'. */
+force_inline
+void si__heapMove(siHeapAny* heap, isize dst, isize src) {
+	isize* slots = (isize*)heap->slots.data;
+	isize* positions = (isize*)heap->positions.data;
+
+	si_memcopy(si__heapElem(heap, dst), si__heapElem(heap, src), heap->array.typeSize);
+	slots[dst] = slots[src];
+	positions[slots[dst]] = dst;
 }
 
 siIntern
-siString si__stringTrimCr(siString str) {
-	isize i = str.len;
-	if (i > 0 && str.data[i - 1] == '\r') {
-		str.len -= 1;
+isize si__heapSiftUp(siHeapAny* heap, isize slot) {
+	isize* slots = (isize*)heap->slots.data;
+	isize* positions = (isize*)heap->positions.data;
+	isize handle = slots[slot];
+	si_memcopy(heap->scratch, si__heapElem(heap, slot), heap->array.typeSize);
+
+	while (slot > 0) {
+		isize parent = (slot - 1) / SI_HEAP_ARITY;
+		SI_STOPIF(!heap->compare(heap->scratch, si__heapElem(heap, parent), heap->userData), break);
+
+		si__heapMove(heap, slot, parent);
+		slot = parent;
 	}
 
-	return str;
+	si_memcopy(si__heapElem(heap, slot), heap->scratch, heap->array.typeSize);
+	slots[slot] = handle;
+	positions[handle] = slot;
+
+	return slot;
 }
 
+siIntern
+void si__heapSiftDown(siHeapAny* heap, isize slot) {
+	isize* slots = (isize*)heap->slots.data;
+	isize* positions = (isize*)heap->positions.data;
+	isize handle = slots[slot];
+	isize len = heap->array.len;
+	si_memcopy(heap->scratch, si__heapElem(heap, slot), heap->array.typeSize);
+
+	while (true) {
+		isize child = SI_HEAP_ARITY * slot + 1;
+		SI_STOPIF(child >= len, break);
+
+		isize end = (child + SI_HEAP_ARITY < len) ? child + SI_HEAP_ARITY : len;
+		isize best = child;
+		for_range (i, child + 1, end) {
+			if (heap->compare(si__heapElem(heap, i), si__heapElem(heap, best), heap->userData)) {
+				best = i;
+			}
+		}
+		SI_STOPIF(!heap->compare(si__heapElem(heap, best), heap->scratch, heap->userData), break);
 
-inline
-siBuilder si_builderMake(isize capacity, siAllocator alloc) {
-	return si_builderMakeEx(0, 0, capacity, alloc);
+		si__heapMove(heap, slot, best);
+		slot = best;
+	}
+
+	si_memcopy(si__heapElem(heap, slot), heap->scratch, heap->array.typeSize);
+	slots[slot] = handle;
+	positions[handle] = slot;
+}
+
+force_inline
+void si__heapRestore(siHeapAny* heap, isize slot) {
+	if (si__heapSiftUp(heap, slot) == slot) {
+		si__heapSiftDown(heap, slot);
+	}
+}
+
+SIDEF
+siHeapAny si_heapReserve(isize typeSize, isize capacity, siHeapCompareProc* compare,
+		void* userData, siAllocator alloc) {
+	SI_ASSERT_NOT_NEG(typeSize);
+	SI_ASSERT_NOT_NEG(capacity);
+	SI_ASSERT_NOT_NIL(compare);
+
+	capacity = (capacity != 0) ? capacity : 1;
+
+	siHeapAny heap;
+	heap.array = si_dynamicArrayReserveNonZeroed(typeSize, capacity, alloc);
+	heap.slots = si_dynamicArrayReserveNonZeroed(si_sizeof(isize), capacity, alloc);
+	heap.positions = si_dynamicArrayReserveNonZeroed(si_sizeof(isize), capacity, alloc);
+	heap.freeHandle = -1;
+	heap.compare = compare;
+	heap.userData = userData;
+	heap.scratch = si_allocNonZeroed(alloc, typeSize);
+
+	return heap;
+}
+
+SIDEF
+siHeapAny si_heapMakeEx(const void* list, isize typeSize, isize count,
+		siHeapCompareProc* compare, void* userData, siAllocator alloc) {
+	SI_ASSERT_NOT_NIL(list);
+	SI_ASSERT_NOT_NEG(count);
+
+	siHeapAny heap = si_heapReserve(typeSize, count, compare, userData, alloc);
+	si_memcopy(heap.array.data, list, typeSize * count);
+
+	isize* slots = (isize*)heap.slots.data;
+	isize* positions = (isize*)heap.positions.data;
+	for_range (i, 0, count) {
+		slots[i] = i;
+		positions[i] = i;
+	}
+	heap.array.len = count;
+	heap.slots.len = count;
+	heap.positions.len = count;
+	SI_STOPIF(count < 2, return heap);
+
+	isize i;
+	for (i = (count - 2) / SI_HEAP_ARITY; i >= 0; i -= 1) {
+		si__heapSiftDown(&heap, i);
+	}
+
+	return heap;
+}
+
+SIDEF
+void si_heapFree(siHeapAny heap) {
+	si_free(heap.array.alloc, heap.scratch);
+	si_dynamicArrayFree(heap.positions);
+	si_dynamicArrayFree(heap.slots);
+	si_dynamicArrayFree(heap.array);
+}
+
+inline
+void* si_heapTop(siHeapAny heap) {
+	SI_STOPIF(heap.array.len == 0, return nil);
+	return heap.array.data;
+}
+
+inline
+void* si_heapGet(siHeapAny heap, isize handle) {
+	SI_ASSERT(si_between(isize, handle, 0, heap.positions.len - 1));
+
+	isize slot = ((isize*)heap.positions.data)[handle];
+	SI_ASSERT_MSG(slot >= 0, "The handle has already been popped or erased.");
+
+	return si__heapElem(&heap, slot);
+}
+
+SIDEF
+isize si_heapPush(siHeapAny* heap, const void* data) {
+	SI_ASSERT_NOT_NIL(heap);
+	SI_ASSERT_NOT_NIL(data);
+
+	isize handle;
+	if (heap->freeHandle != -1) {
+		handle = heap->freeHandle;
+		heap->freeHandle = -2 - ((isize*)heap->positions.data)[handle];
+	}
+	else {
+		handle = heap->positions.len;
+		si_dynamicArrayMakeSpaceFor(&heap->positions, 1);
+	}
+
+	isize slot = heap->array.len;
+	si_dynamicArrayMakeSpaceFor(&heap->array, 1);
+	si_dynamicArrayMakeSpaceFor(&heap->slots, 1);
+
+	si_memcopy(si__heapElem(heap, slot), data, heap->array.typeSize);
+	((isize*)heap->slots.data)[slot] = handle;
+	si__heapSiftUp(heap, slot);
+
+	return handle;
+}
+
+SIDEF
+bool si_heapPop(siHeapAny* heap, void* out) {
+	SI_ASSERT_NOT_NIL(heap);
+	SI_STOPIF(heap->array.len == 0, return false);
+
+	if (out != nil) {
+		si_memcopy(out, heap->array.data, heap->array.typeSize);
+	}
+	si_heapErase(heap, ((isize*)heap->slots.data)[0]);
+
+	return true;
+}
+
+SIDEF
+void si_heapUpdate(siHeapAny* heap, isize handle, const void* data) {
+	SI_ASSERT_NOT_NIL(heap);
+	SI_ASSERT_NOT_NIL(data);
+
+	si_memcopy(si_heapGet(*heap, handle), data, heap->array.typeSize);
+	si__heapRestore(heap, ((isize*)heap->positions.data)[handle]);
+}
+
+SIDEF
+void si_heapErase(siHeapAny* heap, isize handle) {
+	SI_ASSERT_NOT_NIL(heap);
+	SI_ASSERT(si_between(isize, handle, 0, heap->positions.len - 1));
+
+	isize* positions = (isize*)heap->positions.data;
+	isize slot = positions[handle];
+	SI_ASSERT_MSG(slot >= 0, "The handle has already been popped or erased.");
+
+	positions[handle] = -2 - heap->freeHandle;
+	heap->freeHandle = handle;
+
+	heap->array.len -= 1;
+	heap->slots.len -= 1;
+
+	isize last = heap->array.len;
+	if (slot != last) {
+		si__heapMove(heap, slot, last);
+		si__heapRestore(heap, slot);
+	}
+}
+
+SIDEF
+void si_heapClear(siHeapAny* heap) {
+	SI_ASSERT_NOT_NIL(heap);
+	heap->array.len = 0;
+	heap->slots.len = 0;
+	heap->positions.len = 0;
+	heap->freeHandle = -1;
+}
+
+
+#define SI__HEAP_KEY_IMPL(name, type) \
+	siIntern \
+	void si__heapSiftUp##name(siHeapNode##name* nodes, isize slot, siHeapNode##name node) { \
+		while (slot > 0) { \
+			isize parent = (slot - 1) / SI_HEAP_ARITY; \
+			SI_STOPIF(!(node.key < nodes[parent].key), break); \
+			nodes[slot] = nodes[parent]; \
+			slot = parent; \
+		} \
+		nodes[slot] = node; \
+	} \
+	\
+	siIntern \
+	void si__heapSiftDown##name(siHeapNode##name* nodes, isize len, isize slot, siHeapNode##name node) { \
+		while (true) { \
+			isize child = SI_HEAP_ARITY * slot + 1; \
+			SI_STOPIF(child >= len, break); \
+			\
+			isize end = (child + SI_HEAP_ARITY < len) ? child + SI_HEAP_ARITY : len; \
+			isize best = child; \
+			for_range (i, child + 1, end) { \
+				if (nodes[i].key < nodes[best].key) { best = i; } \
+			} \
+			SI_STOPIF(!(nodes[best].key < node.key), break); \
+			\
+			nodes[slot] = nodes[best]; \
+			slot = best; \
+		} \
+		nodes[slot] = node; \
+	} \
+	\
+	SIDEF \
+	void si_heapPush##name(siDynamicArray(siHeapNode##name)* heap, type key, u64 value) { \
+		SI_ASSERT_NOT_NIL(heap); \
+		SI_ASSERT(heap->typeSize == si_sizeof(siHeapNode##name)); \
+		\
+		siHeapNode##name node; \
+		node.key = key; \
+		node.value = value; \
+		\
+		isize slot = heap->len; \
+		si_dynamicArrayMakeSpaceFor(heap, 1); \
+		si__heapSiftUp##name((siHeapNode##name*)heap->data, slot, node); \
+	} \
+	\
+	SIDEF \
+	bool si_heapPop##name(siDynamicArray(siHeapNode##name)* heap, siHeapNode##name* out) { \
+		SI_ASSERT_NOT_NIL(heap); \
+		SI_STOPIF(heap->len == 0, return false); \
+		\
+		siHeapNode##name* nodes = (siHeapNode##name*)heap->data; \
+		if (out != nil) { *out = nodes[0]; } \
+		\
+		heap->len -= 1; \
+		if (heap->len != 0) { \
+			si__heapSiftDown##name(nodes, heap->len, 0, nodes[heap->len]); \
+		} \
+		return true; \
+	} \
+	\
+	SIDEF \
+	void si_heapify##name(siDynamicArray(siHeapNode##name) heap) { \
+		SI_STOPIF(heap.len < 2, return); \
+		siHeapNode##name* nodes = (siHeapNode##name*)heap.data; \
+		isize i; \
+		for (i = (heap.len - 2) / SI_HEAP_ARITY; i >= 0; i -= 1) { \
+			si__heapSiftDown##name(nodes, heap.len, i, nodes[i]); \
+		} \
+	}
+
+SI__HEAP_KEY_IMPL(I64, i64)
+SI__HEAP_KEY_IMPL(U64, u64)
+SI__HEAP_KEY_IMPL(F64, f64)
+
+#undef SI__HEAP_KEY_IMPL
+
+inline
+isize si_memcopy_s(siArrayAny dst, const void* src, isize sizeSrc) {
+	isize length = si_min(isize, dst.len, sizeSrc);
+	return si_memcopy(dst.data, src, length);
+}
+
+inline
+isize si_memmove_s(siArrayAny dst, const void* src, isize sizeSrc) {
+	isize length = si_min(isize, dst.len, sizeSrc);
+	return si_memmove(dst.data, src, length);
+}
+
+
+#endif /* SI_IMPLEMENTATION_ARRAY */
+
+#ifdef SI_IMPLEMENTATION_STRING
+
+#if SI_LANGUAGE_IS_CPP
+u8 siString::operator[](isize index) {
+	SI_ASSERT(index < len);
+	SI_ASSERT_NOT_NEG(index);
+	return this->data[index];
+}
+siString siString::operator()(isize offset1, isize offset2) {
+	return si_substr(*this, offset1, offset2);
+}
+siString siString::from(isize offset1) {
+	return si_substrFrom(*this, offset1);
+}
+siString siString::to(isize offset2) {
+	return si_substrTo(*this, offset2);
+}
+siString siString::substrLen(isize offset1, isize length) {
+	return si_substrLen(*this, offset1, length);
+}
+#endif
+
+siIntern const u8 SI__NUM_DIGIT_PAIRS[200] = {
+	'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+	'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+	'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+	'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+	'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+	'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+	'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+	'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+	'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+	'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+/* Writes the digits of 'num' into 'data' from right to left, 'len' being the
+ * exact amount of digits as returned by 'si__numLen'. */
+siIntern
+void si__numWriteDigits(u64 num, u32 base, u8* data, isize len) {
+	u8* ptr = &data[len];
+
+	if (base == 10) {
+		/* NOTE(EimaMei): Two digits get written per division by using a table
+		 * of every digit pair. */
+		while (num >= 100) {
+			u64 pair = (num % 100) * 2;
+			num /= 100;
+			ptr -= 2;
+			ptr[0] = SI__NUM_DIGIT_PAIRS[pair + 0];
+			ptr[1] = SI__NUM_DIGIT_PAIRS[pair + 1];
+		}
+
+		if (num >= 10) {
+			ptr -= 2;
+			ptr[0] = SI__NUM_DIGIT_PAIRS[num * 2 + 0];
+			ptr[1] = SI__NUM_DIGIT_PAIRS[num * 2 + 1];
+		}
+		else {
+			ptr[-1] = (u8)('0' + num);
+		}
+	}
+	else if ((base & (base - 1)) == 0) {
+		u32 shift = (u32)(63 - si__clz64(base));
+		u64 mask = base - 1;
+		do {
+			ptr -= 1;
+			*ptr = SI_NUM_TO_CHAR_TABLE[num & mask];
+			num >>= shift;
+		} while (num != 0);
+	}
+	else {
+		do {
+			ptr -= 1;
+			*ptr = SI_NUM_TO_CHAR_TABLE[num % base];
+			num /= base;
+		} while (num != 0);
+	}
+}
+
+/* Writes the number with an optional minus sign into 'data', which must fit
+ * 'len' characters as returned by 'si__numLen' (plus one for the sign). */
+force_inline
+void si__numWrite(u64 num, u32 base, bool isNegative, u8* data, isize len) {
+	if (isNegative) {
+		data[0] = '-';
+		si__numWriteDigits(num, base, &data[1], len - 1);
+	}
+	else {
+		si__numWriteDigits(num, base, data, len);
+	}
+}
+
+SIDEF
+siUtf32Char si__stringLastRune(siString str) {
+	SI_ASSERT_MSG(str.len > 0, "This function doesn't check for if the length is zero. Fix your function.");
+
+	u8 lastChar = str.data[str.len - 1];
+	if (lastChar < 0x80) {
+		return SI_COMP_LIT(siUtf32Char, lastChar, 1);
+	}
+
+	isize end = si_max(isize, str.len - 4, 0);
+	isize i;
+	for (i = str.len - 1; i >= end; i -= 1) {
+		if ((str.data[i] & 0xC0) != 0x80) {
+			break;
+		}
+	}
+
+	i = si_max(isize, i, 0);
+	return si_utf8Decode(&str.data[i]);
+}
+
+siIntern
+siString si__stringTrimCr(siString str) {
+	isize i = str.len;
+	if (i > 0 && str.data[i - 1] == '\r') {
+		str.len -= 1;
+	}
+
+	return str;
+}
+
+
+inline
+siBuilder si_builderMake(isize capacity, siAllocator alloc) {
+	return si_builderMakeEx(0, 0, capacity, alloc);
 }
 inline
 siBuilder si_builderMakeLen(isize len, isize capacity, siAllocator alloc) {
@@ -6480,8 +8478,19 @@ siAllocationError si_builderWriteInt(siBuilder* b, i64 num) {
 }
 SIDEF
 siAllocationError si_builderWriteIntEx(siBuilder* b, i64 num, i32 base) {
-	siString str = si_stringFromIntEx(num, base, SI_ARR_STACK(32));
-	return si_builderWriteStr(b, str);
+	SI_ASSERT(si_between(i32, base, 2, SI_BASE_MAX));
+
+	bool isNegative = num < 0;
+	u64 value = isNegative ? (~(u64)num + 1) : (u64)num;
+	isize len = isNegative + si__numLen(value, (u32)base);
+
+	siAllocationError res = si_builderMakeSpaceFor(b, len);
+	if (res == siAllocationError_None) {
+		si__numWrite(value, (u32)base, isNegative, &b->data[b->len], len);
+		b->len += len;
+	}
+
+	return res;
 }
 
 inline
@@ -6490,8 +8499,16 @@ siAllocationError si_builderWriteUInt(siBuilder* b, u64 num) {
 }
 SIDEF
 siAllocationError si_builderWriteUIntEx(siBuilder* b, u64 num, i32 base) {
-	siString str = si_stringFromUIntEx(num, base, SI_ARR_STACK(32));
-	return si_builderWriteStr(b, str);
+	SI_ASSERT(si_between(i32, base, 2, SI_BASE_MAX));
+
+	isize len = si__numLen(num, (u32)base);
+	siAllocationError res = si_builderMakeSpaceFor(b, len);
+	if (res == siAllocationError_None) {
+		si__numWriteDigits(num, (u32)base, &b->data[b->len], len);
+		b->len += len;
+	}
+
+	return res;
 }
 
 inline
@@ -6499,6 +8516,16 @@ siAllocationError si_builderWriteFloat(siBuilder* b, f64 num) {
 	return si_builderWriteFloatEx(b, num, 10, 6);
 }
 SIDEF
+siAllocationError si_builderWriteFloatShortest(siBuilder* b, f64 num) {
+	siString str = si_stringFromFloatShortest(num, SI_ARR_STACK(32));
+	return si_builderWriteStr(b, str);
+}
+SIDEF
+siAllocationError si_builderWriteFloat32Shortest(siBuilder* b, f32 num) {
+	siString str = si_stringFromFloat32Shortest(num, SI_ARR_STACK(32));
+	return si_builderWriteStr(b, str);
+}
+SIDEF
 siAllocationError si_builderWriteFloatEx(siBuilder* b, f64 num, i32 base, i32 afterPoint) {
 	siString str = si_stringFromFloatEx(num, base, afterPoint, SI_ARR_STACK(1024));
 	return si_builderWriteStr(b, str);
@@ -7078,26 +9105,58 @@ siString si__stringFromBits(u64 num, i32 base, bool isNegative, siArray(u8) out)
 	SI_ASSERT_ARR_TYPE(out, u8);
 
 	/* TODO(EimaMei): Add prefix support. */
-	u8 buf[128];
-	u64 base_u = (u64)base;
-
-	isize i = countof(buf) - 1;
-	do {
-		buf[i] = SI_NUM_TO_CHAR_TABLE[num % base_u];
-		num /= base_u;
-		i -= 1;
-	} while (num != 0);
-
-	if (isNegative) {
-		buf[i] = '-';
-		i -= 1;
+	isize len = isNegative + si__numLen(num, (u32)base);
+	if (len <= out.len) {
+		si__numWrite(num, (u32)base, isNegative, (u8*)out.data, len);
+		return SI_STR_LEN(out.data, len);
 	}
 
-	i += 1;
-	isize len = si_memcopy_s(out, &buf[i], countof(buf) - i);
+	u8 buf[65];
+	si__numWrite(num, (u32)base, isNegative, buf, len);
+	len = si_memcopy_s(out, buf, len);
 	return SI_STR_LEN(out.data, len);
 }
 
+/* Parses 8 base 10 ASCII digits loaded as a little-endian u64. Returns false if
+ * any of the characters isn't a digit. */
+force_inline
+b32 si__stringParse8Dec(u64 chunk, u32* out) {
+	u64 check = (chunk & 0xF0F0F0F0F0F0F0F0)
+		| (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4);
+	SI_STOPIF(check != 0x3333333333333333, return false);
+
+	/* NOTE(EimaMei): The first character is the lowest byte, so every step
+	 * merges a lane with the one right above it: 8 digits -> 4 pairs -> 2
+	 * quads -> 1 value. */
+	u64 n = chunk - 0x3030303030303030;
+	n = (n * 10 + (n >> 8)) & 0x00FF00FF00FF00FF;
+	n = (n * 100 + (n >> 16)) & 0x0000FFFF0000FFFF;
+	*out = (u32)(n * 10000 + (n >> 32));
+	return true;
+}
+
+/* Parses 8 base 16 ASCII digits (in either case) loaded as a little-endian u64.
+ * Returns false if any of the characters isn't a hex digit. */
+force_inline
+b32 si__stringParse8Hex(u64 chunk, u32* out) {
+	const u64 ones = 0x0101010101010101,
+			  high = 0x8080808080808080;
+	SI_STOPIF(chunk & high, return false);
+
+	/* NOTE(EimaMei): Each byte is below 0x80, meaning the top bit of 'byte +
+	 * (0x80 - c)' is set only if the byte is at least 'c'. */
+	u64 lower = chunk | (ones * 0x20);
+	u64 isDigit = (chunk + ones * (0x80 - '0')) & ~(chunk + ones * (0x80 - '9' - 1)) & high,
+		isAlpha = (lower + ones * (0x80 - 'a')) & ~(lower + ones * (0x80 - 'f' - 1)) & high;
+	SI_STOPIF((isDigit | isAlpha) != high, return false);
+
+	u64 n = (chunk & (ones * 0x0F)) + (isAlpha >> 7) * 9;
+	n = ((n << 4) | (n >> 8)) & 0x00FF00FF00FF00FF;
+	n = ((n << 8) | (n >> 16)) & 0x0000FFFF0000FFFF;
+	*out = (u32)((n << 16) | (n >> 32));
+	return true;
+}
+
 siIntern
 u64 si__stringToBits(siString str, i32 base, isize* outInvalidIndex) {
 	SI_ASSERT_NOT_NIL(outInvalidIndex);
@@ -7132,7 +9191,7 @@ u64 si__stringToBits(siString str, i32 base, isize* outInvalidIndex) {
 			case 'd': base = 10; str = si_substrFrom(str, 2); baseI += 2; break;
 			case 'o': base =  8; str = si_substrFrom(str, 2); baseI += 2; break;
 			case 'b': base =  2; str = si_substrFrom(str, 2); baseI += 2; break;
-			default:  base = 10;
+			default:  if (base == -1) { base = 10; }
 		}
 	}
 	else if (base == -1) {
@@ -7141,6 +9200,35 @@ u64 si__stringToBits(siString str, i32 base, isize* outInvalidIndex) {
 
 	u64 res = 0;
 	u64 base_u = (u64)base;
+
+#if SI_ENDIAN_IS_LITTLE
+	/* NOTE(EimaMei): Base 10 and 16 get parsed 8 digits at a time, as long as
+	 * the result cannot overflow. Anything else (separators, spaces, invalid
+	 * characters, the last few digits) is left to the regular loop. */
+	if (base == 10 || base == 16) {
+		u64 limit = (base == 10) ? 184467440736 : 0xFFFFFFFF,
+			multiplier = (base == 10) ? 100000000 : 0x100000000;
+
+		isize i = 0;
+		while (str.len - i >= 8 && res <= limit) {
+			u64 chunk;
+			u32 value;
+			si_memcopy(&chunk, &str.data[i], si_sizeof(chunk));
+
+			b32 valid = (base == 10)
+				? si__stringParse8Dec(chunk, &value)
+				: si__stringParse8Hex(chunk, &value);
+			SI_STOPIF(!valid, break);
+
+			res = res * multiplier + value;
+			i += 8;
+		}
+
+		str = si_substrFrom(str, i);
+		baseI += i;
+	}
+#endif
+
 	for_eachStrEx (r, i, str) {
 		if (r == '_') {
 			continue;
@@ -7223,1491 +9311,4247 @@ i64 si_stringToIntBase(siString str, i32 base, isize* outInvalidIndex) {
 	return (i64)si__stringToBits(str, base, outInvalidIndex);
 }
 
-inline
-siString si_stringFromFloat(f64 num, siArray(u8) out) {
-	return si_stringFromFloatEx(num, 10, 6, out);
-}
-SIDEF
-siString si_stringFromFloatEx(f64 num, i32 base, i32 afterPoint, siArray(u8) out) {
-	SI_ASSERT_NOT_NEG(afterPoint);
-	SI_ASSERT(si_between(i32, base, 2, SI_BASE_MAX));
+/* NOTE(EimaMei): The float to decimal conversion is a port of Ryu (Ulf Adams,
+ * 2018), which finds the shortest decimal that rounds back into the same float.
+ * Instead of the full 128-bit power of 5 tables only every 26th power is
+ * stored, the rest get computed by multiplying them with a small power of 5
+ * and correcting the lowest bits with the 2-bit offsets. */
+#define SI__RYU_POW5_BITCOUNT 125
+#define SI__RYU_POW5_INV_BITCOUNT 125
+#define SI__RYU_POW5_TABLE_SIZE 26
+
+siIntern const u64 SI__RYU_POW5_TABLE[SI__RYU_POW5_TABLE_SIZE] = {
+	0x1, 0x5, 0x19, 0x7D, 0x271, 0xC35, 0x3D09, 0x1312D, 0x5F5E1, 0x1DCD65, 0x9502F9,
+	0x2E90EDD, 0xE8D4A51, 0x48C27395, 0x16BCC41E9, 0x71AFD498D, 0x2386F26FC1,
+	0xB1A2BC2EC5, 0x3782DACE9D9, 0x1158E460913D, 0x56BC75E2D631, 0x1B1AE4D6E2EF5,
+	0x878678326EAC9, 0x2A5A058FC295ED, 0xD3C21BCECCEDA1, 0x422CA8B0A00A425
+};
 
-	/* TODO(EimaMei): Rework this to be faster and to be more like si__stringFromBits. */
-	{
-		i32 isInf = si_float64IsInf(num);
-		if (isInf) {
-			siString str = (isInf == 1) ? SI_STR("inf") : SI_STR("-inf");
-			isize len = si_memcopyStr_s(out, str);
-			return SI_STR_LEN(out.data, len);
-		}
-		else if (si_float64IsNan(num)) {
-			isize len = si_memcopyStr_s(out, SI_STR("nan"));
-			return SI_STR_LEN(out.data, len);
-		}
-	}
+siIntern const u64 SI__RYU_POW5_SPLIT[13][2] = {
+	{0x0000000000000000, 0x1000000000000000}, {0x0000000000000000, 0x14ADF4B7320334B9},
+	{0x0E549208B31ADB10, 0x1ABA4714957D300D}, {0x6DC6AD264D8F0866, 0x1145B7E285BF98F5},
+	{0xEB1DBD923D8596CA, 0x1652EFDC6018A1FC}, {0xB4C1B80B22AE923C, 0x1CDA62055B2D9D83},
+	{0x5BB28B4E8F7E4C30, 0x12A5568B9F52F416}, {0xF08AED437682D4FB, 0x1819651531F9E78F},
+	{0xB4EE134AD99BF150, 0x1F25C186A6F04C28}, {0x16499ECB70C25F03, 0x1420EB449C8842E6},
+	{0x85A56EAD360865B0, 0x1A03FDE214CAF085}, {0x093DB1D57999890B, 0x10CFEB353A97DAD8},
+	{0xCF38BB735E3F36AC, 0x15BAAF44FA52673E}
+};
 
-	i32 isNegative;
-	{
-		union { f64 f; u64 n; } check = {num};
-		isNegative = (i32)(check.n >> 63) & 1;
-	   	check.n &= ~SI_BIT(63); /* NOTE(EimaMei): A quick way of changing the minus to plus. */
-		num = check.f;
-	}
-
-	isize baseLen = 0;
-	f64 numWhole = (afterPoint != 0)
-		? num
-		: si_round(f64, num);
-	do {
-		numWhole /= base;
-		baseLen += 1;
-	} while (numWhole > 0.9999999999999999f); /* NOTE(EimaMei): How long can this be?? */
+siIntern const u32 SI__RYU_POW5_OFFSETS[21] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x59695995, 0x55545555,
+	0x56555515, 0x41150504, 0x40555410, 0x44555145, 0x44504540, 0x45555550, 0x40004000,
+	0x96440440, 0x55565565, 0x54454045, 0x40154151, 0x55559155, 0x51405555, 0x00000105
+};
 
+siIntern const u64 SI__RYU_POW5_INV_SPLIT[15][2] = {
+	{0x0000000000000001, 0x2000000000000000}, {0x52A6C95FC0655034, 0x18C240C4AECB13BB},
+	{0x7CA8D50071DFC806, 0x1327FC58DA0F6FF5}, {0x6520247D3556476E, 0x1DA48CE468E7C702},
+	{0x6139CDD76802E6E9, 0x16EF5B40C2FC7779}, {0xF951A7FF43DE8C79, 0x11BEBDF578B2F391},
+	{0x7BE8BEE8D6E957E8, 0x1B758D848FAC54B0}, {0x8BD3F9E999A423EA, 0x153EDA614071A3B7},
+	{0x0848F973CB3EE3CE, 0x10701BD527B4978C}, {0x153285EBB9EFBFA2, 0x196FBB9BB44DB44D},
+	{0xADEEE7F86C07B696, 0x13AE3591F5B4D936}, {0x4D686A4EAF182222, 0x1E74404F3DAADA91},
+	{0x98C0A106E09EBD9F, 0x17900EA4FDA7C257}, {0x8F20E37371497D0E, 0x123B140576D820B2},
+	{0xB043138134743D85, 0x1C35F4275F7A29AD}
+};
 
-	isize len = isNegative + baseLen + (afterPoint != 0) + afterPoint;
-	isize i = 0;
-	u8* res = (u8*)out.data;
+siIntern const u32 SI__RYU_POW5_INV_OFFSETS[22] = {
+	0x54544554, 0x04055545, 0x10041000, 0x00400414, 0x40010000, 0x41155555, 0x00000454,
+	0x00010044, 0x40000000, 0x44000041, 0x50454450, 0x55550054, 0x51655554, 0x40004000,
+	0x01000001, 0x00010500, 0x51515411, 0x05555554, 0x50411500, 0x40040000, 0x05040110,
+	0x00000000
+};
 
-	if (isNegative) {
-		res[i] = '-';
-		i += 1;
-	}
+/* Returns the bit length of 5^e (0 <= e <= 3528). */
+force_inline
+i32 si__ryuPow5Bits(i32 e) {
+	return (i32)(((u32)e * 1217359) >> 19) + 1;
+}
 
-	i32 digit;
-	do {
-		numWhole *= base;
-		digit = (i32)numWhole;
-		numWhole -= digit;
+/* Returns floor(log10(2^e)) (0 <= e <= 1650). */
+force_inline
+u32 si__ryuLog10Pow2(i32 e) {
+	return ((u32)e * 78913) >> 18;
+}
 
-		res[i] = SI_NUM_TO_CHAR_TABLE[(u32)digit % (u32)base];
-		i += 1;
+/* Returns floor(log10(5^e)) (0 <= e <= 2620). */
+force_inline
+u32 si__ryuLog10Pow5(i32 e) {
+	return ((u32)e * 732923) >> 20;
+}
 
-		baseLen -= 1;
-	} while (baseLen > 0);
+force_inline
+u64 si__ryuShiftRight128(u64 low, u64 high, u32 dist) {
+	SI_ASSERT(dist > 0 && dist < 64);
+	return (high << (64 - dist)) | (low >> dist);
+}
 
-	if (afterPoint == 0) {
-		return SI_STR_LEN(res, len);
+/* Computes 5^i shifted to 125 bits. */
+siIntern
+void si__ryuPow5(u32 i, u64 res[2]) {
+	u32 base = i / SI__RYU_POW5_TABLE_SIZE,
+		base2 = base * SI__RYU_POW5_TABLE_SIZE,
+		offset = i - base2;
+	const u64* mul = SI__RYU_POW5_SPLIT[base];
+
+	if (offset == 0) {
+		res[0] = mul[0];
+		res[1] = mul[1];
+		return;
 	}
 
-	res[i] = '.';
-	i += 1;
+	u64 m = SI__RYU_POW5_TABLE[offset];
+	u64 high1, high0;
+	u64 low1 = si__mul128(m, mul[1], &high1);
+	u64 low0 = si__mul128(m, mul[0], &high0);
+	u64 sum = high0 + low1;
+	high1 += (sum < high0);
 
-	f64 rounder = 5.0 / base;
-	for_range (j, 0, afterPoint) { rounder /= base; }
+	u32 delta = (u32)(si__ryuPow5Bits((i32)i) - si__ryuPow5Bits((i32)base2));
+	res[0] = si__ryuShiftRight128(low0, sum, delta) + ((SI__RYU_POW5_OFFSETS[i / 16] >> ((i % 16) << 1)) & 3);
+	res[1] = si__ryuShiftRight128(sum, high1, delta);
+}
 
-	num += rounder;
-	while (afterPoint) {
-		num *= base;
+/* Computes 2^k / 5^i + 1, where 'k' is picked so that the result has 125 bits. */
+siIntern
+void si__ryuInvPow5(u32 i, u64 res[2]) {
+	u32 base = (i + SI__RYU_POW5_TABLE_SIZE - 1) / SI__RYU_POW5_TABLE_SIZE,
+		base2 = base * SI__RYU_POW5_TABLE_SIZE,
+		offset = base2 - i;
+	const u64* mul = SI__RYU_POW5_INV_SPLIT[base];
+
+	if (offset == 0) {
+		res[0] = mul[0];
+		res[1] = mul[1];
+		return;
+	}
 
-		u64 numInt = (u64)num;
-		res[i] = SI_NUM_TO_CHAR_TABLE[numInt % (u64)base];
-		i += 1;
+	u64 m = SI__RYU_POW5_TABLE[offset];
+	u64 high1, high0;
+	u64 low1 = si__mul128(m, mul[1], &high1);
+	u64 low0 = si__mul128(m, mul[0] - 1, &high0);
+	u64 sum = high0 + low1;
+	high1 += (sum < high0);
 
-		afterPoint -= 1;
-		num -= (f64)numInt;
+	u32 delta = (u32)(si__ryuPow5Bits((i32)base2) - si__ryuPow5Bits((i32)i));
+	res[0] = si__ryuShiftRight128(low0, sum, delta) + 1 + ((SI__RYU_POW5_INV_OFFSETS[i / 16] >> ((i % 16) << 1)) & 3);
+	res[1] = si__ryuShiftRight128(sum, high1, delta);
+}
+
+force_inline
+bool si__ryuMultipleOfPow5(u64 value, u32 p) {
+	u32 count = 0;
+	while (value % 5 == 0) {
+		value /= 5;
+		count += 1;
 	}
 
-	return SI_STR_LEN(res, len);
+	return count >= p;
+}
+
+force_inline
+bool si__ryuMultipleOfPow2(u64 value, u32 p) {
+	return (value & (SI_BIT(p) - 1)) == 0;
 }
 
+force_inline
+u64 si__ryuMulShift64(u64 m, const u64 mul[2], i32 j) {
+	u64 high1, high0;
+	u64 low1 = si__mul128(m, mul[1], &high1);
+	si__mul128(m, mul[0], &high0);
 
-inline
-siString si_stringFromBool(bool boolean) {
-	static const siString values[] = {SI_STRC("false"), SI_STRC("true")};
-	return values[boolean & true];
+	u64 sum = high0 + low1;
+	high1 += (sum < high0);
+	return si__ryuShiftRight128(sum, high1, (u32)(j - 64));
 }
 
-SIDEF
-b32 si_stringToBool(siString str) {
-	SI_ASSERT_STR(str);
-	SI_STOPIF(str.len == 0, return UINT32_MAX);
+force_inline
+u32 si__ryuMulShift32(u32 m, u64 factor, i32 shift) {
+	u64 bits0 = (u64)m * (u32)factor,
+		bits1 = (u64)m * (factor >> 32);
+	u64 sum = (bits0 >> 32) + bits1;
+	return (u32)(sum >> (shift - 32));
+}
 
-	if (str.len == 1) {
-		switch (str.data[0]) {
-			case '1': case 't': case 'T': return true;
-			case '0': case 'f': case 'F': return false;
-			default: return UINT32_MAX;
-		}
-	}
+/* A float in the form of 'digits * 10^exponent'. */
+typedef struct si__floatDecimal {
+	u64 digits;
+	i32 exponent;
+} si__floatDecimal;
 
-	if (si_stringEqual(str, SI_STR("true")) || si_stringEqual(str, SI_STR("True"))) {
-		return true;
+siIntern
+si__floatDecimal si__ryuF64(u64 ieeeMantissa, u32 ieeeExponent) {
+	i32 e2;
+	u64 m2;
+	if (ieeeExponent == 0) {
+		e2 = 1 - 1023 - 52 - 2;
+		m2 = ieeeMantissa;
 	}
-	else if (si_stringEqual(str, SI_STR("false")) || si_stringEqual(str, SI_STR("False"))) {
-		return false;
+	else {
+		e2 = (i32)ieeeExponent - 1023 - 52 - 2;
+		m2 = SI_BIT(52) | ieeeMantissa;
+	}
+	bool acceptBounds = (m2 & 1) == 0;
+
+	/* Step 2: Determine the interval of valid decimal representations. */
+	u64 mv = 4 * m2;
+	u32 mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1);
+
+	/* Step 3: Convert to a decimal power base using 128-bit arithmetic. */
+	u64 vr, vp, vm;
+	i32 e10;
+	bool vmIsTrailingZeros = false, vrIsTrailingZeros = false;
+
+	if (e2 >= 0) {
+		u32 q = si__ryuLog10Pow2(e2) - (e2 > 3);
+		e10 = (i32)q;
+		i32 k = SI__RYU_POW5_INV_BITCOUNT + si__ryuPow5Bits((i32)q) - 1;
+		i32 i = -e2 + (i32)q + k;
+
+		u64 pow5[2];
+		si__ryuInvPow5(q, pow5);
+		vr = si__ryuMulShift64(4 * m2, pow5, i);
+		vp = si__ryuMulShift64(4 * m2 + 2, pow5, i);
+		vm = si__ryuMulShift64(4 * m2 - 1 - mmShift, pow5, i);
+
+		if (q <= 21) {
+			if (mv % 5 == 0) {
+				vrIsTrailingZeros = si__ryuMultipleOfPow5(mv, q);
+			}
+			else if (acceptBounds) {
+				vmIsTrailingZeros = si__ryuMultipleOfPow5(mv - 1 - mmShift, q);
+			}
+			else {
+				vp -= si__ryuMultipleOfPow5(mv + 2, q);
+			}
+		}
+	}
+	else {
+		u32 q = si__ryuLog10Pow5(-e2) - (-e2 > 1);
+		e10 = (i32)q + e2;
+		i32 i = -e2 - (i32)q;
+		i32 k = si__ryuPow5Bits(i) - SI__RYU_POW5_BITCOUNT;
+		i32 j = (i32)q - k;
+
+		u64 pow5[2];
+		si__ryuPow5((u32)i, pow5);
+		vr = si__ryuMulShift64(4 * m2, pow5, j);
+		vp = si__ryuMulShift64(4 * m2 + 2, pow5, j);
+		vm = si__ryuMulShift64(4 * m2 - 1 - mmShift, pow5, j);
+
+		if (q <= 1) {
+			vrIsTrailingZeros = true;
+			if (acceptBounds) {
+				vmIsTrailingZeros = (mmShift == 1);
+			}
+			else {
+				vp -= 1;
+			}
+		}
+		else if (q < 63) {
+			vrIsTrailingZeros = si__ryuMultipleOfPow2(mv, q);
+		}
 	}
 
-	return UINT32_MAX;
-}
+	/* Step 4: Find the shortest decimal representation in the interval. */
+	i32 removed = 0;
+	u8 lastRemovedDigit = 0;
+	u64 output;
+
+	if (SI_UNLIKELY(vmIsTrailingZeros || vrIsTrailingZeros)) {
+		while (vp / 10 > vm / 10) {
+			vmIsTrailingZeros &= (vm % 10 == 0);
+			vrIsTrailingZeros &= (lastRemovedDigit == 0);
+			lastRemovedDigit = (u8)(vr % 10);
+			vr /= 10; vp /= 10; vm /= 10;
+			removed += 1;
+		}
 
-inline
-bool si_stringHasPrefix(siString str, siString prefix) {
-	return str.len >= prefix.len && (si_memcompareStr(str.data, prefix) == 0);
-}
+		if (vmIsTrailingZeros) {
+			while (vm % 10 == 0) {
+				vrIsTrailingZeros &= (lastRemovedDigit == 0);
+				lastRemovedDigit = (u8)(vr % 10);
+				vr /= 10; vp /= 10; vm /= 10;
+				removed += 1;
+			}
+		}
 
-SIDEF
-isize si_stringPrefixLen(siString str, siString prefix) {
-	SI_STOPIF(prefix.len > str.len, return 0);
+		if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+			/* NOTE(EimaMei): Round to even if the exact number is .....50..0. */
+			lastRemovedDigit = 4;
+		}
+		output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+	}
+	else {
+		bool roundUp = false;
+		if (vp / 100 > vm / 100) {
+			roundUp = (vr % 100) >= 50;
+			vr /= 100; vp /= 100; vm /= 100;
+			removed += 2;
+		}
 
-	isize count = 0;
-	for_range (i, 0, str.len) {
-		if (str.data[i] == prefix.data[count]) {
-			count += 1;
-			continue;
+		while (vp / 10 > vm / 10) {
+			roundUp = (vr % 10) >= 5;
+			vr /= 10; vp /= 10; vm /= 10;
+			removed += 1;
 		}
-		break;
+		output = vr + (vr == vm || roundUp);
 	}
 
-	return count;
+	si__floatDecimal res;
+	res.digits = output;
+	res.exponent = e10 + removed;
+	return res;
 }
 
-inline
-bool si_stringHasSuffix(siString str, siString suffix) {
-	return str.len >= suffix.len
-		&& (si_memcompareStr(&str.data[str.len - suffix.len], suffix) == 0);
-}
-SIDEF
-isize si_stringSuffixLen(siString str, siString suffix) {
-	SI_ASSERT_STR(str);
-	SI_ASSERT_STR(suffix);
-	SI_STOPIF(suffix.len > str.len, return 0);
+siIntern
+si__floatDecimal si__ryuF32(u32 ieeeMantissa, u32 ieeeExponent) {
+	i32 e2;
+	u32 m2;
+	if (ieeeExponent == 0) {
+		e2 = 1 - 127 - 23 - 2;
+		m2 = ieeeMantissa;
+	}
+	else {
+		e2 = (i32)ieeeExponent - 127 - 23 - 2;
+		m2 = (u32)SI_BIT(23) | ieeeMantissa;
+	}
+	bool acceptBounds = (m2 & 1) == 0;
+
+	u32 mv = 4 * m2, mp = 4 * m2 + 2;
+	u32 mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1);
+	u32 mm = 4 * m2 - 1 - mmShift;
+
+	u32 vr, vp, vm;
+	i32 e10;
+	bool vmIsTrailingZeros = false, vrIsTrailingZeros = false;
+	u8 lastRemovedDigit = 0;
+	u64 pow5[2];
+
+	/* NOTE(EimaMei): The upper 64 bits of the 64-bit float tables are precise
+	 * enough for 32-bit floats, the inverse ones just need their '+ 1' back. */
+	if (e2 >= 0) {
+		u32 q = si__ryuLog10Pow2(e2);
+		e10 = (i32)q;
+		i32 k = (SI__RYU_POW5_INV_BITCOUNT - 64) + si__ryuPow5Bits((i32)q) - 1;
+		i32 i = -e2 + (i32)q + k;
+
+		si__ryuInvPow5(q, pow5);
+		vr = si__ryuMulShift32(mv, pow5[1] + 1, i);
+		vp = si__ryuMulShift32(mp, pow5[1] + 1, i);
+		vm = si__ryuMulShift32(mm, pow5[1] + 1, i);
+
+		if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+			/* NOTE(EimaMei): One removed digit is needed even if the loop below
+			 * doesn't run. */
+			i32 l = (SI__RYU_POW5_INV_BITCOUNT - 64) + si__ryuPow5Bits((i32)q - 1) - 1;
+			si__ryuInvPow5(q - 1, pow5);
+			lastRemovedDigit = (u8)(si__ryuMulShift32(mv, pow5[1] + 1, -e2 + (i32)q - 1 + l) % 10);
+		}
 
-	isize count = suffix.len - 1;
-	isize i;
-	for (i = str.len - 1; i >= 0; i -= 1) {
-		if (str.data[i] == suffix.data[count]) {
-			count -= 1;
-			continue;
+		if (q <= 9) {
+			if (mv % 5 == 0) {
+				vrIsTrailingZeros = si__ryuMultipleOfPow5(mv, q);
+			}
+			else if (acceptBounds) {
+				vmIsTrailingZeros = si__ryuMultipleOfPow5(mm, q);
+			}
+			else {
+				vp -= si__ryuMultipleOfPow5(mp, q);
+			}
 		}
-		break;
 	}
+	else {
+		u32 q = si__ryuLog10Pow5(-e2);
+		e10 = (i32)q + e2;
+		i32 i = -e2 - (i32)q;
+		i32 k = si__ryuPow5Bits(i) - (SI__RYU_POW5_BITCOUNT - 64);
+		i32 j = (i32)q - k;
+
+		si__ryuPow5((u32)i, pow5);
+		vr = si__ryuMulShift32(mv, pow5[1], j);
+		vp = si__ryuMulShift32(mp, pow5[1], j);
+		vm = si__ryuMulShift32(mm, pow5[1], j);
+
+		if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+			j = (i32)q - 1 - (si__ryuPow5Bits(i + 1) - (SI__RYU_POW5_BITCOUNT - 64));
+			si__ryuPow5((u32)i + 1, pow5);
+			lastRemovedDigit = (u8)(si__ryuMulShift32(mv, pow5[1], j) % 10);
+		}
 
-	return (suffix.len - count) + 1;
-}
+		if (q <= 1) {
+			vrIsTrailingZeros = true;
+			if (acceptBounds) {
+				vmIsTrailingZeros = (mmShift == 1);
+			}
+			else {
+				vp -= 1;
+			}
+		}
+		else if (q < 31) {
+			vrIsTrailingZeros = si__ryuMultipleOfPow2(mv, q - 1);
+		}
+	}
 
+	i32 removed = 0;
+	u32 output;
 
-SIDEF
-siString si_stringFromArray(siArrayAny buffer, cstring fmt, siArray(u8) out) {
-	SI_ASSERT_ARR(buffer);
-	SI_ASSERT_NOT_NIL(fmt);
-	SI_ASSERT_ARR_TYPE(out, u8);
-	SI_STOPIF(out.len < 2, return SI_STR_EMPTY);
+	if (SI_UNLIKELY(vmIsTrailingZeros || vrIsTrailingZeros)) {
+		while (vp / 10 > vm / 10) {
+			vmIsTrailingZeros &= (vm % 10 == 0);
+			vrIsTrailingZeros &= (lastRemovedDigit == 0);
+			lastRemovedDigit = (u8)(vr % 10);
+			vr /= 10; vp /= 10; vm /= 10;
+			removed += 1;
+		}
 
-	isize argCount = 0;
-	isize fmtLen = 0;
-	i32 sizes[256] = {0};
-	isize indexes[256];
+		if (vmIsTrailingZeros) {
+			while (vm % 10 == 0) {
+				vrIsTrailingZeros &= (lastRemovedDigit == 0);
+				lastRemovedDigit = (u8)(vr % 10);
+				vr /= 10; vp /= 10; vm /= 10;
+				removed += 1;
+			}
+		}
 
-	{
-		indexes[argCount] = 0;
-		argCount += 1;
+		if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+			lastRemovedDigit = 4;
+		}
+		output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+	}
+	else {
+		while (vp / 10 > vm / 10) {
+			lastRemovedDigit = (u8)(vr % 10);
+			vr /= 10; vp /= 10; vm /= 10;
+			removed += 1;
+		}
+		output = vr + (vr == vm || lastRemovedDigit >= 5);
+	}
 
-		while (fmt[fmtLen] != '\0') {
-			SI_STOPIF(fmt[fmtLen] != '%', fmtLen += 1; continue);
+	si__floatDecimal res;
+	res.digits = output;
+	res.exponent = e10 + removed;
+	return res;
+}
 
-			indexes[argCount] = fmtLen;
-			i32* size = &sizes[argCount];
-back:
-			fmtLen += 1;
-			switch (fmt[fmtLen]) {
-				case 'C': SI_PANIC();
+#undef SI__RYU_POW5_BITCOUNT
+#undef SI__RYU_POW5_INV_BITCOUNT
+#undef SI__RYU_POW5_TABLE_SIZE
 
-				case 'h': {
-					if (*size == 0) {
-						if (fmt[fmtLen + 1]== 'h') {
-							fmtLen += 1;
-							*size = si_sizeof(u8);
-						}
-						else {
-							*size = si_sizeof(u16);
-						}
-					}
 
-					goto back;
-				}
+/* The decimal digits of a float, its value being '0.digits * 10^point'. A length
+ * of zero means that the value is zero. */
+typedef struct si__floatDigits {
+	u8* data;
+	i32 len;
+	i32 point;
+	b32 isNegative;
+} si__floatDigits;
 
-				case 'l': {
-					if (*size == 0) {
-						SI_STOPIF(fmt[fmtLen + 1] == 'l', fmtLen += 1);
-						*size = si_sizeof(u64);
-					}
-					goto back;
-				}
+siIntern
+void si__floatDigitsFromDecimal(si__floatDecimal dec, b32 isNegative, si__floatDigits* out) {
+	out->isNegative = isNegative;
+	SI_STOPIF(dec.digits == 0, out->len = 0; out->point = 1; return);
 
-				case 'z':
-					SI_STOPIF(*size == 0, *size = si_sizeof(usize));
-					goto back;
+	u8 tmp[20];
+	i32 len = 0;
+	do {
+		tmp[len] = (u8)('0' + dec.digits % 10);
+		dec.digits /= 10;
+		len += 1;
+	} while (dec.digits != 0);
 
-				case 'j':
-					SI_STOPIF(*size == 0, *size = 8);
-					goto back;
+	for_range (i, 0, len) {
+		out->data[i] = tmp[len - 1 - i];
+	}
+	out->len = len;
+	out->point = len + dec.exponent;
+}
 
-				case 'f': case 'F': case 'a': case 'A': case 'e': case 'E': case 'g': case 'G':
-					SI_STOPIF(*size == 0, *size = si_sizeof(f64));
-					break;
+siIntern
+void si__floatDigitsMake(f64 num, u8 buffer[20], si__floatDigits* out) {
+	union { f64 f; u64 n; } bits = {num};
+	u64 mantissa = bits.n & (SI_BIT(52) - 1);
+	u32 exponent = (u32)(bits.n >> 52) & 0x7FF;
+
+	si__floatDecimal dec = {0, 0};
+	if (mantissa != 0 || exponent != 0) {
+		dec = si__ryuF64(mantissa, exponent);
+	}
+	out->data = buffer;
+	si__floatDigitsFromDecimal(dec, (b32)(bits.n >> 63), out);
+}
 
-				case 'S': case 'p':
-					SI_STOPIF(*size == 0, *size = si_sizeof(void*));
-					break;
+siIntern
+void si__floatDigitsMake32(f32 num, u8 buffer[20], si__floatDigits* out) {
+	union { f32 f; u32 n; } bits = {num};
+	u32 mantissa = bits.n & ((u32)SI_BIT(23) - 1);
+	u32 exponent = (bits.n >> 23) & 0xFF;
+
+	si__floatDecimal dec = {0, 0};
+	if (mantissa != 0 || exponent != 0) {
+		dec = si__ryuF32(mantissa, exponent);
+	}
+	out->data = buffer;
+	si__floatDigitsFromDecimal(dec, (b32)(bits.n >> 31), out);
+}
 
-				case 'x': case 'X': case 'i': case 'O': case 'o': case 'b': case 't':
-				case 'u': case 'd':
-					SI_STOPIF(*size == 0, *size = si_sizeof(u32));
-					break;
+/* Rounds the digits (half to even) to keep only 'count' significant digits.
+ * 'sticky' tells if the exact value has nonzero digits past the given ones. */
+siIntern
+void si__floatDigitsRound(si__floatDigits* d, i32 count, b32 sticky) {
+	SI_STOPIF(count >= d->len, return);
+	SI_STOPIF(count < 0, d->len = 0; return);
+
+	bool roundUp = d->data[count] > '5';
+	if (d->data[count] == '5') {
+		for_range (i, count + 1, d->len) {
+			sticky |= (d->data[i] != '0');
+		}
+		roundUp = sticky || (count != 0 && (d->data[count - 1] - '0') % 2 == 1);
+	}
 
-				case 'c':
-					SI_STOPIF(*size == 0, *size = si_sizeof(siRune));
-					break;
+	d->len = count;
+	SI_STOPIF(!roundUp, return);
 
-				case 's':
-					SI_STOPIF(*size == 0, *size = si_sizeof(siString));
-					break;
-
-				case 'L':
-					SI_STOPIF(*size == 0, *size = si_sizeof(siCallerLoc));
-					break;
+	i32 i = count - 1;
+	while (i >= 0 && d->data[i] == '9') {
+		i -= 1;
+	}
 
+	if (i < 0) {
+		d->data[0] = '1';
+		d->len = 1;
+		d->point += 1;
+	}
+	else {
+		d->data[i] += 1;
+		d->len = i + 1;
+	}
+}
 
-				case '%': case 'n':
-					*size = 0;
-					break;
+/* The most digits that a double's exact decimal expansion can have (767), with
+ * room for the rest of the last nine digit block. */
+#define SI__FLOAT_EXACT_MAX 776
+/* The 32-bit limbs needed for the biggest double or the longest fraction. */
+#define SI__FLOAT_EXACT_LIMBS 36
 
-				case '*': case '.': case '-': case '+': case ' ': case '0':
-				case '1': case '2': case '3': case '4': case '5': case '6':
-				case '7': case '8': case '9': case '#':
-					goto back;
+siIntern
+void si__floatDigitsPushBlock(si__floatDigits* d, u32 block) {
+	u32 div = 100000000;
+	for_range (i, 0, 9) {
+		u8 digit = (u8)(block / div);
+		block %= div;
+		div /= 10;
+
+		if (d->len != 0 || digit != 0) {
+			d->data[d->len] = (u8)('0' + digit);
+			d->len += 1;
+		}
+		else {
+			d->point -= 1;
+		}
+	}
+}
 
-				default: continue;
-			}
+/* Generates the exact decimal digits of the float, correctly rounded to 'count'
+ * decimals if 'isFixed' is set, otherwise to 'count' significant digits. The
+ * buffer must fit 'SI__FLOAT_EXACT_MAX' digits. */
+siIntern
+void si__floatDigitsExact(f64 num, i32 count, b32 isFixed, u8* buffer, si__floatDigits* out) {
+	union { f64 f; u64 n; } bits = {num};
+	u64 mantissa = bits.n & (SI_BIT(52) - 1);
+	i32 exponent = (i32)((bits.n >> 52) & 0x7FF);
+
+	out->data = buffer;
+	out->len = 0;
+	out->point = 1;
+	out->isNegative = (b32)(bits.n >> 63);
+	SI_STOPIF(mantissa == 0 && exponent == 0, return);
+
+	if (exponent != 0) { mantissa |= SI_BIT(52); }
+	else { exponent = 1; }
+	exponent -= 1075;
+
+	/* NOTE(EimaMei): The value is 'mantissa * 2^exponent'. Its integer part is
+	 * put into a big integer (least significant limb first) and turned into
+	 * decimal by dividing it with 10^9. The fraction is 'frac / 2^shift', which
+	 * gives nine digits each time it's multiplied by 10^9. */
+	u32 big[SI__FLOAT_EXACT_LIMBS];
+	u32 blocks[SI__FLOAT_EXACT_LIMBS];
+	i32 limbs, blockCount = 0;
+	i32 shift = (exponent < 0) ? -exponent : 0;
+
+	if (exponent >= 0) {
+		i32 offset = exponent / 32, bit = exponent % 32;
+		u32 lo = (u32)mantissa, hi = (u32)(mantissa >> 32);
+
+		for_range (i, 0, offset) { big[i] = 0; }
+		big[offset] = lo << bit;
+		big[offset + 1] = (hi << bit) | ((bit != 0) ? lo >> (32 - bit) : 0);
+		big[offset + 2] = (bit != 0) ? hi >> (32 - bit) : 0;
+		limbs = offset + 3;
+	}
+	else {
+		u64 intPart = (shift < 64) ? mantissa >> shift : 0;
+		big[0] = (u32)intPart;
+		big[1] = (u32)(intPart >> 32);
+		limbs = 2;
+	}
 
-			argCount += 1;
+	while (limbs != 0 && big[limbs - 1] == 0) { limbs -= 1; }
+	while (limbs != 0) {
+		u64 rem = 0;
+		for (i32 i = limbs - 1; i >= 0; i -= 1) {
+			u64 cur = (rem << 32) | big[i];
+			big[i] = (u32)(cur / 1000000000);
+			rem = cur % 1000000000;
 		}
-		SI_ASSERT_MSG(argCount <= countof(sizes), "The format str has surpassed the maximum amount of allowed modifiers.");
+		blocks[blockCount] = (u32)rem;
+		blockCount += 1;
+
+		while (limbs != 0 && big[limbs - 1] == 0) { limbs -= 1; }
 	}
 
-	si_arraySet(out, 0, "{");
-	isize length = 1;
+	out->point = 9 * blockCount;
+	for (i32 i = blockCount - 1; i >= 0; i -= 1) {
+		si__floatDigitsPushBlock(out, blocks[i]);
+	}
 
-	for_range (i, 0, buffer.len) {
+	if (exponent < 0) {
+		u64 frac = (shift < 64) ? mantissa & (SI_BIT(shift) - 1) : mantissa;
+		i32 top = shift / 32, bit = shift % 32;
 
-		isize baseLen = 0;
-		for_range (j, 0, argCount) {
-			i32 size = sizes[j];
-			isize index = indexes[j];
-			isize nextIndex = (j < argCount - 1 ? indexes[j + 1] : fmtLen);
+		big[0] = (u32)frac;
+		big[1] = (u32)(frac >> 32);
+		limbs = 2;
+		while (limbs != 0 && big[limbs - 1] == 0) { limbs -= 1; }
 
-			siString substr = SI_STR_LEN(&fmt[index], nextIndex - index);
-			void* base = (u8*)si_arrayGet(buffer, i) + baseLen;
-			baseLen += size;
+		while (limbs != 0 && out->len + 9 <= SI__FLOAT_EXACT_MAX) {
+			i32 need = (isFixed ? out->point + count : count) + 1;
+			SI_STOPIF(out->len >= need, break);
 
-			switch (size) {
-				case 0:  length += si_bprintf(si_sliceFrom(out, length), substr).len; break;
-				case si_sizeof(u8):  length += si_bprintf(si_sliceFrom(out, length), substr, *(u8*)base).len; break;
-				case si_sizeof(u16):  length += si_bprintf(si_sliceFrom(out, length), substr, *(u16*)base).len; break;
-				case si_sizeof(u32):  length += si_bprintf(si_sliceFrom(out, length), substr, *(u32*)base).len; break;
-				case si_sizeof(u64):  length += si_bprintf(si_sliceFrom(out, length), substr, *(u64*)base).len; break;
-				#if SI_ARCH_IS_64BIT
-				case si_sizeof(siString): length += si_bprintf(si_sliceFrom(out, length), substr, *(siString*)base).len; break;
-				#endif
-				case si_sizeof(siCallerLoc): length += si_bprintf(si_sliceFrom(out, length), substr, *(siCallerLoc*)base).len; break;
-				default: SI_PANIC();
+			u64 carry = 0;
+			for_range (i, 0, limbs) {
+				u64 cur = (u64)big[i] * 1000000000 + carry;
+				big[i] = (u32)cur;
+				carry = cur >> 32;
+			}
+			if (carry != 0) {
+				big[limbs] = (u32)carry;
+				limbs += 1;
 			}
-		}
 
-		if (i != buffer.len - 1) {
-			length += si_memcopyStr_s(si_sliceFrom(out, length), SI_STR(", "));
-		}
-		SI_STOPIF(length >= out.len, return SI_STR_LEN(out.data, length));
-	}
+			u64 window = (top < limbs) ? big[top] : 0;
+			if (top + 1 < limbs) { window |= (u64)big[top + 1] << 32; }
+			si__floatDigitsPushBlock(out, (u32)(window >> bit));
 
-	if (length < out.len) {
-		si_arraySet(out, length, "}");
-		length += 1;
+			SI_STOPIF(top >= limbs, continue);
+			big[top] &= (u32)SI_BIT(bit) - 1;
+			limbs = top + 1;
+			while (limbs != 0 && big[limbs - 1] == 0) { limbs -= 1; }
+		}
 	}
 
-	return SI_STR_LEN(out.data, length);
-}
-
-inline
-siOsString si_stringToOsStr(siString str, siArray(siOsChar) out) {
-	isize copied;
-	return si_stringToOsStrEx(str, out, &copied);
+	si__floatDigitsRound(out, isFixed ? out->point + count : count, limbs != 0);
+	SI_STOPIF(out->len == 0, out->point = 1);
 }
 
+typedef struct si__floatWriter {
+	u8* data;
+	isize len;
+	isize capacity;
+	/* NOTE(EimaMei): If set, the buffer gets passed to 'flush' whenever it fills
+	 * up instead of the output being truncated. */
+	void (*flush)(void* ctx, const u8* data, isize len);
+	void* ctx;
+} si__floatWriter;
 
-SIDEF
-siOsString si_stringToOsStrEx(siString str, siArray(siOsChar) out, isize* copied) {
-	SI_ASSERT(out.typeSize == si_sizeof(siOsChar));
-	SI_ASSERT_NOT_NIL(copied);
+force_inline
+void si__floatWriteByte(si__floatWriter* w, u8 x) {
+	if (w->len < w->capacity) {
+		w->data[w->len] = x;
+	}
+	else if (w->flush != nil) {
+		w->flush(w->ctx, w->data, w->len);
+		w->data[0] = x;
+		w->len = 0;
+	}
+	w->len += 1;
+}
 
-#ifdef SI_SYSTEM_IS_WINDOWS
-	SI_STOPIF(out.len == 0, *copied = -1; return nil);
+force_inline
+void si__floatWriteDigit(si__floatWriter* w, const si__floatDigits* d, i32 index) {
+	si__floatWriteByte(w, (index >= 0 && index < d->len) ? d->data[index] : (u8)'0');
+}
 
-	siUtf16String res = si_utf8ToUtf16StrEx(str, true, out);
-	*copied = res.len;
+siIntern
+void si__floatWriteExponent(si__floatWriter* w, i32 exponent, u8 letter) {
+	si__floatWriteByte(w, letter);
+	si__floatWriteByte(w, (exponent < 0) ? '-' : '+');
+	exponent = si_abs(i32, exponent);
 
-	return (siOsString)res.data;
+	if (exponent >= 100) {
+		si__floatWriteByte(w, (u8)('0' + exponent / 100));
+	}
+	si__floatWriteByte(w, (u8)('0' + exponent / 10 % 10));
+	si__floatWriteByte(w, (u8)('0' + exponent % 10));
+}
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	SI_STOPIF(out.len == 0, *copied = -1; return nil);
+/* Writes the digits (already rounded to 'afterPoint' decimals) in the
+ * '[-]ddd.ddd' form. */
+siIntern
+void si__floatWriteFixed(si__floatWriter* w, const si__floatDigits* d, i32 afterPoint) {
+	if (d->isNegative) { si__floatWriteByte(w, '-'); }
 
-	isize len = si_memcopyStr_s(si_sliceTo(out, out.len - 1), str);
-	*((u8*)out.data + len) = '\0';
-	*copied = len + 1;
+	if (d->point <= 0) {
+		si__floatWriteByte(w, '0');
+	}
+	else for_range (i, 0, d->point) {
+		si__floatWriteDigit(w, d, (i32)i);
+	}
 
-	return (siOsChar*)out.data;
+	SI_STOPIF(afterPoint == 0, return);
+	si__floatWriteByte(w, '.');
 
-#else
-	*copied = 0;
-	return (siOsString)str.data;
-#endif
+	for_range (i, 0, afterPoint) {
+		si__floatWriteDigit(w, d, d->point + (i32)i);
+	}
 }
 
-#endif /* SI_IMPLEMENTATION_STRING */
+/* Writes the digits (already rounded to 'precision + 1' significant digits) in
+ * the '[-]d.ddde+dd' form. */
+siIntern
+void si__floatWriteExp(si__floatWriter* w, const si__floatDigits* d, i32 precision, u8 letter) {
+	if (d->isNegative) { si__floatWriteByte(w, '-'); }
+
+	si__floatWriteDigit(w, d, 0);
+	if (precision != 0) {
+		si__floatWriteByte(w, '.');
+		for_range (i, 1, precision + 1) {
+			si__floatWriteDigit(w, d, (i32)i);
+		}
+	}
 
-#ifdef SI_IMPLEMENTATION_OPTIONAL
+	si__floatWriteExponent(w, (d->len != 0) ? d->point - 1 : 0, letter);
+}
 
-SIDEF
-siError si__errorDeclare(i32 error, siErrorProc proc, void* userData, siCallerLoc call) {
-	siError res;
-	res.code = error;
-#ifndef SI_NO_ERROR_STRUCT
-	res.time = si_timeNowUTC();
-	res.location = call;
-#else
-	SI_UNUSED(call);
-#endif
+/* Writes the digits (already rounded to 'precision' significant digits) like
+ * '%g' does, with the trailing zeros removed. */
+siIntern
+void si__floatWriteGeneral(si__floatWriter* w, si__floatDigits* d, i32 precision, u8 letter) {
+	while (d->len != 0 && d->data[d->len - 1] == '0') {
+		d->len -= 1;
+	}
 
-#ifndef SI_NO_ERROR_LOGS
-	if (proc != nil) {
-		bool status = proc(&res, userData);
-		SI_STOPIF(!status, si_exit(1));
+	i32 exponent = (d->len != 0) ? d->point - 1 : 0;
+	if (exponent >= -4 && exponent < precision) {
+		si__floatWriteFixed(w, d, si_max(i32, d->len - d->point, 0));
 	}
 	else {
-		siPrintColor red = si_printColor3bitEx(siPrintColor3bit_Red, true, false);
-		si_fprintf(
-			si_stderr, SI_STR("%CError at \"%L\"%C: Number '%i'.\n"),
-			red, res.location, res.code
-		);
+		si__floatWriteExp(w, d, si_max(i32, d->len - 1, 0), letter);
 	}
-#else
-	SI_UNUSED(proc); SI_UNUSED(userData);
-
-#endif
-
-	return res;
 }
 
-#endif /* SI_IMPLEMENTATION_OPTIONAL */
+/* Writes the digits like the '%f', '%e' and '%g' specifiers (or their uppercase
+ * versions) do. */
+siIntern
+void si__floatWriteSpecifier(si__floatWriter* w, si__floatDigits* d, i32 specifier, i32 precision) {
+	switch (specifier) {
+		case 'F': case 'f': si__floatWriteFixed(w, d, precision); break;
+		case 'E': case 'e': si__floatWriteExp(w, d, precision, (u8)specifier); break;
+		default: si__floatWriteGeneral(w, d, precision, (u8)('E' + (specifier - 'G'))); break;
+	}
+}
 
-#ifdef SI_IMPLEMENTATION_UNICODE
+/* Writes the shortest string that converts back into the same float. Numbers
+ * from 1e-6 to 1e21 are written out fully, the rest in scientific notation. */
+siIntern
+void si__floatWriteShortest(si__floatWriter* w, si__floatDigits d) {
+	if (d.isNegative) { si__floatWriteByte(w, '-'); }
+	SI_STOPIF(d.len == 0, si__floatWriteByte(w, '0'); return);
+
+	if (d.point > 21 || d.point <= -6) {
+		si__floatWriteByte(w, d.data[0]);
+		if (d.len > 1) {
+			si__floatWriteByte(w, '.');
+			for_range (i, 1, d.len) { si__floatWriteByte(w, d.data[i]); }
+		}
+		si__floatWriteExponent(w, d.point - 1, 'e');
+	}
+	else if (d.point <= 0) {
+		si__floatWriteByte(w, '0');
+		si__floatWriteByte(w, '.');
+		for_range (i, d.point, 0) { si__floatWriteByte(w, '0'); }
+		for_range (i, 0, d.len) { si__floatWriteByte(w, d.data[i]); }
+	}
+	else {
+		for_range (i, 0, d.point) { si__floatWriteDigit(w, &d, (i32)i); }
+		if (d.len > d.point) {
+			si__floatWriteByte(w, '.');
+			for_range (i, d.point, d.len) { si__floatWriteByte(w, d.data[i]); }
+		}
+	}
+}
 
-#define FAILURE 12
+/* Writes 'nan'/'inf'/'-inf' and returns true if the float is one of them. */
+siIntern
+bool si__floatWriteSpecial(si__floatWriter* w, f64 num) {
+	i32 isInf = si_float64IsInf(num);
+	siString str;
 
-SIDEF
-siUtf32Char si_utf8Decode(const u8* character) {
-	u32 state = 0;
-	i32 codepoint;
-	const u8* next = character;
+	if (isInf) {
+		str = (isInf == 1) ? SI_STR("inf") : SI_STR("-inf");
+	}
+	else if (si_float64IsNan(num)) {
+		str = SI_STR("nan");
+	}
+	else {
+		return false;
+	}
 
-	do {
-		/* Copyright (c) 2008-2010 Bjoern Hoehrmann <bjoern@hoehrmann.de> */
-		/* See http://bjoern.hoehrmann.de/utf-8/decoder/dfa/ for details. */
-		static const u8 utf8d[] = {
-			/* The first part of the table maps bytes to character classes that */
-			/* to reduce the size of the transition table and create bitmasks. */
-			0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-			0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-			0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-			0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-			1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,  9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-			7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,  7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-			8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-			10,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3, 11,6,6,6,5,8,8,8,8,8,8,8,8,8,8,8,
-			/* The second part is a transition table that maps a combination */
-			/* of a state of the automaton and a character class to a state. */
-			0,12,24,36,60,96,84,12,12,12,48,72, 12,12,12,12,12,12,12,12,12,12,12,12,
-			12, 0,12,12,12,12,12, 0,12, 0,12,12, 12,24,12,12,12,12,12,24,12,24,12,12,
-			12,12,12,12,12,12,12,24,12,12,12,12, 12,24,12,12,12,12,12,12,12,24,12,12,
-			12,12,12,12,12,12,12,36,12,36,12,12, 12,36,12,12,12,12,12,36,12,36,12,12,
-			12,36,12,12,12,12,12,12,12,12,12,12,
-		 };
+	for_range (i, 0, str.len) { si__floatWriteByte(w, str.data[i]); }
+	return true;
+}
 
-		u8 byte = *next;
-		u32 type = utf8d[byte];
 
-		codepoint = (state != 0)
-			? ((byte & 0x3F) | (codepoint << 6))
-			: ((0xFF >> type) & byte);
-		state = utf8d[256 + state + type];
+inline
+siString si_stringFromFloat(f64 num, siArray(u8) out) {
+	return si_stringFromFloatEx(num, 10, 6, out);
+}
 
-		next += 1;
-	} while (state != 0 && state != FAILURE);
+SIDEF
+siString si_stringFromFloatShortest(f64 num, siArray(u8) out) {
+	SI_ASSERT(out.typeSize == sizeof(u8));
 
-	if (state == FAILURE) {
-		return SI_UTF32_INVALID;
+	si__floatWriter w = {(u8*)out.data, 0, out.len, nil, nil};
+	if (!si__floatWriteSpecial(&w, num)) {
+		u8 buffer[20];
+		si__floatDigits digits;
+		si__floatDigitsMake(num, buffer, &digits);
+		si__floatWriteShortest(&w, digits);
 	}
 
-	siUtf32Char res;
-	res.codepoint = codepoint;
-	res.len = (i32)si_pointerDiff(character, next);
-
-	return res;
+	return SI_STR_LEN(out.data, si_min(isize, w.len, out.len));
 }
-#undef FAILURE
 
 SIDEF
-siUtf8Char si_utf8Encode(i32 codepoint) {
-	siUtf8Char res;
+siString si_stringFromFloat32Shortest(f32 num, siArray(u8) out) {
+	SI_ASSERT(out.typeSize == sizeof(u8));
 
-	if (codepoint <= 0x7F) {
-		res.codepoint[0] = (u8)codepoint;
-		res.len = 1;
-		return res;
-	}
-	else if (codepoint <= 0x7FF) {
-		res.codepoint[0] = (u8)(0xC0 | (codepoint >> 6));
-		res.codepoint[1] = (u8)(0x80 | (codepoint & 0x3F));
-		res.len = 2;
-	}
-	else if (codepoint <= 0xFFFF) {
-		if (si_between(i32, codepoint, 0xD800, 0xDFFF)) {
-			return SI_UTF8_INVALID;
-		}
-		res.codepoint[0] = (u8)(0xE0 | (codepoint >> 12));
-		res.codepoint[1] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));
-		res.codepoint[2] = (u8)(0x80 | (codepoint & 0x3F));
-		res.len = 3;
-	}
-	else if (codepoint <= 0x10FFFF) {
-		res.codepoint[0] = (u8)(0xF0 | (codepoint >> 18));
-		res.codepoint[1] = (u8)(0x80 | ((codepoint >> 12) & 0x3F));
-		res.codepoint[2] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));
-		res.codepoint[3] = (u8)(0x80 | (codepoint & 0x3F));
-		res.len = 4;
+	si__floatWriter w = {(u8*)out.data, 0, out.len, nil, nil};
+	if (!si__floatWriteSpecial(&w, (f64)num)) {
+		u8 buffer[20];
+		si__floatDigits digits;
+		si__floatDigitsMake32(num, buffer, &digits);
+		si__floatWriteShortest(&w, digits);
 	}
-	else return SI_UTF8_INVALID;
-
-
-	return res;
-}
 
-inline
-siUtf16String si_utf8ToUtf16Str(siUtf8String str, siArray(u16) out) {
-	return si_utf8ToUtf16StrEx(str, false, out);
+	return SI_STR_LEN(out.data, si_min(isize, w.len, out.len));
 }
 
 SIDEF
-siUtf16String si_utf8ToUtf16StrEx(siUtf8String str, bool nullTerm, siArray(u16) out) {
-	SI_ASSERT_STR(str);
-	SI_ASSERT_ARR_TYPE(out, u16);
-	SI_STOPIF(str.len == 0 || out.len == 0, return SI_ARR_LEN((u16*)nil, 0));
+siString si_stringFromFloatEx(f64 num, i32 base, i32 afterPoint, siArray(u8) out) {
+	SI_ASSERT_NOT_NEG(afterPoint);
+	SI_ASSERT(si_between(i32, base, 2, SI_BASE_MAX));
 
-	isize capacity = out.len - (i32)(nullTerm & true);
-	u16* data = (u16*)out.data;
+	if (base == 10) {
+		si__floatWriter w = {(u8*)out.data, 0, out.len, nil, nil};
+		if (!si__floatWriteSpecial(&w, num)) {
+			u8 buffer[SI__FLOAT_EXACT_MAX];
+			si__floatDigits digits;
+			si__floatDigitsExact(num, afterPoint, true, buffer, &digits);
+			si__floatWriteFixed(&w, &digits, afterPoint);
+		}
 
-	isize inpI = 0, outI = 0;
-	while (inpI < str.len && outI < capacity) {
-		siUtf32Char utf32 = si_utf8Decode(&str.data[inpI]);
-
-		i32 codepoint = utf32.codepoint;
-		inpI += utf32.len;
+		return SI_STR_LEN(out.data, si_min(isize, w.len, out.len));
+	}
 
-		if (codepoint == 0) {
-			break;
-		}
-		else if (codepoint < 0xFFFF) {
-			data[outI] = (u16)codepoint;
-			outI += 1;
+	/* TODO(EimaMei): Rework the non-decimal bases to be more like si__stringFromBits. */
+	{
+		i32 isInf = si_float64IsInf(num);
+		if (isInf) {
+			siString str = (isInf == 1) ? SI_STR("inf") : SI_STR("-inf");
+			isize len = si_memcopyStr_s(out, str);
+			return SI_STR_LEN(out.data, len);
 		}
-		else {
-			i32 t = codepoint - 0x10000;
-			data[outI + 0] = (u16)((t << 10) + 0xD800),
-			data[outI + 1] = (u16)(t + 0xDC00);
-			outI += 2;
+		else if (si_float64IsNan(num)) {
+			isize len = si_memcopyStr_s(out, SI_STR("nan"));
+			return SI_STR_LEN(out.data, len);
 		}
 	}
 
-	if (nullTerm) {
-		data[outI] = '\0';
-		outI+= 1;
+	i32 isNegative;
+	{
+		union { f64 f; u64 n; } check = {num};
+		isNegative = (i32)(check.n >> 63) & 1;
+	   	check.n &= ~SI_BIT(63); /* NOTE(EimaMei): A quick way of changing the minus to plus. */
+		num = check.f;
 	}
 
-	return SI_ARR_LEN(data, outI);
-}
+	isize baseLen = 0;
+	f64 numWhole = (afterPoint != 0)
+		? num
+		: si_round(f64, num);
+	do {
+		numWhole /= base;
+		baseLen += 1;
+	} while (numWhole > 0.9999999999999999f); /* NOTE(EimaMei): How long can this be?? */
 
-inline
-siUtf8String si_utf16ToUtf8Str(siUtf16String str, siArray(u8) out) {
-	return si_utf16ToUtf8StrEx(str, false, out);
-}
 
-SIDEF
-siUtf8String si_utf16ToUtf8StrEx(siUtf16String str, bool nullTerm, siArray(u8) out) {
-	SI_ASSERT_ARR_TYPE(str, u16);
-	SI_ASSERT_ARR_TYPE(out, u8);
-	SI_STOPIF(str.len == 0 || out.len == 0, return SI_STR_EMPTY);
+	isize len = isNegative + baseLen + (afterPoint != 0) + afterPoint;
+	isize i = 0;
+	u8* res = (u8*)out.data;
 
-	isize capacity = out.len - (i32)(nullTerm & true);
-	isize inpI = 0, outI = 0;
-	u8* data = (u8*)out.data;
+	if (isNegative) {
+		res[i] = '-';
+		i += 1;
+	}
 
-	while (inpI < str.len) {
-		siUtf8Char utf8 = si_utf16Encode((u16*)si_arrayGet(str, inpI));
-		if (outI + utf8.len > capacity || utf8.codepoint[0] == '\0') {
-			break;
-		}
+	i32 digit;
+	do {
+		numWhole *= base;
+		digit = (i32)numWhole;
+		numWhole -= digit;
 
-		outI += si_memcopy(&data[outI], utf8.codepoint, utf8.len);
-		inpI += 1 + (utf8.len == 4);
-	}
+		res[i] = SI_NUM_TO_CHAR_TABLE[(u32)digit % (u32)base];
+		i += 1;
 
-	if (nullTerm) {
-		data[outI] = '\0';
-		outI += 1;
+		baseLen -= 1;
+	} while (baseLen > 0);
+
+	if (afterPoint == 0) {
+		return SI_STR_LEN(res, len);
 	}
 
-	return SI_STR_LEN(data, outI);
-}
+	res[i] = '.';
+	i += 1;
 
-SIDEF
-isize si_utf16ToUtf8StrLen(siUtf16String str) {
-	SI_ASSERT_ARR_TYPE(str, u16);
+	f64 rounder = 5.0 / base;
+	for_range (j, 0, afterPoint) { rounder /= base; }
 
-	isize count = 0;
-	isize i = 0;
+	num += rounder;
+	while (afterPoint) {
+		num *= base;
 
-	while (i < str.len) {
-		siUtf32Char character = si_utf16Decode((u16*)si_arrayGet(str, i));
-		count += character.len;
-		i += 1 + (character.len == 4);
+		u64 numInt = (u64)num;
+		res[i] = SI_NUM_TO_CHAR_TABLE[numInt % (u64)base];
+		i += 1;
+
+		afterPoint -= 1;
+		num -= (f64)numInt;
 	}
 
-	return count;
+	return SI_STR_LEN(res, len);
 }
 
-SIDEF
-siUtf32Char si_utf16Decode(const u16 character[2]) {
-	siUtf32Char res;
-	i32 chr = character[0];
+/* NOTE(EimaMei): The string to float conversion first tries the classic fast
+ * path (the mantissa and the power of 10 are both exact doubles), then the
+ * Eisel-Lemire algorithm (Daniel Lemire, 2021), which works out the result from
+ * a 128-bit truncated power of 5. The algorithm always succeeds for 19 digits
+ * or less, the only uncertain case are longer inputs where the truncated
+ * mantissa 'w' and 'w + 1' round differently. That case falls back to a slow
+ * but exact big decimal conversion. */
+#define SI__FLOAT_POW5_MIN -342
+#define SI__FLOAT_POW5_MAX 308
+
+siIntern const u64 SI__FLOAT_POW5_128[SI__FLOAT_POW5_MAX - SI__FLOAT_POW5_MIN + 1][2] = {
+	{0xEEF453D6923BD65A, 0x113FAA2906A13B3F}, {0x9558B4661B6565F8, 0x4AC7CA59A424C507},
+	{0xBAAEE17FA23EBF76, 0x5D79BCF00D2DF649}, {0xE95A99DF8ACE6F53, 0xF4D82C2C107973DC},
+	{0x91D8A02BB6C10594, 0x79071B9B8A4BE869}, {0xB64EC836A47146F9, 0x9748E2826CDEE284},
+	{0xE3E27A444D8D98B7, 0xFD1B1B2308169B25}, {0x8E6D8C6AB0787F72, 0xFE30F0F5E50E20F7},
+	{0xB208EF855C969F4F, 0xBDBD2D335E51A935}, {0xDE8B2B66B3BC4723, 0xAD2C788035E61382},
+	{0x8B16FB203055AC76, 0x4C3BCB5021AFCC31}, {0xADDCB9E83C6B1793, 0xDF4ABE242A1BBF3D},
+	{0xD953E8624B85DD78, 0xD71D6DAD34A2AF0D}, {0x87D4713D6F33AA6B, 0x8672648C40E5AD68},
+	{0xA9C98D8CCB009506, 0x680EFDAF511F18C2}, {0xD43BF0EFFDC0BA48, 0x0212BD1B2566DEF2},
+	{0x84A57695FE98746D, 0x014BB630F7604B57}, {0xA5CED43B7E3E9188, 0x419EA3BD35385E2D},
+	{0xCF42894A5DCE35EA, 0x52064CAC828675B9}, {0x818995CE7AA0E1B2, 0x7343EFEBD1940993},
+	{0xA1EBFB4219491A1F, 0x1014EBE6C5F90BF8}, {0xCA66FA129F9B60A6, 0xD41A26E077774EF6},
+	{0xFD00B897478238D0, 0x8920B098955522B4}, {0x9E20735E8CB16382, 0x55B46E5F5D5535B0},
+	{0xC5A890362FDDBC62, 0xEB2189F734AA831D}, {0xF712B443BBD52B7B, 0xA5E9EC7501D523E4},
+	{0x9A6BB0AA55653B2D, 0x47B233C92125366E}, {0xC1069CD4EABE89F8, 0x999EC0BB696E840A},
+	{0xF148440A256E2C76, 0xC00670EA43CA250D}, {0x96CD2A865764DBCA, 0x380406926A5E5728},
+	{0xBC807527ED3E12BC, 0xC605083704F5ECF2}, {0xEBA09271E88D976B, 0xF7864A44C633682E},
+	{0x93445B8731587EA3, 0x7AB3EE6AFBE0211D}, {0xB8157268FDAE9E4C, 0x5960EA05BAD82964},
+	{0xE61ACF033D1A45DF, 0x6FB92487298E33BD}, {0x8FD0C16206306BAB, 0xA5D3B6D479F8E056},
+	{0xB3C4F1BA87BC8696, 0x8F48A4899877186C}, {0xE0B62E2929ABA83C, 0x331ACDABFE94DE87},
+	{0x8C71DCD9BA0B4925, 0x9FF0C08B7F1D0B14}, {0xAF8E5410288E1B6F, 0x07ECF0AE5EE44DD9},
+	{0xDB71E91432B1A24A, 0xC9E82CD9F69D6150}, {0x892731AC9FAF056E, 0xBE311C083A225CD2},
+	{0xAB70FE17C79AC6CA, 0x6DBD630A48AAF406}, {0xD64D3D9DB981787D, 0x092CBBCCDAD5B108},
+	{0x85F0468293F0EB4E, 0x25BBF56008C58EA5}, {0xA76C582338ED2621, 0xAF2AF2B80AF6F24E},
+	{0xD1476E2C07286FAA, 0x1AF5AF660DB4AEE1}, {0x82CCA4DB847945CA, 0x50D98D9FC890ED4D},
+	{0xA37FCE126597973C, 0xE50FF107BAB528A0}, {0xCC5FC196FEFD7D0C, 0x1E53ED49A96272C8},
+	{0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7A}, {0x9FAACF3DF73609B1, 0x77B191618C54E9AC},
+	{0xC795830D75038C1D, 0xD59DF5B9EF6A2417}, {0xF97AE3D0D2446F25, 0x4B0573286B44AD1D},
+	{0x9BECCE62836AC577, 0x4EE367F9430AEC32}, {0xC2E801FB244576D5, 0x229C41F793CDA73F},
+	{0xF3A20279ED56D48A, 0x6B43527578C1110F}, {0x9845418C345644D6, 0x830A13896B78AAA9},
+	{0xBE5691EF416BD60C, 0x23CC986BC656D553}, {0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA8},
+	{0x94B3A202EB1C3F39, 0x7BF7D71432F3D6A9}, {0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC53},
+	{0xE858AD248F5C22C9, 0xD1B3400F8F9CFF68}, {0x91376C36D99995BE, 0x23100809B9C21FA1},
+	{0xB58547448FFFFB2D, 0xABD40A0C2832A78A}, {0xE2E69915B3FFF9F9, 0x16C90C8F323F516C},
+	{0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E3}, {0xB1442798F49FFB4A, 0x99CD11CFDF41779C},
+	{0xDD95317F31C7FA1D, 0x40405643D711D583}, {0x8A7D3EEF7F1CFC52, 0x482835EA666B2572},
+	{0xAD1C8EAB5EE43B66, 0xDA3243650005EECF}, {0xD863B256369D4A40, 0x90BED43E40076A82},
+	{0x873E4F75E2224E68, 0x5A7744A6E804A291}, {0xA90DE3535AAAE202, 0x711515D0A205CB36},
+	{0xD3515C2831559A83, 0x0D5A5B44CA873E03}, {0x8412D9991ED58091, 0xE858790AFE9486C2},
+	{0xA5178FFF668AE0B6, 0x626E974DBE39A872}, {0xCE5D73FF402D98E3, 0xFB0A3D212DC8128F},
+	{0x80FA687F881C7F8E, 0x7CE66634BC9D0B99}, {0xA139029F6A239F72, 0x1C1FFFC1EBC44E80},
+	{0xC987434744AC874E, 0xA327FFB266B56220}, {0xFBE9141915D7A922, 0x4BF1FF9F0062BAA8},
+	{0x9D71AC8FADA6C9B5, 0x6F773FC3603DB4A9}, {0xC4CE17B399107C22, 0xCB550FB4384D21D3},
+	{0xF6019DA07F549B2B, 0x7E2A53A146606A48}, {0x99C102844F94E0FB, 0x2EDA7444CBFC426D},
+	{0xC0314325637A1939, 0xFA911155FEFB5308}, {0xF03D93EEBC589F88, 0x793555AB7EBA27CA},
+	{0x96267C7535B763B5, 0x4BC1558B2F3458DE}, {0xBBB01B9283253CA2, 0x9EB1AAEDFB016F16},
+	{0xEA9C227723EE8BCB, 0x465E15A979C1CADC}, {0x92A1958A7675175F, 0x0BFACD89EC191EC9},
+	{0xB749FAED14125D36, 0xCEF980EC671F667B}, {0xE51C79A85916F484, 0x82B7E12780E7401A},
+	{0x8F31CC0937AE58D2, 0xD1B2ECB8B0908810}, {0xB2FE3F0B8599EF07, 0x861FA7E6DCB4AA15},
+	{0xDFBDCECE67006AC9, 0x67A791E093E1D49A}, {0x8BD6A141006042BD, 0xE0C8BB2C5C6D24E0},
+	{0xAECC49914078536D, 0x58FAE9F773886E18}, {0xDA7F5BF590966848, 0xAF39A475506A899E},
+	{0x888F99797A5E012D, 0x6D8406C952429603}, {0xAAB37FD7D8F58178, 0xC8E5087BA6D33B83},
+	{0xD5605FCDCF32E1D6, 0xFB1E4A9A90880A64}, {0x855C3BE0A17FCD26, 0x5CF2EEA09A55067F},
+	{0xA6B34AD8C9DFC06F, 0xF42FAA48C0EA481E}, {0xD0601D8EFC57B08B, 0xF13B94DAF124DA26},
+	{0x823C12795DB6CE57, 0x76C53D08D6B70858}, {0xA2CB1717B52481ED, 0x54768C4B0C64CA6E},
+	{0xCB7DDCDDA26DA268, 0xA9942F5DCF7DFD09}, {0xFE5D54150B090B02, 0xD3F93B35435D7C4C},
+	{0x9EFA548D26E5A6E1, 0xC47BC5014A1A6DAF}, {0xC6B8E9B0709F109A, 0x359AB6419CA1091B},
+	{0xF867241C8CC6D4C0, 0xC30163D203C94B62}, {0x9B407691D7FC44F8, 0x79E0DE63425DCF1D},
+	{0xC21094364DFB5636, 0x985915FC12F542E4}, {0xF294B943E17A2BC4, 0x3E6F5B7B17B2939D},
+	{0x979CF3CA6CEC5B5A, 0xA705992CEECF9C42}, {0xBD8430BD08277231, 0x50C6FF782A838353},
+	{0xECE53CEC4A314EBD, 0xA4F8BF5635246428}, {0x940F4613AE5ED136, 0x871B7795E136BE99},
+	{0xB913179899F68584, 0x28E2557B59846E3F}, {0xE757DD7EC07426E5, 0x331AEADA2FE589CF},
+	{0x9096EA6F3848984F, 0x3FF0D2C85DEF7621}, {0xB4BCA50B065ABE63, 0x0FED077A756B53A9},
+	{0xE1EBCE4DC7F16DFB, 0xD3E8495912C62894}, {0x8D3360F09CF6E4BD, 0x64712DD7ABBBD95C},
+	{0xB080392CC4349DEC, 0xBD8D794D96AACFB3}, {0xDCA04777F541C567, 0xECF0D7A0FC5583A0},
+	{0x89E42CAAF9491B60, 0xF41686C49DB57244}, {0xAC5D37D5B79B6239, 0x311C2875C522CED5},
+	{0xD77485CB25823AC7, 0x7D633293366B828B}, {0x86A8D39EF77164BC, 0xAE5DFF9C02033197},
+	{0xA8530886B54DBDEB, 0xD9F57F830283FDFC}, {0xD267CAA862A12D66, 0xD072DF63C324FD7B},
+	{0x8380DEA93DA4BC60, 0x4247CB9E59F71E6D}, {0xA46116538D0DEB78, 0x52D9BE85F074E608},
+	{0xCD795BE870516656, 0x67902E276C921F8B}, {0x806BD9714632DFF6, 0x00BA1CD8A3DB53B6},
+	{0xA086CFCD97BF97F3, 0x80E8A40ECCD228A4}, {0xC8A883C0FDAF7DF0, 0x6122CD128006B2CD},
+	{0xFAD2A4B13D1B5D6C, 0x796B805720085F81}, {0x9CC3A6EEC6311A63, 0xCBE3303674053BB0},
+	{0xC3F490AA77BD60FC, 0xBEDBFC4411068A9C}, {0xF4F1B4D515ACB93B, 0xEE92FB5515482D44},
+	{0x991711052D8BF3C5, 0x751BDD152D4D1C4A}, {0xBF5CD54678EEF0B6, 0xD262D45A78A0635D},
+	{0xEF340A98172AACE4, 0x86FB897116C87C34}, {0x9580869F0E7AAC0E, 0xD45D35E6AE3D4DA0},
+	{0xBAE0A846D2195712, 0x8974836059CCA109}, {0xE998D258869FACD7, 0x2BD1A438703FC94B},
+	{0x91FF83775423CC06, 0x7B6306A34627DDCF}, {0xB67F6455292CBF08, 0x1A3BC84C17B1D542},
+	{0xE41F3D6A7377EECA, 0x20CABA5F1D9E4A93}, {0x8E938662882AF53E, 0x547EB47B7282EE9C},
+	{0xB23867FB2A35B28D, 0xE99E619A4F23AA43}, {0xDEC681F9F4C31F31, 0x6405FA00E2EC94D4},
+	{0x8B3C113C38F9F37E, 0xDE83BC408DD3DD04}, {0xAE0B158B4738705E, 0x9624AB50B148D445},
+	{0xD98DDAEE19068C76, 0x3BADD624DD9B0957}, {0x87F8A8D4CFA417C9, 0xE54CA5D70A80E5D6},
+	{0xA9F6D30A038D1DBC, 0x5E9FCF4CCD211F4C}, {0xD47487CC8470652B, 0x7647C3200069671F},
+	{0x84C8D4DFD2C63F3B, 0x29ECD9F40041E073}, {0xA5FB0A17C777CF09, 0xF468107100525890},
+	{0xCF79CC9DB955C2CC, 0x7182148D4066EEB4}, {0x81AC1FE293D599BF, 0xC6F14CD848405530},
+	{0xA21727DB38CB002F, 0xB8ADA00E5A506A7C}, {0xCA9CF1D206FDC03B, 0xA6D90811F0E4851C},
+	{0xFD442E4688BD304A, 0x908F4A166D1DA663}, {0x9E4A9CEC15763E2E, 0x9A598E4E043287FE},
+	{0xC5DD44271AD3CDBA, 0x40EFF1E1853F29FD}, {0xF7549530E188C128, 0xD12BEE59E68EF47C},
+	{0x9A94DD3E8CF578B9, 0x82BB74F8301958CE}, {0xC13A148E3032D6E7, 0xE36A52363C1FAF01},
+	{0xF18899B1BC3F8CA1, 0xDC44E6C3CB279AC1}, {0x96F5600F15A7B7E5, 0x29AB103A5EF8C0B9},
+	{0xBCB2B812DB11A5DE, 0x7415D448F6B6F0E7}, {0xEBDF661791D60F56, 0x111B495B3464AD21},
+	{0x936B9FCEBB25C995, 0xCAB10DD900BEEC34}, {0xB84687C269EF3BFB, 0x3D5D514F40EEA742},
+	{0xE65829B3046B0AFA, 0x0CB4A5A3112A5112}, {0x8FF71A0FE2C2E6DC, 0x47F0E785EABA72AB},
+	{0xB3F4E093DB73A093, 0x59ED216765690F56}, {0xE0F218B8D25088B8, 0x306869C13EC3532C},
+	{0x8C974F7383725573, 0x1E414218C73A13FB}, {0xAFBD2350644EEACF, 0xE5D1929EF90898FA},
+	{0xDBAC6C247D62A583, 0xDF45F746B74ABF39}, {0x894BC396CE5DA772, 0x6B8BBA8C328EB783},
+	{0xAB9EB47C81F5114F, 0x066EA92F3F326564}, {0xD686619BA27255A2, 0xC80A537B0EFEFEBD},
+	{0x8613FD0145877585, 0xBD06742CE95F5F36}, {0xA798FC4196E952E7, 0x2C48113823B73704},
+	{0xD17F3B51FCA3A7A0, 0xF75A15862CA504C5}, {0x82EF85133DE648C4, 0x9A984D73DBE722FB},
+	{0xA3AB66580D5FDAF5, 0xC13E60D0D2E0EBBA}, {0xCC963FEE10B7D1B3, 0x318DF905079926A8},
+	{0xFFBBCFE994E5C61F, 0xFDF17746497F7052}, {0x9FD561F1FD0F9BD3, 0xFEB6EA8BEDEFA633},
+	{0xC7CABA6E7C5382C8, 0xFE64A52EE96B8FC0}, {0xF9BD690A1B68637B, 0x3DFDCE7AA3C673B0},
+	{0x9C1661A651213E2D, 0x06BEA10CA65C084E}, {0xC31BFA0FE5698DB8, 0x486E494FCFF30A62},
+	{0xF3E2F893DEC3F126, 0x5A89DBA3C3EFCCFA}, {0x986DDB5C6B3A76B7, 0xF89629465A75E01C},
+	{0xBE89523386091465, 0xF6BBB397F1135823}, {0xEE2BA6C0678B597F, 0x746AA07DED582E2C},
+	{0x94DB483840B717EF, 0xA8C2A44EB4571CDC}, {0xBA121A4650E4DDEB, 0x92F34D62616CE413},
+	{0xE896A0D7E51E1566, 0x77B020BAF9C81D17}, {0x915E2486EF32CD60, 0x0ACE1474DC1D122E},
+	{0xB5B5ADA8AAFF80B8, 0x0D819992132456BA}, {0xE3231912D5BF60E6, 0x10E1FFF697ED6C69},
+	{0x8DF5EFABC5979C8F, 0xCA8D3FFA1EF463C1}, {0xB1736B96B6FD83B3, 0xBD308FF8A6B17CB2},
+	{0xDDD0467C64BCE4A0, 0xAC7CB3F6D05DDBDE}, {0x8AA22C0DBEF60EE4, 0x6BCDF07A423AA96B},
+	{0xAD4AB7112EB3929D, 0x86C16C98D2C953C6}, {0xD89D64D57A607744, 0xE871C7BF077BA8B7},
+	{0x87625F056C7C4A8B, 0x11471CD764AD4972}, {0xA93AF6C6C79B5D2D, 0xD598E40D3DD89BCF},
+	{0xD389B47879823479, 0x4AFF1D108D4EC2C3}, {0x843610CB4BF160CB, 0xCEDF722A585139BA},
+	{0xA54394FE1EEDB8FE, 0xC2974EB4EE658828}, {0xCE947A3DA6A9273E, 0x733D226229FEEA32},
+	{0x811CCC668829B887, 0x0806357D5A3F525F}, {0xA163FF802A3426A8, 0xCA07C2DCB0CF26F7},
+	{0xC9BCFF6034C13052, 0xFC89B393DD02F0B5}, {0xFC2C3F3841F17C67, 0xBBAC2078D443ACE2},
+	{0x9D9BA7832936EDC0, 0xD54B944B84AA4C0D}, {0xC5029163F384A931, 0x0A9E795E65D4DF11},
+	{0xF64335BCF065D37D, 0x4D4617B5FF4A16D5}, {0x99EA0196163FA42E, 0x504BCED1BF8E4E45},
+	{0xC06481FB9BCF8D39, 0xE45EC2862F71E1D6}, {0xF07DA27A82C37088, 0x5D767327BB4E5A4C},
+	{0x964E858C91BA2655, 0x3A6A07F8D510F86F}, {0xBBE226EFB628AFEA, 0x890489F70A55368B},
+	{0xEADAB0ABA3B2DBE5, 0x2B45AC74CCEA842E}, {0x92C8AE6B464FC96F, 0x3B0B8BC90012929D},
+	{0xB77ADA0617E3BBCB, 0x09CE6EBB40173744}, {0xE55990879DDCAABD, 0xCC420A6A101D0515},
+	{0x8F57FA54C2A9EAB6, 0x9FA946824A12232D}, {0xB32DF8E9F3546564, 0x47939822DC96ABF9},
+	{0xDFF9772470297EBD, 0x59787E2B93BC56F7}, {0x8BFBEA76C619EF36, 0x57EB4EDB3C55B65A},
+	{0xAEFAE51477A06B03, 0xEDE622920B6B23F1}, {0xDAB99E59958885C4, 0xE95FAB368E45ECED},
+	{0x88B402F7FD75539B, 0x11DBCB0218EBB414}, {0xAAE103B5FCD2A881, 0xD652BDC29F26A119},
+	{0xD59944A37C0752A2, 0x4BE76D3346F0495F}, {0x857FCAE62D8493A5, 0x6F70A4400C562DDB},
+	{0xA6DFBD9FB8E5B88E, 0xCB4CCD500F6BB952}, {0xD097AD07A71F26B2, 0x7E2000A41346A7A7},
+	{0x825ECC24C873782F, 0x8ED400668C0C28C8}, {0xA2F67F2DFA90563B, 0x728900802F0F32FA},
+	{0xCBB41EF979346BCA, 0x4F2B40A03AD2FFB9}, {0xFEA126B7D78186BC, 0xE2F610C84987BFA8},
+	{0x9F24B832E6B0F436, 0x0DD9CA7D2DF4D7C9}, {0xC6EDE63FA05D3143, 0x91503D1C79720DBB},
+	{0xF8A95FCF88747D94, 0x75A44C6397CE912A}, {0x9B69DBE1B548CE7C, 0xC986AFBE3EE11ABA},
+	{0xC24452DA229B021B, 0xFBE85BADCE996168}, {0xF2D56790AB41C2A2, 0xFAE27299423FB9C3},
+	{0x97C560BA6B0919A5, 0xDCCD879FC967D41A}, {0xBDB6B8E905CB600F, 0x5400E987BBC1C920},
+	{0xED246723473E3813, 0x290123E9AAB23B68}, {0x9436C0760C86E30B, 0xF9A0B6720AAF6521},
+	{0xB94470938FA89BCE, 0xF808E40E8D5B3E69}, {0xE7958CB87392C2C2, 0xB60B1D1230B20E04},
+	{0x90BD77F3483BB9B9, 0xB1C6F22B5E6F48C2}, {0xB4ECD5F01A4AA828, 0x1E38AEB6360B1AF3},
+	{0xE2280B6C20DD5232, 0x25C6DA63C38DE1B0}, {0x8D590723948A535F, 0x579C487E5A38AD0E},
+	{0xB0AF48EC79ACE837, 0x2D835A9DF0C6D851}, {0xDCDB1B2798182244, 0xF8E431456CF88E65},
+	{0x8A08F0F8BF0F156B, 0x1B8E9ECB641B58FF}, {0xAC8B2D36EED2DAC5, 0xE272467E3D222F3F},
+	{0xD7ADF884AA879177, 0x5B0ED81DCC6ABB0F}, {0x86CCBB52EA94BAEA, 0x98E947129FC2B4E9},
+	{0xA87FEA27A539E9A5, 0x3F2398D747B36224}, {0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD},
+	{0x83A3EEEEF9153E89, 0x1953CF68300424AC}, {0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7},
+	{0xCDB02555653131B6, 0x3792F412CB06794D}, {0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0},
+	{0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4}, {0xC8DE047564D20A8B, 0xF245825A5A445275},
+	{0xFB158592BE068D2E, 0xEED6E2F0F0D56712}, {0x9CED737BB6C4183D, 0x55464DD69685606B},
+	{0xC428D05AA4751E4C, 0xAA97E14C3C26B886}, {0xF53304714D9265DF, 0xD53DD99F4B3066A8},
+	{0x993FE2C6D07B7FAB, 0xE546A8038EFE4029}, {0xBF8FDB78849A5F96, 0xDE98520472BDD033},
+	{0xEF73D256A5C0F77C, 0x963E66858F6D4440}, {0x95A8637627989AAD, 0xDDE7001379A44AA8},
+	{0xBB127C53B17EC159, 0x5560C018580D5D52}, {0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6},
+	{0x9226712162AB070D, 0xCAB3961304CA70E8}, {0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22},
+	{0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A}, {0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242},
+	{0xB267ED1940F1C61C, 0x55F038B237591ED3}, {0xDF01E85F912E37A3, 0x6B6C46DEC52F6688},
+	{0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015}, {0xAE397D8AA96C1B77, 0xABEC975E0A0D081A},
+	{0xD9C7DCED53C72255, 0x96E7BD358C904A21}, {0x881CEA14545C7575, 0x7E50D64177DA2E54},
+	{0xAA242499697392D2, 0xDDE50BD1D5D0B9E9}, {0xD4AD2DBFC3D07787, 0x955E4EC64B44E864},
+	{0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E}, {0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E},
+	{0xCFB11EAD453994BA, 0x67DE18EDA5814AF2}, {0x81CEB32C4B43FCF4, 0x80EACF948770CED7},
+	{0xA2425FF75E14FC31, 0xA1258379A94D028D}, {0xCAD2F7F5359A3B3E, 0x096EE45813A04330},
+	{0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC}, {0x9E74D1B791E07E48, 0x775EA264CF55347E},
+	{0xC612062576589DDA, 0x95364AFE032A819E}, {0xF79687AED3EEC551, 0x3A83DDBD83F52205},
+	{0x9ABE14CD44753B52, 0xC4926A9672793543}, {0xC16D9A0095928A27, 0x75B7053C0F178294},
+	{0xF1C90080BAF72CB1, 0x5324C68B12DD6339}, {0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04},
+	{0xBCE5086492111AEA, 0x88F4BB1CA6BCF585}, {0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6},
+	{0x9392EE8E921D5D07, 0x3AFF322E62439FD0}, {0xB877AA3236A4B449, 0x09BEFEB9FAD487C3},
+	{0xE69594BEC44DE15B, 0x4C2EBE687989A9B4}, {0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11},
+	{0xB424DC35095CD80F, 0x538484C19EF38C95}, {0xE12E13424BB40E13, 0x2865A5F206B06FBA},
+	{0x8CBCCC096F5088CB, 0xF93F87B7442E45D4}, {0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749},
+	{0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C}, {0x89705F4136B4A597, 0x31680A88F8953031},
+	{0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E}, {0xD6BF94D5E57A42BC, 0x3D32907604691B4D},
+	{0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110}, {0xA7C5AC471B478423, 0x0FCF80DC33721D54},
+	{0xD1B71758E219652B, 0xD3C36113404EA4A9}, {0x83126E978D4FDF3B, 0x645A1CAC083126EA},
+	{0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4}, {0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD},
+	{0x8000000000000000, 0x0000000000000000}, {0xA000000000000000, 0x0000000000000000},
+	{0xC800000000000000, 0x0000000000000000}, {0xFA00000000000000, 0x0000000000000000},
+	{0x9C40000000000000, 0x0000000000000000}, {0xC350000000000000, 0x0000000000000000},
+	{0xF424000000000000, 0x0000000000000000}, {0x9896800000000000, 0x0000000000000000},
+	{0xBEBC200000000000, 0x0000000000000000}, {0xEE6B280000000000, 0x0000000000000000},
+	{0x9502F90000000000, 0x0000000000000000}, {0xBA43B74000000000, 0x0000000000000000},
+	{0xE8D4A51000000000, 0x0000000000000000}, {0x9184E72A00000000, 0x0000000000000000},
+	{0xB5E620F480000000, 0x0000000000000000}, {0xE35FA931A0000000, 0x0000000000000000},
+	{0x8E1BC9BF04000000, 0x0000000000000000}, {0xB1A2BC2EC5000000, 0x0000000000000000},
+	{0xDE0B6B3A76400000, 0x0000000000000000}, {0x8AC7230489E80000, 0x0000000000000000},
+	{0xAD78EBC5AC620000, 0x0000000000000000}, {0xD8D726B7177A8000, 0x0000000000000000},
+	{0x878678326EAC9000, 0x0000000000000000}, {0xA968163F0A57B400, 0x0000000000000000},
+	{0xD3C21BCECCEDA100, 0x0000000000000000}, {0x84595161401484A0, 0x0000000000000000},
+	{0xA56FA5B99019A5C8, 0x0000000000000000}, {0xCECB8F27F4200F3A, 0x0000000000000000},
+	{0x813F3978F8940984, 0x4000000000000000}, {0xA18F07D736B90BE5, 0x5000000000000000},
+	{0xC9F2C9CD04674EDE, 0xA400000000000000}, {0xFC6F7C4045812296, 0x4D00000000000000},
+	{0x9DC5ADA82B70B59D, 0xF020000000000000}, {0xC5371912364CE305, 0x6C28000000000000},
+	{0xF684DF56C3E01BC6, 0xC732000000000000}, {0x9A130B963A6C115C, 0x3C7F400000000000},
+	{0xC097CE7BC90715B3, 0x4B9F100000000000}, {0xF0BDC21ABB48DB20, 0x1E86D40000000000},
+	{0x96769950B50D88F4, 0x1314448000000000}, {0xBC143FA4E250EB31, 0x17D955A000000000},
+	{0xEB194F8E1AE525FD, 0x5DCFAB0800000000}, {0x92EFD1B8D0CF37BE, 0x5AA1CAE500000000},
+	{0xB7ABC627050305AD, 0xF14A3D9E40000000}, {0xE596B7B0C643C719, 0x6D9CCD05D0000000},
+	{0x8F7E32CE7BEA5C6F, 0xE4820023A2000000}, {0xB35DBF821AE4F38B, 0xDDA2802C8A800000},
+	{0xE0352F62A19E306E, 0xD50B2037AD200000}, {0x8C213D9DA502DE45, 0x4526F422CC340000},
+	{0xAF298D050E4395D6, 0x9670B12B7F410000}, {0xDAF3F04651D47B4C, 0x3C0CDD765F114000},
+	{0x88D8762BF324CD0F, 0xA5880A69FB6AC800}, {0xAB0E93B6EFEE0053, 0x8EEA0D047A457A00},
+	{0xD5D238A4ABE98068, 0x72A4904598D6D880}, {0x85A36366EB71F041, 0x47A6DA2B7F864750},
+	{0xA70C3C40A64E6C51, 0x999090B65F67D924}, {0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6D},
+	{0x82818F1281ED449F, 0xBFF8F10E7A8921A4}, {0xA321F2D7226895C7, 0xAFF72D52192B6A0D},
+	{0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764490}, {0xFEE50B7025C36A08, 0x02F236D04753D5B4},
+	{0x9F4F2726179A2245, 0x01D762422C946590}, {0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF5},
+	{0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB2}, {0x9B934C3B330C8577, 0x63CC55F49F88EB2F},
+	{0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FB}, {0xF316271C7FC3908A, 0x8BEF464E3945EF7A},
+	{0x97EDD871CFDA3A56, 0x97758BF0E3CBB5AC}, {0xBDE94E8E43D0C8EC, 0x3D52EEED1CBEA317},
+	{0xED63A231D4C4FB27, 0x4CA7AAA863EE4BDD}, {0x945E455F24FB1CF8, 0x8FE8CAA93E74EF6A},
+	{0xB975D6B6EE39E436, 0xB3E2FD538E122B44}, {0xE7D34C64A9C85D44, 0x60DBBCA87196B616},
+	{0x90E40FBEEA1D3A4A, 0xBC8955E946FE31CD}, {0xB51D13AEA4A488DD, 0x6BABAB6398BDBE41},
+	{0xE264589A4DCDAB14, 0xC696963C7EED2DD1}, {0x8D7EB76070A08AEC, 0xFC1E1DE5CF543CA2},
+	{0xB0DE65388CC8ADA8, 0x3B25A55F43294BCB}, {0xDD15FE86AFFAD912, 0x49EF0EB713F39EBE},
+	{0x8A2DBF142DFCC7AB, 0x6E3569326C784337}, {0xACB92ED9397BF996, 0x49C2C37F07965404},
+	{0xD7E77A8F87DAF7FB, 0xDC33745EC97BE906}, {0x86F0AC99B4E8DAFD, 0x69A028BB3DED71A3},
+	{0xA8ACD7C0222311BC, 0xC40832EA0D68CE0C}, {0xD2D80DB02AABD62B, 0xF50A3FA490C30190},
+	{0x83C7088E1AAB65DB, 0x792667C6DA79E0FA}, {0xA4B8CAB1A1563F52, 0x577001B891185938},
+	{0xCDE6FD5E09ABCF26, 0xED4C0226B55E6F86}, {0x80B05E5AC60B6178, 0x544F8158315B05B4},
+	{0xA0DC75F1778E39D6, 0x696361AE3DB1C721}, {0xC913936DD571C84C, 0x03BC3A19CD1E38E9},
+	{0xFB5878494ACE3A5F, 0x04AB48A04065C723}, {0x9D174B2DCEC0E47B, 0x62EB0D64283F9C76},
+	{0xC45D1DF942711D9A, 0x3BA5D0BD324F8394}, {0xF5746577930D6500, 0xCA8F44EC7EE36479},
+	{0x9968BF6ABBE85F20, 0x7E998B13CF4E1ECB}, {0xBFC2EF456AE276E8, 0x9E3FEDD8C321A67E},
+	{0xEFB3AB16C59B14A2, 0xC5CFE94EF3EA101E}, {0x95D04AEE3B80ECE5, 0xBBA1F1D158724A12},
+	{0xBB445DA9CA61281F, 0x2A8A6E45AE8EDC97}, {0xEA1575143CF97226, 0xF52D09D71A3293BD},
+	{0x924D692CA61BE758, 0x593C2626705F9C56}, {0xB6E0C377CFA2E12E, 0x6F8B2FB00C77836C},
+	{0xE498F455C38B997A, 0x0B6DFB9C0F956447}, {0x8EDF98B59A373FEC, 0x4724BD4189BD5EAC},
+	{0xB2977EE300C50FE7, 0x58EDEC91EC2CB657}, {0xDF3D5E9BC0F653E1, 0x2F2967B66737E3ED},
+	{0x8B865B215899F46C, 0xBD79E0D20082EE74}, {0xAE67F1E9AEC07187, 0xECD8590680A3AA11},
+	{0xDA01EE641A708DE9, 0xE80E6F4820CC9495}, {0x884134FE908658B2, 0x3109058D147FDCDD},
+	{0xAA51823E34A7EEDE, 0xBD4B46F0599FD415}, {0xD4E5E2CDC1D1EA96, 0x6C9E18AC7007C91A},
+	{0x850FADC09923329E, 0x03E2CF6BC604DDB0}, {0xA6539930BF6BFF45, 0x84DB8346B786151C},
+	{0xCFE87F7CEF46FF16, 0xE612641865679A63}, {0x81F14FAE158C5F6E, 0x4FCB7E8F3F60C07E},
+	{0xA26DA3999AEF7749, 0xE3BE5E330F38F09D}, {0xCB090C8001AB551C, 0x5CADF5BFD3072CC5},
+	{0xFDCB4FA002162A63, 0x73D9732FC7C8F7F6}, {0x9E9F11C4014DDA7E, 0x2867E7FDDCDD9AFA},
+	{0xC646D63501A1511D, 0xB281E1FD541501B8}, {0xF7D88BC24209A565, 0x1F225A7CA91A4226},
+	{0x9AE757596946075F, 0x3375788DE9B06958}, {0xC1A12D2FC3978937, 0x0052D6B1641C83AE},
+	{0xF209787BB47D6B84, 0xC0678C5DBD23A49A}, {0x9745EB4D50CE6332, 0xF840B7BA963646E0},
+	{0xBD176620A501FBFF, 0xB650E5A93BC3D898}, {0xEC5D3FA8CE427AFF, 0xA3E51F138AB4CEBE},
+	{0x93BA47C980E98CDF, 0xC66F336C36B10137}, {0xB8A8D9BBE123F017, 0xB80B0047445D4184},
+	{0xE6D3102AD96CEC1D, 0xA60DC059157491E5}, {0x9043EA1AC7E41392, 0x87C89837AD68DB2F},
+	{0xB454E4A179DD1877, 0x29BABE4598C311FB}, {0xE16A1DC9D8545E94, 0xF4296DD6FEF3D67A},
+	{0x8CE2529E2734BB1D, 0x1899E4A65F58660C}, {0xB01AE745B101E9E4, 0x5EC05DCFF72E7F8F},
+	{0xDC21A1171D42645D, 0x76707543F4FA1F73}, {0x899504AE72497EBA, 0x6A06494A791C53A8},
+	{0xABFA45DA0EDBDE69, 0x0487DB9D17636892}, {0xD6F8D7509292D603, 0x45A9D2845D3C42B6},
+	{0x865B86925B9BC5C2, 0x0B8A2392BA45A9B2}, {0xA7F26836F282B732, 0x8E6CAC7768D7141E},
+	{0xD1EF0244AF2364FF, 0x3207D795430CD926}, {0x8335616AED761F1F, 0x7F44E6BD49E807B8},
+	{0xA402B9C5A8D3A6E7, 0x5F16206C9C6209A6}, {0xCD036837130890A1, 0x36DBA887C37A8C0F},
+	{0x802221226BE55A64, 0xC2494954DA2C9789}, {0xA02AA96B06DEB0FD, 0xF2DB9BAA10B7BD6C},
+	{0xC83553C5C8965D3D, 0x6F92829494E5ACC7}, {0xFA42A8B73ABBF48C, 0xCB772339BA1F17F9},
+	{0x9C69A97284B578D7, 0xFF2A760414536EFB}, {0xC38413CF25E2D70D, 0xFEF5138519684ABA},
+	{0xF46518C2EF5B8CD1, 0x7EB258665FC25D69}, {0x98BF2F79D5993802, 0xEF2F773FFBD97A61},
+	{0xBEEEFB584AFF8603, 0xAAFB550FFACFD8FA}, {0xEEAABA2E5DBF6784, 0x95BA2A53F983CF38},
+	{0x952AB45CFA97A0B2, 0xDD945A747BF26183}, {0xBA756174393D88DF, 0x94F971119AEEF9E4},
+	{0xE912B9D1478CEB17, 0x7A37CD5601AAB85D}, {0x91ABB422CCB812EE, 0xAC62E055C10AB33A},
+	{0xB616A12B7FE617AA, 0x577B986B314D6009}, {0xE39C49765FDF9D94, 0xED5A7E85FDA0B80B},
+	{0x8E41ADE9FBEBC27D, 0x14588F13BE847307}, {0xB1D219647AE6B31C, 0x596EB2D8AE258FC8},
+	{0xDE469FBD99A05FE3, 0x6FCA5F8ED9AEF3BB}, {0x8AEC23D680043BEE, 0x25DE7BB9480D5854},
+	{0xADA72CCC20054AE9, 0xAF561AA79A10AE6A}, {0xD910F7FF28069DA4, 0x1B2BA1518094DA04},
+	{0x87AA9AFF79042286, 0x90FB44D2F05D0842}, {0xA99541BF57452B28, 0x353A1607AC744A53},
+	{0xD3FA922F2D1675F2, 0x42889B8997915CE8}, {0x847C9B5D7C2E09B7, 0x69956135FEBADA11},
+	{0xA59BC234DB398C25, 0x43FAB9837E699095}, {0xCF02B2C21207EF2E, 0x94F967E45E03F4BB},
+	{0x8161AFB94B44F57D, 0x1D1BE0EEBAC278F5}, {0xA1BA1BA79E1632DC, 0x6462D92A69731732},
+	{0xCA28A291859BBF93, 0x7D7B8F7503CFDCFE}, {0xFCB2CB35E702AF78, 0x5CDA735244C3D43E},
+	{0x9DEFBF01B061ADAB, 0x3A0888136AFA64A7}, {0xC56BAEC21C7A1916, 0x088AAA1845B8FDD0},
+	{0xF6C69A72A3989F5B, 0x8AAD549E57273D45}, {0x9A3C2087A63F6399, 0x36AC54E2F678864B},
+	{0xC0CB28A98FCF3C7F, 0x84576A1BB416A7DD}, {0xF0FDF2D3F3C30B9F, 0x656D44A2A11C51D5},
+	{0x969EB7C47859E743, 0x9F644AE5A4B1B325}, {0xBC4665B596706114, 0x873D5D9F0DDE1FEE},
+	{0xEB57FF22FC0C7959, 0xA90CB506D155A7EA}, {0x9316FF75DD87CBD8, 0x09A7F12442D588F2},
+	{0xB7DCBF5354E9BECE, 0x0C11ED6D538AEB2F}, {0xE5D3EF282A242E81, 0x8F1668C8A86DA5FA},
+	{0x8FA475791A569D10, 0xF96E017D694487BC}, {0xB38D92D760EC4455, 0x37C981DCC395A9AC},
+	{0xE070F78D3927556A, 0x85BBE253F47B1417}, {0x8C469AB843B89562, 0x93956D7478CCEC8E},
+	{0xAF58416654A6BABB, 0x387AC8D1970027B2}, {0xDB2E51BFE9D0696A, 0x06997B05FCC0319E},
+	{0x88FCF317F22241E2, 0x441FECE3BDF81F03}, {0xAB3C2FDDEEAAD25A, 0xD527E81CAD7626C3},
+	{0xD60B3BD56A5586F1, 0x8A71E223D8D3B074}, {0x85C7056562757456, 0xF6872D5667844E49},
+	{0xA738C6BEBB12D16C, 0xB428F8AC016561DB}, {0xD106F86E69D785C7, 0xE13336D701BEBA52},
+	{0x82A45B450226B39C, 0xECC0024661173473}, {0xA34D721642B06084, 0x27F002D7F95D0190},
+	{0xCC20CE9BD35C78A5, 0x31EC038DF7B441F4}, {0xFF290242C83396CE, 0x7E67047175A15271},
+	{0x9F79A169BD203E41, 0x0F0062C6E984D386}, {0xC75809C42C684DD1, 0x52C07B78A3E60868},
+	{0xF92E0C3537826145, 0xA7709A56CCDF8A82}, {0x9BBCC7A142B17CCB, 0x88A66076400BB691},
+	{0xC2ABF989935DDBFE, 0x6ACFF893D00EA435}, {0xF356F7EBF83552FE, 0x0583F6B8C4124D43},
+	{0x98165AF37B2153DE, 0xC3727A337A8B704A}, {0xBE1BF1B059E9A8D6, 0x744F18C0592E4C5C},
+	{0xEDA2EE1C7064130C, 0x1162DEF06F79DF73}, {0x9485D4D1C63E8BE7, 0x8ADDCB5645AC2BA8},
+	{0xB9A74A0637CE2EE1, 0x6D953E2BD7173692}, {0xE8111C87C5C1BA99, 0xC8FA8DB6CCDD0437},
+	{0x910AB1D4DB9914A0, 0x1D9C9892400A22A2}, {0xB54D5E4A127F59C8, 0x2503BEB6D00CAB4B},
+	{0xE2A0B5DC971F303A, 0x2E44AE64840FD61D}, {0x8DA471A9DE737E24, 0x5CEAECFED289E5D2},
+	{0xB10D8E1456105DAD, 0x7425A83E872C5F47}, {0xDD50F1996B947518, 0xD12F124E28F77719},
+	{0x8A5296FFE33CC92F, 0x82BD6B70D99AAA6F}, {0xACE73CBFDC0BFB7B, 0x636CC64D1001550B},
+	{0xD8210BEFD30EFA5A, 0x3C47F7E05401AA4E}, {0x8714A775E3E95C78, 0x65ACFAEC34810A71},
+	{0xA8D9D1535CE3B396, 0x7F1839A741A14D0D}, {0xD31045A8341CA07C, 0x1EDE48111209A050},
+	{0x83EA2B892091E44D, 0x934AED0AAB460432}, {0xA4E4B66B68B65D60, 0xF81DA84D5617853F},
+	{0xCE1DE40642E3F4B9, 0x36251260AB9D668E}, {0x80D2AE83E9CE78F3, 0xC1D72B7C6B426019},
+	{0xA1075A24E4421730, 0xB24CF65B8612F81F}, {0xC94930AE1D529CFC, 0xDEE033F26797B627},
+	{0xFB9B7CD9A4A7443C, 0x169840EF017DA3B1}, {0x9D412E0806E88AA5, 0x8E1F289560EE864E},
+	{0xC491798A08A2AD4E, 0xF1A6F2BAB92A27E2}, {0xF5B5D7EC8ACB58A2, 0xAE10AF696774B1DB},
+	{0x9991A6F3D6BF1765, 0xACCA6DA1E0A8EF29}, {0xBFF610B0CC6EDD3F, 0x17FD090A58D32AF3},
+	{0xEFF394DCFF8A948E, 0xDDFC4B4CEF07F5B0}, {0x95F83D0A1FB69CD9, 0x4ABDAF101564F98E},
+	{0xBB764C4CA7A4440F, 0x9D6D1AD41ABE37F1}, {0xEA53DF5FD18D5513, 0x84C86189216DC5ED},
+	{0x92746B9BE2F8552C, 0x32FD3CF5B4E49BB4}, {0xB7118682DBB66A77, 0x3FBC8C33221DC2A1},
+	{0xE4D5E82392A40515, 0x0FABAF3FEAA5334A}, {0x8F05B1163BA6832D, 0x29CB4D87F2A7400E},
+	{0xB2C71D5BCA9023F8, 0x743E20E9EF511012}, {0xDF78E4B2BD342CF6, 0x914DA9246B255416},
+	{0x8BAB8EEFB6409C1A, 0x1AD089B6C2F7548E}, {0xAE9672ABA3D0C320, 0xA184AC2473B529B1},
+	{0xDA3C0F568CC4F3E8, 0xC9E5D72D90A2741E}, {0x8865899617FB1871, 0x7E2FA67C7A658892},
+	{0xAA7EEBFB9DF9DE8D, 0xDDBB901B98FEEAB7}, {0xD51EA6FA85785631, 0x552A74227F3EA565},
+	{0x8533285C936B35DE, 0xD53A88958F87275F}, {0xA67FF273B8460356, 0x8A892ABAF368F137},
+	{0xD01FEF10A657842C, 0x2D2B7569B0432D85}, {0x8213F56A67F6B29B, 0x9C3B29620E29FC73},
+	{0xA298F2C501F45F42, 0x8349F3BA91B47B8F}, {0xCB3F2F7642717713, 0x241C70A936219A73},
+	{0xFE0EFB53D30DD4D7, 0xED238CD383AA0110}, {0x9EC95D1463E8A506, 0xF4363804324A40AA},
+	{0xC67BB4597CE2CE48, 0xB143C6053EDCD0D5}, {0xF81AA16FDC1B81DA, 0xDD94B7868E94050A},
+	{0x9B10A4E5E9913128, 0xCA7CF2B4191C8326}, {0xC1D4CE1F63F57D72, 0xFD1C2F611F63A3F0},
+	{0xF24A01A73CF2DCCF, 0xBC633B39673C8CEC}, {0x976E41088617CA01, 0xD5BE0503E085D813},
+	{0xBD49D14AA79DBC82, 0x4B2D8644D8A74E18}, {0xEC9C459D51852BA2, 0xDDF8E7D60ED1219E},
+	{0x93E1AB8252F33B45, 0xCABB90E5C942B503}, {0xB8DA1662E7B00A17, 0x3D6A751F3B936243},
+	{0xE7109BFBA19C0C9D, 0x0CC512670A783AD4}, {0x906A617D450187E2, 0x27FB2B80668B24C5},
+	{0xB484F9DC9641E9DA, 0xB1F9F660802DEDF6}, {0xE1A63853BBD26451, 0x5E7873F8A0396973},
+	{0x8D07E33455637EB2, 0xDB0B487B6423E1E8}, {0xB049DC016ABC5E5F, 0x91CE1A9A3D2CDA62},
+	{0xDC5C5301C56B75F7, 0x7641A140CC7810FB}, {0x89B9B3E11B6329BA, 0xA9E904C87FCB0A9D},
+	{0xAC2820D9623BF429, 0x546345FA9FBDCD44}, {0xD732290FBACAF133, 0xA97C177947AD4095},
+	{0x867F59A9D4BED6C0, 0x49ED8EABCCCC485D}, {0xA81F301449EE8C70, 0x5C68F256BFFF5A74},
+	{0xD226FC195C6A2F8C, 0x73832EEC6FFF3111}, {0x83585D8FD9C25DB7, 0xC831FD53C5FF7EAB},
+	{0xA42E74F3D032F525, 0xBA3E7CA8B77F5E55}, {0xCD3A1230C43FB26F, 0x28CE1BD2E55F35EB},
+	{0x80444B5E7AA7CF85, 0x7980D163CF5B81B3}, {0xA0555E361951C366, 0xD7E105BCC332621F},
+	{0xC86AB5C39FA63440, 0x8DD9472BF3FEFAA7}, {0xFA856334878FC150, 0xB14F98F6F0FEB951},
+	{0x9C935E00D4B9D8D2, 0x6ED1BF9A569F33D3}, {0xC3B8358109E84F07, 0x0A862F80EC4700C8},
+	{0xF4A642E14C6262C8, 0xCD27BB612758C0FA}, {0x98E7E9CCCFBD7DBD, 0x8038D51CB897789C},
+	{0xBF21E44003ACDD2C, 0xE0470A63E6BD56C3}, {0xEEEA5D5004981478, 0x1858CCFCE06CAC74},
+	{0x95527A5202DF0CCB, 0x0F37801E0C43EBC8}, {0xBAA718E68396CFFD, 0xD30560258F54E6BA},
+	{0xE950DF20247C83FD, 0x47C6B82EF32A2069}, {0x91D28B7416CDD27E, 0x4CDC331D57FA5441},
+	{0xB6472E511C81471D, 0xE0133FE4ADF8E952}, {0xE3D8F9E563A198E5, 0x58180FDDD97723A6},
+	{0x8E679C2F5E44FF8F, 0x570F09EAA7EA7648}
+};
 
-	if (!si_between(i32, chr, 0xD800, 0xDBFF)) {
-		res.codepoint = chr;
-		res.len = 1 + (chr >= 0x80) + (chr >= 0x800);
+siIntern const f64 SI__FLOAT_POW10[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+	1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* Returns the IEEE bits (without the sign) of 'w * 10^q'. */
+siIntern
+u64 si__floatEiselLemire(u64 w, i64 q) {
+	SI_STOPIF(w == 0 || q < SI__FLOAT_POW5_MIN, return 0);
+	SI_STOPIF(q > SI__FLOAT_POW5_MAX, return (u64)0x7FF << 52);
+
+	i32 lz = si__clz64(w);
+	w <<= lz;
+
+	const u64* pow5 = SI__FLOAT_POW5_128[q - SI__FLOAT_POW5_MIN];
+	u64 high, low = si__mul128(w, pow5[0], &high);
+	if ((high & 0x1FF) == 0x1FF) {
+		u64 high2;
+		si__mul128(w, pow5[1], &high2);
+		low += high2;
+		high += (u64)(high2 > low);
 	}
-	else {
-		i32 high = (chr - 0xD800) << 10,
-			low = character[1] - 0xDC00;
 
-		res.codepoint = (high | low) + 0x10000;
-		res.len = 4;
+	i32 upperBit = (i32)(high >> 63);
+	i32 shift = upperBit + 64 - 52 - 3;
+	u64 mantissa = high >> shift;
+	i32 power2 = (i32)(((152170 + 65536) * q) >> 16) + 63 + upperBit - lz + 1023;
+
+	if (power2 <= 0) {
+		SI_STOPIF(-power2 + 1 >= 64, return 0);
+
+		/* NOTE(EimaMei): Round-to-even cases cannot happen with subnormals. The
+		 * result may round up into the smallest normal float, in which case the
+		 * carry sets the exponent bit by itself. */
+		mantissa >>= -power2 + 1;
+		mantissa += mantissa & 1;
+		mantissa >>= 1;
+		return mantissa;
 	}
 
-	return res;
+	/* NOTE(EimaMei): The product is exact for -4 <= q <= 23, meaning a value
+	 * right in the middle has to be rounded to even. */
+	if (low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == high) {
+		mantissa &= ~(u64)1;
+	}
+	mantissa += mantissa & 1;
+	mantissa >>= 1;
+	if (mantissa >= SI_BIT(53)) {
+		mantissa = SI_BIT(52);
+		power2 += 1;
+	}
+
+	SI_STOPIF(power2 >= 0x7FF, return (u64)0x7FF << 52);
+	return ((u64)power2 << 52) | (mantissa & (SI_BIT(52) - 1));
 }
 
-SIDEF
-siUtf8Char si_utf16Encode(const u16 character[2]) {
-	siUtf8Char res;
-	u8* data = res.codepoint;
-	u32 chr = character[0];
 
-	if (chr <= 0xFF) {
-		data[0] = (u8)chr;
-		res.len = 1;
+#define SI__DECIMAL_MAX_DIGITS 800
+#define SI__DECIMAL_MAX_SHIFT 60
+
+/* An arbitrary precision decimal of '0.digits * 10^point'. */
+typedef struct si__decimal {
+	i32 count;
+	i32 point;
+	b32 isTruncated;
+	u8 digits[SI__DECIMAL_MAX_DIGITS + 20];
+} si__decimal;
+
+force_inline
+void si__decimalTrim(si__decimal* d) {
+	while (d->count > 0 && d->digits[d->count - 1] == 0) { d->count -= 1; }
+	if (d->count == 0) { d->point = 0; }
+}
+
+siIntern
+void si__decimalShiftLeft(si__decimal* d, u32 k) {
+	i32 delta = (i32)((k * 1233) >> 12) + 1;
+	i32 w = d->count + delta;
+
+	u64 n = 0;
+	for (i32 r = d->count - 1; r >= 0; r -= 1) {
+		n += (u64)d->digits[r] << k;
+		u64 quo = n / 10;
+		w -= 1;
+		d->digits[w] = (u8)(n - quo * 10);
+		n = quo;
 	}
-	else if (chr <= 0x7FF) {
-		data[0] = (u8)(0xC0 | (chr >> 6));
-		data[1] = (u8)(0x80 | (chr & 0x3F));
-		res.len = 2;
+	while (n > 0) {
+		u64 quo = n / 10;
+		w -= 1;
+		d->digits[w] = (u8)(n - quo * 10);
+		n = quo;
 	}
-	else if (chr <= 0xD7FF) {
-		data[0] = (u8)(0xE0 | (chr >> 12));           /* 1110xxxx */
-		data[1] = (u8)(0xE0 | ((chr >> 6) & 0x3F));   /* 10xxxxxx */
-		data[2] = (u8)(0xE0 | (chr & 0x3F));          /* 10xxxxxx */
-		res.len = 3;
+
+	i32 count = d->count + delta - w;
+	if (w != 0) { si_memmove(d->digits, &d->digits[w], count); }
+	d->point += delta - w;
+
+	if (count > SI__DECIMAL_MAX_DIGITS) {
+		for_range (i, SI__DECIMAL_MAX_DIGITS, count) {
+			d->isTruncated |= (d->digits[i] != 0);
+		}
+		count = SI__DECIMAL_MAX_DIGITS;
 	}
-	else if (chr >= 0xD800) {
-		u32 high = (chr - 0xD800u) << 10,
-			low  = character[1] - 0xDC00u;
-		u32 codepoint = (high | low) + 0x10000;
+	d->count = count;
+	si__decimalTrim(d);
+}
 
-		data[0] = (u8)(0xF0 | (codepoint >> 18));           /* 11110xxx */
-		data[1] = (u8)(0x80 | ((codepoint >> 12) & 0x3F));  /* 10xxxxxx */
-		data[2] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));   /* 10xxxxxx */
-		data[3] = (u8)(0x80 | (codepoint & 0x3F));          /* 10xxxxxx */
-		res.len = 4;
+siIntern
+void si__decimalShiftRight(si__decimal* d, u32 k) {
+	i32 r = 0, w = 0;
+	u64 n = 0;
+
+	while ((n >> k) == 0) {
+		if (r >= d->count) {
+			if (n == 0) { d->count = 0; return; }
+			while ((n >> k) == 0) { n *= 10; r += 1; }
+			break;
+		}
+		n = n * 10 + d->digits[r];
+		r += 1;
+	}
+	d->point -= r - 1;
+
+	u64 mask = SI_BIT(k) - 1;
+	for (; r < d->count; r += 1) {
+		u64 digit = n >> k;
+		n &= mask;
+		d->digits[w] = (u8)digit;
+		w += 1;
+		n = n * 10 + d->digits[r];
+	}
+	while (n > 0) {
+		u64 digit = n >> k;
+		n &= mask;
+		if (w < SI__DECIMAL_MAX_DIGITS) {
+			d->digits[w] = (u8)digit;
+			w += 1;
+		}
+		else {
+			d->isTruncated |= (digit != 0);
+		}
+		n *= 10;
 	}
 
-	return res;
+	d->count = w;
+	si__decimalTrim(d);
 }
 
-#endif /* SI_IMPLEMENTATION_UNICODE */
+siIntern
+void si__decimalShift(si__decimal* d, i32 k) {
+	SI_STOPIF(d->count == 0, return);
 
-#ifdef SI_IMPLEMENTATION_CHAR
+	while (k > SI__DECIMAL_MAX_SHIFT) {
+		si__decimalShiftLeft(d, SI__DECIMAL_MAX_SHIFT);
+		k -= SI__DECIMAL_MAX_SHIFT;
+	}
+	while (k < -SI__DECIMAL_MAX_SHIFT) {
+		si__decimalShiftRight(d, SI__DECIMAL_MAX_SHIFT);
+		k += SI__DECIMAL_MAX_SHIFT;
+	}
 
-#if 1
-#define SI__CTRL SI_BIT(0) /* Control characters. */
-#define SI__PUNC SI_BIT(1) /* Punctuation characters. */
-#define SI__NUME SI_BIT(2) /* Numeric digits. */
-#define SI__SPAC SI_BIT(3) /* Space characters. */
-#define SI__LETU SI_BIT(4) /* Uppercase letters. */
-#define SI__LETL SI_BIT(5) /* Lowercase letters. */
-#define SI__HEXA SI_BIT(6) /* Hexadecimal characters. */
+	if (k > 0) { si__decimalShiftLeft(d, (u32)k); }
+	else if (k < 0) { si__decimalShiftRight(d, (u32)-k); }
+}
 
-#define SI__LTXU (SI__LETU | SI__HEXA)
-#define SI__LTXL (SI__LETL | SI__HEXA)
-#define SI__CTRS (SI__CTRL | SI__SPAC)
-#define SI__NUMX (SI__NUME | SI__HEXA)
+/* Returns the integer part of the decimal, rounded half to even. */
+siIntern
+u64 si__decimalRoundedInteger(const si__decimal* d) {
+	SI_STOPIF(d->point > 20, return UINT64_MAX);
+
+	u64 n = 0;
+	i32 i = 0;
+	for (; i < d->point && i < d->count; i += 1) { n = n * 10 + d->digits[i]; }
+	for (; i < d->point; i += 1) { n *= 10; }
+
+	i32 point = d->point;
+	if (point >= 0 && point < d->count) {
+		b32 roundUp;
+		if (d->digits[point] == 5 && point + 1 == d->count) {
+			roundUp = d->isTruncated || (point > 0 && (d->digits[point - 1] & 1));
+		}
+		else {
+			roundUp = (d->digits[point] >= 5);
+		}
+		n += (u64)roundUp;
+	}
 
-const u8 characterTraits[SI_ASCII_MAX + 1] = {
-	SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL,
+	return n;
+}
 
-	SI__CTRS, SI__CTRS, SI__CTRS, SI__CTRS, SI__CTRS,
+/* Exactly converts the digits (including an optional '.') multiplied by
+ * '10^exponent' into IEEE bits (without the sign). A port of Go's 'decimal'
+ * conversion. */
+siIntern
+u64 si__floatSlow(siString str, i64 exponent) {
+	static const u8 powers[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
 
-	SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL,
-	SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL,
+	si__decimal d;
+	d.count = 0;
+	d.point = 0;
+	d.isTruncated = false;
 
-	SI__SPAC,
+	b32 sawPoint = false;
+	for_range (i, 0, str.len) {
+		u8 c = str.data[i];
+		if (c == '.') {
+			sawPoint = true;
+			continue;
+		}
 
-	SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC,
-	SI__PUNC, SI__PUNC, SI__PUNC,
+		if (!sawPoint) { d.point += 1; }
+		if (c == '0' && d.count == 0) {
+			d.point -= 1;
+			continue;
+		}
 
-	SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX,
+		if (d.count < SI__DECIMAL_MAX_DIGITS) {
+			d.digits[d.count] = c - '0';
+			d.count += 1;
+		}
+		else {
+			d.isTruncated |= (c != '0');
+		}
+	}
+	si__decimalTrim(&d);
+
+	SI_STOPIF(d.count == 0, return 0);
+	SI_STOPIF(d.point + exponent > 310, return (u64)0x7FF << 52);
+	SI_STOPIF(d.point + exponent < -330, return 0);
+	d.point += (i32)exponent;
+
+	i32 exp = 0;
+	while (d.point > 0) {
+		i32 n = (d.point >= countof(powers)) ? 27 : powers[d.point];
+		si__decimalShift(&d, -n);
+		exp += n;
+	}
+	while (d.point < 0 || (d.point == 0 && d.digits[0] < 5)) {
+		i32 n = (-d.point >= countof(powers)) ? 27 : powers[-d.point];
+		si__decimalShift(&d, n);
+		exp -= n;
+	}
 
-	SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC,
+	/* NOTE(EimaMei): The decimal is now in the [0.5, 1) range, while floats are
+	 * in [1, 2). */
+	exp -= 1;
+	if (exp < -1022) {
+		si__decimalShift(&d, exp + 1022);
+		exp = -1022;
+	}
+	SI_STOPIF(exp + 1023 >= 0x7FF, return (u64)0x7FF << 52);
+
+	si__decimalShift(&d, 53);
+	u64 mantissa = si__decimalRoundedInteger(&d);
+	if (mantissa == SI_BIT(53)) {
+		mantissa >>= 1;
+		exp += 1;
+		SI_STOPIF(exp + 1023 >= 0x7FF, return (u64)0x7FF << 52);
+	}
+	if ((mantissa & SI_BIT(52)) == 0) {
+		exp = -1023;
+	}
 
-	SI__LTXU, SI__LTXU, SI__LTXU, SI__LTXU, SI__LTXU, SI__LTXU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU,
-	SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU,
-	SI__LETU, SI__LETU,
+	return ((u64)(exp + 1023) << 52) | (mantissa & (SI_BIT(52) - 1));
+}
 
-	SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC,
+/* Returns the length of the given case-insensitive word at the start of 'str',
+ * or 0 if it does not start with it. */
+siIntern
+isize si__floatMatchWord(siString str, isize i, siString word) {
+	SI_STOPIF(str.len - i < word.len, return 0);
 
-	SI__LTXL, SI__LTXL, SI__LTXL, SI__LTXL, SI__LTXL, SI__LTXL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL,
-	SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL,
-	SI__LETL, SI__LETL,
+	for_range (j, 0, word.len) {
+		SI_STOPIF((str.data[i + j] | 0x20) != word.data[j], return 0);
+	}
+	return word.len;
+}
 
-	SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC,
-	SI__CTRL
-};
+inline
+f64 si_stringToFloat(siString str) {
+	isize tmp;
+	return si_stringToFloatEx(str, &tmp);
+}
 
-const u16 alphaRanges[] = {
-	0x00D8, 0x00F6, 0x00F8, 0x01F5, 0x0250, 0x02A8, 0x038E, 0x03A1, 0x03A3, 0x03CE, 0x03D0, 0x03D6, 0x03E2, 0x03F3, 0x0490,
-	0x04C4, 0x0561, 0x0587, 0x05D0, 0x05EA, 0x05F0, 0x05F2, 0x0621, 0x063A, 0x0640, 0x064A, 0x0671, 0x06B7, 0x06BA, 0x06BE,
-	0x06C0, 0x06CE, 0x06D0, 0x06D3, 0x0905, 0x0939, 0x0958, 0x0961, 0x0985, 0x098C, 0x098F, 0x0990, 0x0993, 0x09A8, 0x09AA,
-	0x09B0, 0x09B6, 0x09B9, 0x09DC, 0x09DD, 0x09DF, 0x09E1, 0x09F0, 0x09F1, 0x0A05, 0x0A0A, 0x0A0F, 0x0A10, 0x0A13, 0x0A28,
-	0x0A2A, 0x0A30, 0x0A32, 0x0A33, 0x0A35, 0x0A36, 0x0A38, 0x0A39, 0x0A59, 0x0A5C, 0x0A85, 0x0A8B, 0x0A8F, 0x0A91, 0x0A93,
-	0x0AA8, 0x0AAA, 0x0AB0, 0x0AB2, 0x0AB3, 0x0AB5, 0x0AB9, 0x0B05, 0x0B0C, 0x0B0F, 0x0B10, 0x0B13, 0x0B28, 0x0B2A, 0x0B30,
-	0x0B32, 0x0B33, 0x0B36, 0x0B39, 0x0B5C, 0x0B5D, 0x0B5F, 0x0B61, 0x0B85, 0x0B8A, 0x0B8E, 0x0B90, 0x0B92, 0x0B95, 0x0B99,
-	0x0B9A, 0x0B9E, 0x0B9F, 0x0BA3, 0x0BA4, 0x0BA8, 0x0BAA, 0x0BAE, 0x0BB5, 0x0BB7, 0x0BB9, 0x0C05, 0x0C0C, 0x0C0E, 0x0C10,
-	0x0C12, 0x0C28, 0x0C2A, 0x0C33, 0x0C35, 0x0C39, 0x0C60, 0x0C61, 0x0C85, 0x0C8C, 0x0C8E, 0x0C90, 0x0C92, 0x0CA8, 0x0CAA,
-	0x0CB3, 0x0CB5, 0x0CB9, 0x0CE0, 0x0CE1, 0x0D05, 0x0D0C, 0x0D0E, 0x0D10, 0x0D12, 0x0D28, 0x0D2A, 0x0D39, 0x0D60, 0x0D61,
-	0x0E01, 0x0E30, 0x0E32, 0x0E33, 0x0E40, 0x0E46, 0x0E5A, 0x0E5B, 0x0E81, 0x0E82, 0x0E87, 0x0E88, 0x0E94, 0x0E97, 0x0E99,
-	0x0E9F, 0x0EA1, 0x0EA3, 0x0EAA, 0x0EAB, 0x0EAD, 0x0EAE, 0x0EB2, 0x0EB3, 0x0EC0, 0x0EC4, 0x0EDC, 0x0EDD, 0x0F18, 0x0F19,
-	0x0F40, 0x0F47, 0x0F49, 0x0F69, 0x10D0, 0x10F6, 0x1100, 0x1159, 0x115F, 0x11A2, 0x11A8, 0x11F9, 0x1E00, 0x1E9B, 0x1F50,
-	0x1F57, 0x1F80, 0x1FB4, 0x1FB6, 0x1FBC, 0x1FC2, 0x1FC4, 0x1FC6, 0x1FCC, 0x1FD0, 0x1FD3, 0x1FD6, 0x1FDB, 0x1FE0, 0x1FEC,
-	0x1FF2, 0x1FF4, 0x1FF6, 0x1FFC, 0x210A, 0x2113, 0x2115, 0x211D, 0x2120, 0x2122, 0x212A, 0x2131, 0x2133, 0x2138, 0x3041,
-	0x3094, 0x30A1, 0x30FA, 0x3105, 0x312C, 0x3131, 0x318E, 0x3192, 0x319F, 0x3260, 0x327B, 0x328A, 0x32B0, 0x32D0, 0x32FE,
-	0x3300, 0x3357, 0x3371, 0x3376, 0x337B, 0x3394, 0x3399, 0x339E, 0x33A9, 0x33AD, 0x33B0, 0x33C1, 0x33C3, 0x33C5, 0x33C7,
-	0x33D7, 0x33D9, 0x33DD, 0x4E00, 0x9FFF, 0xAC00, 0xD7A3, 0xF900, 0xFB06, 0xFB13, 0xFB17, 0xFB1F, 0xFB28, 0xFB2A, 0xFB36,
-	0xFB38, 0xFB3C, 0xFB40, 0xFB41, 0xFB43, 0xFB44, 0xFB46, 0xFBB1, 0xFBD3, 0xFD3D, 0xFD50, 0xFD8F, 0xFD92, 0xFDC7, 0xFDF0,
-	0xFDF9, 0xFE70, 0xFE72, 0xFE76, 0xFEFC, 0xFF66, 0xFF6F, 0xFF71, 0xFF9D, 0xFFA0, 0xFFBE, 0xFFC2, 0xFFC7, 0xFFCA, 0xFFCF,
-	0xFFD2, 0xFFD7, 0xFFDA, 0xFFDC
-};
-
-const u16 alphaSingle[] = {
-	0x00AA, 0x00B5, 0x00BA, 0x03DA, 0x03DC, 0x03DE, 0x03E0, 0x06D5, 0x09B2, 0x0A5E, 0x0A8D, 0x0AE0, 0x0B9C, 0x0CDE, 0x0E4F,
-	0x0E84, 0x0E8A, 0x0E8D, 0x0EA5, 0x0EA7, 0x0EB0, 0x0EBD, 0x1FBE, 0x207F, 0x20A8, 0x2102, 0x2107, 0x2124, 0x2126, 0x2128,
-	0xFB3E, 0xFE74
-};
-
-const u16 spaces[] = {
-	0x200A, 0x200B, 0x200E, 0x200F, 0x2028, 0x2029, 0x3000, 0x202F, 0x205f, 0x3000, 0xFEFF
-};
+SIDEF
+f64 si_stringToFloatEx(siString str, isize* outInvalidIndex) {
+	SI_ASSERT_NOT_NIL(outInvalidIndex);
 
-const u16 lowerRange[] = {
-	0x00c0,  0x00d6, 532, 0x00d8,  0x00de, 532, 0x0189,  0x018a, 705, 0x018e,  0x018f, 702, 0x01b1,  0x01b2, 717,
-	0x0388,  0x038a, 537, 0x038e,  0x038f, 563, 0x0391,  0x03a1, 532, 0x03a3,  0x03ab, 532, 0x0401,  0x040c, 580,
-	0x040e,  0x040f, 580, 0x0410,  0x042f, 532, 0x0531,  0x0556, 548, 0x10a0,  0x10c5, 548, 0x1f08,  0x1f0f, 492,
-	0x1f18,  0x1f1d, 492, 0x1f28,  0x1f2f, 492, 0x1f38,  0x1f3f, 492, 0x1f48,  0x1f4d, 492, 0x1f68,  0x1f6f, 492,
-	0x1f88,  0x1f8f, 492, 0x1f98,  0x1f9f, 492, 0x1fa8,  0x1faf, 492, 0x1fb8,  0x1fb9, 492, 0x1fba,  0x1fbb, 426,
-	0x1fc8,  0x1fcb, 414, 0x1fd8,  0x1fd9, 492, 0x1fda,  0x1fdb, 400, 0x1fe8,  0x1fe9, 492, 0x1fea,  0x1feb, 388,
-	0x1ff8,  0x1ff9, 372, 0x1ffa,  0x1ffb, 374, 0x2160,  0x216f, 516, 0x24b6,  0x24cf, 526, 0xff21,  0xff3a, 532,
-};
+	const u8* data = str.data;
+	isize i = 0;
+	while (i < str.len && si_charIsSpace((char)data[i])) { i += 1; }
 
-const u16 lowerSingle[] = {
-	0x0100, 501, 0x0102, 501, 0x0104, 501, 0x0106, 501, 0x0108, 501, 0x010a, 501, 0x010c, 501, 0x010e, 501, 0x0110, 501,
-	0x0112, 501, 0x0114, 501, 0x0116, 501, 0x0118, 501, 0x011a, 501, 0x011c, 501, 0x011e, 501, 0x0120, 501, 0x0122, 501,
-	0x0124, 501, 0x0126, 501, 0x0128, 501, 0x012a, 501, 0x012c, 501, 0x012e, 501, 0x0130, 301, 0x0132, 501, 0x0134, 501,
-	0x0136, 501, 0x0139, 501, 0x013b, 501, 0x013d, 501, 0x013f, 501, 0x0141, 501, 0x0143, 501, 0x0145, 501, 0x0147, 501,
-	0x014a, 501, 0x014c, 501, 0x014e, 501, 0x0150, 501, 0x0152, 501, 0x0154, 501, 0x0156, 501, 0x0158, 501, 0x015a, 501,
-	0x015c, 501, 0x015e, 501, 0x0160, 501, 0x0162, 501, 0x0164, 501, 0x0166, 501, 0x0168, 501, 0x016a, 501, 0x016c, 501,
-	0x016e, 501, 0x0170, 501, 0x0172, 501, 0x0174, 501, 0x0176, 501, 0x0178, 379, 0x0179, 501, 0x017b, 501, 0x017d, 501,
-	0x0181, 710, 0x0182, 501, 0x0184, 501, 0x0186, 706, 0x0187, 501, 0x018b, 501, 0x0190, 703, 0x0191, 501, 0x0193, 705,
-	0x0194, 707, 0x0196, 711, 0x0197, 709, 0x0198, 501, 0x019c, 711, 0x019d, 713, 0x01a0, 501, 0x01a2, 501, 0x01a4, 501,
-	0x01a7, 501, 0x01a9, 718, 0x01ac, 501, 0x01ae, 718, 0x01af, 501, 0x01b3, 501, 0x01b5, 501, 0x01b7, 719, 0x01b8, 501,
-	0x01bc, 501, 0x01c4, 502, 0x01c5, 501, 0x01c7, 502, 0x01c8, 501, 0x01ca, 502, 0x01cb, 501, 0x01cd, 501, 0x01cf, 501,
-	0x01d1, 501, 0x01d3, 501, 0x01d5, 501, 0x01d7, 501, 0x01d9, 501, 0x01db, 501, 0x01de, 501, 0x01e0, 501, 0x01e2, 501,
-	0x01e4, 501, 0x01e6, 501, 0x01e8, 501, 0x01ea, 501, 0x01ec, 501, 0x01ee, 501, 0x01f1, 502, 0x01f2, 501, 0x01f4, 501,
-	0x01fa, 501, 0x01fc, 501, 0x01fe, 501, 0x0200, 501, 0x0202, 501, 0x0204, 501, 0x0206, 501, 0x0208, 501, 0x020a, 501,
-	0x020c, 501, 0x020e, 501, 0x0210, 501, 0x0212, 501, 0x0214, 501, 0x0216, 501, 0x0386, 538, 0x038c, 564, 0x03e2, 501,
-	0x03e4, 501, 0x03e6, 501, 0x03e8, 501, 0x03ea, 501, 0x03ec, 501, 0x03ee, 501, 0x0460, 501, 0x0462, 501, 0x0464, 501,
-	0x0466, 501, 0x0468, 501, 0x046a, 501, 0x046c, 501, 0x046e, 501, 0x0470, 501, 0x0472, 501, 0x0474, 501, 0x0476, 501,
-	0x0478, 501, 0x047a, 501, 0x047c, 501, 0x047e, 501, 0x0480, 501, 0x0490, 501, 0x0492, 501, 0x0494, 501, 0x0496, 501,
-	0x0498, 501, 0x049a, 501, 0x049c, 501, 0x049e, 501, 0x04a0, 501, 0x04a2, 501, 0x04a4, 501, 0x04a6, 501, 0x04a8, 501,
-	0x04aa, 501, 0x04ac, 501, 0x04ae, 501, 0x04b0, 501, 0x04b2, 501, 0x04b4, 501, 0x04b6, 501, 0x04b8, 501, 0x04ba, 501,
-	0x04bc, 501, 0x04be, 501, 0x04c1, 501, 0x04c3, 501, 0x04c7, 501, 0x04cb, 501, 0x04d0, 501, 0x04d2, 501, 0x04d4, 501,
-	0x04d6, 501, 0x04d8, 501, 0x04da, 501, 0x04dc, 501, 0x04de, 501, 0x04e0, 501, 0x04e2, 501, 0x04e4, 501, 0x04e6, 501,
-	0x04e8, 501, 0x04ea, 501, 0x04ee, 501, 0x04f0, 501, 0x04f2, 501, 0x04f4, 501, 0x04f8, 501, 0x1e00, 501, 0x1e02, 501,
-	0x1e04, 501, 0x1e06, 501, 0x1e08, 501, 0x1e0a, 501, 0x1e0c, 501, 0x1e0e, 501, 0x1e10, 501, 0x1e12, 501, 0x1e14, 501,
-	0x1e16, 501, 0x1e18, 501, 0x1e1a, 501, 0x1e1c, 501, 0x1e1e, 501, 0x1e20, 501, 0x1e22, 501, 0x1e24, 501, 0x1e26, 501,
-	0x1e28, 501, 0x1e2a, 501, 0x1e2c, 501, 0x1e2e, 501, 0x1e30, 501, 0x1e32, 501, 0x1e34, 501, 0x1e36, 501, 0x1e38, 501,
-	0x1e3a, 501, 0x1e3c, 501, 0x1e3e, 501, 0x1e40, 501, 0x1e42, 501, 0x1e44, 501, 0x1e46, 501, 0x1e48, 501, 0x1e4a, 501,
-	0x1e4c, 501, 0x1e4e, 501, 0x1e50, 501, 0x1e52, 501, 0x1e54, 501, 0x1e56, 501, 0x1e58, 501, 0x1e5a, 501, 0x1e5c, 501,
-	0x1e5e, 501, 0x1e60, 501, 0x1e62, 501, 0x1e64, 501, 0x1e66, 501, 0x1e68, 501, 0x1e6a, 501, 0x1e6c, 501, 0x1e6e, 501,
-	0x1e70, 501, 0x1e72, 501, 0x1e74, 501, 0x1e76, 501, 0x1e78, 501, 0x1e7a, 501, 0x1e7c, 501, 0x1e7e, 501, 0x1e80, 501,
-	0x1e82, 501, 0x1e84, 501, 0x1e86, 501, 0x1e88, 501, 0x1e8a, 501, 0x1e8c, 501, 0x1e8e, 501, 0x1e90, 501, 0x1e92, 501,
-	0x1e94, 501, 0x1ea0, 501, 0x1ea2, 501, 0x1ea4, 501, 0x1ea6, 501, 0x1ea8, 501, 0x1eaa, 501, 0x1eac, 501, 0x1eae, 501,
-	0x1eb0, 501, 0x1eb2, 501, 0x1eb4, 501, 0x1eb6, 501, 0x1eb8, 501, 0x1eba, 501, 0x1ebc, 501, 0x1ebe, 501, 0x1ec0, 501,
-	0x1ec2, 501, 0x1ec4, 501, 0x1ec6, 501, 0x1ec8, 501, 0x1eca, 501, 0x1ecc, 501, 0x1ece, 501, 0x1ed0, 501, 0x1ed2, 501,
-	0x1ed4, 501, 0x1ed6, 501, 0x1ed8, 501, 0x1eda, 501, 0x1edc, 501, 0x1ede, 501, 0x1ee0, 501, 0x1ee2, 501, 0x1ee4, 501,
-	0x1ee6, 501, 0x1ee8, 501, 0x1eea, 501, 0x1eec, 501, 0x1eee, 501, 0x1ef0, 501, 0x1ef2, 501, 0x1ef4, 501, 0x1ef6, 501,
-	0x1ef8, 501, 0x1f59, 492, 0x1f5b, 492, 0x1f5d, 492, 0x1f5f, 492, 0x1fbc, 491, 0x1fcc, 491, 0x1fec, 493, 0x1ffc, 491,
-};
+	b32 isNegative = false;
+	if (i < str.len && (data[i] == '-' || data[i] == '+')) {
+		isNegative = (data[i] == '-');
+		i += 1;
+	}
 
-const u16 upperRange[] = {
-	0x00e0,  0x00f6, 468, 0x00f8,  0x00fe, 468, 0x0256,  0x0257, 295, 0x0258,  0x0259, 298, 0x028a,  0x028b, 283,
-	0x03ad,  0x03af, 463, 0x03b1,  0x03c1, 468, 0x03c3,  0x03cb, 468, 0x03cd,  0x03ce, 437, 0x0430,  0x044f, 468,
-	0x0451,  0x045c, 420, 0x045e,  0x045f, 420, 0x0561,  0x0586, 452, 0x1f00,  0x1f07, 508, 0x1f10,  0x1f15, 508,
-	0x1f20,  0x1f27, 508, 0x1f30,  0x1f37, 508, 0x1f40,  0x1f45, 508, 0x1f60,  0x1f67, 508, 0x1f70,  0x1f71, 574,
-	0x1f72,  0x1f75, 586, 0x1f76,  0x1f77, 600, 0x1f78,  0x1f79, 628, 0x1f7a,  0x1f7b, 612, 0x1f7c,  0x1f7d, 626,
-	0x1f80,  0x1f87, 508, 0x1f90,  0x1f97, 508, 0x1fa0,  0x1fa7, 508, 0x1fb0,  0x1fb1, 508, 0x1fd0,  0x1fd1, 508,
-	0x1fe0,  0x1fe1, 508, 0x2170,  0x217f, 484, 0x24d0,  0x24e9, 474, 0xff41,  0xff5a, 468,
-};
+	union { f64 f; u64 n; } res = {0};
+	isize digitsStart = i;
+	isize end;
 
-const u16 upperSingle[] = {
-	0x00ff, 621, 0x0101, 499, 0x0103, 499, 0x0105, 499, 0x0107, 499, 0x0109, 499, 0x010b, 499, 0x010d, 499, 0x010f, 499,
-	0x0111, 499, 0x0113, 499, 0x0115, 499, 0x0117, 499, 0x0119, 499, 0x011b, 499, 0x011d, 499, 0x011f, 499, 0x0121, 499,
-	0x0123, 499, 0x0125, 499, 0x0127, 499, 0x0129, 499, 0x012b, 499, 0x012d, 499, 0x012f, 499, 0x0131, 268, 0x0133, 499,
-	0x0135, 499, 0x0137, 499, 0x013a, 499, 0x013c, 499, 0x013e, 499, 0x0140, 499, 0x0142, 499, 0x0144, 499, 0x0146, 499,
-	0x0148, 499, 0x014b, 499, 0x014d, 499, 0x014f, 499, 0x0151, 499, 0x0153, 499, 0x0155, 499, 0x0157, 499, 0x0159, 499,
-	0x015b, 499, 0x015d, 499, 0x015f, 499, 0x0161, 499, 0x0163, 499, 0x0165, 499, 0x0167, 499, 0x0169, 499, 0x016b, 499,
-	0x016d, 499, 0x016f, 499, 0x0171, 499, 0x0173, 499, 0x0175, 499, 0x0177, 499, 0x017a, 499, 0x017c, 499, 0x017e, 499,
-	0x017f, 200, 0x0183, 499, 0x0185, 499, 0x0188, 499, 0x018c, 499, 0x0192, 499, 0x0199, 499, 0x01a1, 499, 0x01a3, 499,
-	0x01a5, 499, 0x01a8, 499, 0x01ad, 499, 0x01b0, 499, 0x01b4, 499, 0x01b6, 499, 0x01b9, 499, 0x01bd, 499, 0x01c5, 499,
-	0x01c6, 498, 0x01c8, 499, 0x01c9, 498, 0x01cb, 499, 0x01cc, 498, 0x01ce, 499, 0x01d0, 499, 0x01d2, 499, 0x01d4, 499,
-	0x01d6, 499, 0x01d8, 499, 0x01da, 499, 0x01dc, 499, 0x01df, 499, 0x01e1, 499, 0x01e3, 499, 0x01e5, 499, 0x01e7, 499,
-	0x01e9, 499, 0x01eb, 499, 0x01ed, 499, 0x01ef, 499, 0x01f2, 499, 0x01f3, 498, 0x01f5, 499, 0x01fb, 499, 0x01fd, 499,
-	0x01ff, 499, 0x0201, 499, 0x0203, 499, 0x0205, 499, 0x0207, 499, 0x0209, 499, 0x020b, 499, 0x020d, 499, 0x020f, 499,
-	0x0211, 499, 0x0213, 499, 0x0215, 499, 0x0217, 499, 0x0253, 290, 0x0254, 294, 0x025b, 297, 0x0260, 295, 0x0263, 293,
-	0x0268, 291, 0x0269, 289, 0x026f, 289, 0x0272, 287, 0x0283, 282, 0x0288, 282, 0x0292, 281, 0x03ac, 462, 0x03cc, 436,
-	0x03d0, 438, 0x03d1, 443, 0x03d5, 453, 0x03d6, 446, 0x03e3, 499, 0x03e5, 499, 0x03e7, 499, 0x03e9, 499, 0x03eb, 499,
-	0x03ed, 499, 0x03ef, 499, 0x03f0, 414, 0x03f1, 420, 0x0461, 499, 0x0463, 499, 0x0465, 499, 0x0467, 499, 0x0469, 499,
-	0x046b, 499, 0x046d, 499, 0x046f, 499, 0x0471, 499, 0x0473, 499, 0x0475, 499, 0x0477, 499, 0x0479, 499, 0x047b, 499,
-	0x047d, 499, 0x047f, 499, 0x0481, 499, 0x0491, 499, 0x0493, 499, 0x0495, 499, 0x0497, 499, 0x0499, 499, 0x049b, 499,
-	0x049d, 499, 0x049f, 499, 0x04a1, 499, 0x04a3, 499, 0x04a5, 499, 0x04a7, 499, 0x04a9, 499, 0x04ab, 499, 0x04ad, 499,
-	0x04af, 499, 0x04b1, 499, 0x04b3, 499, 0x04b5, 499, 0x04b7, 499, 0x04b9, 499, 0x04bb, 499, 0x04bd, 499, 0x04bf, 499,
-	0x04c2, 499, 0x04c4, 499, 0x04c8, 499, 0x04cc, 499, 0x04d1, 499, 0x04d3, 499, 0x04d5, 499, 0x04d7, 499, 0x04d9, 499,
-	0x04db, 499, 0x04dd, 499, 0x04df, 499, 0x04e1, 499, 0x04e3, 499, 0x04e5, 499, 0x04e7, 499, 0x04e9, 499, 0x04eb, 499,
-	0x04ef, 499, 0x04f1, 499, 0x04f3, 499, 0x04f5, 499, 0x04f9, 499, 0x1e01, 499, 0x1e03, 499, 0x1e05, 499, 0x1e07, 499,
-	0x1e09, 499, 0x1e0b, 499, 0x1e0d, 499, 0x1e0f, 499, 0x1e11, 499, 0x1e13, 499, 0x1e15, 499, 0x1e17, 499, 0x1e19, 499,
-	0x1e1b, 499, 0x1e1d, 499, 0x1e1f, 499, 0x1e21, 499, 0x1e23, 499, 0x1e25, 499, 0x1e27, 499, 0x1e29, 499, 0x1e2b, 499,
-	0x1e2d, 499, 0x1e2f, 499, 0x1e31, 499, 0x1e33, 499, 0x1e35, 499, 0x1e37, 499, 0x1e39, 499, 0x1e3b, 499, 0x1e3d, 499,
-	0x1e3f, 499, 0x1e41, 499, 0x1e43, 499, 0x1e45, 499, 0x1e47, 499, 0x1e49, 499, 0x1e4b, 499, 0x1e4d, 499, 0x1e4f, 499,
-	0x1e51, 499, 0x1e53, 499, 0x1e55, 499, 0x1e57, 499, 0x1e59, 499, 0x1e5b, 499, 0x1e5d, 499, 0x1e5f, 499, 0x1e61, 499,
-	0x1e63, 499, 0x1e65, 499, 0x1e67, 499, 0x1e69, 499, 0x1e6b, 499, 0x1e6d, 499, 0x1e6f, 499, 0x1e71, 499, 0x1e73, 499,
-	0x1e75, 499, 0x1e77, 499, 0x1e79, 499, 0x1e7b, 499, 0x1e7d, 499, 0x1e7f, 499, 0x1e81, 499, 0x1e83, 499, 0x1e85, 499,
-	0x1e87, 499, 0x1e89, 499, 0x1e8b, 499, 0x1e8d, 499, 0x1e8f, 499, 0x1e91, 499, 0x1e93, 499, 0x1e95, 499, 0x1ea1, 499,
-	0x1ea3, 499, 0x1ea5, 499, 0x1ea7, 499, 0x1ea9, 499, 0x1eab, 499, 0x1ead, 499, 0x1eaf, 499, 0x1eb1, 499, 0x1eb3, 499,
-	0x1eb5, 499, 0x1eb7, 499, 0x1eb9, 499, 0x1ebb, 499, 0x1ebd, 499, 0x1ebf, 499, 0x1ec1, 499, 0x1ec3, 499, 0x1ec5, 499,
-	0x1ec7, 499, 0x1ec9, 499, 0x1ecb, 499, 0x1ecd, 499, 0x1ecf, 499, 0x1ed1, 499, 0x1ed3, 499, 0x1ed5, 499, 0x1ed7, 499,
-	0x1ed9, 499, 0x1edb, 499, 0x1edd, 499, 0x1edf, 499, 0x1ee1, 499, 0x1ee3, 499, 0x1ee5, 499, 0x1ee7, 499, 0x1ee9, 499,
-	0x1eeb, 499, 0x1eed, 499, 0x1eef, 499, 0x1ef1, 499, 0x1ef3, 499, 0x1ef5, 499, 0x1ef7, 499, 0x1ef9, 499, 0x1f51, 508,
-	0x1f53, 508, 0x1f55, 508, 0x1f57, 508, 0x1fb3, 509, 0x1fc3, 509, 0x1fe5, 507, 0x1ff3, 509,
-};
+	isize wordLen;
+	if ((wordLen = si__floatMatchWord(str, i, SI_STR("infinity"))) || (wordLen = si__floatMatchWord(str, i, SI_STR("inf")))) {
+		res.n = (u64)0x7FF << 52;
+		end = i + wordLen;
+	}
+	else if ((wordLen = si__floatMatchWord(str, i, SI_STR("nan")))) {
+		res.n = ((u64)0x7FF << 52) | SI_BIT(51);
+		end = i + wordLen;
+	}
+	else {
+		u64 mantissa = 0;
+		i64 exponent = 0;
+		i32 digitCount = 0;
+		b32 isTruncated = false, hasDigits = false;
+
+		while (i < str.len && (u8)(data[i] - '0') < 10) {
+			u32 digit = data[i] - '0';
+			if (digitCount < 19) {
+				mantissa = mantissa * 10 + digit;
+				digitCount += (mantissa != 0);
+			}
+			else {
+				exponent += 1;
+				isTruncated |= (digit != 0);
+			}
+			hasDigits = true;
+			i += 1;
+		}
 
+		if (i < str.len && data[i] == '.') {
+			i += 1;
+			while (i < str.len && (u8)(data[i] - '0') < 10) {
+				u32 digit = data[i] - '0';
+				if (digitCount < 19) {
+					mantissa = mantissa * 10 + digit;
+					digitCount += (mantissa != 0);
+					exponent -= 1;
+				}
+				else {
+					isTruncated |= (digit != 0);
+				}
+				hasDigits = true;
+				i += 1;
+			}
+		}
 
-siIntern
-isize si__binarySearch(const u16* array, isize len, siRune target, i32 stride) {
-	isize t = 0;
-	while (len > 1) {
-		len /= 2;
-		isize p = t + len * stride;
+		if (!hasDigits) {
+			*outInvalidIndex = digitsStart;
+			return 0;
+		}
+		siString digits = SI_STR_LEN(&data[digitsStart], i - digitsStart);
+
+		i64 explicitExponent = 0;
+		if (i < str.len && (data[i] | 0x20) == 'e') {
+			isize j = i + 1;
+			b32 isExpNegative = false;
+			if (j < str.len && (data[j] == '-' || data[j] == '+')) {
+				isExpNegative = (data[j] == '-');
+				j += 1;
+			}
 
-		if (target >= array[p]) {
-			t = p;
+			if (j < str.len && (u8)(data[j] - '0') < 10) {
+				while (j < str.len && (u8)(data[j] - '0') < 10) {
+					if (explicitExponent < 0x10000) {
+						explicitExponent = explicitExponent * 10 + (data[j] - '0');
+					}
+					j += 1;
+				}
+				if (isExpNegative) { explicitExponent = -explicitExponent; }
+				i = j;
+			}
+		}
+		exponent += explicitExponent;
+		end = i;
+
+		if (!isTruncated && exponent >= -22 && exponent <= 22 && mantissa <= SI_BIT(53)) {
+			res.f = (f64)mantissa;
+			res.f = (exponent < 0)
+				? res.f / SI__FLOAT_POW10[-exponent]
+				: res.f * SI__FLOAT_POW10[exponent];
+		}
+		else {
+			res.n = si__floatEiselLemire(mantissa, exponent);
+			if (isTruncated && res.n != si__floatEiselLemire(mantissa + 1, exponent)) {
+				res.n = si__floatSlow(digits, explicitExponent);
+			}
 		}
 	}
 
-	return (len != 0 && target >= array[t]) ? t : -1;
-}
+	if (isNegative) { res.n |= SI_BIT(63); }
 
-#endif
+	i = end;
+	while (i < str.len && si_charIsSpace((char)data[i])) { i += 1; }
+	*outInvalidIndex = (i >= str.len) ? -1 : end;
 
-SIDEF
-siRune si_runeLower(siRune rune) {
-	if (rune <= SI_ASCII_MAX) {
-		return si_charLower((char)rune);
-	}
+	return res.f;
+}
 
-	isize i;
-	i = si__binarySearch(lowerRange, countof(lowerRange) / 3, rune, 3);
-	if (i != -1 && si_between(i32, rune, lowerRange[i], lowerRange[i + 1])) {
-		return rune + lowerRange[i + 2] - 500;
-	}
-	i = si__binarySearch(lowerSingle, countof(lowerSingle) / 2, rune, 2);
-	if (i != -1 && rune == lowerSingle[i]) {
-		return rune + lowerSingle[i + 1] - 500;
-	}
 
-	return rune;
+inline
+siString si_stringFromBool(bool boolean) {
+	static const siString values[] = {SI_STRC("false"), SI_STRC("true")};
+	return values[boolean & true];
 }
 
 SIDEF
-siRune si_runeUpper(siRune rune) {
-	if (rune <= SI_ASCII_MAX) {
-		return si_charUpper((char)rune);
+b32 si_stringToBool(siString str) {
+	SI_ASSERT_STR(str);
+	SI_STOPIF(str.len == 0, return UINT32_MAX);
+
+	if (str.len == 1) {
+		switch (str.data[0]) {
+			case '1': case 't': case 'T': return true;
+			case '0': case 'f': case 'F': return false;
+			default: return UINT32_MAX;
+		}
 	}
 
-	isize i;
-	i = si__binarySearch(upperRange, countof(upperRange) / 3, rune, 3);
-	if (i != -1 && si_between(i32, rune, upperRange[i], upperRange[i + 1])) {
-		return rune + upperRange[i + 2] - 500;
+	if (si_stringEqual(str, SI_STR("true")) || si_stringEqual(str, SI_STR("True"))) {
+		return true;
 	}
-	i = si__binarySearch(upperSingle, countof(upperSingle) / 2, rune, 2);
-	if (i != -1 && rune == upperSingle[i]) {
-		return rune + upperSingle[i + 1] - 500;
+	else if (si_stringEqual(str, SI_STR("false")) || si_stringEqual(str, SI_STR("False"))) {
+		return false;
 	}
 
-	return rune;
+	return UINT32_MAX;
 }
 
+inline
+bool si_stringHasPrefix(siString str, siString prefix) {
+	return str.len >= prefix.len && (si_memcompareStr(str.data, prefix) == 0);
+}
 
 SIDEF
-bool si_runeIsLower(siRune rune) {
-	if (rune <= SI_ASCII_MAX) {
-		return si_charIsLower((char)rune);
-	}
+isize si_stringPrefixLen(siString str, siString prefix) {
+	SI_STOPIF(prefix.len > str.len, return 0);
 
-	isize i;
-	i = si__binarySearch(upperRange, countof(upperRange) / 3, rune, 3);
-	if (i != -1 && si_between(i32, rune, upperRange[i], upperRange[i + 1])) {
-		return true;
-	}
-	i = si__binarySearch(upperSingle, countof(upperSingle), rune, 1);
-	if (i != -1 && rune == upperSingle[i]) {
-		return true;
+	isize count = 0;
+	for_range (i, 0, str.len) {
+		if (str.data[i] == prefix.data[count]) {
+			count += 1;
+			continue;
+		}
+		break;
 	}
 
-	return false;
+	return count;
 }
 
+inline
+bool si_stringHasSuffix(siString str, siString suffix) {
+	return str.len >= suffix.len
+		&& (si_memcompareStr(&str.data[str.len - suffix.len], suffix) == 0);
+}
 SIDEF
-bool si_runeIsUpper(siRune rune) {
-	if (rune <= SI_ASCII_MAX) {
-		return si_charIsUpper((char)rune);
-	}
+isize si_stringSuffixLen(siString str, siString suffix) {
+	SI_ASSERT_STR(str);
+	SI_ASSERT_STR(suffix);
+	SI_STOPIF(suffix.len > str.len, return 0);
 
+	isize count = suffix.len - 1;
 	isize i;
-	i = si__binarySearch(lowerRange, countof(lowerRange) / 3, rune, 3);
-	if (i != -1 && si_between(i32, rune, lowerRange[i], lowerRange[i + 1])) {
-		return true;
-	}
-	i = si__binarySearch(lowerSingle, countof(lowerSingle), rune, 1);
-	if (i != -1 && rune == lowerSingle[i]) {
-		return true;
-	}
-
-	return false;
-}
-
-SIDEF
-bool si_runeIsSpace(siRune rune) {
-	if (rune <= 0x1680) {
-		switch (rune) {
-			case '\t': case '\n': case '\v': case '\f': case '\r': case ' ':
-			case 0x85: case 0xA0: case 0x1680:
-				return true;
-		}
-		return false;
-	}
-	else if (si_between(i32, rune, 0x2000, 0x200B)) {
-		return true;
+	for (i = str.len - 1; i >= 0; i -= 1) {
+		if (str.data[i] == suffix.data[count]) {
+			count -= 1;
+			continue;
+		}
+		break;
 	}
 
-	return si__binarySearch(spaces, countof(spaces), rune, 1) != -1;
+	return (suffix.len - count) + 1;
 }
 
-inline
-bool si_runeIsDigit(siRune rune) {
-	return (rune <= SI_ASCII_MAX) ? si_charIsDigit((char)rune) : false;
-}
 
-inline
-bool si_runeIsHex(siRune rune) {
-	return (rune <= SI_ASCII_MAX) ? si_charIsHex((char)rune) : false;
-}
 SIDEF
-bool si_runeIsAlpha(siRune rune) {
-	if (rune <= SI_ASCII_MAX) {
-		return si_charIsAlpha((char)rune);
-	}
-	if (si_runeIsUpper(rune) || si_runeIsLower(rune)) {
-		return true;
-	}
-
-	isize i;
-	i = si__binarySearch(alphaRanges, countof(alphaRanges) / 2, rune, 2);
-	if (i != -1 && si_between(i32, rune, alphaRanges[i], alphaRanges[i + 1])) {
-		return true;
-	}
+siString si_stringFromArray(siArrayAny buffer, cstring fmt, siArray(u8) out) {
+	SI_ASSERT_ARR(buffer);
+	SI_ASSERT_NOT_NIL(fmt);
+	SI_ASSERT_ARR_TYPE(out, u8);
+	SI_STOPIF(out.len < 2, return SI_STR_EMPTY);
 
-	i = si__binarySearch(alphaSingle, countof(alphaSingle), rune, 1);
-	if (i != -1 && rune == alphaRanges[i]) {
-		return true;
-	}
+	isize argCount = 0;
+	isize fmtLen = 0;
+	i32 sizes[256] = {0};
+	isize indexes[256];
 
-	return false;
-}
-inline
-bool si_runeIsAlphanumeric(siRune rune) {
-	return si_runeIsDigit(rune) || si_runeIsAlpha(rune);
-}
-inline
-bool si_runeIsPunctuation(siRune rune) {
-	return (rune <= SI_ASCII_MAX) ? si_charIsPrintable((char)rune) : false;
-}
-inline
-bool si_runeIsControl(siRune rune) {
-	return (rune <= SI_ASCII_MAX) ? si_charIsPrintable((char)rune) : false;
-}
-inline
-bool si_runeIsPrintable(siRune rune) {
-	return (rune <= SI_ASCII_MAX) ? si_charIsPrintable((char)rune) : false;
-}
-inline
-bool si_runeIsGraphical(siRune rune) {
-	return (rune <= SI_ASCII_MAX) ? si_charIsGraphical((char)rune) : false;
-}
-inline
-bool si_runeIsDelimiter(siRune rune) {
-	return !(si_runeIsAlphanumeric(rune) || rune == '@' || rune == '#' || rune == '$');
-}
+	{
+		indexes[argCount] = 0;
+		argCount += 1;
 
-inline
-i32 si_runeDigitToInt(siRune rune) {
-	return (rune <= SI_ASCII_MAX) ? si_charDigitToInt((char)rune) : -1;
-}
-inline
-i32 si_runeBase32ToInt(siRune rune) {
-	return (rune <= SI_ASCII_MAX) ? si_charBase32ToInt((char)rune) : -1;
-}
+		while (fmt[fmtLen] != '\0') {
+			SI_STOPIF(fmt[fmtLen] != '%', fmtLen += 1; continue);
 
+			indexes[argCount] = fmtLen;
+			i32* size = &sizes[argCount];
+back:
+			fmtLen += 1;
+			switch (fmt[fmtLen]) {
+				case 'C': SI_PANIC();
 
-inline
-char si_charLower(char c) {
-	if (characterTraits[(u8)c] & SI__LETU) {
-		return c | (char)SI_BIT(5);
-	}
-	return c;
-}
+				case 'h': {
+					if (*size == 0) {
+						if (fmt[fmtLen + 1]== 'h') {
+							fmtLen += 1;
+							*size = si_sizeof(u8);
+						}
+						else {
+							*size = si_sizeof(u16);
+						}
+					}
 
-inline
-char si_charUpper(char c) {
-	if (characterTraits[(u8)c] & SI__LETL) {
-		return c & ~(char)SI_BIT(5);
-	}
-	return c;
-}
+					goto back;
+				}
 
-inline
-bool si_charIsLower(char c) {
-	return (characterTraits[(u8)c] & SI__LETL) != 0;
-}
+				case 'l': {
+					if (*size == 0) {
+						SI_STOPIF(fmt[fmtLen + 1] == 'l', fmtLen += 1);
+						*size = si_sizeof(u64);
+					}
+					goto back;
+				}
 
-inline
-bool si_charIsUpper(char c) {
-	return (characterTraits[(u8)c] & SI__LETU) != 0;
-}
+				case 'z':
+					SI_STOPIF(*size == 0, *size = si_sizeof(usize));
+					goto back;
 
-inline
-bool si_charIsSpace(char c) {
-	return (characterTraits[(u8)c] & SI__SPAC) != 0;
-}
+				case 'j':
+					SI_STOPIF(*size == 0, *size = 8);
+					goto back;
 
-inline
-bool si_charIsDigit(char c) {
-	return (characterTraits[(u8)c] & SI__NUME) != 0;
-}
+				case 'f': case 'F': case 'a': case 'A': case 'e': case 'E': case 'g': case 'G':
+					SI_STOPIF(*size == 0, *size = si_sizeof(f64));
+					break;
 
-inline
-bool si_charIsHex(char c) {
-	return (characterTraits[(u8)c] & SI__HEXA) != 0;
-}
+				case 'S': case 'p':
+					SI_STOPIF(*size == 0, *size = si_sizeof(void*));
+					break;
 
-inline
-bool si_charIsAlpha(char c) {
-	return (characterTraits[(u8)c] & (SI__LETL | SI__LETU)) != 0;
-}
+				case 'x': case 'X': case 'i': case 'O': case 'o': case 'b': case 't':
+				case 'u': case 'd':
+					SI_STOPIF(*size == 0, *size = si_sizeof(u32));
+					break;
 
-inline
-bool si_charIsAlphanumeric(char c) {
-	return (characterTraits[(u8)c] & (SI__LETL | SI__LETU | SI__NUME)) != 0;
-}
+				case 'c':
+					SI_STOPIF(*size == 0, *size = si_sizeof(siRune));
+					break;
 
-inline
-bool si_charIsPunctuation(char c) {
-	return (characterTraits[(u8)c] & SI__PUNC) != 0;
-}
+				case 's':
+					SI_STOPIF(*size == 0, *size = si_sizeof(siString));
+					break;
 
-inline
-bool si_charIsControl(char c) {
-	return (characterTraits[(u8)c] & SI__CTRL) != 0;
-}
+				case 'L':
+					SI_STOPIF(*size == 0, *size = si_sizeof(siCallerLoc));
+					break;
 
-inline
-bool si_charIsPrintable(char c) {
-	return (characterTraits[(u8)c] & (SI__LETL | SI__LETU | SI__NUME | SI__PUNC | SI__SPAC)) != 0;
-}
 
-inline
-bool si_charIsGraphical(char c) {
-	return (characterTraits[(u8)c] & (SI__LETL | SI__LETU | SI__NUME | SI__PUNC)) != 0;
-}
+				case '%': case 'n':
+					*size = 0;
+					break;
 
+				case '*': case '.': case '-': case '+': case ' ': case '0':
+				case '1': case '2': case '3': case '4': case '5': case '6':
+				case '7': case '8': case '9': case '#':
+					goto back;
 
-inline
-bool si_charIsDelimiter(char c) {
-	return !(si_charIsAlphanumeric(c) || c == '@' || c == '#' || c == '$');
-}
+				default: continue;
+			}
 
-inline
-i32 si_charDigitToInt(char c) {
-	if (characterTraits[(u8)c] & SI__NUME) {
-		return (c - '0');
+			argCount += 1;
+		}
+		SI_ASSERT_MSG(argCount <= countof(sizes), "The format str has surpassed the maximum amount of allowed modifiers.");
 	}
 
-	return -1;
-}
-SIDEF
-i32 si_charBase32ToInt(char c) {
-	u8 trait = characterTraits[(u8)c];
-
-	if (trait & SI__NUME) {
-		return si_charDigitToInt(c);
-	}
-	else if ((trait & SI__LETL) == SI__LETL) {
-		return c - 'a' + 10;
-	}
-	else if ((trait & SI__LETU) == SI__LETU) {
-		return c - 'A' + 10;
-	}
+	si_arraySet(out, 0, "{");
+	isize length = 1;
 
-	return -1;
-}
+	for_range (i, 0, buffer.len) {
 
-#undef SI__CTRL
-#undef SI__PUNC
-#undef SI__NUME
-#undef SI__SPAC
-#undef SI__LETU
-#undef SI__LETL
-#undef SI__HEXA
+		isize baseLen = 0;
+		for_range (j, 0, argCount) {
+			i32 size = sizes[j];
+			isize index = indexes[j];
+			isize nextIndex = (j < argCount - 1 ? indexes[j + 1] : fmtLen);
 
-#undef SI__LTXU
-#undef SI__LTXL
-#undef SI__CTRS
-#undef SI__NUMX
-
-#endif /* SI_IMPLEMENTATION_CHAR */
+			siString substr = SI_STR_LEN(&fmt[index], nextIndex - index);
+			void* base = (u8*)si_arrayGet(buffer, i) + baseLen;
+			baseLen += size;
 
-#ifdef SI_IMPLEMENTATION_HASHING
+			switch (size) {
+				case 0:  length += si_bprintf(si_sliceFrom(out, length), substr).len; break;
+				case si_sizeof(u8):  length += si_bprintf(si_sliceFrom(out, length), substr, *(u8*)base).len; break;
+				case si_sizeof(u16):  length += si_bprintf(si_sliceFrom(out, length), substr, *(u16*)base).len; break;
+				case si_sizeof(u32):  length += si_bprintf(si_sliceFrom(out, length), substr, *(u32*)base).len; break;
+				case si_sizeof(u64):  length += si_bprintf(si_sliceFrom(out, length), substr, *(u64*)base).len; break;
+				#if SI_ARCH_IS_64BIT
+				case si_sizeof(siString): length += si_bprintf(si_sliceFrom(out, length), substr, *(siString*)base).len; break;
+				#endif
+				case si_sizeof(siCallerLoc): length += si_bprintf(si_sliceFrom(out, length), substr, *(siCallerLoc*)base).len; break;
+				default: SI_PANIC();
+			}
+		}
 
-SIDEF
-u32 si_fnv32(const void* data, isize len) {
-	SI_ASSERT_NOT_NIL(data);
-	SI_ASSERT_NOT_NEG(len);
+		if (i != buffer.len - 1) {
+			length += si_memcopyStr_s(si_sliceFrom(out, length), SI_STR(", "));
+		}
+		SI_STOPIF(length >= out.len, return SI_STR_LEN(out.data, length));
+	}
 
-	u32 hash = 0x811C9DC5;
-	const u8* ptr = (u8*)data;
-	for_range (i, 0, len) {
-		hash = (hash * 0x01000193) ^ ptr[i];
+	if (length < out.len) {
+		si_arraySet(out, length, "}");
+		length += 1;
 	}
 
-	return hash;
+	return SI_STR_LEN(out.data, length);
 }
 
-SIDEF
-u32 si_fnv32a(const void* data, isize len) {
-	SI_ASSERT_NOT_NIL(data);
-	SI_ASSERT_NOT_NEG(len);
-
-	u32 hash = 0x811C9DC5;
-	const u8* ptr = (u8*)data;
-	for_range (i, 0, len) {
-		hash = (hash ^ ptr[i]) * 0x01000193;
-	}
-
-	return hash;
+inline
+siOsString si_stringToOsStr(siString str, siArray(siOsChar) out) {
+	isize copied;
+	return si_stringToOsStrEx(str, out, &copied);
 }
 
+
 SIDEF
-u64 si_fnv64(const void* data, isize len) {
-	SI_ASSERT_NOT_NIL(data);
-	SI_ASSERT_NOT_NEG(len);
+siOsString si_stringToOsStrEx(siString str, siArray(siOsChar) out, isize* copied) {
+	SI_ASSERT(out.typeSize == si_sizeof(siOsChar));
+	SI_ASSERT_NOT_NIL(copied);
 
-	u64 hash = 0xCBF29CE484222325;
-	const u8* ptr = (u8*)data;
-	for_range (i, 0, len) {
-		hash = (hash * 0x100000001B3) ^ ptr[i];
-	}
+#ifdef SI_SYSTEM_IS_WINDOWS
+	SI_STOPIF(out.len == 0, *copied = -1; return nil);
 
-	return hash;
-}
+	siUtf16String res = si_utf8ToUtf16StrEx(str, true, out);
+	*copied = res.len;
 
-SIDEF
-u64 si_fnv64a(const void* data, isize len) {
-	SI_ASSERT_NOT_NIL(data);
-	SI_ASSERT_NOT_NEG(len);
+	return (siOsString)res.data;
 
-	u64 hash = 0xCBF29CE484222325;
-	const u8* ptr = (u8*)data;
-	for_range (i, 0, len) {
-		hash = (hash ^ ptr[i]) * 0x100000001B3;
-	}
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	SI_STOPIF(out.len == 0, *copied = -1; return nil);
 
-	return hash;
-}
+	isize len = si_memcopyStr_s(si_sliceTo(out, out.len - 1), str);
+	*((u8*)out.data + len) = '\0';
+	*copied = len + 1;
 
-inline
-u32 si_murmur32(const void* data, isize len) {
-	return si_murmur32Ex(data, len, 0x9747B28C);
+	return (siOsChar*)out.data;
+
+#else
+	*copied = 0;
+	return (siOsString)str.data;
+#endif
 }
 
+#endif /* SI_IMPLEMENTATION_STRING */
 
-force_inline
-u32 si__murmur32Scramble(u32 key) {
-	key *= 0xCC9E2D51;
-	key = (key << 15) | (key >> 17);
-	key *= 0x1B873593;
-	return key;
-}
+#ifdef SI_IMPLEMENTATION_OPTIONAL
 
 SIDEF
-u32 si_murmur32Ex(const void* data, isize len, u32 seed) {
-	SI_ASSERT_NOT_NIL(data);
-	SI_ASSERT_NOT_NEG(len);
-
-	u32 hash = seed;
-	const u32* blocks = (const u32*)data;
+siError si__errorDeclare(i32 error, siErrorProc proc, void* userData, siCallerLoc call) {
+	siError res;
+	res.code = error;
+#ifndef SI_NO_ERROR_STRUCT
+	res.time = si_timeNowUTC();
+	res.location = call;
+#else
+	SI_UNUSED(call);
+#endif
 
-	for_range (i, 0, len / 4) {
-		u32 key = blocks[i];
-		hash ^= si__murmur32Scramble(key);
-		hash = ((hash << 13) | (hash >> 19)) * 5 + 0xE6546B64;
+#ifndef SI_NO_ERROR_LOGS
+	if (proc != nil) {
+		bool status = proc(&res, userData);
+		SI_STOPIF(!status, si_exit(1));
 	}
-
-	u32 key = 0;
-	for (isize i = len & 3; i >= 0; i -= 1) {
-		key <<= 8;
-		key |= ((const u8*)data)[i - 1];
+	else {
+		siPrintColor red = si_printColor3bitEx(siPrintColor3bit_Red, true, false);
+		si_fprintf(
+			si_stderr, SI_STR("%CError at \"%L\"%C: Number '%i'.\n"),
+			red, res.location, res.code
+		);
 	}
+#else
+	SI_UNUSED(proc); SI_UNUSED(userData);
 
-	hash ^= si__murmur32Scramble(key);
-	hash ^= (u32)len;
-	hash ^= hash >> 16;
-	hash *= 0x85EBCA6B;
-	hash ^= hash >> 13;
-	hash *= 0xC2B2AE35;
-	hash ^= hash >> 16;
-	return hash;
-}
-
-#if SI_ARCH_IS_32BIT
-force_inline
-void si__murmur64Scramble(u32* h, const u32* d) {
-	u32 k = *d;
-	k *= 0x5BD1E995;
-	k ^= k >> 24;
-	k *= 0x5BD1E995;
-	*h *= 0x5BD1E995;
-	*h ^= k;
-}
 #endif
 
-
-SIDEF
-u64 si_murmur64(const void* data, isize len) {
-	return si_murmur64Ex(data, len, 0x9747B28C);
+	return res;
 }
-SIDEF
-u64 si_murmur64Ex(const void* data, isize len, u64 seed) {
-	SI_ASSERT_NOT_NIL(data);
-	SI_ASSERT_NOT_NEG(len);
 
-#if SI_ARCH_IS_64BIT
-	const u64 m = 0xC6A4A7935BD1E995;
-	const i32 r = 47;
+#endif /* SI_IMPLEMENTATION_OPTIONAL */
 
-	u64 hash = seed ^ ((u64)len * m);
+#ifdef SI_IMPLEMENTATION_UNICODE
 
+#define FAILURE 12
 
-	for_range (i, 0, len / 8) {
-		u64 k = ((const u64*)data)[i];
+SIDEF
+siUtf32Char si_utf8Decode(const u8* character) {
+	u32 state = 0;
+	i32 codepoint;
+	const u8* next = character;
+
+	do {
+		/* Copyright (c) 2008-2010 Bjoern Hoehrmann <bjoern@hoehrmann.de> */
+		/* See http://bjoern.hoehrmann.de/utf-8/decoder/dfa/ for details. */
+		static const u8 utf8d[] = {
+			/* The first part of the table maps bytes to character classes that */
+			/* to reduce the size of the transition table and create bitmasks. */
+			0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+			0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+			0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+			0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+			1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,  9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+			7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,  7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+			8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+			10,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3, 11,6,6,6,5,8,8,8,8,8,8,8,8,8,8,8,
+			/* The second part is a transition table that maps a combination */
+			/* of a state of the automaton and a character class to a state. */
+			0,12,24,36,60,96,84,12,12,12,48,72, 12,12,12,12,12,12,12,12,12,12,12,12,
+			12, 0,12,12,12,12,12, 0,12, 0,12,12, 12,24,12,12,12,12,12,24,12,24,12,12,
+			12,12,12,12,12,12,12,24,12,12,12,12, 12,24,12,12,12,12,12,12,12,24,12,12,
+			12,12,12,12,12,12,12,36,12,36,12,12, 12,36,12,12,12,12,12,36,12,36,12,12,
+			12,36,12,12,12,12,12,12,12,12,12,12,
+		 };
 
-		k *= m;
-		k ^= k >> r;
-		k *= m;
+		u8 byte = *next;
+		u32 type = utf8d[byte];
 
-		hash ^= k;
-		hash *= m;
-	}
+		codepoint = (state != 0)
+			? ((byte & 0x3F) | (codepoint << 6))
+			: ((0xFF >> type) & byte);
+		state = utf8d[256 + state + type];
 
-	isize i = (len & 7u) - 1;
-	hash ^= (u64)(((const u8*)data)[i] << (i * 8));
+		next += 1;
+	} while (state != 0 && state != FAILURE);
 
-	hash ^= hash >> r;
-	hash *= m;
-	hash ^= hash >> r;
+	if (state == FAILURE) {
+		return SI_UTF32_INVALID;
+	}
 
-	return hash;
-#else
+	siUtf32Char res;
+	res.codepoint = codepoint;
+	res.len = (i32)si_pointerDiff(character, next);
 
-	u32 h[2] = {(u32)seed ^ (u32)len, seed >> 32};
+	return res;
+}
+#undef FAILURE
 
-	const u32* d = (const u32*)data;
+SIDEF
+siUtf8Char si_utf8Encode(i32 codepoint) {
+	siUtf8Char res;
 
-	while (len >= 8) {
-		for_range (i, 0, 2) {
-			si__murmur64Scramble(&h[i], d);
-			d += 1;
-			len -= 4;
+	if (codepoint <= 0x7F) {
+		res.codepoint[0] = (u8)codepoint;
+		res.len = 1;
+		return res;
+	}
+	else if (codepoint <= 0x7FF) {
+		res.codepoint[0] = (u8)(0xC0 | (codepoint >> 6));
+		res.codepoint[1] = (u8)(0x80 | (codepoint & 0x3F));
+		res.len = 2;
+	}
+	else if (codepoint <= 0xFFFF) {
+		if (si_between(i32, codepoint, 0xD800, 0xDFFF)) {
+			return SI_UTF8_INVALID;
 		}
+		res.codepoint[0] = (u8)(0xE0 | (codepoint >> 12));
+		res.codepoint[1] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));
+		res.codepoint[2] = (u8)(0x80 | (codepoint & 0x3F));
+		res.len = 3;
 	}
-
-	if (len >= 4) {
-		si__murmur64Scramble(&h[0], d);
-		d += 1;
-		len -= 4;
+	else if (codepoint <= 0x10FFFF) {
+		res.codepoint[0] = (u8)(0xF0 | (codepoint >> 18));
+		res.codepoint[1] = (u8)(0x80 | ((codepoint >> 12) & 0x3F));
+		res.codepoint[2] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));
+		res.codepoint[3] = (u8)(0x80 | (codepoint & 0x3F));
+		res.len = 4;
 	}
+	else return SI_UTF8_INVALID;
 
-	u32 const m = 0x5BD1E995;
-	isize i = len - 1;
-	h[0] ^= (u32)(((const u8*)data)[i] << (i * 8));
-	h[1] *= m;
-
-	h[0] ^= h[1] >> 18;
-	h[0] *= m;
-	h[1] ^= h[0] >> 22;
-	h[1] *= m;
-	h[0] ^= h[1] >> 17;
-	h[0] *= m;
-	h[1] ^= h[0] >> 19;
-	h[1] *= m;
 
-	return ((u64)h[0] << 32) | h[1];
-#endif
+	return res;
 }
 
-#endif /* SI_IMPLEMENTATION_HASHING */
-
-#ifdef SI_IMPLEMENTATION_MAP
-
-
-SIDEF
-siMapAny si_mapMakeFull(const void* input, isize len, isize structTypeSize, isize valueTypeSize, siAllocator alloc) {
-	siMapAny map = si_mapReserve(valueTypeSize, len, alloc);
-	if (map.entries == nil) { return map; }
-
-	for_range (i, 0, len) {
-		const void* entry = si_pointerAddConst(input, i * structTypeSize);
-		si_mapSet(&map, *(siString*)entry, si_pointerAddConst(entry, si_sizeof(siString)));
-	}
-
-	return map;
-}
-
-#define SI_HASH_NONE UINT32_MAX
+inline
+siUtf16String si_utf8ToUtf16Str(siUtf8String str, siArray(u16) out) {
+	return si_utf8ToUtf16StrEx(str, false, out);
+}
 
 SIDEF
-siMapAny si_mapReserve(isize typeSize, isize capacity, siAllocator alloc) {
-	SI_ASSERT_NOT_NEG(typeSize);
-	SI_ASSERT_NOT_NEG(capacity);
+siUtf16String si_utf8ToUtf16StrEx(siUtf8String str, bool nullTerm, siArray(u16) out) {
+	SI_ASSERT_STR(str);
+	SI_ASSERT_ARR_TYPE(out, u16);
+	SI_STOPIF(str.len == 0 || out.len == 0, return SI_ARR_LEN((u16*)nil, 0));
 
-	siMapAny map;
-	map.alloc = alloc;
-	map.len = 0;
-	map.capacity = si_nextPow2(capacity);
-	map.typeSize = typeSize;
+	isize capacity = out.len - (i32)(nullTerm & true);
+	u16* data = (u16*)out.data;
 
-	isize lenEntries = si_alignForward(si_sizeof(*map.entries) * map.capacity, SI_DEFAULT_MEMORY_ALIGNMENT),
-		  lenHashes = si_alignForward(si_sizeof(*map.hashes) * map.capacity, SI_DEFAULT_MEMORY_ALIGNMENT);
+	isize inpI = 0, outI = 0;
+	while (inpI < str.len && outI < capacity) {
+		siUtf32Char utf32 = si_utf8Decode(&str.data[inpI]);
 
-	void* ptr = si_allocNonZeroed(alloc, lenEntries + lenHashes + map.typeSize * map.capacity);
-	if (ptr == nil) { return SI_TYPE_ZERO(siMapAny); }
+		i32 codepoint = utf32.codepoint;
+		inpI += utf32.len;
 
-	map.entries = (siMapEntry*)ptr;
-	map.hashes = (u32*)si_pointerAdd(map.entries, lenEntries);
-	map.values = (void*)si_pointerAdd(map.hashes, lenHashes);
+		if (codepoint == 0) {
+			break;
+		}
+		else if (codepoint < 0xFFFF) {
+			data[outI] = (u16)codepoint;
+			outI += 1;
+		}
+		else {
+			i32 t = codepoint - 0x10000;
+			data[outI + 0] = (u16)((t << 10) + 0xD800),
+			data[outI + 1] = (u16)(t + 0xDC00);
+			outI += 2;
+		}
+	}
 
-	for_range (i, 0, map.capacity) {
-		map.entries[i].hash = SI_HASH_NONE;
-		map.entries[i].next = SI_HASH_NONE;
-		map.hashes[i] = SI_HASH_NONE;
+	if (nullTerm) {
+		data[outI] = '\0';
+		outI+= 1;
 	}
 
-	return map;
+	return SI_ARR_LEN(data, outI);
 }
 
-force_inline
-u32 si__mapHash(siString name) {
-	return si_fnv32a(name.data, name.len) & 0x7FFFFFFF;
+inline
+siUtf8String si_utf16ToUtf8Str(siUtf16String str, siArray(u8) out) {
+	return si_utf16ToUtf8StrEx(str, false, out);
 }
 
-typedef struct { u32 hashIndex, entryIndex, entryPrev; } __siMapSearch;
-
-siIntern
-__siMapSearch si__mapFind(siMapAny map, u32 hash, siString key) {
-	__siMapSearch res = {SI_HASH_NONE, SI_HASH_NONE, SI_HASH_NONE};
-	SI_STOPIF(map.capacity == 0, return res);
+SIDEF
+siUtf8String si_utf16ToUtf8StrEx(siUtf16String str, bool nullTerm, siArray(u8) out) {
+	SI_ASSERT_ARR_TYPE(str, u16);
+	SI_ASSERT_ARR_TYPE(out, u8);
+	SI_STOPIF(str.len == 0 || out.len == 0, return SI_STR_EMPTY);
 
-	res.hashIndex = hash & (u32)(map.capacity - 1);
-	res.entryIndex = map.hashes[res.hashIndex];
+	isize capacity = out.len - (i32)(nullTerm & true);
+	isize inpI = 0, outI = 0;
+	u8* data = (u8*)out.data;
 
-	while (res.entryIndex != SI_HASH_NONE) {
-		siMapEntry entry = map.entries[res.entryIndex];
-		if (entry.hash == hash && si_stringEqual(entry.key, key)) {
-			return res;
+	while (inpI < str.len) {
+		siUtf8Char utf8 = si_utf16Encode((u16*)si_arrayGet(str, inpI));
+		if (outI + utf8.len > capacity || utf8.codepoint[0] == '\0') {
+			break;
 		}
 
-		res.entryPrev = res.entryIndex;
-		res.entryIndex = entry.next;
+		outI += si_memcopy(&data[outI], utf8.codepoint, utf8.len);
+		inpI += 1 + (utf8.len == 4);
 	}
 
-	return res;
-}
-
+	if (nullTerm) {
+		data[outI] = '\0';
+		outI += 1;
+	}
 
-SIDEF
-void* si_mapGet(siMapAny map, siString name) {
-	return si_mapGetHash(map, name, si__mapHash(name));
-}
-SIDEF
-void* si_mapGetHash(siMapAny map, siString name, u32 hash) {
-	__siMapSearch search = si__mapFind(map, hash, name);
-	return (search.entryIndex != SI_HASH_NONE)
-		? si_pointerAdd(map.values, (isize)search.entryIndex * map.typeSize)
-		: nil;
+	return SI_STR_LEN(data, outI);
 }
 
 SIDEF
-void* si_mapSet(siMapAny* map, siString name, const void* value) {
-	return si_mapSetHash(map, name, value, si__mapHash(name));
+isize si_utf16ToUtf8StrLen(siUtf16String str) {
+	SI_ASSERT_ARR_TYPE(str, u16);
+
+	isize count = 0;
+	isize i = 0;
+
+	while (i < str.len) {
+		siUtf32Char character = si_utf16Decode((u16*)si_arrayGet(str, i));
+		count += character.len;
+		i += 1 + (character.len == 4);
+	}
+
+	return count;
 }
 
 SIDEF
-void* si_mapSetHash(siMapAny* map, siString name, const void* value,
-		u32 hash) {
-	SI_ASSERT_NOT_NIL(map);
-	SI_ASSERT_STR(name);
-	SI_ASSERT_NOT_NIL(value);
-	SI_ASSERT_MSG(map->len < map->capacity, "The capacity of the map has been surpassed.");
-
-	__siMapSearch find = si__mapFind(*map, hash, name);
+siUtf32Char si_utf16Decode(const u16 character[2]) {
+	siUtf32Char res;
+	i32 chr = character[0];
 
-	u32 index;
-	if (find.entryIndex != SI_HASH_NONE) {
-		index = find.entryIndex;
+	if (!si_between(i32, chr, 0xD800, 0xDBFF)) {
+		res.codepoint = chr;
+		res.len = 1 + (chr >= 0x80) + (chr >= 0x800);
 	}
 	else {
-		index = (u32)map->len;
-
-		siMapEntry* entry = &map->entries[index];
-		entry->key = name;
-		entry->hash = hash;
-		entry->next = SI_HASH_NONE;
-		map->len += 1;
+		i32 high = (chr - 0xD800) << 10,
+			low = character[1] - 0xDC00;
 
-		if (find.entryPrev != SI_HASH_NONE) {
-			map->entries[find.entryPrev].next = index;
-		}
-		else {
-			map->hashes[find.hashIndex] = index;
-		}
+		res.codepoint = (high | low) + 0x10000;
+		res.len = 4;
 	}
 
-	void* res = si_pointerAdd(map->values, (isize)index * map->typeSize);
-	si_memcopy(res, value, map->typeSize);
-
 	return res;
 }
 
 SIDEF
-void si_mapErase(siMapAny* map, siString name) {
-	si_mapEraseHash(map, name, si__mapHash(name));
-}
-
-SIDEF
-void si_mapEraseHash(siMapAny* map, siString name, u32 hash) {
-	SI_ASSERT_NOT_NIL(map);
-	SI_ASSERT_STR(name);
-	SI_STOPIF(map->capacity == 0, return);
-
-	__siMapSearch find = si__mapFind(*map, hash, name);
-	SI_STOPIF(find.entryIndex == SI_HASH_NONE, return);
+siUtf8Char si_utf16Encode(const u16 character[2]) {
+	siUtf8Char res;
+	u8* data = res.codepoint;
+	u32 chr = character[0];
 
-	if (find.entryPrev == SI_HASH_NONE) {
-		map->hashes[find.hashIndex] = map->entries[find.entryIndex].next;
+	if (chr <= 0xFF) {
+		data[0] = (u8)chr;
+		res.len = 1;
 	}
-	else {
-		map->entries[find.entryPrev].next = map->entries[find.entryIndex].next;
+	else if (chr <= 0x7FF) {
+		data[0] = (u8)(0xC0 | (chr >> 6));
+		data[1] = (u8)(0x80 | (chr & 0x3F));
+		res.len = 2;
 	}
-
-	map->len -= 1;
-	if ((isize)find.entryIndex == map->len) {
-		return;
+	else if (chr <= 0xD7FF) {
+		data[0] = (u8)(0xE0 | (chr >> 12));           /* 1110xxxx */
+		data[1] = (u8)(0xE0 | ((chr >> 6) & 0x3F));   /* 10xxxxxx */
+		data[2] = (u8)(0xE0 | (chr & 0x3F));          /* 10xxxxxx */
+		res.len = 3;
 	}
+	else if (chr >= 0xD800) {
+		u32 high = (chr - 0xD800u) << 10,
+			low  = character[1] - 0xDC00u;
+		u32 codepoint = (high | low) + 0x10000;
 
-	siMapEntry* entryLast = &map->entries[map->len];
-	map->entries[find.entryIndex] = *entryLast;
-
-	__siMapSearch last = si__mapFind(*map, entryLast->hash, entryLast->key);
-	if (last.entryPrev != SI_HASH_NONE) {
-		map->entries[last.entryPrev].next = find.entryIndex;
-	}
-	else {
-		map->hashes[last.hashIndex] = find.entryIndex;
+		data[0] = (u8)(0xF0 | (codepoint >> 18));           /* 11110xxx */
+		data[1] = (u8)(0x80 | ((codepoint >> 12) & 0x3F));  /* 10xxxxxx */
+		data[2] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));   /* 10xxxxxx */
+		data[3] = (u8)(0x80 | (codepoint & 0x3F));          /* 10xxxxxx */
+		res.len = 4;
 	}
+
+	return res;
 }
 
-SIDEF
-void si_mapClear(siMapAny* map) {
-	SI_ASSERT_NOT_NIL(map);
+#endif /* SI_IMPLEMENTATION_UNICODE */
 
-	for_range (i, 0, map->len) {
-		siMapEntry entry = map->entries[i];
-		__siMapSearch find = si__mapFind(*map, entry.hash, entry.key);
-		map->hashes[find.entryIndex] = SI_HASH_NONE;
-	}
-	map->len = 0;
-}
+#ifdef SI_IMPLEMENTATION_CHAR
 
-inline
-void si_mapFree(siMapAny map) {
-	si_free(map.alloc, map.entries);
-}
+#if 1
+#define SI__CTRL SI_BIT(0) /* Control characters. */
+#define SI__PUNC SI_BIT(1) /* Punctuation characters. */
+#define SI__NUME SI_BIT(2) /* Numeric digits. */
+#define SI__SPAC SI_BIT(3) /* Space characters. */
+#define SI__LETU SI_BIT(4) /* Uppercase letters. */
+#define SI__LETL SI_BIT(5) /* Lowercase letters. */
+#define SI__HEXA SI_BIT(6) /* Hexadecimal characters. */
 
-#undef SI_HASH_NONE
+#define SI__LTXU (SI__LETU | SI__HEXA)
+#define SI__LTXL (SI__LETL | SI__HEXA)
+#define SI__CTRS (SI__CTRL | SI__SPAC)
+#define SI__NUMX (SI__NUME | SI__HEXA)
 
-#endif /* SI_IMPLEMENTATION_MAP */
+const u8 characterTraits[SI_ASCII_MAX + 1] = {
+	SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL,
 
-#ifdef SI_IMPLEMENTATION_BIT
+	SI__CTRS, SI__CTRS, SI__CTRS, SI__CTRS, SI__CTRS,
 
-#define SI_BIT_DEC_AMOUNT_IMPL(func, def, body, retVal) \
-	def u8 si__##func##_u8(u8 x, i32 amount) { body return (u8)(retVal); } \
-	def u16 si__##func##_u16(u16 x, i32 amount) { body return (u16)(retVal); } \
-	def u32 si__##func##_u32(u32 x, i32 amount) { body return (u32)(retVal); } \
-	def u64 si__##func##_u64(u64 x, i32 amount) { body return (u64)(retVal); } \
-	def usize si__##func##_usize(usize x, i32 amount) { body return (usize)(retVal); }
+	SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL,
+	SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL, SI__CTRL,
+
+	SI__SPAC,
+
+	SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC,
+	SI__PUNC, SI__PUNC, SI__PUNC,
+
+	SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX, SI__NUMX,
+
+	SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC,
+
+	SI__LTXU, SI__LTXU, SI__LTXU, SI__LTXU, SI__LTXU, SI__LTXU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU,
+	SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU, SI__LETU,
+	SI__LETU, SI__LETU,
+
+	SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC,
+
+	SI__LTXL, SI__LTXL, SI__LTXL, SI__LTXL, SI__LTXL, SI__LTXL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL,
+	SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL, SI__LETL,
+	SI__LETL, SI__LETL,
+
+	SI__PUNC, SI__PUNC, SI__PUNC, SI__PUNC,
+	SI__CTRL
+};
+
+const u16 alphaRanges[] = {
+	0x00D8, 0x00F6, 0x00F8, 0x01F5, 0x0250, 0x02A8, 0x038E, 0x03A1, 0x03A3, 0x03CE, 0x03D0, 0x03D6, 0x03E2, 0x03F3, 0x0490,
+	0x04C4, 0x0561, 0x0587, 0x05D0, 0x05EA, 0x05F0, 0x05F2, 0x0621, 0x063A, 0x0640, 0x064A, 0x0671, 0x06B7, 0x06BA, 0x06BE,
+	0x06C0, 0x06CE, 0x06D0, 0x06D3, 0x0905, 0x0939, 0x0958, 0x0961, 0x0985, 0x098C, 0x098F, 0x0990, 0x0993, 0x09A8, 0x09AA,
+	0x09B0, 0x09B6, 0x09B9, 0x09DC, 0x09DD, 0x09DF, 0x09E1, 0x09F0, 0x09F1, 0x0A05, 0x0A0A, 0x0A0F, 0x0A10, 0x0A13, 0x0A28,
+	0x0A2A, 0x0A30, 0x0A32, 0x0A33, 0x0A35, 0x0A36, 0x0A38, 0x0A39, 0x0A59, 0x0A5C, 0x0A85, 0x0A8B, 0x0A8F, 0x0A91, 0x0A93,
+	0x0AA8, 0x0AAA, 0x0AB0, 0x0AB2, 0x0AB3, 0x0AB5, 0x0AB9, 0x0B05, 0x0B0C, 0x0B0F, 0x0B10, 0x0B13, 0x0B28, 0x0B2A, 0x0B30,
+	0x0B32, 0x0B33, 0x0B36, 0x0B39, 0x0B5C, 0x0B5D, 0x0B5F, 0x0B61, 0x0B85, 0x0B8A, 0x0B8E, 0x0B90, 0x0B92, 0x0B95, 0x0B99,
+	0x0B9A, 0x0B9E, 0x0B9F, 0x0BA3, 0x0BA4, 0x0BA8, 0x0BAA, 0x0BAE, 0x0BB5, 0x0BB7, 0x0BB9, 0x0C05, 0x0C0C, 0x0C0E, 0x0C10,
+	0x0C12, 0x0C28, 0x0C2A, 0x0C33, 0x0C35, 0x0C39, 0x0C60, 0x0C61, 0x0C85, 0x0C8C, 0x0C8E, 0x0C90, 0x0C92, 0x0CA8, 0x0CAA,
+	0x0CB3, 0x0CB5, 0x0CB9, 0x0CE0, 0x0CE1, 0x0D05, 0x0D0C, 0x0D0E, 0x0D10, 0x0D12, 0x0D28, 0x0D2A, 0x0D39, 0x0D60, 0x0D61,
+	0x0E01, 0x0E30, 0x0E32, 0x0E33, 0x0E40, 0x0E46, 0x0E5A, 0x0E5B, 0x0E81, 0x0E82, 0x0E87, 0x0E88, 0x0E94, 0x0E97, 0x0E99,
+	0x0E9F, 0x0EA1, 0x0EA3, 0x0EAA, 0x0EAB, 0x0EAD, 0x0EAE, 0x0EB2, 0x0EB3, 0x0EC0, 0x0EC4, 0x0EDC, 0x0EDD, 0x0F18, 0x0F19,
+	0x0F40, 0x0F47, 0x0F49, 0x0F69, 0x10D0, 0x10F6, 0x1100, 0x1159, 0x115F, 0x11A2, 0x11A8, 0x11F9, 0x1E00, 0x1E9B, 0x1F50,
+	0x1F57, 0x1F80, 0x1FB4, 0x1FB6, 0x1FBC, 0x1FC2, 0x1FC4, 0x1FC6, 0x1FCC, 0x1FD0, 0x1FD3, 0x1FD6, 0x1FDB, 0x1FE0, 0x1FEC,
+	0x1FF2, 0x1FF4, 0x1FF6, 0x1FFC, 0x210A, 0x2113, 0x2115, 0x211D, 0x2120, 0x2122, 0x212A, 0x2131, 0x2133, 0x2138, 0x3041,
+	0x3094, 0x30A1, 0x30FA, 0x3105, 0x312C, 0x3131, 0x318E, 0x3192, 0x319F, 0x3260, 0x327B, 0x328A, 0x32B0, 0x32D0, 0x32FE,
+	0x3300, 0x3357, 0x3371, 0x3376, 0x337B, 0x3394, 0x3399, 0x339E, 0x33A9, 0x33AD, 0x33B0, 0x33C1, 0x33C3, 0x33C5, 0x33C7,
+	0x33D7, 0x33D9, 0x33DD, 0x4E00, 0x9FFF, 0xAC00, 0xD7A3, 0xF900, 0xFB06, 0xFB13, 0xFB17, 0xFB1F, 0xFB28, 0xFB2A, 0xFB36,
+	0xFB38, 0xFB3C, 0xFB40, 0xFB41, 0xFB43, 0xFB44, 0xFB46, 0xFBB1, 0xFBD3, 0xFD3D, 0xFD50, 0xFD8F, 0xFD92, 0xFDC7, 0xFDF0,
+	0xFDF9, 0xFE70, 0xFE72, 0xFE76, 0xFEFC, 0xFF66, 0xFF6F, 0xFF71, 0xFF9D, 0xFFA0, 0xFFBE, 0xFFC2, 0xFFC7, 0xFFCA, 0xFFCF,
+	0xFFD2, 0xFFD7, 0xFFDA, 0xFFDC
+};
+
+const u16 alphaSingle[] = {
+	0x00AA, 0x00B5, 0x00BA, 0x03DA, 0x03DC, 0x03DE, 0x03E0, 0x06D5, 0x09B2, 0x0A5E, 0x0A8D, 0x0AE0, 0x0B9C, 0x0CDE, 0x0E4F,
+	0x0E84, 0x0E8A, 0x0E8D, 0x0EA5, 0x0EA7, 0x0EB0, 0x0EBD, 0x1FBE, 0x207F, 0x20A8, 0x2102, 0x2107, 0x2124, 0x2126, 0x2128,
+	0xFB3E, 0xFE74
+};
+
+const u16 spaces[] = {
+	0x200A, 0x200B, 0x200E, 0x200F, 0x2028, 0x2029, 0x3000, 0x202F, 0x205f, 0x3000, 0xFEFF
+};
+
+const u16 lowerRange[] = {
+	0x00c0,  0x00d6, 532, 0x00d8,  0x00de, 532, 0x0189,  0x018a, 705, 0x018e,  0x018f, 702, 0x01b1,  0x01b2, 717,
+	0x0388,  0x038a, 537, 0x038e,  0x038f, 563, 0x0391,  0x03a1, 532, 0x03a3,  0x03ab, 532, 0x0401,  0x040c, 580,
+	0x040e,  0x040f, 580, 0x0410,  0x042f, 532, 0x0531,  0x0556, 548, 0x10a0,  0x10c5, 548, 0x1f08,  0x1f0f, 492,
+	0x1f18,  0x1f1d, 492, 0x1f28,  0x1f2f, 492, 0x1f38,  0x1f3f, 492, 0x1f48,  0x1f4d, 492, 0x1f68,  0x1f6f, 492,
+	0x1f88,  0x1f8f, 492, 0x1f98,  0x1f9f, 492, 0x1fa8,  0x1faf, 492, 0x1fb8,  0x1fb9, 492, 0x1fba,  0x1fbb, 426,
+	0x1fc8,  0x1fcb, 414, 0x1fd8,  0x1fd9, 492, 0x1fda,  0x1fdb, 400, 0x1fe8,  0x1fe9, 492, 0x1fea,  0x1feb, 388,
+	0x1ff8,  0x1ff9, 372, 0x1ffa,  0x1ffb, 374, 0x2160,  0x216f, 516, 0x24b6,  0x24cf, 526, 0xff21,  0xff3a, 532,
+};
+
+const u16 lowerSingle[] = {
+	0x0100, 501, 0x0102, 501, 0x0104, 501, 0x0106, 501, 0x0108, 501, 0x010a, 501, 0x010c, 501, 0x010e, 501, 0x0110, 501,
+	0x0112, 501, 0x0114, 501, 0x0116, 501, 0x0118, 501, 0x011a, 501, 0x011c, 501, 0x011e, 501, 0x0120, 501, 0x0122, 501,
+	0x0124, 501, 0x0126, 501, 0x0128, 501, 0x012a, 501, 0x012c, 501, 0x012e, 501, 0x0130, 301, 0x0132, 501, 0x0134, 501,
+	0x0136, 501, 0x0139, 501, 0x013b, 501, 0x013d, 501, 0x013f, 501, 0x0141, 501, 0x0143, 501, 0x0145, 501, 0x0147, 501,
+	0x014a, 501, 0x014c, 501, 0x014e, 501, 0x0150, 501, 0x0152, 501, 0x0154, 501, 0x0156, 501, 0x0158, 501, 0x015a, 501,
+	0x015c, 501, 0x015e, 501, 0x0160, 501, 0x0162, 501, 0x0164, 501, 0x0166, 501, 0x0168, 501, 0x016a, 501, 0x016c, 501,
+	0x016e, 501, 0x0170, 501, 0x0172, 501, 0x0174, 501, 0x0176, 501, 0x0178, 379, 0x0179, 501, 0x017b, 501, 0x017d, 501,
+	0x0181, 710, 0x0182, 501, 0x0184, 501, 0x0186, 706, 0x0187, 501, 0x018b, 501, 0x0190, 703, 0x0191, 501, 0x0193, 705,
+	0x0194, 707, 0x0196, 711, 0x0197, 709, 0x0198, 501, 0x019c, 711, 0x019d, 713, 0x01a0, 501, 0x01a2, 501, 0x01a4, 501,
+	0x01a7, 501, 0x01a9, 718, 0x01ac, 501, 0x01ae, 718, 0x01af, 501, 0x01b3, 501, 0x01b5, 501, 0x01b7, 719, 0x01b8, 501,
+	0x01bc, 501, 0x01c4, 502, 0x01c5, 501, 0x01c7, 502, 0x01c8, 501, 0x01ca, 502, 0x01cb, 501, 0x01cd, 501, 0x01cf, 501,
+	0x01d1, 501, 0x01d3, 501, 0x01d5, 501, 0x01d7, 501, 0x01d9, 501, 0x01db, 501, 0x01de, 501, 0x01e0, 501, 0x01e2, 501,
+	0x01e4, 501, 0x01e6, 501, 0x01e8, 501, 0x01ea, 501, 0x01ec, 501, 0x01ee, 501, 0x01f1, 502, 0x01f2, 501, 0x01f4, 501,
+	0x01fa, 501, 0x01fc, 501, 0x01fe, 501, 0x0200, 501, 0x0202, 501, 0x0204, 501, 0x0206, 501, 0x0208, 501, 0x020a, 501,
+	0x020c, 501, 0x020e, 501, 0x0210, 501, 0x0212, 501, 0x0214, 501, 0x0216, 501, 0x0386, 538, 0x038c, 564, 0x03e2, 501,
+	0x03e4, 501, 0x03e6, 501, 0x03e8, 501, 0x03ea, 501, 0x03ec, 501, 0x03ee, 501, 0x0460, 501, 0x0462, 501, 0x0464, 501,
+	0x0466, 501, 0x0468, 501, 0x046a, 501, 0x046c, 501, 0x046e, 501, 0x0470, 501, 0x0472, 501, 0x0474, 501, 0x0476, 501,
+	0x0478, 501, 0x047a, 501, 0x047c, 501, 0x047e, 501, 0x0480, 501, 0x0490, 501, 0x0492, 501, 0x0494, 501, 0x0496, 501,
+	0x0498, 501, 0x049a, 501, 0x049c, 501, 0x049e, 501, 0x04a0, 501, 0x04a2, 501, 0x04a4, 501, 0x04a6, 501, 0x04a8, 501,
+	0x04aa, 501, 0x04ac, 501, 0x04ae, 501, 0x04b0, 501, 0x04b2, 501, 0x04b4, 501, 0x04b6, 501, 0x04b8, 501, 0x04ba, 501,
+	0x04bc, 501, 0x04be, 501, 0x04c1, 501, 0x04c3, 501, 0x04c7, 501, 0x04cb, 501, 0x04d0, 501, 0x04d2, 501, 0x04d4, 501,
+	0x04d6, 501, 0x04d8, 501, 0x04da, 501, 0x04dc, 501, 0x04de, 501, 0x04e0, 501, 0x04e2, 501, 0x04e4, 501, 0x04e6, 501,
+	0x04e8, 501, 0x04ea, 501, 0x04ee, 501, 0x04f0, 501, 0x04f2, 501, 0x04f4, 501, 0x04f8, 501, 0x1e00, 501, 0x1e02, 501,
+	0x1e04, 501, 0x1e06, 501, 0x1e08, 501, 0x1e0a, 501, 0x1e0c, 501, 0x1e0e, 501, 0x1e10, 501, 0x1e12, 501, 0x1e14, 501,
+	0x1e16, 501, 0x1e18, 501, 0x1e1a, 501, 0x1e1c, 501, 0x1e1e, 501, 0x1e20, 501, 0x1e22, 501, 0x1e24, 501, 0x1e26, 501,
+	0x1e28, 501, 0x1e2a, 501, 0x1e2c, 501, 0x1e2e, 501, 0x1e30, 501, 0x1e32, 501, 0x1e34, 501, 0x1e36, 501, 0x1e38, 501,
+	0x1e3a, 501, 0x1e3c, 501, 0x1e3e, 501, 0x1e40, 501, 0x1e42, 501, 0x1e44, 501, 0x1e46, 501, 0x1e48, 501, 0x1e4a, 501,
+	0x1e4c, 501, 0x1e4e, 501, 0x1e50, 501, 0x1e52, 501, 0x1e54, 501, 0x1e56, 501, 0x1e58, 501, 0x1e5a, 501, 0x1e5c, 501,
+	0x1e5e, 501, 0x1e60, 501, 0x1e62, 501, 0x1e64, 501, 0x1e66, 501, 0x1e68, 501, 0x1e6a, 501, 0x1e6c, 501, 0x1e6e, 501,
+	0x1e70, 501, 0x1e72, 501, 0x1e74, 501, 0x1e76, 501, 0x1e78, 501, 0x1e7a, 501, 0x1e7c, 501, 0x1e7e, 501, 0x1e80, 501,
+	0x1e82, 501, 0x1e84, 501, 0x1e86, 501, 0x1e88, 501, 0x1e8a, 501, 0x1e8c, 501, 0x1e8e, 501, 0x1e90, 501, 0x1e92, 501,
+	0x1e94, 501, 0x1ea0, 501, 0x1ea2, 501, 0x1ea4, 501, 0x1ea6, 501, 0x1ea8, 501, 0x1eaa, 501, 0x1eac, 501, 0x1eae, 501,
+	0x1eb0, 501, 0x1eb2, 501, 0x1eb4, 501, 0x1eb6, 501, 0x1eb8, 501, 0x1eba, 501, 0x1ebc, 501, 0x1ebe, 501, 0x1ec0, 501,
+	0x1ec2, 501, 0x1ec4, 501, 0x1ec6, 501, 0x1ec8, 501, 0x1eca, 501, 0x1ecc, 501, 0x1ece, 501, 0x1ed0, 501, 0x1ed2, 501,
+	0x1ed4, 501, 0x1ed6, 501, 0x1ed8, 501, 0x1eda, 501, 0x1edc, 501, 0x1ede, 501, 0x1ee0, 501, 0x1ee2, 501, 0x1ee4, 501,
+	0x1ee6, 501, 0x1ee8, 501, 0x1eea, 501, 0x1eec, 501, 0x1eee, 501, 0x1ef0, 501, 0x1ef2, 501, 0x1ef4, 501, 0x1ef6, 501,
+	0x1ef8, 501, 0x1f59, 492, 0x1f5b, 492, 0x1f5d, 492, 0x1f5f, 492, 0x1fbc, 491, 0x1fcc, 491, 0x1fec, 493, 0x1ffc, 491,
+};
+
+const u16 upperRange[] = {
+	0x00e0,  0x00f6, 468, 0x00f8,  0x00fe, 468, 0x0256,  0x0257, 295, 0x0258,  0x0259, 298, 0x028a,  0x028b, 283,
+	0x03ad,  0x03af, 463, 0x03b1,  0x03c1, 468, 0x03c3,  0x03cb, 468, 0x03cd,  0x03ce, 437, 0x0430,  0x044f, 468,
+	0x0451,  0x045c, 420, 0x045e,  0x045f, 420, 0x0561,  0x0586, 452, 0x1f00,  0x1f07, 508, 0x1f10,  0x1f15, 508,
+	0x1f20,  0x1f27, 508, 0x1f30,  0x1f37, 508, 0x1f40,  0x1f45, 508, 0x1f60,  0x1f67, 508, 0x1f70,  0x1f71, 574,
+	0x1f72,  0x1f75, 586, 0x1f76,  0x1f77, 600, 0x1f78,  0x1f79, 628, 0x1f7a,  0x1f7b, 612, 0x1f7c,  0x1f7d, 626,
+	0x1f80,  0x1f87, 508, 0x1f90,  0x1f97, 508, 0x1fa0,  0x1fa7, 508, 0x1fb0,  0x1fb1, 508, 0x1fd0,  0x1fd1, 508,
+	0x1fe0,  0x1fe1, 508, 0x2170,  0x217f, 484, 0x24d0,  0x24e9, 474, 0xff41,  0xff5a, 468,
+};
+
+const u16 upperSingle[] = {
+	0x00ff, 621, 0x0101, 499, 0x0103, 499, 0x0105, 499, 0x0107, 499, 0x0109, 499, 0x010b, 499, 0x010d, 499, 0x010f, 499,
+	0x0111, 499, 0x0113, 499, 0x0115, 499, 0x0117, 499, 0x0119, 499, 0x011b, 499, 0x011d, 499, 0x011f, 499, 0x0121, 499,
+	0x0123, 499, 0x0125, 499, 0x0127, 499, 0x0129, 499, 0x012b, 499, 0x012d, 499, 0x012f, 499, 0x0131, 268, 0x0133, 499,
+	0x0135, 499, 0x0137, 499, 0x013a, 499, 0x013c, 499, 0x013e, 499, 0x0140, 499, 0x0142, 499, 0x0144, 499, 0x0146, 499,
+	0x0148, 499, 0x014b, 499, 0x014d, 499, 0x014f, 499, 0x0151, 499, 0x0153, 499, 0x0155, 499, 0x0157, 499, 0x0159, 499,
+	0x015b, 499, 0x015d, 499, 0x015f, 499, 0x0161, 499, 0x0163, 499, 0x0165, 499, 0x0167, 499, 0x0169, 499, 0x016b, 499,
+	0x016d, 499, 0x016f, 499, 0x0171, 499, 0x0173, 499, 0x0175, 499, 0x0177, 499, 0x017a, 499, 0x017c, 499, 0x017e, 499,
+	0x017f, 200, 0x0183, 499, 0x0185, 499, 0x0188, 499, 0x018c, 499, 0x0192, 499, 0x0199, 499, 0x01a1, 499, 0x01a3, 499,
+	0x01a5, 499, 0x01a8, 499, 0x01ad, 499, 0x01b0, 499, 0x01b4, 499, 0x01b6, 499, 0x01b9, 499, 0x01bd, 499, 0x01c5, 499,
+	0x01c6, 498, 0x01c8, 499, 0x01c9, 498, 0x01cb, 499, 0x01cc, 498, 0x01ce, 499, 0x01d0, 499, 0x01d2, 499, 0x01d4, 499,
+	0x01d6, 499, 0x01d8, 499, 0x01da, 499, 0x01dc, 499, 0x01df, 499, 0x01e1, 499, 0x01e3, 499, 0x01e5, 499, 0x01e7, 499,
+	0x01e9, 499, 0x01eb, 499, 0x01ed, 499, 0x01ef, 499, 0x01f2, 499, 0x01f3, 498, 0x01f5, 499, 0x01fb, 499, 0x01fd, 499,
+	0x01ff, 499, 0x0201, 499, 0x0203, 499, 0x0205, 499, 0x0207, 499, 0x0209, 499, 0x020b, 499, 0x020d, 499, 0x020f, 499,
+	0x0211, 499, 0x0213, 499, 0x0215, 499, 0x0217, 499, 0x0253, 290, 0x0254, 294, 0x025b, 297, 0x0260, 295, 0x0263, 293,
+	0x0268, 291, 0x0269, 289, 0x026f, 289, 0x0272, 287, 0x0283, 282, 0x0288, 282, 0x0292, 281, 0x03ac, 462, 0x03cc, 436,
+	0x03d0, 438, 0x03d1, 443, 0x03d5, 453, 0x03d6, 446, 0x03e3, 499, 0x03e5, 499, 0x03e7, 499, 0x03e9, 499, 0x03eb, 499,
+	0x03ed, 499, 0x03ef, 499, 0x03f0, 414, 0x03f1, 420, 0x0461, 499, 0x0463, 499, 0x0465, 499, 0x0467, 499, 0x0469, 499,
+	0x046b, 499, 0x046d, 499, 0x046f, 499, 0x0471, 499, 0x0473, 499, 0x0475, 499, 0x0477, 499, 0x0479, 499, 0x047b, 499,
+	0x047d, 499, 0x047f, 499, 0x0481, 499, 0x0491, 499, 0x0493, 499, 0x0495, 499, 0x0497, 499, 0x0499, 499, 0x049b, 499,
+	0x049d, 499, 0x049f, 499, 0x04a1, 499, 0x04a3, 499, 0x04a5, 499, 0x04a7, 499, 0x04a9, 499, 0x04ab, 499, 0x04ad, 499,
+	0x04af, 499, 0x04b1, 499, 0x04b3, 499, 0x04b5, 499, 0x04b7, 499, 0x04b9, 499, 0x04bb, 499, 0x04bd, 499, 0x04bf, 499,
+	0x04c2, 499, 0x04c4, 499, 0x04c8, 499, 0x04cc, 499, 0x04d1, 499, 0x04d3, 499, 0x04d5, 499, 0x04d7, 499, 0x04d9, 499,
+	0x04db, 499, 0x04dd, 499, 0x04df, 499, 0x04e1, 499, 0x04e3, 499, 0x04e5, 499, 0x04e7, 499, 0x04e9, 499, 0x04eb, 499,
+	0x04ef, 499, 0x04f1, 499, 0x04f3, 499, 0x04f5, 499, 0x04f9, 499, 0x1e01, 499, 0x1e03, 499, 0x1e05, 499, 0x1e07, 499,
+	0x1e09, 499, 0x1e0b, 499, 0x1e0d, 499, 0x1e0f, 499, 0x1e11, 499, 0x1e13, 499, 0x1e15, 499, 0x1e17, 499, 0x1e19, 499,
+	0x1e1b, 499, 0x1e1d, 499, 0x1e1f, 499, 0x1e21, 499, 0x1e23, 499, 0x1e25, 499, 0x1e27, 499, 0x1e29, 499, 0x1e2b, 499,
+	0x1e2d, 499, 0x1e2f, 499, 0x1e31, 499, 0x1e33, 499, 0x1e35, 499, 0x1e37, 499, 0x1e39, 499, 0x1e3b, 499, 0x1e3d, 499,
+	0x1e3f, 499, 0x1e41, 499, 0x1e43, 499, 0x1e45, 499, 0x1e47, 499, 0x1e49, 499, 0x1e4b, 499, 0x1e4d, 499, 0x1e4f, 499,
+	0x1e51, 499, 0x1e53, 499, 0x1e55, 499, 0x1e57, 499, 0x1e59, 499, 0x1e5b, 499, 0x1e5d, 499, 0x1e5f, 499, 0x1e61, 499,
+	0x1e63, 499, 0x1e65, 499, 0x1e67, 499, 0x1e69, 499, 0x1e6b, 499, 0x1e6d, 499, 0x1e6f, 499, 0x1e71, 499, 0x1e73, 499,
+	0x1e75, 499, 0x1e77, 499, 0x1e79, 499, 0x1e7b, 499, 0x1e7d, 499, 0x1e7f, 499, 0x1e81, 499, 0x1e83, 499, 0x1e85, 499,
+	0x1e87, 499, 0x1e89, 499, 0x1e8b, 499, 0x1e8d, 499, 0x1e8f, 499, 0x1e91, 499, 0x1e93, 499, 0x1e95, 499, 0x1ea1, 499,
+	0x1ea3, 499, 0x1ea5, 499, 0x1ea7, 499, 0x1ea9, 499, 0x1eab, 499, 0x1ead, 499, 0x1eaf, 499, 0x1eb1, 499, 0x1eb3, 499,
+	0x1eb5, 499, 0x1eb7, 499, 0x1eb9, 499, 0x1ebb, 499, 0x1ebd, 499, 0x1ebf, 499, 0x1ec1, 499, 0x1ec3, 499, 0x1ec5, 499,
+	0x1ec7, 499, 0x1ec9, 499, 0x1ecb, 499, 0x1ecd, 499, 0x1ecf, 499, 0x1ed1, 499, 0x1ed3, 499, 0x1ed5, 499, 0x1ed7, 499,
+	0x1ed9, 499, 0x1edb, 499, 0x1edd, 499, 0x1edf, 499, 0x1ee1, 499, 0x1ee3, 499, 0x1ee5, 499, 0x1ee7, 499, 0x1ee9, 499,
+	0x1eeb, 499, 0x1eed, 499, 0x1eef, 499, 0x1ef1, 499, 0x1ef3, 499, 0x1ef5, 499, 0x1ef7, 499, 0x1ef9, 499, 0x1f51, 508,
+	0x1f53, 508, 0x1f55, 508, 0x1f57, 508, 0x1fb3, 509, 0x1fc3, 509, 0x1fe5, 507, 0x1ff3, 509,
+};
+
+
+siIntern
+isize si__binarySearch(const u16* array, isize len, siRune target, i32 stride) {
+	isize t = 0;
+	while (len > 1) {
+		len /= 2;
+		isize p = t + len * stride;
+
+		if (target >= array[p]) {
+			t = p;
+		}
+	}
+
+	return (len != 0 && target >= array[t]) ? t : -1;
+}
+
+#endif
+
+SIDEF
+siRune si_runeLower(siRune rune) {
+	if (rune <= SI_ASCII_MAX) {
+		return si_charLower((char)rune);
+	}
+
+	isize i;
+	i = si__binarySearch(lowerRange, countof(lowerRange) / 3, rune, 3);
+	if (i != -1 && si_between(i32, rune, lowerRange[i], lowerRange[i + 1])) {
+		return rune + lowerRange[i + 2] - 500;
+	}
+	i = si__binarySearch(lowerSingle, countof(lowerSingle) / 2, rune, 2);
+	if (i != -1 && rune == lowerSingle[i]) {
+		return rune + lowerSingle[i + 1] - 500;
+	}
+
+	return rune;
+}
+
+SIDEF
+siRune si_runeUpper(siRune rune) {
+	if (rune <= SI_ASCII_MAX) {
+		return si_charUpper((char)rune);
+	}
+
+	isize i;
+	i = si__binarySearch(upperRange, countof(upperRange) / 3, rune, 3);
+	if (i != -1 && si_between(i32, rune, upperRange[i], upperRange[i + 1])) {
+		return rune + upperRange[i + 2] - 500;
+	}
+	i = si__binarySearch(upperSingle, countof(upperSingle) / 2, rune, 2);
+	if (i != -1 && rune == upperSingle[i]) {
+		return rune + upperSingle[i + 1] - 500;
+	}
+
+	return rune;
+}
+
+
+SIDEF
+bool si_runeIsLower(siRune rune) {
+	if (rune <= SI_ASCII_MAX) {
+		return si_charIsLower((char)rune);
+	}
+
+	isize i;
+	i = si__binarySearch(upperRange, countof(upperRange) / 3, rune, 3);
+	if (i != -1 && si_between(i32, rune, upperRange[i], upperRange[i + 1])) {
+		return true;
+	}
+	i = si__binarySearch(upperSingle, countof(upperSingle), rune, 1);
+	if (i != -1 && rune == upperSingle[i]) {
+		return true;
+	}
+
+	return false;
+}
+
+SIDEF
+bool si_runeIsUpper(siRune rune) {
+	if (rune <= SI_ASCII_MAX) {
+		return si_charIsUpper((char)rune);
+	}
+
+	isize i;
+	i = si__binarySearch(lowerRange, countof(lowerRange) / 3, rune, 3);
+	if (i != -1 && si_between(i32, rune, lowerRange[i], lowerRange[i + 1])) {
+		return true;
+	}
+	i = si__binarySearch(lowerSingle, countof(lowerSingle), rune, 1);
+	if (i != -1 && rune == lowerSingle[i]) {
+		return true;
+	}
+
+	return false;
+}
+
+SIDEF
+bool si_runeIsSpace(siRune rune) {
+	if (rune <= 0x1680) {
+		switch (rune) {
+			case '\t': case '\n': case '\v': case '\f': case '\r': case ' ':
+			case 0x85: case 0xA0: case 0x1680:
+				return true;
+		}
+		return false;
+	}
+	else if (si_between(i32, rune, 0x2000, 0x200B)) {
+		return true;
+	}
+
+	return si__binarySearch(spaces, countof(spaces), rune, 1) != -1;
+}
+
+inline
+bool si_runeIsDigit(siRune rune) {
+	return (rune <= SI_ASCII_MAX) ? si_charIsDigit((char)rune) : false;
+}
+
+inline
+bool si_runeIsHex(siRune rune) {
+	return (rune <= SI_ASCII_MAX) ? si_charIsHex((char)rune) : false;
+}
+SIDEF
+bool si_runeIsAlpha(siRune rune) {
+	if (rune <= SI_ASCII_MAX) {
+		return si_charIsAlpha((char)rune);
+	}
+	if (si_runeIsUpper(rune) || si_runeIsLower(rune)) {
+		return true;
+	}
+
+	isize i;
+	i = si__binarySearch(alphaRanges, countof(alphaRanges) / 2, rune, 2);
+	if (i != -1 && si_between(i32, rune, alphaRanges[i], alphaRanges[i + 1])) {
+		return true;
+	}
+
+	i = si__binarySearch(alphaSingle, countof(alphaSingle), rune, 1);
+	if (i != -1 && rune == alphaRanges[i]) {
+		return true;
+	}
+
+	return false;
+}
+inline
+bool si_runeIsAlphanumeric(siRune rune) {
+	return si_runeIsDigit(rune) || si_runeIsAlpha(rune);
+}
+inline
+bool si_runeIsPunctuation(siRune rune) {
+	return (rune <= SI_ASCII_MAX) ? si_charIsPrintable((char)rune) : false;
+}
+inline
+bool si_runeIsControl(siRune rune) {
+	return (rune <= SI_ASCII_MAX) ? si_charIsPrintable((char)rune) : false;
+}
+inline
+bool si_runeIsPrintable(siRune rune) {
+	return (rune <= SI_ASCII_MAX) ? si_charIsPrintable((char)rune) : false;
+}
+inline
+bool si_runeIsGraphical(siRune rune) {
+	return (rune <= SI_ASCII_MAX) ? si_charIsGraphical((char)rune) : false;
+}
+inline
+bool si_runeIsDelimiter(siRune rune) {
+	return !(si_runeIsAlphanumeric(rune) || rune == '@' || rune == '#' || rune == '$');
+}
+
+inline
+i32 si_runeDigitToInt(siRune rune) {
+	return (rune <= SI_ASCII_MAX) ? si_charDigitToInt((char)rune) : -1;
+}
+inline
+i32 si_runeBase32ToInt(siRune rune) {
+	return (rune <= SI_ASCII_MAX) ? si_charBase32ToInt((char)rune) : -1;
+}
+
+
+inline
+char si_charLower(char c) {
+	if (characterTraits[(u8)c] & SI__LETU) {
+		return c | (char)SI_BIT(5);
+	}
+	return c;
+}
+
+inline
+char si_charUpper(char c) {
+	if (characterTraits[(u8)c] & SI__LETL) {
+		return c & ~(char)SI_BIT(5);
+	}
+	return c;
+}
+
+inline
+bool si_charIsLower(char c) {
+	return (characterTraits[(u8)c] & SI__LETL) != 0;
+}
+
+inline
+bool si_charIsUpper(char c) {
+	return (characterTraits[(u8)c] & SI__LETU) != 0;
+}
+
+inline
+bool si_charIsSpace(char c) {
+	return (characterTraits[(u8)c] & SI__SPAC) != 0;
+}
+
+inline
+bool si_charIsDigit(char c) {
+	return (characterTraits[(u8)c] & SI__NUME) != 0;
+}
+
+inline
+bool si_charIsHex(char c) {
+	return (characterTraits[(u8)c] & SI__HEXA) != 0;
+}
+
+inline
+bool si_charIsAlpha(char c) {
+	return (characterTraits[(u8)c] & (SI__LETL | SI__LETU)) != 0;
+}
+
+inline
+bool si_charIsAlphanumeric(char c) {
+	return (characterTraits[(u8)c] & (SI__LETL | SI__LETU | SI__NUME)) != 0;
+}
+
+inline
+bool si_charIsPunctuation(char c) {
+	return (characterTraits[(u8)c] & SI__PUNC) != 0;
+}
+
+inline
+bool si_charIsControl(char c) {
+	return (characterTraits[(u8)c] & SI__CTRL) != 0;
+}
+
+inline
+bool si_charIsPrintable(char c) {
+	return (characterTraits[(u8)c] & (SI__LETL | SI__LETU | SI__NUME | SI__PUNC | SI__SPAC)) != 0;
+}
+
+inline
+bool si_charIsGraphical(char c) {
+	return (characterTraits[(u8)c] & (SI__LETL | SI__LETU | SI__NUME | SI__PUNC)) != 0;
+}
+
+
+inline
+bool si_charIsDelimiter(char c) {
+	return !(si_charIsAlphanumeric(c) || c == '@' || c == '#' || c == '$');
+}
+
+inline
+i32 si_charDigitToInt(char c) {
+	if (characterTraits[(u8)c] & SI__NUME) {
+		return (c - '0');
+	}
+
+	return -1;
+}
+SIDEF
+i32 si_charBase32ToInt(char c) {
+	u8 trait = characterTraits[(u8)c];
+
+	if (trait & SI__NUME) {
+		return si_charDigitToInt(c);
+	}
+	else if ((trait & SI__LETL) == SI__LETL) {
+		return c - 'a' + 10;
+	}
+	else if ((trait & SI__LETU) == SI__LETU) {
+		return c - 'A' + 10;
+	}
+
+	return -1;
+}
+
+#undef SI__CTRL
+#undef SI__PUNC
+#undef SI__NUME
+#undef SI__SPAC
+#undef SI__LETU
+#undef SI__LETL
+#undef SI__HEXA
+
+#undef SI__LTXU
+#undef SI__LTXL
+#undef SI__CTRS
+#undef SI__NUMX
+
+#endif /* SI_IMPLEMENTATION_CHAR */
+
+#ifdef SI_IMPLEMENTATION_HASHING
+
+SIDEF
+u32 si_fnv32(const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(data);
+	SI_ASSERT_NOT_NEG(len);
+
+	u32 hash = 0x811C9DC5;
+	const u8* ptr = (u8*)data;
+	for_range (i, 0, len) {
+		hash = (hash * 0x01000193) ^ ptr[i];
+	}
+
+	return hash;
+}
+
+SIDEF
+u32 si_fnv32a(const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(data);
+	SI_ASSERT_NOT_NEG(len);
+
+	u32 hash = 0x811C9DC5;
+	const u8* ptr = (u8*)data;
+	for_range (i, 0, len) {
+		hash = (hash ^ ptr[i]) * 0x01000193;
+	}
+
+	return hash;
+}
+
+SIDEF
+u64 si_fnv64(const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(data);
+	SI_ASSERT_NOT_NEG(len);
+
+	u64 hash = 0xCBF29CE484222325;
+	const u8* ptr = (u8*)data;
+	for_range (i, 0, len) {
+		hash = (hash * 0x100000001B3) ^ ptr[i];
+	}
+
+	return hash;
+}
+
+SIDEF
+u64 si_fnv64a(const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(data);
+	SI_ASSERT_NOT_NEG(len);
+
+	u64 hash = 0xCBF29CE484222325;
+	const u8* ptr = (u8*)data;
+	for_range (i, 0, len) {
+		hash = (hash ^ ptr[i]) * 0x100000001B3;
+	}
+
+	return hash;
+}
+
+inline
+siFnv32State si_fnv32Init(void) {
+	siFnv32State state;
+	state.hash = 0x811C9DC5;
+	state.alternate = false;
+	return state;
+}
+inline
+siFnv32State si_fnv32aInit(void) {
+	siFnv32State state = si_fnv32Init();
+	state.alternate = true;
+	return state;
+}
+
+SIDEF
+void si_fnv32Update(siFnv32State* state, const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(state);
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	u32 hash = state->hash;
+	const u8* ptr = (const u8*)data;
+	if (state->alternate) {
+		for_range (i, 0, len) { hash = (hash ^ ptr[i]) * 0x01000193; }
+	}
+	else {
+		for_range (i, 0, len) { hash = (hash * 0x01000193) ^ ptr[i]; }
+	}
+	state->hash = hash;
+}
+
+inline
+u32 si_fnv32Final(siFnv32State state) {
+	return state.hash;
+}
+
+inline
+siFnv64State si_fnv64Init(void) {
+	siFnv64State state;
+	state.hash = 0xCBF29CE484222325;
+	state.alternate = false;
+	return state;
+}
+inline
+siFnv64State si_fnv64aInit(void) {
+	siFnv64State state = si_fnv64Init();
+	state.alternate = true;
+	return state;
+}
+
+SIDEF
+void si_fnv64Update(siFnv64State* state, const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(state);
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	u64 hash = state->hash;
+	const u8* ptr = (const u8*)data;
+	if (state->alternate) {
+		for_range (i, 0, len) { hash = (hash ^ ptr[i]) * 0x100000001B3; }
+	}
+	else {
+		for_range (i, 0, len) { hash = (hash * 0x100000001B3) ^ ptr[i]; }
+	}
+	state->hash = hash;
+}
+
+inline
+u64 si_fnv64Final(siFnv64State state) {
+	return state.hash;
+}
+
+
+#define SI__MURMUR_SEED 0x9747B28C
+
+/* Appends the bytes to the state's buffer. Every time the buffer gets filled up
+ * to 'blockSize', 'action' is executed with 'block' pointing to the full block.
+ * Full blocks inside the input are processed in place. */
+#define SI__HASH_BUFFERED_UPDATE(state, data, len, blockSize, action) do { \
+	const u8* si__ptr = (const u8*)(data); \
+	isize si__len = (len); \
+	if ((state)->bufferLen != 0) { \
+		isize si__take = si_min(isize, si__len, (blockSize) - (state)->bufferLen); \
+		si_memcopy(&(state)->buffer[(state)->bufferLen], si__ptr, si__take); \
+		(state)->bufferLen += si__take; \
+		si__ptr += si__take; \
+		si__len -= si__take; \
+		SI_STOPIF((state)->bufferLen < (blockSize), break); \
+		\
+		const u8* block = (state)->buffer; \
+		action; \
+		(state)->bufferLen = 0; \
+	} \
+	while (si__len >= (blockSize)) { \
+		const u8* block = si__ptr; \
+		action; \
+		si__ptr += (blockSize); \
+		si__len -= (blockSize); \
+	} \
+	si_memcopy((state)->buffer, si__ptr, si__len); \
+	(state)->bufferLen = si__len; \
+} while (0)
+
+
+inline
+u32 si_murmur32(const void* data, isize len) {
+	return si_murmur32Ex(data, len, SI__MURMUR_SEED);
+}
+
+
+force_inline
+u32 si__murmur32Scramble(u32 key) {
+	key *= 0xCC9E2D51;
+	key = (key << 15) | (key >> 17);
+	key *= 0x1B873593;
+	return key;
+}
+
+force_inline
+u32 si__murmur32Block(u32 hash, u32 key) {
+	hash ^= si__murmur32Scramble(key);
+	return ((hash << 13) | (hash >> 19)) * 5 + 0xE6546B64;
+}
+
+force_inline
+u32 si__murmur32Final(u32 hash, const u8* tail, isize len) {
+	u32 key = 0;
+	switch (len & 3) {
+		case 3: key ^= (u32)tail[2] << 16; siFallthrough;
+		case 2: key ^= (u32)tail[1] << 8; siFallthrough;
+		case 1: key ^= tail[0];
+	}
+
+	hash ^= si__murmur32Scramble(key);
+	hash ^= (u32)len;
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6B;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+SIDEF
+u32 si_murmur32Ex(const void* data, isize len, u32 seed) {
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	u32 hash = seed;
+	const u8* ptr = (const u8*)data;
+
+	for_range (i, 0, len / 4) {
+		u32 key;
+		si_memcopy(&key, &ptr[i * 4], si_sizeof(key));
+		hash = si__murmur32Block(hash, key);
+	}
+
+	return si__murmur32Final(hash, &ptr[len & ~(isize)3], len);
+}
+
+inline
+siMurmur32State si_murmur32Init(void) {
+	return si_murmur32InitEx(SI__MURMUR_SEED);
+}
+SIDEF
+siMurmur32State si_murmur32InitEx(u32 seed) {
+	siMurmur32State state;
+	state.hash = seed;
+	state.bufferLen = 0;
+	state.len = 0;
+	return state;
+}
+
+SIDEF
+void si_murmur32Update(siMurmur32State* state, const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(state);
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	state->len += len;
+	SI__HASH_BUFFERED_UPDATE(state, data, len, 4, {
+		u32 key;
+		si_memcopy(&key, block, si_sizeof(key));
+		state->hash = si__murmur32Block(state->hash, key);
+	});
+}
+
+inline
+u32 si_murmur32Final(siMurmur32State state) {
+	return si__murmur32Final(state.hash, state.buffer, state.len);
+}
+
+
+#if SI_ARCH_IS_64BIT
+#define SI__MURMUR64_M 0xC6A4A7935BD1E995
+#define SI__MURMUR64_R 47
+
+force_inline
+u64 si__murmur64Block(u64 hash, const u8* block) {
+	u64 k;
+	si_memcopy(&k, block, si_sizeof(k));
+
+	k *= SI__MURMUR64_M;
+	k ^= k >> SI__MURMUR64_R;
+	k *= SI__MURMUR64_M;
+
+	hash ^= k;
+	hash *= SI__MURMUR64_M;
+	return hash;
+}
+
+force_inline
+u64 si__murmur64Final(u64 hash, const u8* tail, isize len) {
+	switch (len & 7) {
+		case 7: hash ^= (u64)tail[6] << 48; siFallthrough;
+		case 6: hash ^= (u64)tail[5] << 40; siFallthrough;
+		case 5: hash ^= (u64)tail[4] << 32; siFallthrough;
+		case 4: hash ^= (u64)tail[3] << 24; siFallthrough;
+		case 3: hash ^= (u64)tail[2] << 16; siFallthrough;
+		case 2: hash ^= (u64)tail[1] << 8; siFallthrough;
+		case 1: hash ^= (u64)tail[0];
+				hash *= SI__MURMUR64_M;
+	}
+
+	hash ^= hash >> SI__MURMUR64_R;
+	hash *= SI__MURMUR64_M;
+	hash ^= hash >> SI__MURMUR64_R;
+	return hash;
+}
+
+#else
+#define SI__MURMUR64_M 0x5BD1E995
+
+force_inline
+void si__murmur64Scramble(u32* h, const u8* d) {
+	u32 k;
+	si_memcopy(&k, d, si_sizeof(k));
+
+	k *= SI__MURMUR64_M;
+	k ^= k >> 24;
+	k *= SI__MURMUR64_M;
+	*h *= SI__MURMUR64_M;
+	*h ^= k;
+}
+
+force_inline
+void si__murmur64Block(u32* h, const u8* block) {
+	si__murmur64Scramble(&h[0], &block[0]);
+	si__murmur64Scramble(&h[1], &block[4]);
+}
+
+force_inline
+u64 si__murmur64Final(u32* h, const u8* tail, isize len) {
+	if ((len & 7) >= 4) {
+		si__murmur64Scramble(&h[0], tail);
+		tail += 4;
+	}
+
+	switch (len & 3) {
+		case 3: h[1] ^= (u32)tail[2] << 16; siFallthrough;
+		case 2: h[1] ^= (u32)tail[1] << 8; siFallthrough;
+		case 1: h[1] ^= tail[0];
+				h[1] *= SI__MURMUR64_M;
+	}
+
+	h[0] ^= h[1] >> 18;
+	h[0] *= SI__MURMUR64_M;
+	h[1] ^= h[0] >> 22;
+	h[1] *= SI__MURMUR64_M;
+	h[0] ^= h[1] >> 17;
+	h[0] *= SI__MURMUR64_M;
+	h[1] ^= h[0] >> 19;
+	h[1] *= SI__MURMUR64_M;
+
+	return ((u64)h[0] << 32) | h[1];
+}
+#endif
+
+
+force_inline
+void si__murmur64StateBlock(siMurmur64State* state, const u8* block) {
+#if SI_ARCH_IS_64BIT
+	state->hash = si__murmur64Block(state->hash, block);
+#else
+	si__murmur64Block(state->hash, block);
+#endif
+}
+
+SIDEF
+u64 si_murmur64(const void* data, isize len) {
+	return si_murmur64Ex(data, len, SI__MURMUR_SEED);
+}
+SIDEF
+u64 si_murmur64Ex(const void* data, isize len, u64 seed) {
+	siMurmur64State state = si_murmur64InitEx(len, seed);
+	const u8* ptr = (const u8*)data;
+
+	for_range (i, 0, len / 8) {
+		si__murmur64StateBlock(&state, &ptr[i * 8]);
+	}
+
+	return si__murmur64Final(state.hash, &ptr[len & ~(isize)7], len);
+}
+
+inline
+siMurmur64State si_murmur64Init(isize len) {
+	return si_murmur64InitEx(len, SI__MURMUR_SEED);
+}
+SIDEF
+siMurmur64State si_murmur64InitEx(isize len, u64 seed) {
+	SI_ASSERT_NOT_NEG(len);
+
+	siMurmur64State state;
+#if SI_ARCH_IS_64BIT
+	state.hash = seed ^ ((u64)len * SI__MURMUR64_M);
+#else
+	state.hash[0] = (u32)seed ^ (u32)len;
+	state.hash[1] = (u32)(seed >> 32);
+#endif
+	state.bufferLen = 0;
+	state.len = len;
+	state.processed = 0;
+
+	return state;
+}
+
+SIDEF
+void si_murmur64Update(siMurmur64State* state, const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(state);
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	state->processed += len;
+	SI_ASSERT_MSG(state->processed <= state->len, "More data was given than specified in 'si_murmur64Init'.");
+
+	SI__HASH_BUFFERED_UPDATE(state, data, len, 8, si__murmur64StateBlock(state, block));
+}
+
+inline
+u64 si_murmur64Final(siMurmur64State state) {
+	SI_ASSERT_MSG(state.processed == state.len, "Less data was given than specified in 'si_murmur64Init'.");
+	return si__murmur64Final(state.hash, state.buffer, state.len);
+}
+
+#undef SI__MURMUR64_M
+#undef SI__MURMUR64_R
+
+
+#define SI__WYHASH_SEED 0x9747B28C
+
+siIntern const u64 SI__WYHASH_SECRET[4] = {
+	0xA0761D6478BD642F, 0xE7037ED1A0B428DB, 0x8EBC6AF09C88C6E3, 0x589965CC75374CC3
+};
+
+/* Multiplies two 64-bit numbers, writes the lower half of the 128-bit result
+ * to 'a' and the upper half to 'b'. */
+force_inline
+void si__wyhashMum(u64* a, u64* b) {
+	*a = si__mul128(*a, *b, b);
+}
+
+force_inline
+u64 si__wyhashMix(u64 a, u64 b) {
+	si__wyhashMum(&a, &b);
+	return a ^ b;
+}
+
+force_inline
+u64 si__wyhashRead8(const u8* ptr) {
+	u64 res;
+	si_memcopy(&res, ptr, si_sizeof(res));
+	return res;
+}
+
+force_inline
+u64 si__wyhashRead4(const u8* ptr) {
+	u32 res;
+	si_memcopy(&res, ptr, si_sizeof(res));
+	return res;
+}
+
+/* Processes a 48 byte block. Only gets called if there's more data after it. */
+force_inline
+void si__wyhashBlock(u64* seed, u64* see1, u64* see2, const u8* ptr) {
+	const u64* secret = SI__WYHASH_SECRET;
+	/* NOTE(EimaMei): Three independent lanes keep the multipliers busy instead
+	 * of waiting on a single dependency chain. */
+	*seed = si__wyhashMix(si__wyhashRead8(ptr +  0) ^ secret[1], si__wyhashRead8(ptr +  8) ^ *seed);
+	*see1 = si__wyhashMix(si__wyhashRead8(ptr + 16) ^ secret[2], si__wyhashRead8(ptr + 24) ^ *see1);
+	*see2 = si__wyhashMix(si__wyhashRead8(ptr + 32) ^ secret[3], si__wyhashRead8(ptr + 40) ^ *see2);
+}
+
+/* Hashes the last 'len' bytes of the input (or the entire input if it's 16 bytes
+ * or less) and writes the state that gets mixed into the final hash to 'outA'
+ * and 'outB'. If 'totalLen' is over 16, the 16 bytes before 'ptr' must be
+ * readable. */
+force_inline
+void si__wyhashTail(u64 seed, const u8* ptr, isize len, isize totalLen, u64* outA, u64* outB) {
+	const u64* secret = SI__WYHASH_SECRET;
+
+	u64 a, b;
+	if (SI_LIKELY(totalLen <= 16)) {
+		if (SI_LIKELY(len >= 4)) {
+			isize offset = (len >> 3) << 2;
+			a = (si__wyhashRead4(ptr) << 32) | si__wyhashRead4(ptr + offset);
+			b = (si__wyhashRead4(ptr + len - 4) << 32) | si__wyhashRead4(ptr + len - 4 - offset);
+		}
+		else if (SI_LIKELY(len > 0)) {
+			a = ((u64)ptr[0] << 16) | ((u64)ptr[len >> 1] << 8) | ptr[len - 1];
+			b = 0;
+		}
+		else {
+			a = b = 0;
+		}
+	}
+	else {
+		while (SI_UNLIKELY(len > 16)) {
+			seed = si__wyhashMix(si__wyhashRead8(ptr) ^ secret[1], si__wyhashRead8(ptr + 8) ^ seed);
+			ptr += 16;
+			len -= 16;
+		}
+
+		a = si__wyhashRead8(ptr + len - 16);
+		b = si__wyhashRead8(ptr + len - 8);
+	}
+
+	*outA = a ^ secret[1];
+	*outB = b ^ seed;
+}
+
+/* Runs the main wyhash (final version 3) pass and writes the state that gets
+ * mixed into the final hash to 'outA' and 'outB'. */
+force_inline
+void si__wyhash(const void* data, isize len, u64 seed, u64* outA, u64* outB) {
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	const u8* ptr = (const u8*)data;
+	isize i = len;
+	seed ^= SI__WYHASH_SECRET[0];
+
+	if (SI_UNLIKELY(i > 48)) {
+		u64 see1 = seed, see2 = seed;
+		do {
+			si__wyhashBlock(&seed, &see1, &see2, ptr);
+			ptr += 48;
+			i -= 48;
+		} while (SI_LIKELY(i > 48));
+		seed ^= see1 ^ see2;
+	}
+
+	si__wyhashTail(seed, ptr, i, len, outA, outB);
+}
+
+force_inline
+u64 si__wyhashFinal64(u64 a, u64 b, isize len) {
+	return si__wyhashMix(SI__WYHASH_SECRET[1] ^ (u64)len, si__wyhashMix(a, b));
+}
+
+force_inline
+siHash128 si__wyhashFinal128(u64 a, u64 b, isize len) {
+	siHash128 res;
+	res.low = si__wyhashFinal64(a, b, len);
+	res.high = si__wyhashMix(SI__WYHASH_SECRET[2] ^ (u64)len, si__wyhashMix(a ^ SI__WYHASH_SECRET[3], b ^ SI__WYHASH_SECRET[2]));
+	return res;
+}
+
+inline
+u64 si_wyhash64(const void* data, isize len) {
+	return si_wyhash64Ex(data, len, SI__WYHASH_SEED);
+}
+
+SIDEF
+u64 si_wyhash64Ex(const void* data, isize len, u64 seed) {
+	u64 a, b;
+	si__wyhash(data, len, seed, &a, &b);
+	return si__wyhashFinal64(a, b, len);
+}
+
+inline
+void si_wyhash64Batch(siArray(siString) keys, u64* out) {
+	si_wyhash64BatchEx(keys, SI__WYHASH_SEED, out);
+}
+
+SIDEF
+void si_wyhash64BatchEx(siArray(siString) keys, u64 seed, u64* out) {
+	SI_ASSERT_ARR_TYPE(keys, siString);
+	SI_ASSERT(out != nil || keys.len == 0);
+
+	const siString* strs = (const siString*)keys.data;
+	isize i = 0;
+
+	/* NOTE(EimaMei): Each key's hash ends in two dependent multiplications.
+	 * Running every stage for all four lanes before moving onto the next one
+	 * puts four independent multiplications back to back, so they overlap
+	 * instead of each lane waiting on the previous one. */
+	for (; i + 4 <= keys.len; i += 4) {
+		u64 a[4], b[4], mix[4];
+		for_range (j, 0, 4) {
+			si__wyhash(strs[i + j].data, strs[i + j].len, seed, &a[j], &b[j]);
+		}
+		for_range (j, 0, 4) {
+			mix[j] = si__wyhashMix(a[j], b[j]);
+		}
+		for_range (j, 0, 4) {
+			out[i + j] = si__wyhashMix(SI__WYHASH_SECRET[1] ^ (u64)strs[i + j].len, mix[j]);
+		}
+	}
+
+	for (; i < keys.len; i += 1) {
+		out[i] = si_wyhash64Ex(strs[i].data, strs[i].len, seed);
+	}
+}
+
+#define SI__SIPHASH_ROTL(x, bits) (((x) << (bits)) | ((x) >> (64 - (bits))))
+#define SI__SIPHASH_ROUND(v0, v1, v2, v3) \
+	do { \
+		v0 += v1; v1 = SI__SIPHASH_ROTL(v1, 13); v1 ^= v0; v0 = SI__SIPHASH_ROTL(v0, 32); \
+		v2 += v3; v3 = SI__SIPHASH_ROTL(v3, 16); v3 ^= v2; \
+		v0 += v3; v3 = SI__SIPHASH_ROTL(v3, 21); v3 ^= v0; \
+		v2 += v1; v1 = SI__SIPHASH_ROTL(v1, 17); v1 ^= v2; v2 = SI__SIPHASH_ROTL(v2, 32); \
+	} while (0)
+
+force_inline
+u64 si__siphash(const void* data, isize len, siHash128 key, i32 cRounds, i32 dRounds) {
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	u64 v0 = 0x736F6D6570736575 ^ key.low,
+		v1 = 0x646F72616E646F6D ^ key.high,
+		v2 = 0x6C7967656E657261 ^ key.low,
+		v3 = 0x7465646279746573 ^ key.high;
+
+	const u8* ptr = (const u8*)data;
+	isize i = 0;
+	for (; i + 8 <= len; i += 8) {
+		u64 m = si__wyhashRead8(&ptr[i]);
+		v3 ^= m;
+		for_range (j, 0, cRounds) { SI__SIPHASH_ROUND(v0, v1, v2, v3); }
+		v0 ^= m;
+	}
+
+	u64 m = (u64)len << 56;
+	for_range (j, 0, len - i) {
+		m |= (u64)ptr[i + j] << (8 * j);
+	}
+
+	v3 ^= m;
+	for_range (j, 0, cRounds) { SI__SIPHASH_ROUND(v0, v1, v2, v3); }
+	v0 ^= m;
+
+	v2 ^= 0xFF;
+	for_range (j, 0, dRounds) { SI__SIPHASH_ROUND(v0, v1, v2, v3); }
+
+	return v0 ^ v1 ^ v2 ^ v3;
+}
+
+SIDEF
+u64 si_siphash13(const void* data, isize len, siHash128 key) {
+	return si__siphash(data, len, key, 1, 3);
+}
+
+SIDEF
+u64 si_siphash24(const void* data, isize len, siHash128 key) {
+	return si__siphash(data, len, key, 2, 4);
+}
+
+#undef SI__SIPHASH_ROUND
+#undef SI__SIPHASH_ROTL
+
+inline
+siHash128 si_wyhash128(const void* data, isize len) {
+	return si_wyhash128Ex(data, len, SI__WYHASH_SEED);
+}
+
+SIDEF
+siHash128 si_wyhash128Ex(const void* data, isize len, u64 seed) {
+	u64 a, b;
+	si__wyhash(data, len, seed, &a, &b);
+	return si__wyhashFinal128(a, b, len);
+}
+
+inline
+siWyhashState si_wyhashInit(void) {
+	return si_wyhashInitEx(SI__WYHASH_SEED);
+}
+
+SIDEF
+siWyhashState si_wyhashInitEx(u64 seed) {
+	siWyhashState state;
+	state.seed = seed ^ SI__WYHASH_SECRET[0];
+	state.see1 = state.seed;
+	state.see2 = state.seed;
+	state.bufferLen = 0;
+	state.len = 0;
+	return state;
+}
+
+SIDEF
+void si_wyhashUpdate(siWyhashState* state, const void* data, isize len) {
+	SI_ASSERT_NOT_NIL(state);
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	/* NOTE(EimaMei): The last 16 bytes of the previous block are kept at the
+	 * start of the buffer, as the final step may read back into them. A block
+	 * only gets processed once it's known that more data follows it. */
+	u8* pending = &state->buffer[16];
+	const u8* ptr = (const u8*)data;
+	state->len += len;
+
+	while (len > 0) {
+		if (state->bufferLen == 48) {
+			si__wyhashBlock(&state->seed, &state->see1, &state->see2, pending);
+			si_memcopy(state->buffer, &state->buffer[48], 16);
+			state->bufferLen = 0;
+		}
+
+		if (state->bufferLen == 0 && len > 48) {
+			do {
+				si__wyhashBlock(&state->seed, &state->see1, &state->see2, ptr);
+				ptr += 48;
+				len -= 48;
+			} while (len > 48);
+			si_memcopy(state->buffer, ptr - 16, 16);
+		}
+
+		isize take = si_min(isize, len, 48 - state->bufferLen);
+		si_memcopy(&pending[state->bufferLen], ptr, take);
+		state->bufferLen += take;
+		ptr += take;
+		len -= take;
+	}
+}
+
+force_inline
+void si__wyhashStateFinal(const siWyhashState* state, u64* outA, u64* outB) {
+	u64 seed = state->seed;
+	if (state->len > 48) {
+		seed ^= state->see1 ^ state->see2;
+	}
+	si__wyhashTail(seed, &state->buffer[16], state->bufferLen, state->len, outA, outB);
+}
+
+SIDEF
+u64 si_wyhash64Final(siWyhashState state) {
+	u64 a, b;
+	si__wyhashStateFinal(&state, &a, &b);
+	return si__wyhashFinal64(a, b, state.len);
+}
+
+SIDEF
+siHash128 si_wyhash128Final(siWyhashState state) {
+	u64 a, b;
+	si__wyhashStateFinal(&state, &a, &b);
+	return si__wyhashFinal128(a, b, state.len);
+}
+
+#undef SI__HASH_BUFFERED_UPDATE
+
+
+#if SI_ARCH_IS_X86 && (SI_COMPILER_GCC || SI_COMPILER_CLANG || SI_COMPILER_MSVC) && !defined(SI_NO_SIMD)
+	#include <nmmintrin.h>
+	#define SI__CRC32C_SSE42 1
+
+	#if defined(__SSE4_2__)
+		#define SI__CRC32C_TARGET
+	#elif SI_COMPILER_GCC || SI_COMPILER_CLANG
+		#define SI__CRC32C_TARGET __attribute__((target("sse4.2")))
+	#else
+		#define SI__CRC32C_TARGET
+	#endif
+
+#elif SI_ARCH_ARM64 && defined(__ARM_FEATURE_CRC32)
+	#include <arm_acle.h>
+	#define SI__CRC32C_ARM 1
+#endif
+
+/* The lookup tables for the slice-by-8 algorithm, where the first table is the
+ * regular byte-wise table of the reflected 0x82F63B78 polynomial and every next
+ * one advances the previous one's entry by another byte. */
+siIntern const u32 SI__CRC32C_TABLE[8][256] = {
+	{
+		0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+		0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+		0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+		0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+		0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+		0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+		0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+		0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+		0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+		0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+		0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+		0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+		0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+		0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+		0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+		0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+		0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+		0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+		0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+		0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+		0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+		0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+		0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+		0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+		0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+		0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+		0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+		0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+		0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+		0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+		0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+		0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351
+	},
+	{
+		0x00000000, 0x13A29877, 0x274530EE, 0x34E7A899, 0x4E8A61DC, 0x5D28F9AB, 0x69CF5132, 0x7A6DC945,
+		0x9D14C3B8, 0x8EB65BCF, 0xBA51F356, 0xA9F36B21, 0xD39EA264, 0xC03C3A13, 0xF4DB928A, 0xE7790AFD,
+		0x3FC5F181, 0x2C6769F6, 0x1880C16F, 0x0B225918, 0x714F905D, 0x62ED082A, 0x560AA0B3, 0x45A838C4,
+		0xA2D13239, 0xB173AA4E, 0x859402D7, 0x96369AA0, 0xEC5B53E5, 0xFFF9CB92, 0xCB1E630B, 0xD8BCFB7C,
+		0x7F8BE302, 0x6C297B75, 0x58CED3EC, 0x4B6C4B9B, 0x310182DE, 0x22A31AA9, 0x1644B230, 0x05E62A47,
+		0xE29F20BA, 0xF13DB8CD, 0xC5DA1054, 0xD6788823, 0xAC154166, 0xBFB7D911, 0x8B507188, 0x98F2E9FF,
+		0x404E1283, 0x53EC8AF4, 0x670B226D, 0x74A9BA1A, 0x0EC4735F, 0x1D66EB28, 0x298143B1, 0x3A23DBC6,
+		0xDD5AD13B, 0xCEF8494C, 0xFA1FE1D5, 0xE9BD79A2, 0x93D0B0E7, 0x80722890, 0xB4958009, 0xA737187E,
+		0xFF17C604, 0xECB55E73, 0xD852F6EA, 0xCBF06E9D, 0xB19DA7D8, 0xA23F3FAF, 0x96D89736, 0x857A0F41,
+		0x620305BC, 0x71A19DCB, 0x45463552, 0x56E4AD25, 0x2C896460, 0x3F2BFC17, 0x0BCC548E, 0x186ECCF9,
+		0xC0D23785, 0xD370AFF2, 0xE797076B, 0xF4359F1C, 0x8E585659, 0x9DFACE2E, 0xA91D66B7, 0xBABFFEC0,
+		0x5DC6F43D, 0x4E646C4A, 0x7A83C4D3, 0x69215CA4, 0x134C95E1, 0x00EE0D96, 0x3409A50F, 0x27AB3D78,
+		0x809C2506, 0x933EBD71, 0xA7D915E8, 0xB47B8D9F, 0xCE1644DA, 0xDDB4DCAD, 0xE9537434, 0xFAF1EC43,
+		0x1D88E6BE, 0x0E2A7EC9, 0x3ACDD650, 0x296F4E27, 0x53028762, 0x40A01F15, 0x7447B78C, 0x67E52FFB,
+		0xBF59D487, 0xACFB4CF0, 0x981CE469, 0x8BBE7C1E, 0xF1D3B55B, 0xE2712D2C, 0xD69685B5, 0xC5341DC2,
+		0x224D173F, 0x31EF8F48, 0x050827D1, 0x16AABFA6, 0x6CC776E3, 0x7F65EE94, 0x4B82460D, 0x5820DE7A,
+		0xFBC3FAF9, 0xE861628E, 0xDC86CA17, 0xCF245260, 0xB5499B25, 0xA6EB0352, 0x920CABCB, 0x81AE33BC,
+		0x66D73941, 0x7575A136, 0x419209AF, 0x523091D8, 0x285D589D, 0x3BFFC0EA, 0x0F186873, 0x1CBAF004,
+		0xC4060B78, 0xD7A4930F, 0xE3433B96, 0xF0E1A3E1, 0x8A8C6AA4, 0x992EF2D3, 0xADC95A4A, 0xBE6BC23D,
+		0x5912C8C0, 0x4AB050B7, 0x7E57F82E, 0x6DF56059, 0x1798A91C, 0x043A316B, 0x30DD99F2, 0x237F0185,
+		0x844819FB, 0x97EA818C, 0xA30D2915, 0xB0AFB162, 0xCAC27827, 0xD960E050, 0xED8748C9, 0xFE25D0BE,
+		0x195CDA43, 0x0AFE4234, 0x3E19EAAD, 0x2DBB72DA, 0x57D6BB9F, 0x447423E8, 0x70938B71, 0x63311306,
+		0xBB8DE87A, 0xA82F700D, 0x9CC8D894, 0x8F6A40E3, 0xF50789A6, 0xE6A511D1, 0xD242B948, 0xC1E0213F,
+		0x26992BC2, 0x353BB3B5, 0x01DC1B2C, 0x127E835B, 0x68134A1E, 0x7BB1D269, 0x4F567AF0, 0x5CF4E287,
+		0x04D43CFD, 0x1776A48A, 0x23910C13, 0x30339464, 0x4A5E5D21, 0x59FCC556, 0x6D1B6DCF, 0x7EB9F5B8,
+		0x99C0FF45, 0x8A626732, 0xBE85CFAB, 0xAD2757DC, 0xD74A9E99, 0xC4E806EE, 0xF00FAE77, 0xE3AD3600,
+		0x3B11CD7C, 0x28B3550B, 0x1C54FD92, 0x0FF665E5, 0x759BACA0, 0x663934D7, 0x52DE9C4E, 0x417C0439,
+		0xA6050EC4, 0xB5A796B3, 0x81403E2A, 0x92E2A65D, 0xE88F6F18, 0xFB2DF76F, 0xCFCA5FF6, 0xDC68C781,
+		0x7B5FDFFF, 0x68FD4788, 0x5C1AEF11, 0x4FB87766, 0x35D5BE23, 0x26772654, 0x12908ECD, 0x013216BA,
+		0xE64B1C47, 0xF5E98430, 0xC10E2CA9, 0xD2ACB4DE, 0xA8C17D9B, 0xBB63E5EC, 0x8F844D75, 0x9C26D502,
+		0x449A2E7E, 0x5738B609, 0x63DF1E90, 0x707D86E7, 0x0A104FA2, 0x19B2D7D5, 0x2D557F4C, 0x3EF7E73B,
+		0xD98EEDC6, 0xCA2C75B1, 0xFECBDD28, 0xED69455F, 0x97048C1A, 0x84A6146D, 0xB041BCF4, 0xA3E32483
+	},
+	{
+		0x00000000, 0xA541927E, 0x4F6F520D, 0xEA2EC073, 0x9EDEA41A, 0x3B9F3664, 0xD1B1F617, 0x74F06469,
+		0x38513EC5, 0x9D10ACBB, 0x773E6CC8, 0xD27FFEB6, 0xA68F9ADF, 0x03CE08A1, 0xE9E0C8D2, 0x4CA15AAC,
+		0x70A27D8A, 0xD5E3EFF4, 0x3FCD2F87, 0x9A8CBDF9, 0xEE7CD990, 0x4B3D4BEE, 0xA1138B9D, 0x045219E3,
+		0x48F3434F, 0xEDB2D131, 0x079C1142, 0xA2DD833C, 0xD62DE755, 0x736C752B, 0x9942B558, 0x3C032726,
+		0xE144FB14, 0x4405696A, 0xAE2BA919, 0x0B6A3B67, 0x7F9A5F0E, 0xDADBCD70, 0x30F50D03, 0x95B49F7D,
+		0xD915C5D1, 0x7C5457AF, 0x967A97DC, 0x333B05A2, 0x47CB61CB, 0xE28AF3B5, 0x08A433C6, 0xADE5A1B8,
+		0x91E6869E, 0x34A714E0, 0xDE89D493, 0x7BC846ED, 0x0F382284, 0xAA79B0FA, 0x40577089, 0xE516E2F7,
+		0xA9B7B85B, 0x0CF62A25, 0xE6D8EA56, 0x43997828, 0x37691C41, 0x92288E3F, 0x78064E4C, 0xDD47DC32,
+		0xC76580D9, 0x622412A7, 0x880AD2D4, 0x2D4B40AA, 0x59BB24C3, 0xFCFAB6BD, 0x16D476CE, 0xB395E4B0,
+		0xFF34BE1C, 0x5A752C62, 0xB05BEC11, 0x151A7E6F, 0x61EA1A06, 0xC4AB8878, 0x2E85480B, 0x8BC4DA75,
+		0xB7C7FD53, 0x12866F2D, 0xF8A8AF5E, 0x5DE93D20, 0x29195949, 0x8C58CB37, 0x66760B44, 0xC337993A,
+		0x8F96C396, 0x2AD751E8, 0xC0F9919B, 0x65B803E5, 0x1148678C, 0xB409F5F2, 0x5E273581, 0xFB66A7FF,
+		0x26217BCD, 0x8360E9B3, 0x694E29C0, 0xCC0FBBBE, 0xB8FFDFD7, 0x1DBE4DA9, 0xF7908DDA, 0x52D11FA4,
+		0x1E704508, 0xBB31D776, 0x511F1705, 0xF45E857B, 0x80AEE112, 0x25EF736C, 0xCFC1B31F, 0x6A802161,
+		0x56830647, 0xF3C29439, 0x19EC544A, 0xBCADC634, 0xC85DA25D, 0x6D1C3023, 0x8732F050, 0x2273622E,
+		0x6ED23882, 0xCB93AAFC, 0x21BD6A8F, 0x84FCF8F1, 0xF00C9C98, 0x554D0EE6, 0xBF63CE95, 0x1A225CEB,
+		0x8B277743, 0x2E66E53D, 0xC448254E, 0x6109B730, 0x15F9D359, 0xB0B84127, 0x5A968154, 0xFFD7132A,
+		0xB3764986, 0x1637DBF8, 0xFC191B8B, 0x595889F5, 0x2DA8ED9C, 0x88E97FE2, 0x62C7BF91, 0xC7862DEF,
+		0xFB850AC9, 0x5EC498B7, 0xB4EA58C4, 0x11ABCABA, 0x655BAED3, 0xC01A3CAD, 0x2A34FCDE, 0x8F756EA0,
+		0xC3D4340C, 0x6695A672, 0x8CBB6601, 0x29FAF47F, 0x5D0A9016, 0xF84B0268, 0x1265C21B, 0xB7245065,
+		0x6A638C57, 0xCF221E29, 0x250CDE5A, 0x804D4C24, 0xF4BD284D, 0x51FCBA33, 0xBBD27A40, 0x1E93E83E,
+		0x5232B292, 0xF77320EC, 0x1D5DE09F, 0xB81C72E1, 0xCCEC1688, 0x69AD84F6, 0x83834485, 0x26C2D6FB,
+		0x1AC1F1DD, 0xBF8063A3, 0x55AEA3D0, 0xF0EF31AE, 0x841F55C7, 0x215EC7B9, 0xCB7007CA, 0x6E3195B4,
+		0x2290CF18, 0x87D15D66, 0x6DFF9D15, 0xC8BE0F6B, 0xBC4E6B02, 0x190FF97C, 0xF321390F, 0x5660AB71,
+		0x4C42F79A, 0xE90365E4, 0x032DA597, 0xA66C37E9, 0xD29C5380, 0x77DDC1FE, 0x9DF3018D, 0x38B293F3,
+		0x7413C95F, 0xD1525B21, 0x3B7C9B52, 0x9E3D092C, 0xEACD6D45, 0x4F8CFF3B, 0xA5A23F48, 0x00E3AD36,
+		0x3CE08A10, 0x99A1186E, 0x738FD81D, 0xD6CE4A63, 0xA23E2E0A, 0x077FBC74, 0xED517C07, 0x4810EE79,
+		0x04B1B4D5, 0xA1F026AB, 0x4BDEE6D8, 0xEE9F74A6, 0x9A6F10CF, 0x3F2E82B1, 0xD50042C2, 0x7041D0BC,
+		0xAD060C8E, 0x08479EF0, 0xE2695E83, 0x4728CCFD, 0x33D8A894, 0x96993AEA, 0x7CB7FA99, 0xD9F668E7,
+		0x9557324B, 0x3016A035, 0xDA386046, 0x7F79F238, 0x0B899651, 0xAEC8042F, 0x44E6C45C, 0xE1A75622,
+		0xDDA47104, 0x78E5E37A, 0x92CB2309, 0x378AB177, 0x437AD51E, 0xE63B4760, 0x0C158713, 0xA954156D,
+		0xE5F54FC1, 0x40B4DDBF, 0xAA9A1DCC, 0x0FDB8FB2, 0x7B2BEBDB, 0xDE6A79A5, 0x3444B9D6, 0x91052BA8
+	},
+	{
+		0x00000000, 0xDD45AAB8, 0xBF672381, 0x62228939, 0x7B2231F3, 0xA6679B4B, 0xC4451272, 0x1900B8CA,
+		0xF64463E6, 0x2B01C95E, 0x49234067, 0x9466EADF, 0x8D665215, 0x5023F8AD, 0x32017194, 0xEF44DB2C,
+		0xE964B13D, 0x34211B85, 0x560392BC, 0x8B463804, 0x924680CE, 0x4F032A76, 0x2D21A34F, 0xF06409F7,
+		0x1F20D2DB, 0xC2657863, 0xA047F15A, 0x7D025BE2, 0x6402E328, 0xB9474990, 0xDB65C0A9, 0x06206A11,
+		0xD725148B, 0x0A60BE33, 0x6842370A, 0xB5079DB2, 0xAC072578, 0x71428FC0, 0x136006F9, 0xCE25AC41,
+		0x2161776D, 0xFC24DDD5, 0x9E0654EC, 0x4343FE54, 0x5A43469E, 0x8706EC26, 0xE524651F, 0x3861CFA7,
+		0x3E41A5B6, 0xE3040F0E, 0x81268637, 0x5C632C8F, 0x45639445, 0x98263EFD, 0xFA04B7C4, 0x27411D7C,
+		0xC805C650, 0x15406CE8, 0x7762E5D1, 0xAA274F69, 0xB327F7A3, 0x6E625D1B, 0x0C40D422, 0xD1057E9A,
+		0xABA65FE7, 0x76E3F55F, 0x14C17C66, 0xC984D6DE, 0xD0846E14, 0x0DC1C4AC, 0x6FE34D95, 0xB2A6E72D,
+		0x5DE23C01, 0x80A796B9, 0xE2851F80, 0x3FC0B538, 0x26C00DF2, 0xFB85A74A, 0x99A72E73, 0x44E284CB,
+		0x42C2EEDA, 0x9F874462, 0xFDA5CD5B, 0x20E067E3, 0x39E0DF29, 0xE4A57591, 0x8687FCA8, 0x5BC25610,
+		0xB4868D3C, 0x69C32784, 0x0BE1AEBD, 0xD6A40405, 0xCFA4BCCF, 0x12E11677, 0x70C39F4E, 0xAD8635F6,
+		0x7C834B6C, 0xA1C6E1D4, 0xC3E468ED, 0x1EA1C255, 0x07A17A9F, 0xDAE4D027, 0xB8C6591E, 0x6583F3A6,
+		0x8AC7288A, 0x57828232, 0x35A00B0B, 0xE8E5A1B3, 0xF1E51979, 0x2CA0B3C1, 0x4E823AF8, 0x93C79040,
+		0x95E7FA51, 0x48A250E9, 0x2A80D9D0, 0xF7C57368, 0xEEC5CBA2, 0x3380611A, 0x51A2E823, 0x8CE7429B,
+		0x63A399B7, 0xBEE6330F, 0xDCC4BA36, 0x0181108E, 0x1881A844, 0xC5C402FC, 0xA7E68BC5, 0x7AA3217D,
+		0x52A0C93F, 0x8FE56387, 0xEDC7EABE, 0x30824006, 0x2982F8CC, 0xF4C75274, 0x96E5DB4D, 0x4BA071F5,
+		0xA4E4AAD9, 0x79A10061, 0x1B838958, 0xC6C623E0, 0xDFC69B2A, 0x02833192, 0x60A1B8AB, 0xBDE41213,
+		0xBBC47802, 0x6681D2BA, 0x04A35B83, 0xD9E6F13B, 0xC0E649F1, 0x1DA3E349, 0x7F816A70, 0xA2C4C0C8,
+		0x4D801BE4, 0x90C5B15C, 0xF2E73865, 0x2FA292DD, 0x36A22A17, 0xEBE780AF, 0x89C50996, 0x5480A32E,
+		0x8585DDB4, 0x58C0770C, 0x3AE2FE35, 0xE7A7548D, 0xFEA7EC47, 0x23E246FF, 0x41C0CFC6, 0x9C85657E,
+		0x73C1BE52, 0xAE8414EA, 0xCCA69DD3, 0x11E3376B, 0x08E38FA1, 0xD5A62519, 0xB784AC20, 0x6AC10698,
+		0x6CE16C89, 0xB1A4C631, 0xD3864F08, 0x0EC3E5B0, 0x17C35D7A, 0xCA86F7C2, 0xA8A47EFB, 0x75E1D443,
+		0x9AA50F6F, 0x47E0A5D7, 0x25C22CEE, 0xF8878656, 0xE1873E9C, 0x3CC29424, 0x5EE01D1D, 0x83A5B7A5,
+		0xF90696D8, 0x24433C60, 0x4661B559, 0x9B241FE1, 0x8224A72B, 0x5F610D93, 0x3D4384AA, 0xE0062E12,
+		0x0F42F53E, 0xD2075F86, 0xB025D6BF, 0x6D607C07, 0x7460C4CD, 0xA9256E75, 0xCB07E74C, 0x16424DF4,
+		0x106227E5, 0xCD278D5D, 0xAF050464, 0x7240AEDC, 0x6B401616, 0xB605BCAE, 0xD4273597, 0x09629F2F,
+		0xE6264403, 0x3B63EEBB, 0x59416782, 0x8404CD3A, 0x9D0475F0, 0x4041DF48, 0x22635671, 0xFF26FCC9,
+		0x2E238253, 0xF36628EB, 0x9144A1D2, 0x4C010B6A, 0x5501B3A0, 0x88441918, 0xEA669021, 0x37233A99,
+		0xD867E1B5, 0x05224B0D, 0x6700C234, 0xBA45688C, 0xA345D046, 0x7E007AFE, 0x1C22F3C7, 0xC167597F,
+		0xC747336E, 0x1A0299D6, 0x782010EF, 0xA565BA57, 0xBC65029D, 0x6120A825, 0x0302211C, 0xDE478BA4,
+		0x31035088, 0xEC46FA30, 0x8E647309, 0x5321D9B1, 0x4A21617B, 0x9764CBC3, 0xF54642FA, 0x2803E842
+	},
+	{
+		0x00000000, 0x38116FAC, 0x7022DF58, 0x4833B0F4, 0xE045BEB0, 0xD854D11C, 0x906761E8, 0xA8760E44,
+		0xC5670B91, 0xFD76643D, 0xB545D4C9, 0x8D54BB65, 0x2522B521, 0x1D33DA8D, 0x55006A79, 0x6D1105D5,
+		0x8F2261D3, 0xB7330E7F, 0xFF00BE8B, 0xC711D127, 0x6F67DF63, 0x5776B0CF, 0x1F45003B, 0x27546F97,
+		0x4A456A42, 0x725405EE, 0x3A67B51A, 0x0276DAB6, 0xAA00D4F2, 0x9211BB5E, 0xDA220BAA, 0xE2336406,
+		0x1BA8B557, 0x23B9DAFB, 0x6B8A6A0F, 0x539B05A3, 0xFBED0BE7, 0xC3FC644B, 0x8BCFD4BF, 0xB3DEBB13,
+		0xDECFBEC6, 0xE6DED16A, 0xAEED619E, 0x96FC0E32, 0x3E8A0076, 0x069B6FDA, 0x4EA8DF2E, 0x76B9B082,
+		0x948AD484, 0xAC9BBB28, 0xE4A80BDC, 0xDCB96470, 0x74CF6A34, 0x4CDE0598, 0x04EDB56C, 0x3CFCDAC0,
+		0x51EDDF15, 0x69FCB0B9, 0x21CF004D, 0x19DE6FE1, 0xB1A861A5, 0x89B90E09, 0xC18ABEFD, 0xF99BD151,
+		0x37516AAE, 0x0F400502, 0x4773B5F6, 0x7F62DA5A, 0xD714D41E, 0xEF05BBB2, 0xA7360B46, 0x9F2764EA,
+		0xF236613F, 0xCA270E93, 0x8214BE67, 0xBA05D1CB, 0x1273DF8F, 0x2A62B023, 0x625100D7, 0x5A406F7B,
+		0xB8730B7D, 0x806264D1, 0xC851D425, 0xF040BB89, 0x5836B5CD, 0x6027DA61, 0x28146A95, 0x10050539,
+		0x7D1400EC, 0x45056F40, 0x0D36DFB4, 0x3527B018, 0x9D51BE5C, 0xA540D1F0, 0xED736104, 0xD5620EA8,
+		0x2CF9DFF9, 0x14E8B055, 0x5CDB00A1, 0x64CA6F0D, 0xCCBC6149, 0xF4AD0EE5, 0xBC9EBE11, 0x848FD1BD,
+		0xE99ED468, 0xD18FBBC4, 0x99BC0B30, 0xA1AD649C, 0x09DB6AD8, 0x31CA0574, 0x79F9B580, 0x41E8DA2C,
+		0xA3DBBE2A, 0x9BCAD186, 0xD3F96172, 0xEBE80EDE, 0x439E009A, 0x7B8F6F36, 0x33BCDFC2, 0x0BADB06E,
+		0x66BCB5BB, 0x5EADDA17, 0x169E6AE3, 0x2E8F054F, 0x86F90B0B, 0xBEE864A7, 0xF6DBD453, 0xCECABBFF,
+		0x6EA2D55C, 0x56B3BAF0, 0x1E800A04, 0x269165A8, 0x8EE76BEC, 0xB6F60440, 0xFEC5B4B4, 0xC6D4DB18,
+		0xABC5DECD, 0x93D4B161, 0xDBE70195, 0xE3F66E39, 0x4B80607D, 0x73910FD1, 0x3BA2BF25, 0x03B3D089,
+		0xE180B48F, 0xD991DB23, 0x91A26BD7, 0xA9B3047B, 0x01C50A3F, 0x39D46593, 0x71E7D567, 0x49F6BACB,
+		0x24E7BF1E, 0x1CF6D0B2, 0x54C56046, 0x6CD40FEA, 0xC4A201AE, 0xFCB36E02, 0xB480DEF6, 0x8C91B15A,
+		0x750A600B, 0x4D1B0FA7, 0x0528BF53, 0x3D39D0FF, 0x954FDEBB, 0xAD5EB117, 0xE56D01E3, 0xDD7C6E4F,
+		0xB06D6B9A, 0x887C0436, 0xC04FB4C2, 0xF85EDB6E, 0x5028D52A, 0x6839BA86, 0x200A0A72, 0x181B65DE,
+		0xFA2801D8, 0xC2396E74, 0x8A0ADE80, 0xB21BB12C, 0x1A6DBF68, 0x227CD0C4, 0x6A4F6030, 0x525E0F9C,
+		0x3F4F0A49, 0x075E65E5, 0x4F6DD511, 0x777CBABD, 0xDF0AB4F9, 0xE71BDB55, 0xAF286BA1, 0x9739040D,
+		0x59F3BFF2, 0x61E2D05E, 0x29D160AA, 0x11C00F06, 0xB9B60142, 0x81A76EEE, 0xC994DE1A, 0xF185B1B6,
+		0x9C94B463, 0xA485DBCF, 0xECB66B3B, 0xD4A70497, 0x7CD10AD3, 0x44C0657F, 0x0CF3D58B, 0x34E2BA27,
+		0xD6D1DE21, 0xEEC0B18D, 0xA6F30179, 0x9EE26ED5, 0x36946091, 0x0E850F3D, 0x46B6BFC9, 0x7EA7D065,
+		0x13B6D5B0, 0x2BA7BA1C, 0x63940AE8, 0x5B856544, 0xF3F36B00, 0xCBE204AC, 0x83D1B458, 0xBBC0DBF4,
+		0x425B0AA5, 0x7A4A6509, 0x3279D5FD, 0x0A68BA51, 0xA21EB415, 0x9A0FDBB9, 0xD23C6B4D, 0xEA2D04E1,
+		0x873C0134, 0xBF2D6E98, 0xF71EDE6C, 0xCF0FB1C0, 0x6779BF84, 0x5F68D028, 0x175B60DC, 0x2F4A0F70,
+		0xCD796B76, 0xF56804DA, 0xBD5BB42E, 0x854ADB82, 0x2D3CD5C6, 0x152DBA6A, 0x5D1E0A9E, 0x650F6532,
+		0x081E60E7, 0x300F0F4B, 0x783CBFBF, 0x402DD013, 0xE85BDE57, 0xD04AB1FB, 0x9879010F, 0xA0686EA3
+	},
+	{
+		0x00000000, 0xEF306B19, 0xDB8CA0C3, 0x34BCCBDA, 0xB2F53777, 0x5DC55C6E, 0x697997B4, 0x8649FCAD,
+		0x6006181F, 0x8F367306, 0xBB8AB8DC, 0x54BAD3C5, 0xD2F32F68, 0x3DC34471, 0x097F8FAB, 0xE64FE4B2,
+		0xC00C303E, 0x2F3C5B27, 0x1B8090FD, 0xF4B0FBE4, 0x72F90749, 0x9DC96C50, 0xA975A78A, 0x4645CC93,
+		0xA00A2821, 0x4F3A4338, 0x7B8688E2, 0x94B6E3FB, 0x12FF1F56, 0xFDCF744F, 0xC973BF95, 0x2643D48C,
+		0x85F4168D, 0x6AC47D94, 0x5E78B64E, 0xB148DD57, 0x370121FA, 0xD8314AE3, 0xEC8D8139, 0x03BDEA20,
+		0xE5F20E92, 0x0AC2658B, 0x3E7EAE51, 0xD14EC548, 0x570739E5, 0xB83752FC, 0x8C8B9926, 0x63BBF23F,
+		0x45F826B3, 0xAAC84DAA, 0x9E748670, 0x7144ED69, 0xF70D11C4, 0x183D7ADD, 0x2C81B107, 0xC3B1DA1E,
+		0x25FE3EAC, 0xCACE55B5, 0xFE729E6F, 0x1142F576, 0x970B09DB, 0x783B62C2, 0x4C87A918, 0xA3B7C201,
+		0x0E045BEB, 0xE13430F2, 0xD588FB28, 0x3AB89031, 0xBCF16C9C, 0x53C10785, 0x677DCC5F, 0x884DA746,
+		0x6E0243F4, 0x813228ED, 0xB58EE337, 0x5ABE882E, 0xDCF77483, 0x33C71F9A, 0x077BD440, 0xE84BBF59,
+		0xCE086BD5, 0x213800CC, 0x1584CB16, 0xFAB4A00F, 0x7CFD5CA2, 0x93CD37BB, 0xA771FC61, 0x48419778,
+		0xAE0E73CA, 0x413E18D3, 0x7582D309, 0x9AB2B810, 0x1CFB44BD, 0xF3CB2FA4, 0xC777E47E, 0x28478F67,
+		0x8BF04D66, 0x64C0267F, 0x507CEDA5, 0xBF4C86BC, 0x39057A11, 0xD6351108, 0xE289DAD2, 0x0DB9B1CB,
+		0xEBF65579, 0x04C63E60, 0x307AF5BA, 0xDF4A9EA3, 0x5903620E, 0xB6330917, 0x828FC2CD, 0x6DBFA9D4,
+		0x4BFC7D58, 0xA4CC1641, 0x9070DD9B, 0x7F40B682, 0xF9094A2F, 0x16392136, 0x2285EAEC, 0xCDB581F5,
+		0x2BFA6547, 0xC4CA0E5E, 0xF076C584, 0x1F46AE9D, 0x990F5230, 0x763F3929, 0x4283F2F3, 0xADB399EA,
+		0x1C08B7D6, 0xF338DCCF, 0xC7841715, 0x28B47C0C, 0xAEFD80A1, 0x41CDEBB8, 0x75712062, 0x9A414B7B,
+		0x7C0EAFC9, 0x933EC4D0, 0xA7820F0A, 0x48B26413, 0xCEFB98BE, 0x21CBF3A7, 0x1577387D, 0xFA475364,
+		0xDC0487E8, 0x3334ECF1, 0x0788272B, 0xE8B84C32, 0x6EF1B09F, 0x81C1DB86, 0xB57D105C, 0x5A4D7B45,
+		0xBC029FF7, 0x5332F4EE, 0x678E3F34, 0x88BE542D, 0x0EF7A880, 0xE1C7C399, 0xD57B0843, 0x3A4B635A,
+		0x99FCA15B, 0x76CCCA42, 0x42700198, 0xAD406A81, 0x2B09962C, 0xC439FD35, 0xF08536EF, 0x1FB55DF6,
+		0xF9FAB944, 0x16CAD25D, 0x22761987, 0xCD46729E, 0x4B0F8E33, 0xA43FE52A, 0x90832EF0, 0x7FB345E9,
+		0x59F09165, 0xB6C0FA7C, 0x827C31A6, 0x6D4C5ABF, 0xEB05A612, 0x0435CD0B, 0x308906D1, 0xDFB96DC8,
+		0x39F6897A, 0xD6C6E263, 0xE27A29B9, 0x0D4A42A0, 0x8B03BE0D, 0x6433D514, 0x508F1ECE, 0xBFBF75D7,
+		0x120CEC3D, 0xFD3C8724, 0xC9804CFE, 0x26B027E7, 0xA0F9DB4A, 0x4FC9B053, 0x7B757B89, 0x94451090,
+		0x720AF422, 0x9D3A9F3B, 0xA98654E1, 0x46B63FF8, 0xC0FFC355, 0x2FCFA84C, 0x1B736396, 0xF443088F,
+		0xD200DC03, 0x3D30B71A, 0x098C7CC0, 0xE6BC17D9, 0x60F5EB74, 0x8FC5806D, 0xBB794BB7, 0x544920AE,
+		0xB206C41C, 0x5D36AF05, 0x698A64DF, 0x86BA0FC6, 0x00F3F36B, 0xEFC39872, 0xDB7F53A8, 0x344F38B1,
+		0x97F8FAB0, 0x78C891A9, 0x4C745A73, 0xA344316A, 0x250DCDC7, 0xCA3DA6DE, 0xFE816D04, 0x11B1061D,
+		0xF7FEE2AF, 0x18CE89B6, 0x2C72426C, 0xC3422975, 0x450BD5D8, 0xAA3BBEC1, 0x9E87751B, 0x71B71E02,
+		0x57F4CA8E, 0xB8C4A197, 0x8C786A4D, 0x63480154, 0xE501FDF9, 0x0A3196E0, 0x3E8D5D3A, 0xD1BD3623,
+		0x37F2D291, 0xD8C2B988, 0xEC7E7252, 0x034E194B, 0x8507E5E6, 0x6A378EFF, 0x5E8B4525, 0xB1BB2E3C
+	},
+	{
+		0x00000000, 0x68032CC8, 0xD0065990, 0xB8057558, 0xA5E0C5D1, 0xCDE3E919, 0x75E69C41, 0x1DE5B089,
+		0x4E2DFD53, 0x262ED19B, 0x9E2BA4C3, 0xF628880B, 0xEBCD3882, 0x83CE144A, 0x3BCB6112, 0x53C84DDA,
+		0x9C5BFAA6, 0xF458D66E, 0x4C5DA336, 0x245E8FFE, 0x39BB3F77, 0x51B813BF, 0xE9BD66E7, 0x81BE4A2F,
+		0xD27607F5, 0xBA752B3D, 0x02705E65, 0x6A7372AD, 0x7796C224, 0x1F95EEEC, 0xA7909BB4, 0xCF93B77C,
+		0x3D5B83BD, 0x5558AF75, 0xED5DDA2D, 0x855EF6E5, 0x98BB466C, 0xF0B86AA4, 0x48BD1FFC, 0x20BE3334,
+		0x73767EEE, 0x1B755226, 0xA370277E, 0xCB730BB6, 0xD696BB3F, 0xBE9597F7, 0x0690E2AF, 0x6E93CE67,
+		0xA100791B, 0xC90355D3, 0x7106208B, 0x19050C43, 0x04E0BCCA, 0x6CE39002, 0xD4E6E55A, 0xBCE5C992,
+		0xEF2D8448, 0x872EA880, 0x3F2BDDD8, 0x5728F110, 0x4ACD4199, 0x22CE6D51, 0x9ACB1809, 0xF2C834C1,
+		0x7AB7077A, 0x12B42BB2, 0xAAB15EEA, 0xC2B27222, 0xDF57C2AB, 0xB754EE63, 0x0F519B3B, 0x6752B7F3,
+		0x349AFA29, 0x5C99D6E1, 0xE49CA3B9, 0x8C9F8F71, 0x917A3FF8, 0xF9791330, 0x417C6668, 0x297F4AA0,
+		0xE6ECFDDC, 0x8EEFD114, 0x36EAA44C, 0x5EE98884, 0x430C380D, 0x2B0F14C5, 0x930A619D, 0xFB094D55,
+		0xA8C1008F, 0xC0C22C47, 0x78C7591F, 0x10C475D7, 0x0D21C55E, 0x6522E996, 0xDD279CCE, 0xB524B006,
+		0x47EC84C7, 0x2FEFA80F, 0x97EADD57, 0xFFE9F19F, 0xE20C4116, 0x8A0F6DDE, 0x320A1886, 0x5A09344E,
+		0x09C17994, 0x61C2555C, 0xD9C72004, 0xB1C40CCC, 0xAC21BC45, 0xC422908D, 0x7C27E5D5, 0x1424C91D,
+		0xDBB77E61, 0xB3B452A9, 0x0BB127F1, 0x63B20B39, 0x7E57BBB0, 0x16549778, 0xAE51E220, 0xC652CEE8,
+		0x959A8332, 0xFD99AFFA, 0x459CDAA2, 0x2D9FF66A, 0x307A46E3, 0x58796A2B, 0xE07C1F73, 0x887F33BB,
+		0xF56E0EF4, 0x9D6D223C, 0x25685764, 0x4D6B7BAC, 0x508ECB25, 0x388DE7ED, 0x808892B5, 0xE88BBE7D,
+		0xBB43F3A7, 0xD340DF6F, 0x6B45AA37, 0x034686FF, 0x1EA33676, 0x76A01ABE, 0xCEA56FE6, 0xA6A6432E,
+		0x6935F452, 0x0136D89A, 0xB933ADC2, 0xD130810A, 0xCCD53183, 0xA4D61D4B, 0x1CD36813, 0x74D044DB,
+		0x27180901, 0x4F1B25C9, 0xF71E5091, 0x9F1D7C59, 0x82F8CCD0, 0xEAFBE018, 0x52FE9540, 0x3AFDB988,
+		0xC8358D49, 0xA036A181, 0x1833D4D9, 0x7030F811, 0x6DD54898, 0x05D66450, 0xBDD31108, 0xD5D03DC0,
+		0x8618701A, 0xEE1B5CD2, 0x561E298A, 0x3E1D0542, 0x23F8B5CB, 0x4BFB9903, 0xF3FEEC5B, 0x9BFDC093,
+		0x546E77EF, 0x3C6D5B27, 0x84682E7F, 0xEC6B02B7, 0xF18EB23E, 0x998D9EF6, 0x2188EBAE, 0x498BC766,
+		0x1A438ABC, 0x7240A674, 0xCA45D32C, 0xA246FFE4, 0xBFA34F6D, 0xD7A063A5, 0x6FA516FD, 0x07A63A35,
+		0x8FD9098E, 0xE7DA2546, 0x5FDF501E, 0x37DC7CD6, 0x2A39CC5F, 0x423AE097, 0xFA3F95CF, 0x923CB907,
+		0xC1F4F4DD, 0xA9F7D815, 0x11F2AD4D, 0x79F18185, 0x6414310C, 0x0C171DC4, 0xB412689C, 0xDC114454,
+		0x1382F328, 0x7B81DFE0, 0xC384AAB8, 0xAB878670, 0xB66236F9, 0xDE611A31, 0x66646F69, 0x0E6743A1,
+		0x5DAF0E7B, 0x35AC22B3, 0x8DA957EB, 0xE5AA7B23, 0xF84FCBAA, 0x904CE762, 0x2849923A, 0x404ABEF2,
+		0xB2828A33, 0xDA81A6FB, 0x6284D3A3, 0x0A87FF6B, 0x17624FE2, 0x7F61632A, 0xC7641672, 0xAF673ABA,
+		0xFCAF7760, 0x94AC5BA8, 0x2CA92EF0, 0x44AA0238, 0x594FB2B1, 0x314C9E79, 0x8949EB21, 0xE14AC7E9,
+		0x2ED97095, 0x46DA5C5D, 0xFEDF2905, 0x96DC05CD, 0x8B39B544, 0xE33A998C, 0x5B3FECD4, 0x333CC01C,
+		0x60F48DC6, 0x08F7A10E, 0xB0F2D456, 0xD8F1F89E, 0xC5144817, 0xAD1764DF, 0x15121187, 0x7D113D4F
+	},
+	{
+		0x00000000, 0x493C7D27, 0x9278FA4E, 0xDB448769, 0x211D826D, 0x6821FF4A, 0xB3657823, 0xFA590504,
+		0x423B04DA, 0x0B0779FD, 0xD043FE94, 0x997F83B3, 0x632686B7, 0x2A1AFB90, 0xF15E7CF9, 0xB86201DE,
+		0x847609B4, 0xCD4A7493, 0x160EF3FA, 0x5F328EDD, 0xA56B8BD9, 0xEC57F6FE, 0x37137197, 0x7E2F0CB0,
+		0xC64D0D6E, 0x8F717049, 0x5435F720, 0x1D098A07, 0xE7508F03, 0xAE6CF224, 0x7528754D, 0x3C14086A,
+		0x0D006599, 0x443C18BE, 0x9F789FD7, 0xD644E2F0, 0x2C1DE7F4, 0x65219AD3, 0xBE651DBA, 0xF759609D,
+		0x4F3B6143, 0x06071C64, 0xDD439B0D, 0x947FE62A, 0x6E26E32E, 0x271A9E09, 0xFC5E1960, 0xB5626447,
+		0x89766C2D, 0xC04A110A, 0x1B0E9663, 0x5232EB44, 0xA86BEE40, 0xE1579367, 0x3A13140E, 0x732F6929,
+		0xCB4D68F7, 0x827115D0, 0x593592B9, 0x1009EF9E, 0xEA50EA9A, 0xA36C97BD, 0x782810D4, 0x31146DF3,
+		0x1A00CB32, 0x533CB615, 0x8878317C, 0xC1444C5B, 0x3B1D495F, 0x72213478, 0xA965B311, 0xE059CE36,
+		0x583BCFE8, 0x1107B2CF, 0xCA4335A6, 0x837F4881, 0x79264D85, 0x301A30A2, 0xEB5EB7CB, 0xA262CAEC,
+		0x9E76C286, 0xD74ABFA1, 0x0C0E38C8, 0x453245EF, 0xBF6B40EB, 0xF6573DCC, 0x2D13BAA5, 0x642FC782,
+		0xDC4DC65C, 0x9571BB7B, 0x4E353C12, 0x07094135, 0xFD504431, 0xB46C3916, 0x6F28BE7F, 0x2614C358,
+		0x1700AEAB, 0x5E3CD38C, 0x857854E5, 0xCC4429C2, 0x361D2CC6, 0x7F2151E1, 0xA465D688, 0xED59ABAF,
+		0x553BAA71, 0x1C07D756, 0xC743503F, 0x8E7F2D18, 0x7426281C, 0x3D1A553B, 0xE65ED252, 0xAF62AF75,
+		0x9376A71F, 0xDA4ADA38, 0x010E5D51, 0x48322076, 0xB26B2572, 0xFB575855, 0x2013DF3C, 0x692FA21B,
+		0xD14DA3C5, 0x9871DEE2, 0x4335598B, 0x0A0924AC, 0xF05021A8, 0xB96C5C8F, 0x6228DBE6, 0x2B14A6C1,
+		0x34019664, 0x7D3DEB43, 0xA6796C2A, 0xEF45110D, 0x151C1409, 0x5C20692E, 0x8764EE47, 0xCE589360,
+		0x763A92BE, 0x3F06EF99, 0xE44268F0, 0xAD7E15D7, 0x572710D3, 0x1E1B6DF4, 0xC55FEA9D, 0x8C6397BA,
+		0xB0779FD0, 0xF94BE2F7, 0x220F659E, 0x6B3318B9, 0x916A1DBD, 0xD856609A, 0x0312E7F3, 0x4A2E9AD4,
+		0xF24C9B0A, 0xBB70E62D, 0x60346144, 0x29081C63, 0xD3511967, 0x9A6D6440, 0x4129E329, 0x08159E0E,
+		0x3901F3FD, 0x703D8EDA, 0xAB7909B3, 0xE2457494, 0x181C7190, 0x51200CB7, 0x8A648BDE, 0xC358F6F9,
+		0x7B3AF727, 0x32068A00, 0xE9420D69, 0xA07E704E, 0x5A27754A, 0x131B086D, 0xC85F8F04, 0x8163F223,
+		0xBD77FA49, 0xF44B876E, 0x2F0F0007, 0x66337D20, 0x9C6A7824, 0xD5560503, 0x0E12826A, 0x472EFF4D,
+		0xFF4CFE93, 0xB67083B4, 0x6D3404DD, 0x240879FA, 0xDE517CFE, 0x976D01D9, 0x4C2986B0, 0x0515FB97,
+		0x2E015D56, 0x673D2071, 0xBC79A718, 0xF545DA3F, 0x0F1CDF3B, 0x4620A21C, 0x9D642575, 0xD4585852,
+		0x6C3A598C, 0x250624AB, 0xFE42A3C2, 0xB77EDEE5, 0x4D27DBE1, 0x041BA6C6, 0xDF5F21AF, 0x96635C88,
+		0xAA7754E2, 0xE34B29C5, 0x380FAEAC, 0x7133D38B, 0x8B6AD68F, 0xC256ABA8, 0x19122CC1, 0x502E51E6,
+		0xE84C5038, 0xA1702D1F, 0x7A34AA76, 0x3308D751, 0xC951D255, 0x806DAF72, 0x5B29281B, 0x1215553C,
+		0x230138CF, 0x6A3D45E8, 0xB179C281, 0xF845BFA6, 0x021CBAA2, 0x4B20C785, 0x906440EC, 0xD9583DCB,
+		0x613A3C15, 0x28064132, 0xF342C65B, 0xBA7EBB7C, 0x4027BE78, 0x091BC35F, 0xD25F4436, 0x9B633911,
+		0xA777317B, 0xEE4B4C5C, 0x350FCB35, 0x7C33B612, 0x866AB316, 0xCF56CE31, 0x14124958, 0x5D2E347F,
+		0xE54C35A1, 0xAC704886, 0x7734CFEF, 0x3E08B2C8, 0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5
+	}
+};
+
+siIntern
+u32 si__crc32cTable(u32 crc, const u8* ptr, isize len) {
+	const u32 (*table)[256] = SI__CRC32C_TABLE;
+
+	for (; len >= 8; len -= 8) {
+		u32 low, high;
+		si_memcopy(&low, &ptr[0], si_sizeof(low));
+		si_memcopy(&high, &ptr[4], si_sizeof(high));
+	#if !SI_ENDIAN_IS_LITTLE
+		low = si_swap32(low);
+		high = si_swap32(high);
+	#endif
+		low ^= crc;
+
+		crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF]
+			^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24]
+			^ table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF]
+			^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+		ptr += 8;
+	}
+
+	for_range (i, 0, len) {
+		crc = (crc >> 8) ^ table[0][(crc ^ ptr[i]) & 0xFF];
+	}
+
+	return crc;
+}
+
+#if SI__CRC32C_SSE42
+siIntern SI__CRC32C_TARGET
+u32 si__crc32cSse42(u32 crc, const u8* ptr, isize len) {
+#if SI_ARCH_AMD64
+	u64 crc64 = crc;
+	for (; len >= 8; len -= 8) {
+		u64 value;
+		si_memcopy(&value, ptr, si_sizeof(value));
+		crc64 = _mm_crc32_u64(crc64, value);
+		ptr += 8;
+	}
+	crc = (u32)crc64;
+#endif
+
+	for (; len >= 4; len -= 4) {
+		u32 value;
+		si_memcopy(&value, ptr, si_sizeof(value));
+		crc = _mm_crc32_u32(crc, value);
+		ptr += 4;
+	}
+
+	for_range (i, 0, len) {
+		crc = _mm_crc32_u8(crc, ptr[i]);
+	}
+
+	return crc;
+}
+
+/* Returns true if the CPU supports the SSE4.2 'crc32' instruction. */
+siIntern
+bool si__crc32cHasSse42(void) {
+#if defined(__SSE4_2__)
+	return true;
+#elif !defined(SI_NO_CPU)
+	static i32 supported = -1;
+	if (supported == -1) {
+		u32 registers[4];
+		si_CPUID(1, registers);
+		supported = (registers[2] & SI_BIT(20)) != 0;
+	}
+	return supported != 0;
+#else
+	return false;
+#endif
+}
+#endif
+
+#if SI__CRC32C_ARM
+siIntern
+u32 si__crc32cArm(u32 crc, const u8* ptr, isize len) {
+	for (; len >= 8; len -= 8) {
+		u64 value;
+		si_memcopy(&value, ptr, si_sizeof(value));
+		crc = __crc32cd(crc, value);
+		ptr += 8;
+	}
+
+	for_range (i, 0, len) {
+		crc = __crc32cb(crc, ptr[i]);
+	}
+
+	return crc;
+}
+#endif
+
+inline
+u32 si_crc32c(const void* data, isize len) {
+	return si_crc32cEx(data, len, 0);
+}
+
+SIDEF
+u32 si_crc32cEx(const void* data, isize len, u32 crc) {
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	const u8* ptr = (const u8*)data;
+	crc = ~crc;
+
+#if SI__CRC32C_SSE42
+	if (si__crc32cHasSse42()) {
+		return ~si__crc32cSse42(crc, ptr, len);
+	}
+#elif SI__CRC32C_ARM
+	return ~si__crc32cArm(crc, ptr, len);
+#endif
+
+	return ~si__crc32cTable(crc, ptr, len);
+}
+
+#undef SI__CRC32C_TARGET
+
+
+inline
+u32 si_adler32(const void* data, isize len) {
+	return si_adler32Ex(data, len, 1);
+}
+
+SIDEF
+u32 si_adler32Ex(const void* data, isize len, u32 adler) {
+	SI_ASSERT(data != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
+
+	/* NOTE(EimaMei): 5552 is the largest amount of bytes that can be summed
+	 * before 'b' could overflow 32 bits, so the expensive modulo only has to be
+	 * done once per chunk. */
+	const u32 mod = 65521;
+	const isize chunk = 5552;
+
+	const u8* ptr = (const u8*)data;
+	u32 a = adler & 0xFFFF,
+		b = adler >> 16;
+
+	while (len > 0) {
+		isize n = si_min(isize, len, chunk);
+		len -= n;
+
+		for (; n >= 4; n -= 4) {
+			a += ptr[0]; b += a;
+			a += ptr[1]; b += a;
+			a += ptr[2]; b += a;
+			a += ptr[3]; b += a;
+			ptr += 4;
+		}
+		for (; n > 0; n -= 1) {
+			a += *ptr; b += a;
+			ptr += 1;
+		}
+
+		a %= mod;
+		b %= mod;
+	}
+
+	return (b << 16) | a;
+}
+
+#endif /* SI_IMPLEMENTATION_HASHING */
+
+#ifdef SI_IMPLEMENTATION_MAP
+
+
+/* The amount of keys that go through each stage of the batch pipeline at once. */
+#define SI__MAP_BATCH 16
+
+siIntern void si__mapBatch(siMapAny* map, const void* keys, isize keyStride,
+		const void* values, isize valueStride, isize len, void** out);
+
+SIDEF
+siMapAny si_mapMakeFull(const void* input, isize len, isize structTypeSize, isize valueTypeSize, siAllocator alloc) {
+	siMapAny map = si_mapReserve(valueTypeSize, len, alloc);
+	if (map.entries == nil) { return map; }
+
+	si__mapBatch(
+		&map, input, structTypeSize,
+		si_pointerAddConst(input, si_sizeof(siString)), structTypeSize, len, nil
+	);
+	return map;
+}
+
+#define SI_HASH_NONE UINT32_MAX
+
+SIDEF
+siMapAny si_mapReserve(isize typeSize, isize capacity, siAllocator alloc) {
+	SI_ASSERT_NOT_NEG(typeSize);
+	SI_ASSERT_NOT_NEG(capacity);
+
+	siMapAny map;
+	map.alloc = alloc;
+	map.len = 0;
+	map.capacity = si_nextPow2(capacity);
+	map.typeSize = typeSize;
+
+	isize lenEntries = si_alignForward(si_sizeof(*map.entries) * map.capacity, SI_DEFAULT_MEMORY_ALIGNMENT),
+		  lenHashes = si_alignForward(si_sizeof(*map.hashes) * map.capacity, SI_DEFAULT_MEMORY_ALIGNMENT);
+
+	void* ptr = si_allocNonZeroed(alloc, lenEntries + lenHashes + map.typeSize * map.capacity);
+	if (ptr == nil) { return SI_TYPE_ZERO(siMapAny); }
+
+	map.entries = (siMapEntry*)ptr;
+	map.hashes = (u32*)si_pointerAdd(map.entries, lenEntries);
+	map.values = (void*)si_pointerAdd(map.hashes, lenHashes);
+#ifndef SI_NO_HASHING
+	map.key = SI_TYPE_ZERO(siHash128);
+	map.keyed = false;
+#endif
+
+	for_range (i, 0, map.capacity) {
+		map.entries[i].hash = SI_HASH_NONE;
+		map.entries[i].next = SI_HASH_NONE;
+		map.hashes[i] = SI_HASH_NONE;
+	}
+
+	return map;
+}
+
+#ifndef SI_NO_HASHING
+SIDEF
+siMapAny si_mapReserveKeyed(isize typeSize, isize capacity, siAllocator alloc) {
+	siHash128 key;
+#ifndef SI_NO_SYSTEM
+	if (!si_systemRandomBytes(&key, si_sizeof(key)))
+#endif
+	{
+		/* NOTE(EimaMei): Without an OS entropy source the key is derived from the
+		 * timestamp counter and the stack address. It's far weaker, but still not
+		 * something that can be guessed ahead of time. */
+		u64 entropy[2] = {(u64)si_RDTSC(), (u64)(usize)&key};
+		key = si_wyhash128(entropy, si_sizeof(entropy));
+	}
+
+	return si_mapReserveKeyedEx(typeSize, capacity, key, alloc);
+}
+
+SIDEF
+siMapAny si_mapReserveKeyedEx(isize typeSize, isize capacity, siHash128 key,
+		siAllocator alloc) {
+	siMapAny map = si_mapReserve(typeSize, capacity, alloc);
+	map.key = key;
+	map.keyed = true;
+
+	return map;
+}
+#else
+siIntern
+u32 si__mapFnv32a(const void* data, isize len) {
+	const u8* bytes = (const u8*)data;
+	u32 hash = 0x811C9DC5;
+
+	for_range (i, 0, len) {
+		hash = (hash ^ bytes[i]) * 0x01000193;
+	}
+	return hash;
+}
+#endif
+
+force_inline
+u32 si__mapHash(siMapAny map, siString name) {
+#ifndef SI_NO_HASHING
+	u64 hash = map.keyed
+		? si_siphash13(name.data, name.len, map.key)
+		: (u64)SI_MAP_HASH(name.data, name.len);
+#else
+	u64 hash = (u64)SI_MAP_HASH(name.data, name.len);
+	SI_UNUSED(map);
+#endif
+	return (u32)hash & 0x7FFFFFFF;
+}
+
+inline
+u32 si_mapHash(siMapAny map, siString name) {
+	return si__mapHash(map, name);
+}
+
+typedef struct { u32 hashIndex, entryIndex, entryPrev; } __siMapSearch;
+
+siIntern
+__siMapSearch si__mapFind(siMapAny map, u32 hash, siString key) {
+	__siMapSearch res = {SI_HASH_NONE, SI_HASH_NONE, SI_HASH_NONE};
+	SI_STOPIF(map.capacity == 0, return res);
+
+	res.hashIndex = hash & (u32)(map.capacity - 1);
+	res.entryIndex = map.hashes[res.hashIndex];
+
+	while (res.entryIndex != SI_HASH_NONE) {
+		siMapEntry entry = map.entries[res.entryIndex];
+		if (entry.hash == hash && si_stringEqual(entry.key, key)) {
+			return res;
+		}
+
+		res.entryPrev = res.entryIndex;
+		res.entryIndex = entry.next;
+	}
+
+	return res;
+}
+
+
+SIDEF
+void* si_mapGet(siMapAny map, siString name) {
+	return si_mapGetHash(map, name, si__mapHash(map, name));
+}
+SIDEF
+void* si_mapGetHash(siMapAny map, siString name, u32 hash) {
+	__siMapSearch search = si__mapFind(map, hash, name);
+	return (search.entryIndex != SI_HASH_NONE)
+		? si_pointerAdd(map.values, (isize)search.entryIndex * map.typeSize)
+		: nil;
+}
+
+SIDEF
+void* si_mapSet(siMapAny* map, siString name, const void* value) {
+	return si_mapSetHash(map, name, value, si__mapHash(*map, name));
+}
+
+SIDEF
+void* si_mapSetHash(siMapAny* map, siString name, const void* value,
+		u32 hash) {
+	SI_ASSERT_NOT_NIL(map);
+	SI_ASSERT_STR(name);
+	SI_ASSERT_NOT_NIL(value);
+	SI_ASSERT_MSG(map->len < map->capacity, "The capacity of the map has been surpassed.");
+
+	__siMapSearch find = si__mapFind(*map, hash, name);
+
+	u32 index;
+	if (find.entryIndex != SI_HASH_NONE) {
+		index = find.entryIndex;
+	}
+	else {
+		index = (u32)map->len;
+
+		siMapEntry* entry = &map->entries[index];
+		entry->key = name;
+		entry->hash = hash;
+		entry->next = SI_HASH_NONE;
+		map->len += 1;
+
+		if (find.entryPrev != SI_HASH_NONE) {
+			map->entries[find.entryPrev].next = index;
+		}
+		else {
+			map->hashes[find.hashIndex] = index;
+		}
+	}
+
+	void* res = si_pointerAdd(map->values, (isize)index * map->typeSize);
+	si_memcopy(res, value, map->typeSize);
+
+	return res;
+}
+
+siIntern
+void si__mapHashBatch(siMapAny map, siString* names, isize len, u32* out) {
+#ifdef SI__MAP_HASH_IS_WYHASH
+	if (!map.keyed) {
+		u64 hashes[SI__MAP_BATCH];
+
+		for (isize i = 0; i < len; i += SI__MAP_BATCH) {
+			isize count = si_min(isize, len - i, SI__MAP_BATCH);
+			si_wyhash64Batch(SI_ARR_LEN(&names[i], count), hashes);
+
+			for_range (j, 0, count) {
+				out[i + j] = (u32)hashes[j] & 0x7FFFFFFF;
+			}
+		}
+		return;
+	}
+#endif
+
+	for_range (i, 0, len) {
+		out[i] = si__mapHash(map, names[i]);
+	}
+}
+
+/* Reads and hashes the next batch of keys, returning how many there were. */
+siIntern
+isize si__mapBatchLoad(siMapAny map, const void* keys, isize keyStride, isize start,
+		isize len, siString* names, u32* hashes) {
+	isize count = si_min(isize, len - start, SI__MAP_BATCH);
+	for_range (i, 0, count) {
+		names[i] = *(const siString*)si_pointerAddConst(keys, (start + i) * keyStride);
+	}
+
+	si__mapHashBatch(map, names, count, hashes);
+	return count;
+}
+
+siIntern
+void si__mapPrefetchBuckets(siMapAny map, const u32* hashes, isize len) {
+	SI_STOPIF(map.capacity == 0, return);
+	u32 mask = (u32)(map.capacity - 1);
+
+	for_range (i, 0, len) {
+		SI_PREFETCH(&map.hashes[hashes[i] & mask]);
+	}
+}
+
+siIntern
+void si__mapPrefetchEntries(siMapAny map, const u32* hashes, isize len) {
+	SI_STOPIF(map.capacity == 0, return);
+	u32 mask = (u32)(map.capacity - 1);
+
+	for_range (i, 0, len) {
+		u32 head = map.hashes[hashes[i] & mask];
+		if (head != SI_HASH_NONE) {
+			SI_PREFETCH(&map.entries[head]);
+		}
+	}
+}
+
+/* Gets every key into 'out', or sets it to its value if 'out' is nil. */
+siIntern
+void si__mapBatch(siMapAny* map, const void* keys, isize keyStride,
+		const void* values, isize valueStride, isize len, void** out) {
+	siString names[2][SI__MAP_BATCH];
+	u32 hashes[2][SI__MAP_BATCH];
+	isize counts[2];
+
+	/* NOTE(EimaMei): The batches go through a pipeline. While one batch gets
+	 * probed, the next one has already been hashed and its buckets are being
+	 * fetched, meaning that every load happens a whole stage after its prefetch. */
+	isize cur = 0;
+	counts[cur] = si__mapBatchLoad(*map, keys, keyStride, 0, len, names[cur], hashes[cur]);
+	si__mapPrefetchBuckets(*map, hashes[cur], counts[cur]);
+
+	for (isize i = 0; i < len; i += counts[cur ^ 1]) {
+		isize next = cur ^ 1;
+		counts[next] = si__mapBatchLoad(*map, keys, keyStride, i + counts[cur], len, names[next], hashes[next]);
+
+		si__mapPrefetchEntries(*map, hashes[cur], counts[cur]);
+		si__mapPrefetchBuckets(*map, hashes[next], counts[next]);
+
+		for_range (j, 0, counts[cur]) {
+			if (out != nil) {
+				out[i + j] = si_mapGetHash(*map, names[cur][j], hashes[cur][j]);
+			}
+			else {
+				const void* value = si_pointerAddConst(values, (i + j) * valueStride);
+				si_mapSetHash(map, names[cur][j], value, hashes[cur][j]);
+			}
+		}
+		cur = next;
+	}
+}
+
+SIDEF
+void si_mapHashBatch(siMapAny map, siArray(siString) names, u32* out) {
+	SI_ASSERT_ARR_TYPE(names, siString);
+	SI_ASSERT_NOT_NIL(out);
+	si__mapHashBatch(map, (siString*)names.data, names.len, out);
+}
+
+SIDEF
+void si_mapGetBatch(siMapAny map, siArray(siString) names, void** out) {
+	SI_ASSERT_ARR_TYPE(names, siString);
+	SI_ASSERT_NOT_NIL(out);
+
+	si__mapBatch(&map, names.data, si_sizeof(siString), nil, 0, names.len, out);
+}
+
+SIDEF
+void si_mapSetBatch(siMapAny* map, siArray(siString) names, const void* values) {
+	SI_ASSERT_NOT_NIL(map);
+	SI_ASSERT_ARR_TYPE(names, siString);
+	SI_ASSERT_NOT_NIL(values);
+
+	si__mapBatch(map, names.data, si_sizeof(siString), values, map->typeSize, names.len, nil);
+}
+
+SIDEF
+void si_mapErase(siMapAny* map, siString name) {
+	si_mapEraseHash(map, name, si__mapHash(*map, name));
+}
+
+SIDEF
+void si_mapEraseHash(siMapAny* map, siString name, u32 hash) {
+	SI_ASSERT_NOT_NIL(map);
+	SI_ASSERT_STR(name);
+	SI_STOPIF(map->capacity == 0, return);
+
+	__siMapSearch find = si__mapFind(*map, hash, name);
+	SI_STOPIF(find.entryIndex == SI_HASH_NONE, return);
+
+	if (find.entryPrev == SI_HASH_NONE) {
+		map->hashes[find.hashIndex] = map->entries[find.entryIndex].next;
+	}
+	else {
+		map->entries[find.entryPrev].next = map->entries[find.entryIndex].next;
+	}
+
+	map->len -= 1;
+	if ((isize)find.entryIndex == map->len) {
+		return;
+	}
+
+	siMapEntry* entryLast = &map->entries[map->len];
+	map->entries[find.entryIndex] = *entryLast;
+	si_memcopy(
+		si_pointerAdd(map->values, (isize)find.entryIndex * map->typeSize),
+		si_pointerAdd(map->values, map->len * map->typeSize),
+		map->typeSize
+	);
+
+	__siMapSearch last = si__mapFind(*map, entryLast->hash, entryLast->key);
+	if (last.entryPrev != SI_HASH_NONE) {
+		map->entries[last.entryPrev].next = find.entryIndex;
+	}
+	else {
+		map->hashes[last.hashIndex] = find.entryIndex;
+	}
+}
+
+SIDEF
+void si_mapClear(siMapAny* map) {
+	SI_ASSERT_NOT_NIL(map);
+
+	si_memset(map->hashes, 0xFF, si_sizeof(*map->hashes) * map->capacity);
+	map->len = 0;
+}
+
+inline
+void si_mapFree(siMapAny map) {
+	si_free(map.alloc, map.entries);
+}
+
+#undef SI_HASH_NONE
+
+#endif /* SI_IMPLEMENTATION_MAP */
+
+#ifdef SI_IMPLEMENTATION_BIT
+
+#define SI_BIT_DEC_AMOUNT_IMPL(func, def, body, retVal) \
+	def u8 si__##func##_u8(u8 x, i32 amount) { body return (u8)(retVal); } \
+	def u16 si__##func##_u16(u16 x, i32 amount) { body return (u16)(retVal); } \
+	def u32 si__##func##_u32(u32 x, i32 amount) { body return (u32)(retVal); } \
+	def u64 si__##func##_u64(u64 x, i32 amount) { body return (u64)(retVal); } \
+	def usize si__##func##_usize(usize x, i32 amount) { body return (usize)(retVal); }
 
 #define SI_BIT_DEC_TYPE_IMPL(func, def, body) \
 	def u8 si__##func##_u8(u8 x)    { u64 res = 0; body return (u8)res; } \
@@ -8716,3613 +13560,6991 @@ void si_mapFree(siMapAny map) {
 	def u64 si__##func##_u64(u64 x) { u64 res = 0; body return (u64)res; } \
 	def usize si__##func##_usize(usize x) { usize res = 0; body return (u64)res; }
 
-SI_BIT_DEC(countOnes, inline, {
-	isize count = 0;
-	while (x) {
-		count += (isize)(x & 1);
-		x >>= 1;
+SI_BIT_DEC(countOnes, inline, {
+	isize count = 0;
+	while (x) {
+		count += (isize)(x & 1);
+		x >>= 1;
+	}
+	return count;
+})
+
+SI_BIT_DEC(countLeadingOnes, inline, {
+	isize count = 0;
+
+	for (isize i = si_sizeof(x) * 8 - 1; i >= 0; i -= 1) {
+		if (x & SI_BIT(i)) { count += 1; }
+		else { break; }
+	}
+
+	return count;
+})
+
+SI_BIT_DEC(countLeadingZeros, inline, {
+	isize count = 0;
+
+	for (isize i = si_sizeof(x) * 8 - 1; i >= 0; i -= 1) {
+		if ((x & SI_BIT(i)) == 0) { count += 1; }
+		else { break; }
+	}
+
+	return count;
+})
+
+SI_BIT_DEC(countTrailingOnes, inline, {
+	isize count = 0;
+
+	while (x & 1) {
+		count += 1;
+		x >>= 1;
+	}
+
+	return count;
+})
+
+SI_BIT_DEC(countTrailingZeros, inline, {
+	if (x == 0) { return si_sizeof(x) * 8; }
+	isize count = 0;
+
+	while ((x & 1) == 0) {
+		count += 1;
+		x >>= 1;
+	}
+
+	return count;
+})
+
+SI_BIT_DEC_AMOUNT_IMPL(bitsRotateLeft, inline,
+	{
+		SI_ASSERT_NOT_NEG(amount);
+		amount &= si_sizeof(x) * 8 - 1;
+		if (!amount) { return x; }
+	},
+	(x << amount) | (x >> (si_sizeof(x) * 8 - amount))
+)
+
+SI_BIT_DEC_AMOUNT_IMPL(bitsRotateRight, inline,
+	{
+		SI_ASSERT_NOT_NEG(amount);
+		amount &= si_sizeof(x) * 8 - 1;
+		if (!amount) { return x; }
+	},
+	(x >> amount) | (x << (si_sizeof(x) * 8 - amount))
+)
+
+SI_BIT_DEC_TYPE_IMPL(bitsReverse, inline, {
+	for_range (i, 0, si_sizeof(x) * 8) {
+		res <<= 1;
+		res |= (x & 1);
+		x >>= 1;
+	}
+})
+
+SI_BIT_DEC_ARRAY(bytesToArray, inline, {
+	isize len = si_sizeof(x);
+	u8* res = si_allocArrayNonZeroed(alloc, u8, len);
+
+	u64 copy = x;
+	for_range (i, 0, len - 1) {
+		res[i] = (u8)(copy & 0xFF);
+		copy >>= 8;
+	}
+
+	return SI_ARR_LEN(res, len);
+})
+
+#undef SI_BIT_DEC
+#undef SI_BIT_DEC_ARRAY
+#undef SI_BIT_DEC_TYPE_IMPL
+#undef SI_BIT_DEC_AMOUNT_IMPL
+
+SIDEF
+u64 si_bytesFromArray(siArray(u8) bytes) {
+	SI_ASSERT_ARR_TYPE(bytes, u8);
+	SI_ASSERT(bytes.len <= si_sizeof(u64));
+
+	u64 res = 0;
+	u8 byte;
+	for_eachArr (byte, bytes) {
+		res <<= 8;
+		res |= byte;
+	}
+
+	return res;
+}
+
+inline
+u16 si_swap16(u16 x) {
+	return (u16)(((x >> 8) & 0xFFu) | ((x & 0xFFu) << 8));
+}
+inline
+u32 si_swap32(u32 x) {
+	return (u32)(
+		((x & 0xFF000000u) >> 24)  | ((x & 0x00FF0000u) >>  8) |
+		((x & 0x0000FF00u) <<  8)  | ((x & 0x000000FFu) << 24)
+	);
+}
+inline
+u64 si_swap64(u64 x) {
+   return (u64)(
+		((x & 0xFF00000000000000ull) >> 56) | ((x & 0x00FF000000000000ull) >> 40) |
+		((x & 0x0000FF0000000000ull) >> 24) | ((x & 0x000000FF00000000ull) >>  8) |
+		((x & 0x00000000FF000000ull) <<  8) | ((x & 0x0000000000FF0000ull) << 24) |
+		((x & 0x000000000000FF00ull) << 40) | ((x & 0x00000000000000FFull) << 56)
+   );
+}
+
+#if SI_ENDIAN_IS_LITTLE
+inline u16 si_swap16be(u16 x) { return si_swap16(x); }
+inline u32 si_swap32be(u32 x) { return si_swap32(x); }
+inline u64 si_swap64be(u64 x) { return si_swap64(x); }
+
+inline u16 si_swap16le(u16 x) { return x; }
+inline u32 si_swap32le(u32 x) { return x; }
+inline u64 si_swap64le(u64 x) { return x; }
+
+#else
+inline u16 si_swap16be(u16 x) { return x; }
+inline u32 si_swap32be(u32 x) { return x; }
+inline u64 si_swap64be(u64 x) { return x; }
+
+inline u16 si_swap16le(u16 x) { return si_swap16(x); }
+inline u32 si_swap32le(u32 x) { return si_swap32(x); }
+inline u64 si_swap64le(u64 x) { return si_swap64(x); }
+
+#endif
+
+
+SIDEF
+isize si_numLenInt(i64 num) {
+	return si_numLenIntEx(num, 10);
+}
+inline
+isize si_numLenIntEx(i64 num, i32 base) {
+	if (num < 0) {
+		return 1 + si_numLenUintEx(~(u64)num + 1, base);
+	}
+	return si_numLenUintEx((u64)num, base);
+}
+
+SIDEF
+isize si_numLenUint(u64 num) {
+	return si__numLen(num, 10);
+}
+
+inline
+isize si_numLenUintEx(u64 num, i32 base) {
+	SI_ASSERT(base >= 2);
+	return si__numLen(num, (u32)base);
+}
+
+
+
+#define SI_CHECK_ARITHMETIC_IMPL_ALL_I(func, def, action, ...) \
+	SI_CHECK_ARITHMETIC_DEC(i8,    func, SIDEF, {    const i8 max = INT8_MAX;     const i8 min = INT8_MIN;  *res =    (i8)(action); __VA_ARGS__ })  \
+	SI_CHECK_ARITHMETIC_DEC(i16,   func, SIDEF, {   const i16 max = INT16_MAX;   const i16 min = INT16_MIN; *res =   (i16)(action); __VA_ARGS__ }) \
+	SI_CHECK_ARITHMETIC_DEC(i32,   func, SIDEF, {   const i32 max = INT32_MAX;   const i32 min = INT32_MIN; *res =   (i32)(action); __VA_ARGS__ }) \
+	SI_CHECK_ARITHMETIC_DEC(i64,   func, SIDEF, {   const i64 max = INT64_MAX;   const i64 min = INT64_MIN; *res =   (i64)(action); __VA_ARGS__ }) \
+	SI_CHECK_ARITHMETIC_DEC(isize, func, SIDEF, { const isize max = ISIZE_MAX; const isize min = ISIZE_MIN; *res = (isize)(action); __VA_ARGS__ })
+
+#define SI_CHECK_ARITHMETIC_IMPL_ALL_U(func, def, action, ...) \
+	SI_CHECK_ARITHMETIC_DEC(u8,    func, SIDEF, {    const u8 max = UINT8_MAX;  SI_UNUSED(max); *res =    (u8)(action); __VA_ARGS__ } ) \
+	SI_CHECK_ARITHMETIC_DEC(u16,   func, SIDEF, {   const u16 max = UINT16_MAX; SI_UNUSED(max); *res =   (u16)(action); __VA_ARGS__ } ) \
+	SI_CHECK_ARITHMETIC_DEC(u32,   func, SIDEF, {   const u32 max = UINT32_MAX; SI_UNUSED(max); *res =   (u32)(action); __VA_ARGS__ } ) \
+	SI_CHECK_ARITHMETIC_DEC(u64,   func, SIDEF, {   const u64 max = UINT64_MAX; SI_UNUSED(max); *res =   (u64)(action); __VA_ARGS__ } ) \
+	SI_CHECK_ARITHMETIC_DEC(usize, func, SIDEF, { const usize max = USIZE_MAX;  SI_UNUSED(max); *res = (usize)(action); __VA_ARGS__ } ) \
+
+
+SI_CHECK_ARITHMETIC_IMPL_ALL_U(Add, SIDEF, a + b,
+	SI_ASSERT_NOT_NIL(res); \
+	return a > *res; \
+)
+SI_CHECK_ARITHMETIC_IMPL_ALL_I(Add, SIDEF, a + b,
+	SI_ASSERT_NOT_NIL(res); \
+	if (a >= 0) { \
+		return (max - a < b); \
+	} \
+	return (b < min - a); \
+)
+
+SI_CHECK_ARITHMETIC_IMPL_ALL_U(Sub, SIDEF, a - b,
+	SI_ASSERT_NOT_NIL(res); \
+	return a < *res; \
+)
+SI_CHECK_ARITHMETIC_IMPL_ALL_I(Sub, SIDEF, a - b,
+	SI_ASSERT_NOT_NIL(res); \
+	if (b < 0) { \
+		return (max + b < a); \
+	} \
+	return (min + b > a); \
+)
+
+SI_CHECK_ARITHMETIC_IMPL_ALL_U(Mul, SIDEF, a * b,
+	SI_ASSERT_NOT_NIL(res); \
+	return (b > 0 && a > max / b);
+)
+SI_CHECK_ARITHMETIC_IMPL_ALL_I(Mul, SIDEF, a * b,
+	SI_ASSERT_NOT_NIL(res); \
+	if (a > 0) { \
+		return (b > 0 && a > max / b) \
+			|| (b < 0 && b < min / a); \
+	} \
+	return a < 0 && ( \
+		(b > 0 && a < min / b) \
+		|| (b < 0 && a < max / b) \
+	); \
+)
+
+#undef SI_CHECK_ARITHMETIC_IMPL_ALL_U
+#undef SI_CHECK_ARITHMETIC_IMPL_ALL_S
+#undef SI_CHECK_ARITHMETIC_DEC
+
+force_inline
+isize si__bitsetCountOnes(u64 word) {
+#if SI_COMPILER_GCC || SI_COMPILER_CLANG
+	return __builtin_popcountll(word);
+#else
+	word = word - ((word >> 1) & 0x5555555555555555ull);
+	word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+	word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+	return (isize)((word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+/* NOTE(EimaMei): The word must not be zero. */
+force_inline
+isize si__bitsetFirstOne(u64 word) {
+#if SI_COMPILER_GCC || SI_COMPILER_CLANG
+	return __builtin_ctzll(word);
+#else
+	isize i = 0;
+	while ((word & 1) == 0) { word >>= 1; i += 1; }
+	return i;
+#endif
+}
+
+/* Returns the mask of the used bits inside the last word. */
+force_inline
+u64 si__bitsetTailMask(isize len) {
+	isize used = len % SI_BITSET_WORD_BITS;
+	return (used != 0) ? (UINT64_MAX >> (SI_BITSET_WORD_BITS - used)) : UINT64_MAX;
+}
+
+/* Number of words covered by a single rank block. */
+#define SI__BITSET_RANK_WORDS 8
+/* Number of rank blocks for the specified set, including the total count. */
+#define SI__BITSET_RANK_LEN(set) \
+	((SI_BITSET_WORDS((set).len) + SI__BITSET_RANK_WORDS - 1) / SI__BITSET_RANK_WORDS + 1)
+
+
+SIDEF
+siBitset si_bitsetMake(isize bits, siAllocator alloc) {
+	SI_ASSERT_NOT_NEG(bits);
+	SI_ASSERT_NOT_NIL(alloc.proc);
+
+	siBitset set;
+	set.capacity = si_max(isize, SI_BITSET_WORDS(bits), 1);
+	set.data = si_allocArray(alloc, u64, set.capacity);
+	set.len = (set.data != nil) ? bits : 0;
+	set.alloc = alloc;
+
+	return set;
+}
+
+SIDEF
+siBitset si_bitsetMakeBuffer(siArray(u64) buffer, isize bits) {
+	SI_ASSERT_ARR_TYPE(buffer, u64);
+	SI_ASSERT_NOT_NEG(bits);
+	SI_ASSERT(SI_BITSET_WORDS(bits) <= buffer.len);
+
+	siBitset set;
+	set.data = (u64*)buffer.data;
+	set.len = bits;
+	set.capacity = buffer.len;
+	set.alloc.proc = nil;
+	set.alloc.data = nil;
+
+	si_memset(set.data, 0, set.capacity * si_sizeof(u64));
+	return set;
+}
+
+inline
+void si_bitsetFree(siBitset set) {
+	SI_STOPIF(set.alloc.proc == nil, return);
+	si_free(set.alloc, set.data);
+}
+
+SIDEF
+bool si_bitsetResize(siBitset* set, isize bits) {
+	SI_ASSERT_NOT_NIL(set);
+	SI_ASSERT_NOT_NEG(bits);
+
+	isize words = SI_BITSET_WORDS(bits);
+	if (words > set->capacity) {
+		SI_STOPIF(set->alloc.proc == nil, return false);
+
+		isize capacity = si_max(isize, words, set->capacity * 2);
+		u64* data = (u64*)si_realloc(
+			set->alloc, set->data,
+			set->capacity * si_sizeof(u64), capacity * si_sizeof(u64)
+		);
+		SI_STOPIF(data == nil, return false);
+
+		set->data = data;
+		set->capacity = capacity;
+	}
+
+	if (bits > set->len) {
+		/* NOTE(EimaMei): The unused bits of the last word are always unset, only
+		 * the words after it need clearing. */
+		isize oldWords = SI_BITSET_WORDS(set->len);
+		si_memset(&set->data[oldWords], 0, (words - oldWords) * si_sizeof(u64));
+	}
+	else if (words != 0) {
+		set->data[words - 1] &= si__bitsetTailMask(bits);
+	}
+	set->len = bits;
+
+	return true;
+}
+
+inline
+bool si_bitsetTest(siBitset set, isize index) {
+	SI_ASSERT_NOT_NEG(index);
+	SI_ASSERT_MSG(index < set.len, "Index is out of bounds.");
+	return (set.data[index / SI_BITSET_WORD_BITS] >> (index % SI_BITSET_WORD_BITS)) & 1;
+}
+
+inline
+void si_bitsetSet(siBitset set, isize index) {
+	SI_ASSERT_NOT_NEG(index);
+	SI_ASSERT_MSG(index < set.len, "Index is out of bounds.");
+	set.data[index / SI_BITSET_WORD_BITS] |= SI_BIT(index % SI_BITSET_WORD_BITS);
+}
+
+inline
+void si_bitsetClear(siBitset set, isize index) {
+	SI_ASSERT_NOT_NEG(index);
+	SI_ASSERT_MSG(index < set.len, "Index is out of bounds.");
+	set.data[index / SI_BITSET_WORD_BITS] &= ~SI_BIT(index % SI_BITSET_WORD_BITS);
+}
+
+inline
+void si_bitsetFlip(siBitset set, isize index) {
+	SI_ASSERT_NOT_NEG(index);
+	SI_ASSERT_MSG(index < set.len, "Index is out of bounds.");
+	set.data[index / SI_BITSET_WORD_BITS] ^= SI_BIT(index % SI_BITSET_WORD_BITS);
+}
+
+inline
+void si_bitsetSetValue(siBitset set, isize index, bool value) {
+	SI_ASSERT_NOT_NEG(index);
+	SI_ASSERT_MSG(index < set.len, "Index is out of bounds.");
+	SI_MASK_SET(set.data[index / SI_BITSET_WORD_BITS], value, SI_BIT(index % SI_BITSET_WORD_BITS));
+}
+
+SIDEF
+void si_bitsetFill(siBitset set, bool value) {
+	isize words = SI_BITSET_WORDS(set.len);
+	SI_STOPIF(words == 0, return);
+
+	si_memset(set.data, value ? 0xFF : 0x00, words * si_sizeof(u64));
+	set.data[words - 1] &= si__bitsetTailMask(set.len);
+}
+
+SIDEF
+void si_bitsetAnd(siBitset set, siBitset other) {
+	isize len = si_min(isize, set.len, other.len);
+	isize words = len / SI_BITSET_WORD_BITS;
+
+	for_range (i, 0, words) {
+		set.data[i] &= other.data[i];
+	}
+
+	if (len % SI_BITSET_WORD_BITS) {
+		set.data[words] &= other.data[words] | ~si__bitsetTailMask(len);
+	}
+}
+
+SIDEF
+void si_bitsetOr(siBitset set, siBitset other) {
+	isize len = si_min(isize, set.len, other.len);
+	isize words = len / SI_BITSET_WORD_BITS;
+
+	for_range (i, 0, words) {
+		set.data[i] |= other.data[i];
+	}
+
+	if (len % SI_BITSET_WORD_BITS) {
+		set.data[words] |= other.data[words] & si__bitsetTailMask(len);
+	}
+}
+
+SIDEF
+void si_bitsetXor(siBitset set, siBitset other) {
+	isize len = si_min(isize, set.len, other.len);
+	isize words = len / SI_BITSET_WORD_BITS;
+
+	for_range (i, 0, words) {
+		set.data[i] ^= other.data[i];
+	}
+
+	if (len % SI_BITSET_WORD_BITS) {
+		set.data[words] ^= other.data[words] & si__bitsetTailMask(len);
+	}
+}
+
+SIDEF
+void si_bitsetNot(siBitset set) {
+	isize words = SI_BITSET_WORDS(set.len);
+	SI_STOPIF(words == 0, return);
+
+	for_range (i, 0, words) {
+		set.data[i] = ~set.data[i];
+	}
+	set.data[words - 1] &= si__bitsetTailMask(set.len);
+}
+
+SIDEF
+isize si_bitsetCount(siBitset set) {
+	isize words = SI_BITSET_WORDS(set.len);
+	isize i = 0;
+
+	/* NOTE(EimaMei): Independent accumulators let the CPU overlap the popcounts
+	 * instead of waiting on a single dependency chain. */
+	isize count0 = 0, count1 = 0, count2 = 0, count3 = 0;
+	for (; i + 4 <= words; i += 4) {
+		count0 += si__bitsetCountOnes(set.data[i + 0]);
+		count1 += si__bitsetCountOnes(set.data[i + 1]);
+		count2 += si__bitsetCountOnes(set.data[i + 2]);
+		count3 += si__bitsetCountOnes(set.data[i + 3]);
+	}
+	for (; i < words; i += 1) {
+		count0 += si__bitsetCountOnes(set.data[i]);
+	}
+
+	return count0 + count1 + count2 + count3;
+}
+
+SIDEF
+isize si_bitsetFindFirst(siBitset set, isize start) {
+	SI_ASSERT_NOT_NEG(start);
+	SI_STOPIF(start >= set.len, return -1);
+
+	isize words = SI_BITSET_WORDS(set.len);
+	isize i = start / SI_BITSET_WORD_BITS;
+	u64 word = set.data[i] & (UINT64_MAX << (start % SI_BITSET_WORD_BITS));
+
+	while (word == 0) {
+		i += 1;
+		SI_STOPIF(i >= words, return -1);
+		word = set.data[i];
+	}
+
+	return i * SI_BITSET_WORD_BITS + si__bitsetFirstOne(word);
+}
+
+SIDEF
+isize si_bitsetFindFirstZero(siBitset set, isize start) {
+	SI_ASSERT_NOT_NEG(start);
+	SI_STOPIF(start >= set.len, return -1);
+
+	isize words = SI_BITSET_WORDS(set.len);
+	isize i = start / SI_BITSET_WORD_BITS;
+	u64 word = ~set.data[i] & (UINT64_MAX << (start % SI_BITSET_WORD_BITS));
+
+	while (word == 0) {
+		i += 1;
+		SI_STOPIF(i >= words, return -1);
+		word = ~set.data[i];
+	}
+
+	isize index = i * SI_BITSET_WORD_BITS + si__bitsetFirstOne(word);
+	return (index < set.len) ? index : -1;
+}
+
+SIDEF
+siBitsetRank si_bitsetRankMake(siBitset set, siAllocator alloc) {
+	isize words = SI_BITSET_WORDS(set.len);
+
+	siBitsetRank rank;
+	rank.len = SI__BITSET_RANK_LEN(set);
+	rank.blocks = si_allocArrayNonZeroed(alloc, isize, rank.len);
+	rank.alloc = alloc;
+	SI_STOPIF(rank.blocks == nil, rank.len = 0; return rank);
+
+	isize count = 0;
+	for_range (i, 0, words) {
+		if (i % SI__BITSET_RANK_WORDS == 0) {
+			rank.blocks[i / SI__BITSET_RANK_WORDS] = count;
+		}
+		count += si__bitsetCountOnes(set.data[i]);
+	}
+	rank.blocks[rank.len - 1] = count;
+
+	return rank;
+}
+
+inline
+void si_bitsetRankFree(siBitsetRank rank) {
+	si_free(rank.alloc, rank.blocks);
+}
+
+SIDEF
+isize si_bitsetRank(siBitset set, siBitsetRank rank, isize index) {
+	SI_ASSERT_NOT_NEG(index);
+	SI_ASSERT(index <= set.len);
+	SI_ASSERT(rank.len == SI__BITSET_RANK_LEN(set));
+
+	isize word = index / SI_BITSET_WORD_BITS;
+	isize block = word / SI__BITSET_RANK_WORDS;
+	isize count = rank.blocks[block];
+
+	for_range (i, block * SI__BITSET_RANK_WORDS, word) {
+		count += si__bitsetCountOnes(set.data[i]);
+	}
+
+	isize bit = index % SI_BITSET_WORD_BITS;
+	if (bit != 0) {
+		count += si__bitsetCountOnes(set.data[word] & (UINT64_MAX >> (SI_BITSET_WORD_BITS - bit)));
+	}
+
+	return count;
+}
+
+SIDEF
+isize si_bitsetSelect(siBitset set, siBitsetRank rank, isize n) {
+	SI_ASSERT_NOT_NEG(n);
+	SI_ASSERT(rank.len == SI__BITSET_RANK_LEN(set));
+	SI_STOPIF(n >= rank.blocks[rank.len - 1], return -1);
+
+	/* NOTE(EimaMei): Finds the last block whose starting rank is <= n. */
+	isize low = 0, high = rank.len - 1;
+	while (high - low > 1) {
+		isize middle = low + (high - low) / 2;
+		if (rank.blocks[middle] <= n) { low = middle; }
+		else { high = middle; }
+	}
+
+	n -= rank.blocks[low];
+	isize i = low * SI__BITSET_RANK_WORDS;
+	isize count = si__bitsetCountOnes(set.data[i]);
+	while (count <= n) {
+		n -= count;
+		i += 1;
+		count = si__bitsetCountOnes(set.data[i]);
+	}
+
+	u64 word = set.data[i];
+	isize bit = 0;
+	for (isize ones = si__bitsetCountOnes(word & 0xFF); ones <= n; ones = si__bitsetCountOnes(word & 0xFF)) {
+		n -= ones;
+		word >>= 8;
+		bit += 8;
+	}
+	while (n != 0) {
+		word &= word - 1;
+		n -= 1;
+	}
+
+	return i * SI_BITSET_WORD_BITS + bit + si__bitsetFirstOne(word);
+}
+
+#undef SI__BITSET_RANK_WORDS
+#undef SI__BITSET_RANK_LEN
+
+
+#endif /* SI_IMPLEMENTATION_BIT */
+
+#ifdef SI_IMPLEMENTATION_TIME
+
+siString si__timeMonthNames[] = {
+	SI_STRC("January"), SI_STRC("February"), SI_STRC("March"), SI_STRC("April"),
+	SI_STRC("May"), SI_STRC("June"), SI_STRC("July"), SI_STRC("August"),
+	SI_STRC("September"), SI_STRC("October"), SI_STRC("November"), SI_STRC("December"),
+};
+
+siString si__timeMonthNamesShrt[] = {
+	SI_STRC("Jan"), SI_STRC("Feb"), SI_STRC("Mar"), SI_STRC("Apr"), SI_STRC("May"),
+	SI_STRC("Jun"), SI_STRC("Jul"), SI_STRC("Aug"), SI_STRC("Sep"), SI_STRC("Oct"),
+	SI_STRC("Nov"), SI_STRC("Dec"),
+};
+
+siString si__timeWeekNames[] = {
+	SI_STRC("Sunday"), SI_STRC("Monday"), SI_STRC("Tuesday"), SI_STRC("Wednesday"),
+	SI_STRC("Thursday"), SI_STRC("Friday"), SI_STRC("Saturday"),
+};
+
+siString si__timeWeekNamesShrt[] = {
+	SI_STRC("Sun"), SI_STRC("Mon"), SI_STRC("Tue"), SI_STRC("Wed"), SI_STRC("Thu"),
+	SI_STRC("Fri"), SI_STRC("Sat"),
+};
+
+siString si__timeAM_PM_Names[] = {
+	SI_STRC("AM"), SI_STRC("PM"), SI_STRC("am"), SI_STRC("pm")
+};
+
+
+siString si__timeTimeUnits[] = {
+	SI_STRC("ns"), SI_STRC("μs"), SI_STRC("ms"), SI_STRC("s"), SI_STRC("min"),
+	SI_STRC("h"), SI_STRC("d"), SI_STRC("m"), SI_STRC("y")
+};
+
+siString* SI_NAMES_MONTHS_FULL = si__timeMonthNames;
+siString* SI_NAMES_MONTHS_SHRT = si__timeMonthNamesShrt;
+siString* SI_NAMES_DAYS_FULL = si__timeWeekNames;
+siString* SI_NAMES_DAYS_SHRT = si__timeWeekNamesShrt;
+siString* SI_NAMES_AM_PM = si__timeAM_PM_Names;
+siString* SI_NAMES_TIME_UNITS = si__timeTimeUnits;
+
+#if SI_SYSTEM_IS_WINDOWS
+siIntern
+siTime si__win32ToSili(i64 time) {
+	return (siTime)(((time) - 116444736000000000) * 100);
+}
+
+#elif SI_ARCH_IS_WASM
+siIntern
+i64 si__wasiRdtsc(void) {
+	__wasi_timestamp_t time;
+	__wasi_errno_t res = __wasi_clock_time_get(__WASI_CLOCKID_PROCESS_CPUTIME_ID, 1, &time);
+
+	return (res == 0) ? (siTime)time : 0;
+}
+#endif
+
+
+/* NOTE(EimaMei): Credit goes to gb.h for the i386 and PPC code. */
+inline
+i64 si_RDTSC(void) {
+#if SI_COMPILER_CHECK_MIN(MSVC, 12, 0, 0)
+	#if !SI_SYSTEM_IS_WASM
+		return __rdtsc();
+	#else
+		return si__wasiRdtsc();
+	#endif
+#elif SI_COMPILER_GCC || SI_COMPILER_CLANG || SI_COMPILER_TCC
+	#if SI_ARCH_I386
+		i64 res;
+		__asm__ volatile (".byte 0x0f, 0x31" : "=A" (res));
+		return res;
+
+	#elif SI_ARCH_AMD64
+		i64 high, low;
+		__asm__ volatile ("rdtsc" : "=a"(low), "=d"(high));
+		return (high << 32) | low;
+
+	#elif SI_ARCH_IS_PPC
+		i32 high, low, tmp;
+		__asm__ volatile (
+			"0:\n"
+			"\tmftbu %0\n"
+			"\tmftb %1\n"
+			"\tmftbu %2\n"
+			"\tcmpw %2, %0\n"
+			"\tbne 0b\n"
+			: "=r"(high), "=r"(low), "=r"(tmp)
+		);
+		return ((i64)high << 32) | low;
+
+	#elif SI_ARCH_ARM64
+		i64 res;
+		__asm__ volatile ("mrs %0, cntvct_el0" : "=r"(res));
+		return res;
+
+	#elif SI_ARCH_IS_RISC
+		i64 res = 0;
+		__asm__ volatile ("rdcycle %0" : "=r"(res));
+		return res;
+
+	#elif SI_ARCH_IS_WASM
+		return si__wasiRdtsc();
+
+	#else
+		return 0;
+	#endif
+
+#else
+	#if SI_SYSTEM_IS_WINDOWS
+		LARGE_INTEGER count;
+		QueryPerformanceCounter(&count);
+		return count.QuadPart;
+
+	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+		struct timespec tv = {0};
+		clock_gettime(CLOCK_MONOTONIC, &tv);
+		return SI_TIME_S(tv.tv_sec) + tv.tv_nsec;
+
+	#elif SI_ARCH_IS_WASM
+		return si__wasiRdtsc();
+
+	#else
+		return 0;
+	#endif
+#endif
+}
+
+inline
+i64 si_RDTSCP(i32* proc) {
+	SI_ASSERT_NOT_NIL(proc);
+
+#if SI_COMPILER_CHECK_MIN(MSVC, 12, 0, 0)
+	#if !SI_SYSTEM_IS_WASM
+		return __rdtscp((u32*)proc);
+	#else
+		*proc = 0;
+		return si_RDTSC();
+	#endif
+#elif SI_COMPILER_GCC || SI_COMPILER_CLANG || SI_COMPILER_TCC
+	#if SI_ARCH_I386
+		i32 high, low;
+		__asm__ volatile (
+			"rdtscp"
+			: "=a"(high), "=d"(low), "=c"(*proc)
+		);
+		return ((i64)high << 32) | (i64)low;
+
+	#elif SI_ARCH_AMD64
+		i64 high, low;
+		__asm__ volatile ("rdtscp" : "=a"(low), "=d"(high), "=c"(*proc));
+		return (high << 32) | low;
+
+	#elif SI_ARCH_IS_PPC
+		u32 aux;
+
+		/* TODO(EimaMei): Check if this is even accurate. */
+		__asm__ volatile ("mfspr %0, 1023" : "=r"(aux));
+		*proc = (i32)aux;
+
+		return si_RDTSC();
+
+	#elif SI_ARCH_ARM64
+		u64 mpidr;
+
+		/* TODO(EimaMei): Check if this is even accurate. */
+		__asm__ volatile ("mrs %0, mpidr_el1" : "=r"(mpidr));
+		*proc = (i32)(mpidr & 0xFF);
+
+		return si_RDTSC();
+
+	#elif SI_SYSTEM_IS_WINDOWS
+		*proc = GetCurrentProcessorNumber();
+		return si_RDTSC();
+
+	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+		*proc = sched_getcpu();
+		return si_RDTSC();
+
+	#else
+		*proc = 0;
+		return si_RDTSC();
+
+	#endif
+
+#else
+	#if SI_SYSTEM_IS_WINDOWS
+		*proc = GetCurrentProcessorNumber();
+		return si_RDTSC();
+
+	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+		*proc = sched_getcpu();
+		return si_RDTSC();
+	#else
+		*proc = 0;
+		return si_RDTSC();
+	#endif
+#endif
+}
+
+
+SIDEF
+siTime si_clock(void) {
+	u64 ticks = (u64)si_RDTSC();
+	u32 proc = (u32)si_cpuClockSpeed(); /* TODO(EimaMei): Remove this later. */
+	return (siTime)(ticks * 1000) / proc;
+}
+
+inline
+siTime si_timeStampStart(void) {
+	return si_clock();
+}
+
+SIDEF
+void si_timeStampPrintSinceLoc(siTime timestamp, siCallerLoc loc) {
+	siTime end = si_clock();
+	siTime diff = (end - timestamp);
+
+	const siTimeUnitScale scale = si_timeGetUnit(diff);
+	si_printf(
+		"si_timeStampPrintSince: %L: TIME: %.2f %2s\n",
+		loc, (f32)diff / (f32)scale.threshold, si_timeUnitStr(scale.unit)
+	);
+}
+
+SIDEF
+void si_sleep(siTime time) {
+	SI_ASSERT_NOT_NEG(time);
+
+#if SI_SYSTEM_IS_WINDOWS
+	if (time < SI_MILLISECOND) { return; }
+
+	Sleep((u32)time / SI_MILLISECOND);
+
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	if (time == 0) { return; }
+
+	struct timespec ts = {
+		time / SI_SECOND,
+		(time % SI_SECOND)
+	};
+	nanosleep(&ts, &ts);
+
+#elif SI_SYSTEM_WASI
+	if (time == 0) { return; }
+
+	__wasi_subscription_t in = SI_STRUCT_ZERO;
+	in.u.tag = __WASI_EVENTTYPE_CLOCK;
+	in.u.u.clock.id = __WASI_CLOCKID_MONOTONIC;
+	in.u.u.clock.timeout = time;
+	in.u.u.clock.precision = SI_NANOSECOND;
+
+	__wasi_event_t events;
+	size_t nevents;
+
+	__wasi_errno_t result = __wasi_poll_oneoff(&in, &events, 1, &nevents);
+	SI_UNUSED(result);
+#elif SI_SYSTEM_EMSCRIPTEN
+	if (time < SI_MILLISECOND) { return; }
+	emscripten_sleep((unsigned int)(time / SI_MILLISECOND));
+#endif
+}
+
+
+SIDEF
+siTime si_timeNowUTC(void) {
+#if SI_SYSTEM_IS_WINDOWS
+	FILETIME time;
+	GetSystemTimePreciseAsFileTime(&time);
+
+	return si__win32ToSili((i64)time.dwHighDateTime << 32 | (i64)time.dwLowDateTime);
+
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	struct timespec spec;
+	i32 res = clock_gettime(CLOCK_REALTIME, &spec);
+
+	return (res == 0) ? SI_TIME_S(spec.tv_sec) + spec.tv_nsec : 0;
+
+#else
+	return 0;
+
+#endif
+}
+
+inline
+siTime si_timeNowLocal(void) {
+#if SI_SYSTEM_IS_WINDOWS
+	FILETIME utc;
+	GetSystemTimePreciseAsFileTime(&utc);
+	FILETIME time;
+	int res = FileTimeToLocalFileTime(&utc, &time);
+
+	return (res)
+		? si__win32ToSili((i64)time.dwHighDateTime << 32 | (i64)time.dwLowDateTime)
+		: 0;
+
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	i64 timeNow = si_timeNowUTC();
+	if (timezone == 0) {
+		tzset();
+	}
+
+	return (timezone != 0)
+		? timeNow - SI_TIME_S(timezone) + daylight * SI_HOUR
+		: 0;
+#else
+	return 0;
+
+#endif
+}
+
+SIDEF
+bool si_timeYearIsLeap(i32 year) {
+	return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+}
+
+SIDEF
+i32 si_timeGetDayOfWeek(i32 year, i32 month, i32 day) {
+	static i8 t[] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+	if (month < 3 ) {
+		year -= 1;
+	}
+	return (year + year / 4 - year / 100 + year / 400 + t[month - 1] + day) % 7;
+}
+
+static i8 SI__LUT_DAYS_IN_MONTH[2][12] = {
+	{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+	{31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+};
+
+SIDEF
+siTimeCalendar si_timeToCalendar(i64 time) {
+	/* TODO(EimaMei): Add leap second support??? */
+	siTimeCalendar calendar;
+
+	i32 daysSinceEpoch = (i32)(time / SI_DAY);
+
+	{
+		const i32 DAYS_IN_400_YEARS = (400 * 365) + 97;
+		const i32 DAYS_IN_100_YEARS = (100 * 365) + 24;
+		const i32 DAYS_IN_4_YEARS   = (  4 * 365) + 1;
+
+		calendar.years = 1970;
+		calendar.years += 400 * (daysSinceEpoch / DAYS_IN_400_YEARS);
+		daysSinceEpoch %= DAYS_IN_400_YEARS;
+
+		calendar.years += 100 * (daysSinceEpoch / DAYS_IN_100_YEARS);
+		daysSinceEpoch %= DAYS_IN_100_YEARS;
+
+		calendar.years += 4 * (daysSinceEpoch / DAYS_IN_4_YEARS);
+		daysSinceEpoch %= DAYS_IN_4_YEARS;
+
+		calendar.years += daysSinceEpoch / 365;
+		daysSinceEpoch %= 365;
+	}
+
+	{
+		i8* daysInMonths = SI__LUT_DAYS_IN_MONTH[si_timeYearIsLeap(calendar.years)];
+
+		daysSinceEpoch = si_abs(i32, daysSinceEpoch);
+		for_rangeRef (calendar.months, 0, 12) {
+			i32 days = daysInMonths[calendar.months];
+			SI_STOPIF(daysSinceEpoch < days, break);
+
+			daysSinceEpoch -= days;
+		}
+		calendar.months += 1;
+		calendar.days = daysSinceEpoch;
+	}
+
+	{
+		i64 nanoseconds = time % SI_DAY;
+
+		calendar.hours = (i32)(nanoseconds / SI_HOUR);
+		nanoseconds %= SI_HOUR;
+
+		calendar.minutes = (i32)(nanoseconds / SI_MINUTE);
+		nanoseconds %= SI_MINUTE;
+
+		calendar.seconds = (i32)(nanoseconds / SI_SECOND);
+		nanoseconds %= SI_SECOND;
+
+		calendar.nanoseconds = (i32)nanoseconds;
+	}
+
+	return calendar;
+}
+
+
+SIDEF
+siTime si_calendarToTime(siTimeCalendar calendar) {
+	SI_ASSERT(si_between(i32, calendar.years, 1677, 2262));
+	SI_ASSERT(si_between(i32, calendar.months, 1, 12));
+	SI_ASSERT(si_between(i32, calendar.days, 1, SI__LUT_DAYS_IN_MONTH[si_timeYearIsLeap(calendar.years)][calendar.months]));
+	SI_ASSERT(si_between(i32, calendar.hours, 0, 23));
+	SI_ASSERT(si_between(i32, calendar.minutes, 0, 59));
+	SI_ASSERT(si_between(i32, calendar.seconds, 0, 59));
+	SI_ASSERT(si_between(i32, calendar.nanoseconds, 0, SI_SECOND - 1));
+
+	/* TODO(EimaMei): Add leap second support??? */
+	siTime res = 0;
+	res += calendar.nanoseconds;
+	res += calendar.seconds * SI_SECOND;
+	res += calendar.minutes * SI_MINUTE;
+	res += calendar.hours * SI_HOUR;
+	res += calendar.days * SI_DAY;
+
+	i8* daysInMonths = SI__LUT_DAYS_IN_MONTH[si_timeYearIsLeap(calendar.years)];
+	for_range (i, 0, calendar.months - 1) {
+		res += daysInMonths[i] * SI_DAY;
+	}
+
+	isize amountOfYears = si_abs(i32, calendar.years - 1970);
+	i32 direction = (calendar.years > 1970) ? 1 : -1;
+	i32 year = 1970;
+	for_range (i, 0, amountOfYears) {
+		res += (365 + si_timeYearIsLeap(year - 1)) * SI_DAY;
+		year += direction;
+	}
+
+	return res;
+}
+
+siIntern
+isize si__timeToStr(siString fmt, isize* i, char letter, siArray(u8) out, isize len, i32 time) {
+	if (*i < fmt.len - 1 && fmt.data[1 + *i] == letter) {
+		*i += 1;
+		if (time < 10) {
+			si_arraySet(out, len, "0");
+			return 1 + si_stringFromUInt((u32)time, si_sliceFrom(out, len + 1)).len;
+		}
+	}
+
+	return si_stringFromUInt((u32)time, si_sliceFrom(out, len)).len;
+}
+
+siIntern
+void si__timeTimezone(bool check, siTimeCalendar* calendar) {
+	SI_STOPIF(check == false, return);
+
+	if (calendar->hours != 12 && calendar->hours != 0) {
+		calendar->hours %= 12;
+	}
+	else if (calendar->hours == 0) {
+		calendar->hours = 12;
+	}
+}
+
+SIDEF
+siString si_timeToString(siTimeCalendar calendar, siString fmt, siArray(u8) out) {
+	SI_ASSERT_STR(fmt);
+	SI_ASSERT_ARR_TYPE(out, u8);
+
+	bool AMwasChecked = false;
+	i32 ogHour = calendar.hours;
+	isize len = 0;
+
+	for_range (i, 0, fmt.len) {
+		SI_STOPIF(len >= out.len, break);
+
+		switch (fmt.data[i]) {
+			case 'y': {
+				isize ogI = i;
+				while (i < fmt.len - 1 && fmt.data[i + 1] == 'y' && (i - ogI) != 4) { i += 1; }
+
+				u32 year = (i - ogI != 1) ? (u32)calendar.years : (u32)calendar.years % 100u;
+				len += si_stringFromUInt(year, si_sliceFrom(out, len)).len;
+			} break;
+
+			case 'M': {
+				SI_ASSERT(si_between(i32, calendar.months, 0, 12));
+
+				isize ogI = i;
+				while (i < fmt.len - 1 && fmt.data[i + 1] == 'M' && (i - ogI) != 2) { i += 1; }
+
+				switch (i - ogI) {
+					case 0: {
+						len += si_stringFromUInt((u32)calendar.months, si_sliceFrom(out, len)).len;
+					} break;
+
+					case 1: {
+						if (calendar.months < 10) {
+							si_arraySet(out, len, "0");
+							len += 1;
+						}
+
+						len += si_stringFromUInt((u32)calendar.months, si_sliceFrom(out, len)).len;
+					} break;
+				}
+			} break;
+
+			case 'd': {
+				isize ogI = i;
+				while (i < fmt.len - 1 && fmt.data[i + 1] == 'd' && (i - ogI) != 4) { i += 1; }
+
+				switch (i - ogI) {
+					case 0: {
+						len += si_stringFromUInt((u32)calendar.days, si_sliceFrom(out, len)).len;
+					} break;
+
+					case 1: {
+						if (calendar.days < 10) {
+							si_arraySet(out, len, "0");
+							len += 1;
+						}
+
+						len += si_stringFromUInt((u32)calendar.days, si_sliceFrom(out, len)).len;
+					} break;
+
+					case 2: {
+						i32 wd = si_timeGetDayOfWeek(calendar.years, calendar.months, calendar.days);
+						siString* str = &SI_NAMES_DAYS_SHRT[wd];
+						len += si_memcopyStr_s(si_sliceFrom(out, len), *str);
+					} break;
+
+					case 4: {
+						i32 wd = si_timeGetDayOfWeek(calendar.years, calendar.months, calendar.days);
+						siString* str = &SI_NAMES_DAYS_FULL[wd];
+						len += si_memcopyStr_s(si_sliceFrom(out, len), *str);
+					} break;
+				}
+			} break;
+
+			case 'h': {
+				if (!AMwasChecked) {
+					for_range (j, i + 1, fmt.len) {
+						if (j + 1 < fmt.len &&
+							((fmt.data[j] == 'a' && fmt.data[j + 1] == 'p')
+							|| (fmt.data[j] == 'A' && fmt.data[j + 1] == 'P'))
+						) {
+							si__timeTimezone(AMwasChecked, &calendar);
+							break;
+						}
+					}
+					AMwasChecked = true;
+				}
+
+				len += si__timeToStr(fmt, &i, 'h', out, len, calendar.hours);
+			} break;
+
+			case 'm': {
+				len += si__timeToStr(fmt, &i, 'm', out, len, calendar.minutes);
+			} break;
+
+			case 's': {
+				len += si__timeToStr(fmt, &i, 's', out, len, calendar.seconds);
+			} break;
+
+			case 'n': {
+				len += si__timeToStr(fmt, &i, 'n', out, len, calendar.nanoseconds);
+			} break;
+
+			case 'A': {
+				SI_STOPIF(i < fmt.len - 1 && fmt.data[1 + i] == 'P', break);
+				goto AM_code;
+			} break;
+
+			case 'a': {
+				SI_STOPIF(i < fmt.len - 1 && fmt.data[1 + i] == 'p', break);
+AM_code:
+				i += 1;
+
+				siString* str = &SI_NAMES_AM_PM[2 * (fmt.data[i] == 'p') + (ogHour >= 12)];
+				len += si_memcopyStr_s(si_sliceFrom(out, len), *str);
+
+				si__timeTimezone(AMwasChecked, &calendar);
+				AMwasChecked = true;
+			} break;
+
+			default:
+				si_arraySet(out, len, &fmt.data[i]);
+				len += 1;
+		}
+	}
+
+	return SI_STR_LEN(out.data, len);
+}
+
+SIDEF
+siTimeUnitScale si_timeGetUnit(i64 time) {
+	static const siTimeUnitScale arr[] = {
+		{siTimeUnit_Nanosecond, SI_NANOSECOND},
+		{siTimeUnit_Microsecond, SI_MICROSECOND},
+		{siTimeUnit_Millisecond, SI_MILLISECOND},
+		{siTimeUnit_Second, SI_SECOND},
+		{siTimeUnit_Minute, SI_MINUTE},
+		{siTimeUnit_Hour, SI_HOUR},
+		{siTimeUnit_Day, SI_DAY},
+		{siTimeUnit_Month, SI_DAY * 30},
+		{siTimeUnit_Year, SI_DAY * 365},
+	};
+	SI_STOPIF(time <= 0, return SI_COMP_LIT(siTimeUnitScale, -1, 0));
+
+	for_range (i, 1, countof(arr)) {
+		siTime converted = time / arr[i].threshold;
+		if (converted == 0) {
+			return arr[i - 1];
+		}
+	}
+
+	return arr[countof(arr) - 1];
+}
+
+inline
+siString si_timeUnitStr(siTimeUnit type) {
+	SI_ASSERT(si_between(i32, type, 0, siTimeUnit_Year));
+	return SI_NAMES_TIME_UNITS[type];
+}
+
+
+#endif /* SI_IMPLEMENTATION_TIME */
+
+#ifdef SI_IMPLEMENTATION_PRINT
+
+siIntern bool SI__COLOR_MODE = true;
+
+SIDEF
+isize si_print(cstring str) {
+	return si_fprint(si_stdout, SI_CSTR(str));
+}
+SIDEF
+isize si_printLn(cstring str) {
+	return si_fprintLn(si_stdout, SI_CSTR(str));
+}
+
+SIDEF
+isize si_printf(cstring fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	isize res = si_printfVa(fmt, va);
+	va_end(va);
+
+	return res;
+}
+inline
+isize si_printfVa(cstring fmt, va_list va) {
+	return si_printfVaStr(SI_CSTR(fmt), va);
+}
+
+SIDEF
+isize si_printfStr(siString fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	isize res = si_printfVaStr(fmt, va);
+	va_end(va);
+
+	return res;
+}
+
+SIDEF
+isize si_printfVaStr(siString fmt, va_list va) {
+	return si_fprintfVa(si_stdout, fmt, va);
+}
+
+SIDEF
+isize si_printfLn(cstring fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	isize res = si_printfLnVa(fmt, va);
+	va_end(va);
+
+	return res;
+}
+SIDEF
+isize si_printfLnVa(cstring fmt, va_list va) {
+	return si_fprintfLnVa(si_stdout, SI_CSTR(fmt), va);
+}
+
+
+inline
+isize si_fprint(siFile* file, siString str) {
+	return si_fileWriteStr(file, str);
+}
+SIDEF
+isize si_fprintLn(siFile* file, siString str) {
+	isize n = si_fprint(file, str);
+	n += si_fileWriteByte(file, '\n');
+	return n;
+}
+
+SIDEF
+siString si_bprintf(siArray(u8) out, siString fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	siString res = si_bprintfVa(out, fmt, va);
+	va_end(va);
+
+	return res;
+}
+
+#if 1
+
+struct si__printfInfoStruct {
+	u8* data;
+	isize index;
+	isize capacity;
+
+	i32 padSize;
+	u8 padLetter;
+	bool colorPresent;
+
+	siString str;
+
+	/* NOTE(EimaMei): If set, the buffer gets flushed into the file whenever it
+	 * fills up instead of the output being truncated. */
+	siFile* file;
+	isize written;
+
+	/* NOTE(EimaMei): If set, 'data' is the builder's buffer and it gets grown
+	 * whenever it fills up. */
+	siBuilder* builder;
+	siAllocationError error;
+
+	/* NOTE(EimaMei): The full length of the output, including the truncated
+	 * parts. Formatting only stops early if 'measure' is false. */
+	isize total;
+	bool measure;
+};
+
+force_inline
+bool si__printIsFull(const struct si__printfInfoStruct* info) {
+	return info->index >= info->capacity && info->file == nil && info->builder == nil
+		&& !info->measure;
+}
+
+siIntern
+void si__printFlush(struct si__printfInfoStruct* info) {
+	SI_STOPIF(info->index == 0, return);
+
+	info->written += si_fileWriteStr(info->file, SI_STR_LEN(info->data, info->index));
+	info->index = 0;
+}
+
+siIntern
+void si__printGrow(struct si__printfInfoStruct* info, isize len) {
+	siBuilder* b = info->builder;
+	b->len = info->index;
+
+	siAllocationError error = si_builderMakeSpaceFor(b, len);
+	if (error != siAllocationError_None && info->error == siAllocationError_None) {
+		info->error = error;
+	}
+
+	info->data = b->data;
+	info->capacity = b->capacity;
+}
+
+force_inline
+void si__printWrite(struct si__printfInfoStruct* info, const void* data, isize len) {
+	info->total += len;
+
+	if (info->index + len > info->capacity) {
+		if (info->file != nil) {
+			si__printFlush(info);
+
+			if (len >= info->capacity) {
+				info->written += si_fileWriteStr(info->file, SI_STR_LEN((const u8*)data, len));
+				return;
+			}
+		}
+		else if (info->builder != nil) {
+			si__printGrow(info, len);
+		}
+	}
+
+	len = si_min(isize, len, info->capacity - info->index);
+	info->index += si_memcopy(&info->data[info->index], data, len);
+}
+
+siIntern
+void si__printPad(struct si__printfInfoStruct* info, u8 letter, isize len) {
+	SI_STOPIF(len <= 0, return);
+	info->total += len;
+
+	if (info->index + len > info->capacity && info->builder != nil) {
+		si__printGrow(info, len);
+	}
+
+	while (len > 0) {
+		if (info->index == info->capacity) {
+			SI_STOPIF(info->file == nil, return);
+			si__printFlush(info);
+		}
+
+		isize chunk = si_min(isize, len, info->capacity - info->index);
+		si_memset(&info->data[info->index], letter, chunk);
+		info->index += chunk;
+		len -= chunk;
+	}
+}
+
+siIntern
+void si__printStrToBuf(struct si__printfInfoStruct* info) {
+	SI_ASSERT_STR(info->str);
+
+	isize padding = (info->padSize < 0) ? -(isize)info->padSize : info->padSize;
+	padding = si_max(isize, padding - info->str.len, 0);
+
+	if (info->padSize > 0) { si__printPad(info, info->padLetter, padding); }
+	si__printWrite(info, info->str.data, info->str.len);
+	if (info->padSize < 0) { si__printPad(info, info->padLetter, padding); }
+
+	info->padSize = 0;
+}
+force_inline
+void si__printStrCpy(struct si__printfInfoStruct* info) {
+	si__printWrite(info, info->str.data, info->str.len);
+}
+siIntern
+void si__printFloatFlush(void* info, const u8* data, isize len) {
+	si__printWrite((struct si__printfInfoStruct*)info, data, len);
+}
+
+/* Parses the literal text and the specifier that follows it. Returns the
+ * position right after the specifier. */
+siIntern
+const u8* si__formatParse(const u8* ptr, const u8* end, siFormatSpec* spec) {
+	/* NOTE(EimaMei): '%' can never be a part of a multi-byte UTF-8 character,
+	 * meaning the literal text doesn't need to be decoded. */
+	const u8* literal = ptr;
+	while (ptr < end && *ptr != '%') { ptr += 1; }
+
+	spec->literal = SI_STR_LEN(literal, ptr - literal);
+	spec->specifier = 0;
+	spec->typeSize = 0;
+	spec->padLetter = ' ';
+	spec->prefixLen = 0;
+	spec->hasPrecision = false;
+	spec->width = 0;
+	spec->precision = 6;
+	SI_STOPIF(ptr >= end, return ptr);
+	ptr += 1;
+
+	i32* value = &spec->width;
+	while (ptr < end) {
+		siUtf32Char x = si_utf8Decode(ptr);
+		ptr += x.len;
+
+		switch (x.codepoint) {
+			case 'h': {
+				SI_STOPIF(spec->typeSize != 0, return ptr);
+				if (ptr < end && *ptr == 'h') {
+					ptr += 1;
+					spec->typeSize = 1;
+				}
+				else {
+					spec->typeSize = 2;
+				}
+			} break;
+
+			case 'l': {
+				SI_STOPIF(spec->typeSize != 0, return ptr);
+				SI_STOPIF(ptr < end && *ptr == 'l', ptr += 1);
+				spec->typeSize = 8;
+			} break;
+
+			case 'z': {
+				SI_STOPIF(spec->typeSize != 0, return ptr);
+				spec->typeSize = si_sizeof(usize);
+			} break;
+
+			case 'j': {
+				SI_STOPIF(spec->typeSize != 0, return ptr);
+				spec->typeSize = 8;
+			} break;
+
+			case '*': {
+				*value = SI_FORMAT_ARG;
+			} break;
+
+			case '.': {
+				value = &spec->precision;
+				spec->hasPrecision = true;
+			} break;
+
+			case '-': case '+': {
+				if (ptr < end && si_charIsDigit((char)*ptr)) {
+					ptr -= 1;
+					goto conv_decimal;
+				}
+				siFallthrough; /* NOTE(EimaMei): Go to the ' ' case. */
+			}
+			case ' ': case '#': {
+				if (spec->prefixLen < countof(spec->prefix)) {
+					spec->prefix[spec->prefixLen] = (u8)x.codepoint;
+					spec->prefixLen += 1;
+				}
+			} break;
+
+			case '0': {
+				if (ptr < end && si_charIsDigit((char)*ptr)) {
+					spec->padLetter = '0';
+				}
+				else {
+					*value = 0;
+				}
+			} break;
+
+			case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+			case '8': case '9': {
+				ptr -= 1;
+conv_decimal:
+				{
+					bool isNegative = (*ptr == '-');
+					ptr += (*ptr == '-' || *ptr == '+');
+
+					i64 count = 0;
+					while (ptr < end && si_charIsDigit((char)*ptr)) {
+						count = count * 10 + (*ptr - '0');
+						SI_ASSERT(count <= INT32_MAX);
+						ptr += 1;
+					}
+
+					*value = (i32)(isNegative ? -count : count);
+				}
+			} break;
+
+			default: {
+				spec->specifier = x.codepoint;
+				return ptr;
+			}
+		}
+	}
+
+	/* NOTE(EimaMei): The format ended before the specifier did (e.g. a lone '%'),
+	 * in which case it's printed as is. */
+	spec->literal = SI_STR_LEN(literal, ptr - literal);
+	return ptr;
+}
+
+#define SI_CHECK_AFTERPOINT_INT(info, afterPointIsSet, afterPoint) \
+	if (afterPointIsSet) { \
+		SI_STOPIF(afterPoint == 0, break); \
+		info->padLetter = '0'; \
+		info->padSize = afterPoint; \
+	} \
+	do {} while (0)
+
+/* Writes the literal text of the specifier and its value. */
+siIntern
+void si__formatExecute(struct si__printfInfoStruct* info, const siFormatSpec* spec, va_list* va) {
+	si__printWrite(info, spec->literal.data, spec->literal.len);
+	SI_STOPIF(spec->specifier == 0, return);
+
+	union {
+		i32 I32; u32 U32;
+		u64 U64; i64 I64; f64 F64;
+		usize USIZE; isize ISIZE;
+		cstring STR; u8* PTR;
+	} vaValue;
+	vaValue.U64 = 0;
+
+	/* NOTE(EimaMei): Big enough for '%f' of the largest 64-bit float. */
+	siArray(u8) stack = SI_ARR_STACK(384);
+
+	siRune x = spec->specifier;
+	i32 base = 10;
+	i32 typeSize = spec->typeSize;
+	bool afterPointIsSet = spec->hasPrecision;
+
+	info->padLetter = spec->padLetter;
+	info->padSize = (spec->width == SI_FORMAT_ARG) ? va_arg(*va, i32) : spec->width;
+	i32 afterPoint = (spec->precision == SI_FORMAT_ARG) ? va_arg(*va, i32) : spec->precision;
+
+	for_range (i, 0, spec->prefixLen) {
+		u8 prefix = spec->prefix[i];
+		if (prefix != '#') {
+			info->str = SI_STR_LEN(&spec->prefix[i], 1);
+			si__printStrCpy(info);
+		}
+		else if (x == 'x' || x == 'X' || x == 'b' || x == 'o' || x == 'O') {
+			u8 altForm[2] = {'0', (u8)(x | (siRune)SI_BIT(5))};
+			info->str = SI_STR_LEN(altForm, si_sizeof(altForm));
+			si__printStrCpy(info);
+		}
+	}
+
+	switch (x) {
+		case 'n': {
+			(void)va_arg(*va, signed int*);
+			break;
+		}
+		case '%': {
+			info->str = SI_STR("%");
+			si__printStrCpy(info);
+			break;
+		}
+
+		case 'x': case 'X':
+			base = 16;
+			si_numEnableUpper(x != 'x');
+			goto GOTO_SPECIFIER_U;
+		case 'o':
+			base = 8;
+			goto GOTO_SPECIFIER_U;
+		case 'b':
+			base = 2;
+			goto GOTO_SPECIFIER_U;
+
+		case 'u': {
+GOTO_SPECIFIER_U:
+			switch (typeSize) {
+				case 0: vaValue.U32 = va_arg(*va, u32); break;
+				case 1: vaValue.U32 = (u8)va_arg(*va, u32); break;
+				case 2: vaValue.U32 = (u16)va_arg(*va, u32); break;
+				case 4: vaValue.U32 = va_arg(*va, u32); break;
+				case 8: vaValue.U64 = va_arg(*va, u64); break;
+				default: SI_PANIC();
+			}
+			SI_CHECK_AFTERPOINT_INT(info, afterPointIsSet, afterPoint);
+
+			info->str = si_stringFromUIntEx(vaValue.U64, base, stack);
+			si__printStrToBuf(info);
+
+			si_numEnableUpper(true);
+		} break;
+
+		case 'i': case 'd': {
+			switch (typeSize) {
+				case 0: vaValue.I64 = va_arg(*va, i32); break;
+				case 1: vaValue.I64 = (i8)va_arg(*va, i32); break;
+				case 2: vaValue.I64 = (i16)va_arg(*va, i32); break;
+				case 4: vaValue.I64 = va_arg(*va, i32); break;
+				case 8: vaValue.I64 = va_arg(*va, i64); break;
+				default: SI_DEBUG_TRAP();
+			}
+			SI_CHECK_AFTERPOINT_INT(info, afterPointIsSet, afterPoint);
+
+			info->str = si_stringFromInt(vaValue.I64, stack);
+			si__printStrToBuf(info);
+			break;
+		}
+
+		case 'c': {
+			vaValue.I32 = va_arg(*va, i32);
+
+			siUtf8Char utf8 = si_utf8Encode(vaValue.I32);
+			info->str = SI_STR_LEN(utf8.codepoint, utf8.len);
+
+			si__printStrToBuf(info);
+
+		} break;
+
+		case 'S': {
+			vaValue.STR = va_arg(*va, char*);
+
+			if (vaValue.STR != nil) {
+				isize len = afterPointIsSet
+					? afterPoint
+					: si_cstrLen(vaValue.STR);
+				info->str = SI_STR_LEN(vaValue.STR, len);
+			}
+			else { info->str = SI_STR("(nil)"); }
+
+			si__printStrToBuf(info);
+		} break;
+
+		case 'A': case 'a': {
+			vaValue.F64 = va_arg(*va, f64);
+
+			char altForm[2] = {'0', (char)(x + ('X' - 'A'))};
+			info->str = SI_STR_LEN(altForm, si_sizeof(altForm));
+			si__printStrCpy(info);
+
+			info->str = si_stringFromFloatEx(vaValue.F64, 16, afterPoint, stack);
+			si__printStrToBuf(info);
+		} break;
+
+		case 'F': case 'f':
+		case 'E': case 'e':
+		case 'G': case 'g': {
+			vaValue.F64 = va_arg(*va, f64);
+
+			u8 buffer[SI__FLOAT_EXACT_MAX];
+			si__floatDigits digits;
+			i32 precision = afterPoint;
+
+			si__floatWriter w = {(u8*)stack.data, 0, stack.len, nil, nil};
+			if (!si__floatWriteSpecial(&w, vaValue.F64)) {
+				switch (x) {
+					case 'F': case 'f': si__floatDigitsExact(vaValue.F64, precision, true, buffer, &digits); break;
+					case 'E': case 'e': si__floatDigitsExact(vaValue.F64, precision + 1, false, buffer, &digits); break;
+					default: {
+						precision = si_max(i32, precision, 1);
+						si__floatDigitsExact(vaValue.F64, precision, false, buffer, &digits);
+					}
+				}
+				si__floatWriteSpecifier(&w, &digits, x, precision);
+			}
+
+			if (w.len > stack.len) {
+				/* NOTE(EimaMei): Large precisions don't fit into the stack, in which
+				 * case the number is written again straight into the output. */
+				isize len = w.len;
+				isize padding = (info->padSize < 0) ? -(isize)info->padSize : info->padSize;
+				padding = si_max(isize, padding - len, 0);
+
+				if (info->padSize > 0) { si__printPad(info, info->padLetter, padding); }
+				w.len = 0;
+				w.flush = si__printFloatFlush;
+				w.ctx = info;
+				si__floatWriteSpecifier(&w, &digits, x, precision);
+				si__printWrite(info, w.data, w.len);
+				if (info->padSize < 0) { si__printPad(info, info->padLetter, padding); }
+
+				info->padSize = 0;
+				break;
+			}
+
+			info->str = SI_STR_LEN(stack.data, w.len);
+			si__printStrToBuf(info);
+		} break;
+
+		case 'p': {
+			info->str = SI_STR("0x");
+			si__printStrCpy(info);
+
+			vaValue.USIZE = (usize)va_arg(*va, void*);
+			info->str = si_stringFromUIntEx(vaValue.USIZE, 16, stack);
+			si__printStrCpy(info);
+		} break;
+
+		case 's': {
+			info->str = va_arg(*va, siString);
+			if (info->str.data == nil) { info->str = SI_STR("(nil)"); }
+
+			si__printStrToBuf(info);
+		} break;
+
+		case 't': { /* Boolean */
+			info->str = si_stringFromBool((bool)va_arg(*va, b32));
+			si__printStrCpy(info);
+		} break;
+
+		case 'L': { /* Location */
+			siCallerLoc loc = va_arg(*va, siCallerLoc);
+			siArena arena = si_arenaMakePtr(si_stackAlloc(1024), 1);
+
+			siBuilder b = si_builderMake(loc.filename.len + 20 + loc.function.len + 2, si_allocatorArena(&arena));
+			si_builderWriteStr(&b, loc.filename);
+			si_builderWriteByte(&b, ':');
+			si_builderWriteInt(&b, loc.line);
+			si_builderWriteByte(&b, ':');
+			si_builderWriteStr(&b, loc.function);
+
+			info->str = si_builderToStr(b);
+			si__printStrToBuf(info);
+		} break;
+
+
+		case 'C': {
+			if (info->colorPresent) {
+				info->colorPresent = false;
+				info->str = SI_STR("\33[0m");
+				si__printStrCpy(info);
+				break;
+			}
+
+			siPrintColor clr = va_arg(*va, siPrintColor);
+			if (!SI__COLOR_MODE) { break; }
+
+			info->colorPresent = true;
+			switch (clr.type) {
+				case siPrintColorType_3bit: {
+					SI_ASSERT(si_between(u8, clr.data.ansi.color, 0, 7));
+
+					char str[] ="\33[\0;\0\0m";
+					str[2] = (!clr.data.ansi.bold) ? '0' : '1';
+					str[4] = (!clr.data.ansi.light) ? '3' : '9';
+					str[5] = (char)('0' + clr.data.ansi.color);
+
+					info->str = SI_STR(str);
+					si__printStrCpy(info);
+				} break;
+
+				case siPrintColorType_8bit: {
+					#define _8BIT_STR "\33[38;5;"
+
+					char str[32] = _8BIT_STR;
+					siArray(char) buf = SI_ARR_LEN(str, countof_str(str));
+					isize trueLen = countof_str(_8BIT_STR);
+
+					siString num = si_stringFromInt(
+						clr.data.cube, si_sliceFrom(buf, countof_str(_8BIT_STR))
+					);
+					trueLen += num.len;
+
+					str[trueLen] = 'm';
+					trueLen += 1;
+
+					info->str = SI_STR_LEN(str, trueLen);
+					si__printStrCpy(info);
+
+					#undef _8BIT_STR
+				} break;
+
+				case siPrintColorType_24bit: {
+					#define _24BIT_STR "\33[38;2;"
+
+					char str[64] = _24BIT_STR;
+					siArray(char) buf = SI_ARR_LEN(str, countof_str(str));
+					isize trueLen = countof_str(_24BIT_STR);
+
+					static char divider[countof(clr.data.rgb)] = {';', ';', 'm'};
+					for_range (j, 0, countof(clr.data.rgb)) {
+						siString num = si_stringFromInt(
+							clr.data.rgb[j], si_sliceFrom(buf, trueLen)
+						);
+						trueLen += num.len;
+
+						str[trueLen] = divider[j];
+						trueLen += 1;
+
+					}
+
+					info->str = SI_STR_LEN(str, trueLen);
+					si__printStrCpy(info);
+
+					#undef _24BIT_STR
+				} break;
+
+				default: SI_PANIC_MSG("Invalid color type. Most likely a non-color value was given.");
+			}
+		} break;
+
+		default: {
+			siUtf8Char utf8 = si_utf8Encode(x);
+			u8 str[5] = {'%'};
+			si_memcopy(&str[1], utf8.codepoint, utf8.len);
+			info->str = SI_STR_LEN(str, 1 + utf8.len);
+			si__printStrCpy(info);
+		}
 	}
-	return count;
-})
+}
 
-SI_BIT_DEC(countLeadingOnes, inline, {
-	isize count = 0;
+#undef SI_CHECK_AFTERPOINT_INT
 
-	for (isize i = si_sizeof(x) * 8 - 1; i >= 0; i -= 1) {
-		if (x & SI_BIT(i)) { count += 1; }
-		else { break; }
+#endif
+
+siIntern
+void si__printfVa(struct si__printfInfoStruct* info, siString fmt, va_list va) {
+	va_list args;
+	va_copy(args, va);
+
+	const u8* ptr = fmt.data;
+	const u8* end = &fmt.data[fmt.len];
+	while (ptr < end && !si__printIsFull(info)) {
+		siFormatSpec spec;
+		ptr = si__formatParse(ptr, end, &spec);
+		si__formatExecute(info, &spec, &args);
 	}
+	va_end(args);
+}
 
-	return count;
-})
+siIntern
+void si__printfFormatVa(struct si__printfInfoStruct* info, siFormat format, va_list va) {
+	va_list args;
+	va_copy(args, va);
+
+	const siFormatSpec* specs = (const siFormatSpec*)format.data;
+	for_range (i, 0, format.len) {
+		SI_STOPIF(si__printIsFull(info), break);
+		si__formatExecute(info, &specs[i], &args);
+	}
+	va_end(args);
+}
+
+SIDEF
+siString si_bprintfVa(siArray(u8) out, siString fmt, va_list va) {
+	SI_ASSERT_ARR_TYPE(out, u8);
+	SI_STOPIF(out.len == 0, return SI_STR_EMPTY);
+
+	struct si__printfInfoStruct info = SI_STRUCT_ZERO;
+	info.data = (u8*)out.data;
+	info.capacity = out.len;
+	si__printfVa(&info, fmt, va);
+
+	return SI_STR_LEN(info.data, info.index);
+}
+
+SIDEF
+siString si_bprintfEx(siArray(u8) out, isize* outRequiredLen, siString fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	siString res = si_bprintfExVa(out, outRequiredLen, fmt, va);
+	va_end(va);
+
+	return res;
+}
+
+SIDEF
+siString si_bprintfExVa(siArray(u8) out, isize* outRequiredLen, siString fmt, va_list va) {
+	SI_ASSERT_ARR_TYPE(out, u8);
+	SI_ASSERT_NOT_NIL(outRequiredLen);
+
+	struct si__printfInfoStruct info = SI_STRUCT_ZERO;
+	info.data = (u8*)out.data;
+	info.capacity = out.len;
+	info.measure = true;
+	si__printfVa(&info, fmt, va);
+
+	*outRequiredLen = info.total;
+	return SI_STR_LEN(info.data, info.index);
+}
+
+SIDEF
+siAllocationError si_builderPrintf(siBuilder* b, siString fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	siAllocationError res = si_builderPrintfVa(b, fmt, va);
+	va_end(va);
+
+	return res;
+}
+
+SIDEF
+siAllocationError si_builderPrintfVa(siBuilder* b, siString fmt, va_list va) {
+	SI_ASSERT_NOT_NIL(b);
+
+	struct si__printfInfoStruct info = SI_STRUCT_ZERO;
+	info.data = b->data;
+	info.index = b->len;
+	info.capacity = b->capacity;
+	info.builder = b;
+	si__printfVa(&info, fmt, va);
+
+	b->len = info.index;
+	return info.error;
+}
+
+
+SIDEF
+siFormat si_formatMake(siString fmt, siAllocator alloc) {
+	SI_ASSERT_STR(fmt);
+
+	/* NOTE(EimaMei): Every specifier starts with a '%', plus one more for the
+	 * literal text after the last one. */
+	isize count = 1;
+	for_range (i, 0, fmt.len) {
+		count += (fmt.data[i] == '%');
+	}
+
+	siFormatSpec* specs = si_allocArrayNonZeroed(alloc, siFormatSpec, count);
+	SI_STOPIF(specs == nil, return SI_ARR_LEN(specs, 0));
+
+	isize len = 0;
+	const u8* ptr = fmt.data;
+	const u8* end = &fmt.data[fmt.len];
+	while (ptr < end) {
+		ptr = si__formatParse(ptr, end, &specs[len]);
+		len += 1;
+	}
+
+	return SI_ARR_LEN(specs, len);
+}
+
+SIDEF
+siString si_bprintfFormat(siArray(u8) out, siFormat format, ...) {
+	va_list va;
+	va_start(va, format);
+	siString res = si_bprintfFormatVa(out, format, va);
+	va_end(va);
+
+	return res;
+}
+
+SIDEF
+siString si_bprintfFormatVa(siArray(u8) out, siFormat format, va_list va) {
+	SI_ASSERT_ARR_TYPE(out, u8);
+	SI_STOPIF(out.len == 0, return SI_STR_EMPTY);
+
+	struct si__printfInfoStruct info = SI_STRUCT_ZERO;
+	info.data = (u8*)out.data;
+	info.capacity = out.len;
+	si__printfFormatVa(&info, format, va);
+
+	return SI_STR_LEN(info.data, info.index);
+}
+
+SIDEF
+isize si_fprintf(siFile* file, siString fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	isize res = si_fprintfVa(file, fmt, va);
+	va_end(va);
+
+	return res;
+}
+
+/* NOTE(EimaMei): Formatted output is streamed into the file in chunks of
+ * 'SI_PRINT_CHUNK_SIZE' bytes, meaning the output is never truncated and each
+ * chunk is written with a single call. */
+SIDEF
+isize si_fprintfVa(siFile* file, siString fmt, va_list va) {
+	SI_ASSERT_NOT_NIL(file);
+
+	u8 buffer[SI_PRINT_CHUNK_SIZE];
+	struct si__printfInfoStruct info = SI_STRUCT_ZERO;
+	info.data = buffer;
+	info.capacity = countof(buffer);
+	info.file = file;
+
+	si__printfVa(&info, fmt, va);
+	si__printFlush(&info);
+
+	return info.written;
+}
+
+SIDEF
+isize si_fprintfLn(siFile* file, siString fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	isize res = si_fprintfLnVa(file, fmt, va);
+	va_end(va);
+
+	return res;
+}
+SIDEF
+isize si_fprintfLnVa(siFile* file, siString fmt, va_list va) {
+	SI_ASSERT_NOT_NIL(file);
+
+	u8 buffer[SI_PRINT_CHUNK_SIZE];
+	struct si__printfInfoStruct info = SI_STRUCT_ZERO;
+	info.data = buffer;
+	info.capacity = countof(buffer);
+	info.file = file;
+
+	si__printfVa(&info, fmt, va);
+	si__printWrite(&info, "\n", 1);
+	si__printFlush(&info);
+
+	return info.written;
+}
+
+SIDEF
+isize si_fprintfFormat(siFile* file, siFormat format, ...) {
+	va_list va;
+	va_start(va, format);
+	isize res = si_fprintfFormatVa(file, format, va);
+	va_end(va);
+
+	return res;
+}
+SIDEF
+isize si_fprintfFormatVa(siFile* file, siFormat format, va_list va) {
+	SI_ASSERT_NOT_NIL(file);
+
+	u8 buffer[SI_PRINT_CHUNK_SIZE];
+	struct si__printfInfoStruct info = SI_STRUCT_ZERO;
+	info.data = buffer;
+	info.capacity = countof(buffer);
+	info.file = file;
+
+	si__printfFormatVa(&info, format, va);
+	si__printFlush(&info);
+
+	return info.written;
+}
+
+SIDEF
+siString si_bprintfLn(siArray(u8) out, siString fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	siString res = si_bprintfLnVa(out, fmt, va);
+	va_end(va);
+
+	return res;
+}
+SIDEF
+siString si_bprintfLnVa(siArray(u8) out, siString fmt, va_list va) {
+	siString str = si_bprintfVa(out, fmt, va);
+	if (out.len != 0) {
+		si_arraySet(out, str.len, "\n");
+		str.len += 1;
+	}
+
+	return str;
+}
+
+
+SIDEF
+bool si_printHas24bitColor(void) {
+	siString colorterm = si_envVarGetData(SI_STR("COLORTERM"), SI_ARR_STACK(16));
+
+	return si_stringEqual(colorterm, SI_STR("truecolor"));
+}
+
+SIDEF
+void si_printEnableColor(bool value) {
+	SI__COLOR_MODE = value & 1;
+}
+
+
+inline
+void si_printMemory(const void* ptr, isize amount) {
+	si_printMemoryEx(ptr, amount, 16, 64);
+}
+
+SIDEF
+void si_printMemoryEx(const void* ptr, isize amount, i32 base, i32 stride) {
+	SI_ASSERT_NOT_NIL(ptr);
+	SI_ASSERT_NOT_NEG(amount);
+
+	siString fmt;
+	switch (base) {
+		case 16: fmt = SI_STR("%02X%c"); break;
+		default: SI_PANIC();
+	}
+
+	const u8* buf = (const u8*)ptr;
+	for_range (i, 0, amount) {
+		si_printfStr(fmt, buf[i], ((i + 1) % stride == 0) ? '\n' : ' ');
+	}
+	si_print("\n");
+}
+
+siNoreturn SIDEF
+void si_panic(siString strCondition, siCallerLoc call, siString strMessage, ...) {
+	va_list va;
+	va_start(va, strMessage);
+	si_panicVa(strCondition, call, strMessage, va);
+}
+
+void si_panicVa(siString strCondition, siCallerLoc call, siString strMessage, va_list va) {
+	siPrintColor red = si_printColor3bitEx(siPrintColor3bit_Red, true, false);
 
-SI_BIT_DEC(countLeadingZeros, inline, {
-	isize count = 0;
+	si_fprintf(
+		si_stderr,
+		SI_STR("%CAssertion \"%s\" at \"%L\"%C%s"),
+		red, strCondition, call, (strMessage.len != 0) ? SI_STR(": ") : SI_STR("\n")
+	);
 
-	for (isize i = si_sizeof(x) * 8 - 1; i >= 0; i -= 1) {
-		if ((x & SI_BIT(i)) == 0) { count += 1; }
-		else { break; }
+	if (strMessage.len != 0) {
+		si_fprintfLnVa(si_stderr, strMessage, va);
 	}
+	va_end(va);
 
-	return count;
-})
+	SI_DEBUG_TRAP();
+}
 
-SI_BIT_DEC(countTrailingOnes, inline, {
-	isize count = 0;
+#endif /* SI_IMPLEMENTATION_PRINT */
 
-	while (x & 1) {
-		count += 1;
-		x >>= 1;
-	}
+#ifdef SI_IMPLEMENTATION_MATH
 
-	return count;
-})
+SI_MATH_FUNC_DECLARE_2X       (min,     inline, { return (a < b) ? a : b;  })
+SI_MATH_FUNC_DECLARE_2X       (max,     inline, { return (a > b) ? a : b;  })
+SI_MATH_FUNC_DECLARE_3X_bool   (between, inline, { return b <= a && a <= c; })
 
-SI_BIT_DEC(countTrailingZeros, inline, {
-	if (x == 0) { return si_sizeof(x) * 8; }
-	isize count = 0;
+#undef SI_MATH_FUNC_DECLARE_2X
+#undef SI_MATH_FUNC_DECLARE_3X_bool
 
-	while ((x & 1) == 0) {
-		count += 1;
-		x >>= 1;
-	}
+inline i8 si__abs_i8(i8 a)    { return a < 0 ?  (i8)-a : (i8)a; }
+inline i16 si__abs_i16(i16 a) { return a < 0 ? (i16)-a : (i16)a; }
+inline i32 si__abs_i32(i32 a) { return a < 0 ? -a : a; }
+inline i64 si__abs_i64(i64 a) { return a < 0 ? -a : a; }
+inline isize si__abs_isize(isize a) { return a < 0 ? -a : a; }
+inline f32 si__abs_f32(f32 a) { return a < 0 ? -a : a; }
+inline f64 si__abs_f64(f64 a) { return a < 0 ? -a : a; }
 
-	return count;
-})
+inline f64 si__round_f64(f64 x) { return (x >= 0.0f) ? si_floor(f64, x + 0.5f) : si_ceil(f64, x - 0.5f); }
+inline f32 si__round_f32(f32 x) { return (x >= 0.0f) ? si_floor(f32, x + 0.5f) : si_ceil(f32, x - 0.5f); }
 
-SI_BIT_DEC_AMOUNT_IMPL(bitsRotateLeft, inline,
-	{
-		SI_ASSERT_NOT_NEG(amount);
-		amount &= si_sizeof(x) * 8 - 1;
-		if (!amount) { return x; }
-	},
-	(x << amount) | (x >> (si_sizeof(x) * 8 - amount))
-)
+inline f32 si__floor_f32(f32 a) { return (f32)((a >= 0.0f) ? (i64)a : (i64)(a - 0.9999999999999999f)); }
+inline f64 si__floor_f64(f64 a) { return (f64)((a >= 0.0) ? (i64)a : (i64)(a - 0.9999999999999999)); }
 
-SI_BIT_DEC_AMOUNT_IMPL(bitsRotateRight, inline,
-	{
-		SI_ASSERT_NOT_NEG(amount);
-		amount &= si_sizeof(x) * 8 - 1;
-		if (!amount) { return x; }
-	},
-	(x >> amount) | (x << (si_sizeof(x) * 8 - amount))
-)
+inline f32 si__ceil_f32(f32 a) { return (f32)((a < 0) ? (i64)a : (i64)a + 1); }
+inline f64 si__ceil_f64(f64 a) { return (f64)((a < 0) ? (i64)a : (i64)a + 1); }
 
-SI_BIT_DEC_TYPE_IMPL(bitsReverse, inline, {
-	for_range (i, 0, si_sizeof(x) * 8) {
-		res <<= 1;
-		res |= (x & 1);
-		x >>= 1;
+inline
+i32 si_float32IsInf(f32 num) {
+	union { f32 f; u32 n; } check;
+	check.f = num;
+
+	switch (check.n) {
+		case 0x7F800000: return 1;
+		case 0xFF800000: return 2;
 	}
-})
 
-SI_BIT_DEC_ARRAY(bytesToArray, inline, {
-	isize len = si_sizeof(x);
-	u8* res = si_allocArrayNonZeroed(alloc, u8, len);
+	return 0;
+}
 
-	u64 copy = x;
-	for_range (i, 0, len - 1) {
-		res[i] = (u8)(copy & 0xFF);
-		copy >>= 8;
-	}
+inline
+bool si_float32IsNan(f32 num) {
+	static const u32 nanV = 0x7FC00000; /* NOTE(EimaMei): Canonical NaN value for 32-bit. */
 
-	return SI_ARR_LEN(res, len);
-})
+	union { f32 f; u32 n; } check;
+	check.f = num;
+	check.n &= ~SI_ENDIAN_VALUE((u32)SI_BIT(31), SI_BIT(0)); /* NOTE(EimaMei): A quick way of changing the minus to plus. */
 
-#undef SI_BIT_DEC
-#undef SI_BIT_DEC_ARRAY
-#undef SI_BIT_DEC_TYPE_IMPL
-#undef SI_BIT_DEC_AMOUNT_IMPL
+	return check.n == nanV;
+}
 
-SIDEF
-u64 si_bytesFromArray(siArray(u8) bytes) {
-	SI_ASSERT_ARR_TYPE(bytes, u8);
-	SI_ASSERT(bytes.len <= si_sizeof(u64));
+inline
+i32 si_float64IsInf(f64 num) {
+	union { f64 f; u64 n; } check;
+	check.f = num;
 
-	u64 res = 0;
-	u8 byte;
-	for_eachArr (byte, bytes) {
-		res <<= 8;
-		res |= byte;
+	switch (check.n) {
+		case 0x7FF0000000000000: return 1; /* NOTE(EimaMei): Positive infinity. */
+		case 0xFFF0000000000000: return 2; /* NOTE(EimaMei): Negative infinity. */
 	}
 
-	return res;
+	return 0;
 }
 
 inline
-u16 si_swap16(u16 x) {
-	return (u16)(((x >> 8) & 0xFFu) | ((x & 0xFFu) << 8));
-}
-inline
-u32 si_swap32(u32 x) {
-	return (u32)(
-		((x & 0xFF000000u) >> 24)  | ((x & 0x00FF0000u) >>  8) |
-		((x & 0x0000FF00u) <<  8)  | ((x & 0x000000FFu) << 24)
-	);
-}
-inline
-u64 si_swap64(u64 x) {
-   return (u64)(
-		((x & 0xFF00000000000000ull) >> 56) | ((x & 0x00FF000000000000ull) >> 40) |
-		((x & 0x0000FF0000000000ull) >> 24) | ((x & 0x000000FF00000000ull) >>  8) |
-		((x & 0x00000000FF000000ull) <<  8) | ((x & 0x0000000000FF0000ull) << 24) |
-		((x & 0x000000000000FF00ull) << 40) | ((x & 0x00000000000000FFull) << 56)
-   );
+bool si_float64IsNan(f64 num) {
+	static const u64 nanV = 0x7FF8000000000000; /* NOTE(EimaMei): Canonical NaN value for 64-bit. */
+
+	union { f64 f; u64 n; } check;
+	check.f = num;
+	check.n &= ~SI_ENDIAN_VALUE(SI_BIT(63), SI_BIT(0)); /* NOTE(EimaMei): A quick way of changing the minus to plus. */
+
+	return check.n == nanV;
 }
 
-#if SI_ENDIAN_IS_LITTLE
-inline u16 si_swap16be(u16 x) { return si_swap16(x); }
-inline u32 si_swap32be(u32 x) { return si_swap32(x); }
-inline u64 si_swap64be(u64 x) { return si_swap64(x); }
+#endif /* SI_IMPLEMENTATION_MATH */
 
-inline u16 si_swap16le(u16 x) { return x; }
-inline u32 si_swap32le(u32 x) { return x; }
-inline u64 si_swap64le(u64 x) { return x; }
+#ifdef SI_IMPLEMENTATION_RANDOM
 
-#else
-inline u16 si_swap16be(u16 x) { return x; }
-inline u32 si_swap32be(u32 x) { return x; }
-inline u64 si_swap64be(u64 x) { return x; }
+#define SI__RANDOM_ROTL(x, bits) (((x) << (bits)) | ((x) >> (64 - (bits))))
 
-inline u16 si_swap16le(u16 x) { return si_swap16(x); }
-inline u32 si_swap32le(u32 x) { return si_swap32(x); }
-inline u64 si_swap64le(u64 x) { return si_swap64(x); }
+/* The multiplier of PCG's 128-bit LCG. */
+#define SI__PCG_MULTIPLIER_LOW  0x4385DF649FCCF645
+#define SI__PCG_MULTIPLIER_HIGH 0x2360ED051FC65DA4
 
-#endif
+/* The amount of xoshiro256** generators that 'si_randomFill' runs side by side. */
+#define SI__RANDOM_FILL_LANES 8
 
+/* Calculates 'a * b + c' modulo 2^128 and writes the result to 'out'. */
+force_inline
+void si__randomMulAdd128(const u64 a[2], const u64 b[2], const u64 c[2], u64 out[2]) {
+	u64 high;
+	u64 low = si__mul128(a[0], b[0], &high);
+	high += a[0] * b[1] + a[1] * b[0];
 
-SIDEF
-isize si_numLenInt(i64 num) {
-	isize len;
-	if (num < 0) {
-		num = -num;
-		len = 1;
-	}
-	else { len = 0; }
-
-	if (num < 10) return 1 + len;
-	if (num < 100) return 2 + len;
-	if (num < 1000) return 3 + len;
-	if (num < 10000) return 4 + len;
-	if (num < 100000) return 5 + len;
-	if (num < 1000000) return 6 + len;
-	if (num < 10000000) return 7 + len;
-	if (num < 100000000) return 8 + len;
-	if (num < 1000000000) return 9 + len;
-	if (num < 10000000000) return 10 + len;
-	if (num < 100000000000) return 11 + len;
-	if (num < 1000000000000) return 12 + len;
-	if (num < 10000000000000) return 13 + len;
-	if (num < 100000000000000) return 14 + len;
-	if (num < 1000000000000000) return 15 + len;
-	if (num < 10000000000000000) return 16 + len;
-	if (num < 100000000000000000) return 17 + len;
-	if (num < 1000000000000000000) return 18 + len;
-	return 19 + len;
-}
-inline
-isize si_numLenIntEx(i64 num, i32 base) {
-	if (num < 0) {
-		num = -num;
-		return 1 + si_numLenUintEx((u64)num, base);
-	}
-	return si_numLenUintEx((u64)num, base);
+	out[0] = low + c[0];
+	out[1] = high + c[1] + (out[0] < low);
 }
 
-SIDEF
-isize si_numLenUint(u64 num) {
-	if (num < 10) return 1;
-	if (num < 100) return 2;
-	if (num < 1000) return 3;
-	if (num < 10000) return 4;
-	if (num < 100000) return 5;
-	if (num < 1000000) return 6;
-	if (num < 10000000) return 7;
-	if (num < 100000000) return 8;
-	if (num < 1000000000) return 9;
-	if (num < 10000000000) return 10;
-	if (num < 100000000000) return 11;
-	if (num < 1000000000000) return 12;
-	if (num < 10000000000000) return 13;
-	if (num < 100000000000000) return 14;
-	if (num < 1000000000000000) return 15;
-	if (num < 10000000000000000) return 16;
-	if (num < 100000000000000000) return 17;
-	if (num < 1000000000000000000) return 18;
-	if (num < 10000000000000000000U) return 19;
-	return 20;
+force_inline
+u64 si__randomSplitmix64(u64* state) {
+	*state += 0x9E3779B97F4A7C15;
+
+	u64 z = *state;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+	return z ^ (z >> 31);
 }
 
-inline
-isize si_numLenUintEx(u64 num, i32 base) {
-	SI_ASSERT_NOT_NEG(base);
+force_inline
+u64 si__randomXoshiro(u64 s[4]) {
+	u64 res = SI__RANDOM_ROTL(s[1] * 5, 7) * 9;
+	u64 t = s[1] << 17;
 
-	isize count = 0;
-	do {
-		count += 1;
-		num /= (u32)base;
-	} while (num != 0);
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = SI__RANDOM_ROTL(s[3], 45);
 
-	return count;
+	return res;
 }
 
+force_inline
+void si__randomPcgStep(siRandom* rng) {
+	static const u64 multiplier[2] = {SI__PCG_MULTIPLIER_LOW, SI__PCG_MULTIPLIER_HIGH};
+	si__randomMulAdd128(rng->state.pcg.state, multiplier, rng->state.pcg.increment, rng->state.pcg.state);
+}
 
-#define SI_CHECK_ARITHMETIC_IMPL_ALL_I(func, def, action, ...) \
-	SI_CHECK_ARITHMETIC_DEC(i8,    func, SIDEF, {    const i8 max = INT8_MAX;     const i8 min = INT8_MIN;  *res =    (i8)(action); __VA_ARGS__ })  \
-	SI_CHECK_ARITHMETIC_DEC(i16,   func, SIDEF, {   const i16 max = INT16_MAX;   const i16 min = INT16_MIN; *res =   (i16)(action); __VA_ARGS__ }) \
-	SI_CHECK_ARITHMETIC_DEC(i32,   func, SIDEF, {   const i32 max = INT32_MAX;   const i32 min = INT32_MIN; *res =   (i32)(action); __VA_ARGS__ }) \
-	SI_CHECK_ARITHMETIC_DEC(i64,   func, SIDEF, {   const i64 max = INT64_MAX;   const i64 min = INT64_MIN; *res =   (i64)(action); __VA_ARGS__ }) \
-	SI_CHECK_ARITHMETIC_DEC(isize, func, SIDEF, { const isize max = ISIZE_MAX; const isize min = ISIZE_MIN; *res = (isize)(action); __VA_ARGS__ })
+force_inline
+u64 si__randomPcg(siRandom* rng) {
+	si__randomPcgStep(rng);
 
-#define SI_CHECK_ARITHMETIC_IMPL_ALL_U(func, def, action, ...) \
-	SI_CHECK_ARITHMETIC_DEC(u8,    func, SIDEF, {    const u8 max = UINT8_MAX;  SI_UNUSED(max); *res =    (u8)(action); __VA_ARGS__ } ) \
-	SI_CHECK_ARITHMETIC_DEC(u16,   func, SIDEF, {   const u16 max = UINT16_MAX; SI_UNUSED(max); *res =   (u16)(action); __VA_ARGS__ } ) \
-	SI_CHECK_ARITHMETIC_DEC(u32,   func, SIDEF, {   const u32 max = UINT32_MAX; SI_UNUSED(max); *res =   (u32)(action); __VA_ARGS__ } ) \
-	SI_CHECK_ARITHMETIC_DEC(u64,   func, SIDEF, {   const u64 max = UINT64_MAX; SI_UNUSED(max); *res =   (u64)(action); __VA_ARGS__ } ) \
-	SI_CHECK_ARITHMETIC_DEC(usize, func, SIDEF, { const usize max = USIZE_MAX;  SI_UNUSED(max); *res = (usize)(action); __VA_ARGS__ } ) \
+	u64 low = rng->state.pcg.state[0], high = rng->state.pcg.state[1];
+	u64 x = low ^ high;
+	u32 rot = (u32)(high >> 58);
+	return (x >> rot) | (x << ((64 - rot) & 63));
+}
 
+/* Advances the LCG by 'delta' steps in O(log2(delta)) time. */
+siIntern
+void si__randomPcgAdvance(siRandom* rng, u64 deltaLow, u64 deltaHigh) {
+	u64 curMult[2] = {SI__PCG_MULTIPLIER_LOW, SI__PCG_MULTIPLIER_HIGH};
+	u64 curPlus[2] = {rng->state.pcg.increment[0], rng->state.pcg.increment[1]};
+	u64 accMult[2] = {1, 0}, accPlus[2] = {0, 0};
+	static const u64 zero[2] = {0, 0};
+
+	while (deltaLow != 0 || deltaHigh != 0) {
+		if (deltaLow & 1) {
+			si__randomMulAdd128(accMult, curMult, zero, accMult);
+			si__randomMulAdd128(accPlus, curMult, curPlus, accPlus);
+		}
 
-SI_CHECK_ARITHMETIC_IMPL_ALL_U(Add, SIDEF, a + b,
-	SI_ASSERT_NOT_NIL(res); \
-	return a > *res; \
-)
-SI_CHECK_ARITHMETIC_IMPL_ALL_I(Add, SIDEF, a + b,
-	SI_ASSERT_NOT_NIL(res); \
-	if (a >= 0) { \
-		return (max - a < b); \
-	} \
-	return (b < min - a); \
-)
+		u64 multPlusOne[2] = {curMult[0] + 1, curMult[1] + (curMult[0] == UINT64_MAX)};
+		si__randomMulAdd128(multPlusOne, curPlus, zero, curPlus);
+		si__randomMulAdd128(curMult, curMult, zero, curMult);
 
-SI_CHECK_ARITHMETIC_IMPL_ALL_U(Sub, SIDEF, a - b,
-	SI_ASSERT_NOT_NIL(res); \
-	return a < *res; \
-)
-SI_CHECK_ARITHMETIC_IMPL_ALL_I(Sub, SIDEF, a - b,
-	SI_ASSERT_NOT_NIL(res); \
-	if (b < 0) { \
-		return (max + b < a); \
-	} \
-	return (min + b > a); \
-)
+		deltaLow = (deltaLow >> 1) | (deltaHigh << 63);
+		deltaHigh >>= 1;
+	}
 
-SI_CHECK_ARITHMETIC_IMPL_ALL_U(Mul, SIDEF, a * b,
-	SI_ASSERT_NOT_NIL(res); \
-	return (b > 0 && a > max / b);
-)
-SI_CHECK_ARITHMETIC_IMPL_ALL_I(Mul, SIDEF, a * b,
-	SI_ASSERT_NOT_NIL(res); \
-	if (a > 0) { \
-		return (b > 0 && a > max / b) \
-			|| (b < 0 && b < min / a); \
-	} \
-	return a < 0 && ( \
-		(b > 0 && a < min / b) \
-		|| (b < 0 && a < max / b) \
-	); \
-)
+	si__randomMulAdd128(accMult, rng->state.pcg.state, accPlus, rng->state.pcg.state);
+}
+
+siIntern
+void si__randomXoshiroJump(u64 s[4], const u64 table[4]) {
+	u64 res[4] = {0, 0, 0, 0};
+
+	for_range (i, 0, 4) {
+		for_range (bit, 0, 64) {
+			if (table[i] & SI_BIT(bit)) {
+				res[0] ^= s[0];
+				res[1] ^= s[1];
+				res[2] ^= s[2];
+				res[3] ^= s[3];
+			}
+			si__randomXoshiro(s);
+		}
+	}
+
+	si_memcopy(s, res, si_sizeof(res));
+}
 
-#undef SI_CHECK_ARITHMETIC_IMPL_ALL_U
-#undef SI_CHECK_ARITHMETIC_IMPL_ALL_S
-#undef SI_CHECK_ARITHMETIC_DEC
 
-#endif /* SI_IMPLEMENTATION_BIT */
+SIDEF
+siRandom si_randomMake(u64 seed) {
+	siRandom rng;
+	rng.type = siRandomType_Xoshiro256;
+
+	/* NOTE(EimaMei): splitmix64 never outputs four zeroes in a row, so the
+	 * xoshiro state can never end up being all zero. */
+	for_range (i, 0, countof(rng.state.xoshiro)) {
+		rng.state.xoshiro[i] = si__randomSplitmix64(&seed);
+	}
 
-#ifdef SI_IMPLEMENTATION_TIME
+	return rng;
+}
 
-siString si__timeMonthNames[] = {
-	SI_STRC("January"), SI_STRC("February"), SI_STRC("March"), SI_STRC("April"),
-	SI_STRC("May"), SI_STRC("June"), SI_STRC("July"), SI_STRC("August"),
-	SI_STRC("September"), SI_STRC("October"), SI_STRC("November"), SI_STRC("December"),
-};
+SIDEF
+siRandom si_randomMakePcg(u64 seed, u64 stream) {
+	siRandom rng;
+	rng.type = siRandomType_Pcg64;
+	rng.state.pcg.state[0] = 0;
+	rng.state.pcg.state[1] = 0;
+	rng.state.pcg.increment[0] = (stream << 1) | 1;
+	rng.state.pcg.increment[1] = stream >> 63;
 
-siString si__timeMonthNamesShrt[] = {
-	SI_STRC("Jan"), SI_STRC("Feb"), SI_STRC("Mar"), SI_STRC("Apr"), SI_STRC("May"),
-	SI_STRC("Jun"), SI_STRC("Jul"), SI_STRC("Aug"), SI_STRC("Sep"), SI_STRC("Oct"),
-	SI_STRC("Nov"), SI_STRC("Dec"),
-};
+	si__randomPcgStep(&rng);
+	u64 low = rng.state.pcg.state[0];
+	rng.state.pcg.state[0] += seed;
+	rng.state.pcg.state[1] += (rng.state.pcg.state[0] < low);
+	si__randomPcgStep(&rng);
 
-siString si__timeWeekNames[] = {
-	SI_STRC("Sunday"), SI_STRC("Monday"), SI_STRC("Tuesday"), SI_STRC("Wednesday"),
-	SI_STRC("Thursday"), SI_STRC("Friday"), SI_STRC("Saturday"),
-};
+	return rng;
+}
 
-siString si__timeWeekNamesShrt[] = {
-	SI_STRC("Sun"), SI_STRC("Mon"), SI_STRC("Tue"), SI_STRC("Wed"), SI_STRC("Thu"),
-	SI_STRC("Fri"), SI_STRC("Sat"),
-};
+SIDEF
+siRandom si_randomMakeSystem(siRandomType type) {
+	u64 seed[2];
+#ifndef SI_NO_SYSTEM
+	if (!si_systemRandomBytes(seed, si_sizeof(seed)))
+#endif
+	{
+		seed[0] = (u64)si_RDTSC();
+		seed[1] = (u64)(usize)&seed;
+	}
 
-siString si__timeAM_PM_Names[] = {
-	SI_STRC("AM"), SI_STRC("PM"), SI_STRC("am"), SI_STRC("pm")
-};
+	switch (type) {
+		case siRandomType_Xoshiro256: return si_randomMake(seed[0] ^ SI__RANDOM_ROTL(seed[1], 32));
+		case siRandomType_Pcg64: return si_randomMakePcg(seed[0], seed[1]);
+		default: SI_PANIC();
+	}
+}
 
+SIDEF
+u64 si_randomNext(siRandom* rng) {
+	SI_ASSERT_NOT_NIL(rng);
 
-siString si__timeTimeUnits[] = {
-	SI_STRC("ns"), SI_STRC("μs"), SI_STRC("ms"), SI_STRC("s"), SI_STRC("min"),
-	SI_STRC("h"), SI_STRC("d"), SI_STRC("m"), SI_STRC("y")
-};
+	switch (rng->type) {
+		case siRandomType_Xoshiro256: return si__randomXoshiro(rng->state.xoshiro);
+		case siRandomType_Pcg64: return si__randomPcg(rng);
+		default: SI_PANIC();
+	}
+}
 
-siString* SI_NAMES_MONTHS_FULL = si__timeMonthNames;
-siString* SI_NAMES_MONTHS_SHRT = si__timeMonthNamesShrt;
-siString* SI_NAMES_DAYS_FULL = si__timeWeekNames;
-siString* SI_NAMES_DAYS_SHRT = si__timeWeekNamesShrt;
-siString* SI_NAMES_AM_PM = si__timeAM_PM_Names;
-siString* SI_NAMES_TIME_UNITS = si__timeTimeUnits;
+inline
+u32 si_randomNextU32(siRandom* rng) {
+	return (u32)(si_randomNext(rng) >> 32);
+}
 
-#if SI_SYSTEM_IS_WINDOWS
-siIntern
-siTime si__win32ToSili(i64 time) {
-	return (siTime)(((time) - 116444736000000000) * 100);
+SIDEF
+u64 si_randomBounded(siRandom* rng, u64 bound) {
+	SI_ASSERT(bound != 0);
+
+	/* NOTE(EimaMei): Lemire's method: the upper half of 'x * bound' is already
+	 * in range, only the rare products whose lower half falls under '2^64 % bound'
+	 * have to be thrown away to remove the bias. */
+	u64 high;
+	u64 low = si__mul128(si_randomNext(rng), bound, &high);
+
+	if (SI_UNLIKELY(low < bound)) {
+		u64 threshold = (0 - bound) % bound;
+		while (low < threshold) {
+			low = si__mul128(si_randomNext(rng), bound, &high);
+		}
+	}
+
+	return high;
 }
 
-#elif SI_ARCH_IS_WASM
-siIntern
-i64 si__wasiRdtsc(void) {
-	__wasi_timestamp_t time;
-	__wasi_errno_t res = __wasi_clock_time_get(__WASI_CLOCKID_PROCESS_CPUTIME_ID, 1, &time);
+SIDEF
+i64 si_randomRange(siRandom* rng, i64 lower, i64 upper) {
+	SI_ASSERT(lower <= upper);
 
-	return (res == 0) ? (siTime)time : 0;
+	u64 span = (u64)upper - (u64)lower + 1;
+	u64 offset = (span != 0) ? si_randomBounded(rng, span) : si_randomNext(rng);
+
+	return (i64)((u64)lower + offset);
 }
-#endif
 
+inline
+f64 si_randomF64(siRandom* rng) {
+	return (f64)(si_randomNext(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
 
-/* NOTE(EimaMei): Credit goes to gb.h for the i386 and PPC code. */
 inline
-i64 si_RDTSC(void) {
-#if SI_COMPILER_CHECK_MIN(MSVC, 12, 0, 0)
-	#if !SI_SYSTEM_IS_WASM
-		return __rdtsc();
-	#else
-		return si__wasiRdtsc();
-	#endif
-#elif SI_COMPILER_GCC || SI_COMPILER_CLANG || SI_COMPILER_TCC
-	#if SI_ARCH_I386
-		i64 res;
-		__asm__ volatile (".byte 0x0f, 0x31" : "=A" (res));
-		return res;
+f32 si_randomF32(siRandom* rng) {
+	return (f32)(si_randomNext(rng) >> 40) * (1.0f / 16777216.0f);
+}
 
-	#elif SI_ARCH_AMD64
-		i64 high, low;
-		__asm__ volatile ("rdtsc" : "=a"(low), "=d"(high));
-		return (high << 32) | low;
+inline
+f64 si_randomRangeF64(siRandom* rng, f64 lower, f64 upper) {
+	SI_ASSERT(lower <= upper);
+	return lower + (upper - lower) * si_randomF64(rng);
+}
 
-	#elif SI_ARCH_IS_PPC
-		i32 high, low, tmp;
-		__asm__ volatile (
-			"0:\n"
-			"\tmftbu %0\n"
-			"\tmftb %1\n"
-			"\tmftbu %2\n"
-			"\tcmpw %2, %0\n"
-			"\tbne 0b\n"
-			: "=r"(high), "=r"(low), "=r"(tmp)
-		);
-		return ((i64)high << 32) | low;
+SIDEF
+void si_randomFill(siRandom* rng, void* out, isize len) {
+	SI_ASSERT_NOT_NIL(rng);
+	SI_ASSERT(out != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
 
-	#elif SI_ARCH_ARM64
-		i64 res;
-		__asm__ volatile ("mrs %0, cntvct_el0" : "=r"(res));
-		return res;
+	u8* ptr = (u8*)out;
+
+	if (rng->type == siRandomType_Xoshiro256 && len >= SI__RANDOM_FILL_LANES * si_sizeof(u64) * 4) {
+		/* NOTE(EimaMei): The lanes are stored as structure-of-arrays with no
+		 * dependencies between each other, which lets the compiler turn the
+		 * loop body into SIMD shifts and adds ('* 5' and '* 9' are a shift
+		 * and an add each). */
+		u64 s0[SI__RANDOM_FILL_LANES], s1[SI__RANDOM_FILL_LANES],
+			s2[SI__RANDOM_FILL_LANES], s3[SI__RANDOM_FILL_LANES];
+
+		for_range (lane, 0, SI__RANDOM_FILL_LANES) {
+			u64 seed = si__randomXoshiro(rng->state.xoshiro);
+			s0[lane] = si__randomSplitmix64(&seed);
+			s1[lane] = si__randomSplitmix64(&seed);
+			s2[lane] = si__randomSplitmix64(&seed);
+			s3[lane] = si__randomSplitmix64(&seed);
+		}
 
-	#elif SI_ARCH_IS_RISC
-		i64 res = 0;
-		__asm__ volatile ("rdcycle %0" : "=r"(res));
-		return res;
+		while (len >= SI__RANDOM_FILL_LANES * si_sizeof(u64)) {
+			u64 res[SI__RANDOM_FILL_LANES];
 
-	#elif SI_ARCH_IS_WASM
-		return si__wasiRdtsc();
+			for_range (lane, 0, SI__RANDOM_FILL_LANES) {
+				res[lane] = SI__RANDOM_ROTL(s1[lane] * 5, 7) * 9;
+				u64 t = s1[lane] << 17;
 
-	#else
-		return 0;
-	#endif
+				s2[lane] ^= s0[lane];
+				s3[lane] ^= s1[lane];
+				s1[lane] ^= s2[lane];
+				s0[lane] ^= s3[lane];
+				s2[lane] ^= t;
+				s3[lane] = SI__RANDOM_ROTL(s3[lane], 45);
+			}
 
-#else
-	#if SI_SYSTEM_IS_WINDOWS
-		LARGE_INTEGER count;
-		QueryPerformanceCounter(&count);
-		return count.QuadPart;
+			si_memcopy(ptr, res, si_sizeof(res));
+			ptr += si_sizeof(res);
+			len -= si_sizeof(res);
+		}
+	}
 
-	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-		struct timespec tv = {0};
-		clock_gettime(CLOCK_MONOTONIC, &tv);
-		return SI_TIME_S(tv.tv_sec) + tv.tv_nsec;
+	while (len >= si_sizeof(u64)) {
+		u64 x = si_randomNext(rng);
+		si_memcopy(ptr, &x, si_sizeof(x));
+		ptr += si_sizeof(x);
+		len -= si_sizeof(x);
+	}
 
-	#elif SI_ARCH_IS_WASM
-		return si__wasiRdtsc();
+	if (len != 0) {
+		u64 x = si_randomNext(rng);
+		si_memcopy(ptr, &x, len);
+	}
+}
 
-	#else
-		return 0;
-	#endif
-#endif
+SIDEF
+void si_randomJump(siRandom* rng) {
+	SI_ASSERT_NOT_NIL(rng);
+	static const u64 jump[4] = {
+		0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C
+	};
+
+	switch (rng->type) {
+		case siRandomType_Xoshiro256: si__randomXoshiroJump(rng->state.xoshiro, jump); break;
+		case siRandomType_Pcg64: si__randomPcgAdvance(rng, 0, 1); break;
+		default: SI_PANIC();
+	}
 }
 
-inline
-i64 si_RDTSCP(i32* proc) {
-	SI_ASSERT_NOT_NIL(proc);
+SIDEF
+void si_randomLongJump(siRandom* rng) {
+	SI_ASSERT_NOT_NIL(rng);
+	static const u64 jump[4] = {
+		0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635
+	};
 
-#if SI_COMPILER_CHECK_MIN(MSVC, 12, 0, 0)
-	#if !SI_SYSTEM_IS_WASM
-		return __rdtscp((u32*)proc);
-	#else
-		*proc = 0;
-		return si_RDTSC();
-	#endif
-#elif SI_COMPILER_GCC || SI_COMPILER_CLANG || SI_COMPILER_TCC
-	#if SI_ARCH_I386
-		i32 high, low;
-		__asm__ volatile (
-			"rdtscp"
-			: "=a"(high), "=d"(low), "=c"(*proc)
-		);
-		return ((i64)high << 32) | (i64)low;
+	switch (rng->type) {
+		case siRandomType_Xoshiro256: si__randomXoshiroJump(rng->state.xoshiro, jump); break;
+		case siRandomType_Pcg64: si__randomPcgAdvance(rng, 0, SI_BIT(32)); break;
+		default: SI_PANIC();
+	}
+}
 
-	#elif SI_ARCH_AMD64
-		i64 high, low;
-		__asm__ volatile ("rdtscp" : "=a"(low), "=d"(high), "=c"(*proc));
-		return (high << 32) | low;
+#undef SI__RANDOM_ROTL
+#undef SI__PCG_MULTIPLIER_LOW
+#undef SI__PCG_MULTIPLIER_HIGH
+#undef SI__RANDOM_FILL_LANES
 
-	#elif SI_ARCH_IS_PPC
-		u32 aux;
+#endif /* SI_IMPLEMENTATION_RANDOM */
 
-		/* TODO(EimaMei): Check if this is even accurate. */
-		__asm__ volatile ("mfspr %0, 1023" : "=r"(aux));
-		*proc = (i32)aux;
+#ifdef SI_IMPLEMENTATION_BENCHMARK
 
-		return si_RDTSC();
+SIDEF
+void si_benchmarkLoopsAvgPrint(siString name, i64 array[20], isize len, usize range[2]) {
+	si_printf(
+		"====== BENCHMARK DATA ======\n"
+		"General:\n"
+			"\tFunction - '%s'\n"
+		"Runs:\n",
+		name
+	);
 
-	#elif SI_ARCH_ARM64
-		u64 mpidr;
+	f64 freq = (f64)si_cpuClockSpeed() / 1000.0;
+	isize padRuns = si_numLenUint(range[1]);
 
-		/* TODO(EimaMei): Check if this is even accurate. */
-		__asm__ volatile ("mrs %0, mpidr_el1" : "=r"(mpidr));
-		*proc = (i32)(mpidr & 0xFF);
+	usize arrayI = 0, runs;
+	for (runs = range[0]; runs <= range[1]; runs *= 10) {
+		i64 cycles = array[arrayI];
+		f64 time = (f64)cycles / freq;
 
-		return si_RDTSC();
+		siTimeUnitScale unit = si_timeGetUnit((i64)time);
+		time /= (f64)unit.threshold;
+		si_printf(
+			"\t%*zu %s - %C%9.4f%C %2s (%lu cycles)\n",
+			padRuns, runs, (runs != 1) ? SI_STR("runs") : SI_STR("run "),
+			si_printColor3bit(siPrintColor3bit_Green), time, si_timeUnitStr(unit.unit), cycles
+		);
 
-	#elif SI_SYSTEM_IS_WINDOWS
-		*proc = GetCurrentProcessorNumber();
-		return si_RDTSC();
+		arrayI += 1;
+	}
+
+	i64 cyclesTotal = 0;
+	for_range (i, 0, len) {
+		cyclesTotal += array[i];
+	}
+
+	f64 cyclesMedian = (f64)cyclesTotal / (f64)len;
+	f64 time = cyclesMedian / freq;
+
+	siTimeUnitScale unit = si_timeGetUnit((i64)time);
+	time /= (f64)unit.threshold;
+
+	isize padCycles = si_numLenUint((u64)cyclesMedian);
+	si_printf(
+		"Final result:\n"
+			"\tTime average   - %C%*.4f%C %2s\n"
+			"\tCycles average - %*lu cycles\n",
+		si_printColor3bit(siPrintColor3bit_Green),
+		padCycles, time, si_timeUnitStr(unit.unit), padCycles, (u64)cyclesMedian
+	);
+}
+
+SIDEF
+void si_benchmarkLoopsAvgCmpPrint(siString names[2], i64 arrays[2][20], isize len,
+		usize range[2]) {
+	si_printf(
+		"====== BENCHMARK DATA ======\n"
+		"General:\n"
+			"\tFunction 1 - '%s'\n"
+			"\tFunction 2 - '%s'\n"
+		"Runs:\n",
+		names[0], names[1]
+	);
+	siTimeUnitScale units[2];
+	f64 freq = (f64)si_cpuClockSpeed() / 1000.0;
+
+	isize padRuns = si_numLenUint(range[1]);
+	isize padCycles[2] = {
+		si_numLenUint((u64)arrays[0][len - 1]), si_numLenUint((u64)arrays[1][len - 1])
+	};
 
-	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-		*proc = sched_getcpu();
-		return si_RDTSC();
+	usize arrayI = 0, runs;
+	for (runs = range[0]; runs <= range[1]; runs *= 10) {
+		i64 cycles[2] = {arrays[0][arrayI], arrays[1][arrayI]};
+		f64 time[2] = {(f64)cycles[0] / freq, (f64)cycles[1] / freq};
 
-	#else
-		*proc = 0;
-		return si_RDTSC();
+		f64 ratio;
+		siPrintColor clr[2];
+		if (time[0] > time[1]){
+			ratio = time[0] / time[1];
+			clr[0] = si_printColor3bit(siPrintColor3bit_Red);
+			clr[1] = si_printColor3bit(siPrintColor3bit_Green);
+		}
+		else if (time[0] < time[1]) {
+			ratio = time[1] / time[0];
+			clr[0] = si_printColor3bit(siPrintColor3bit_Green);
+			clr[1] = si_printColor3bit(siPrintColor3bit_Red);
+		}
+		else {
+			ratio = 1.0;
+			clr[0] = clr[1] = si_printColor3bit(siPrintColor3bit_Yellow);
+		}
 
-	#endif
+		for_range (j, 0, countof(units)) {
+			units[j] = si_timeGetUnit((i64)time[j]);
+			time[j] /= (f64)units[j].threshold;
+		}
 
-#else
-	#if SI_SYSTEM_IS_WINDOWS
-		*proc = GetCurrentProcessorNumber();
-		return si_RDTSC();
+		si_printf(
+			"\t%*zu %s - %C%9.4f%C %2s vs %C%9.4f%C %2s (%4.4f ratio, %*li vs %*li cycles)\n",
+			padRuns, runs, (runs != 1) ? SI_STR("runs") : SI_STR("run "),
+			clr[0], time[0], si_timeUnitStr(units[0].unit), clr[1], time[1], si_timeUnitStr(units[1].unit),
+			ratio, padCycles[0], cycles[0], padCycles[1], cycles[1]
+		);
 
-	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-		*proc = sched_getcpu();
-		return si_RDTSC();
-	#else
-		*proc = 0;
-		return si_RDTSC();
-	#endif
-#endif
-}
+		arrayI += 1;
+	}
 
+	i64 cyclesTotal[2] = {0, 0};
+	for_range (i, 0, len) {
+		for_range (j, 0, 2) {
+			cyclesTotal[j] += arrays[j][i];
+		}
+	}
 
-SIDEF
-siTime si_clock(void) {
-	u64 ticks = (u64)si_RDTSC();
-	u32 proc = (u32)si_cpuClockSpeed(); /* TODO(EimaMei): Remove this later. */
-	return (siTime)(ticks * 1000) / proc;
-}
+	f64 cyclesMedian[2] = {
+		(f64)cyclesTotal[0] / (f64)len,
+		(f64)cyclesTotal[1] / (f64)len
+	};
+	f64 time[] = {cyclesMedian[0] / freq, cyclesMedian[1] / freq};
 
-inline
-siTime si_timeStampStart(void) {
-	return si_clock();
-}
+	for_range (i, 0, countof(padCycles)) {
+		padCycles[i] = si_numLenUint((u64)cyclesMedian[i]);
+	}
 
-SIDEF
-void si_timeStampPrintSinceLoc(siTime timestamp, siCallerLoc loc) {
-	siTime end = si_clock();
-	siTime diff = (end - timestamp);
+	f64 ratio;
+	siPrintColor clr[2];
+	if (time[0] > time[1]){
+		ratio = time[0] / time[1];
+		clr[0] = si_printColor3bit(siPrintColor3bit_Red);
+		clr[1] = si_printColor3bit(siPrintColor3bit_Green);
+	}
+	else if (time[0] < time[1]) {
+		ratio = time[1] / time[0];
+		clr[0] = si_printColor3bit(siPrintColor3bit_Green);
+		clr[1] = si_printColor3bit(siPrintColor3bit_Red);
+	}
+	else {
+		ratio = 1.0;
+		clr[0] = clr[1] = si_printColor3bit(siPrintColor3bit_Yellow);
+	}
 
-	const siTimeUnitScale scale = si_timeGetUnit(diff);
-	si_printf(
-		"si_timeStampPrintSince: %L: TIME: %.2f %2s\n",
-		loc, (f32)diff / (f32)scale.threshold, si_timeUnitStr(scale.unit)
+	for_range (j, 0, countof(units)) {
+		units[j] = si_timeGetUnit((i64)time[j]);
+		time[j] /= (f64)units[j].threshold;
+	}
+
+	si_printfLn(
+		"Final result:\n"
+			"\tTime average   - %C%*.4f%C %s vs %C%*.4f%C %s (%4.4f ratio)\n"
+			"\tCycles average - %*lu cycles vs %*lu cycles",
+		clr[0], padCycles[0], time[0], si_timeUnitStr(units[0].unit),
+		clr[1], padCycles[1], time[1], si_timeUnitStr(units[1].unit),
+		ratio,
+		padCycles[0], (u64)cyclesMedian[0], padCycles[1], (u64)cyclesMedian[1]
 	);
 }
 
-SIDEF
-void si_sleep(siTime time) {
-	SI_ASSERT_NOT_NEG(time);
-
-#if SI_SYSTEM_IS_WINDOWS
-	if (time < SI_MILLISECOND) { return; }
-
-	Sleep((u32)time / SI_MILLISECOND);
+void* si__benchmarkThread(void* arg) {
+	si_sleep(*(siTime*)arg);
+	return nil;
+}
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	if (time == 0) { return; }
 
-	struct timespec ts = {
-		time / SI_SECOND,
-		(time % SI_SECOND)
-	};
-	nanosleep(&ts, &ts);
+#endif /* SI_IMPLEMENTATION_BENCHMARK */
 
-#elif SI_SYSTEM_WASI
-	if (time == 0) { return; }
+#ifdef SI_IMPLEMENTATION_SYSTEM
+/*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+*
+	========================
+	| siSystem             |
+	========================
+*/
 
-	__wasi_subscription_t in = SI_STRUCT_ZERO;
-	in.u.tag = __WASI_EVENTTYPE_CLOCK;
-	in.u.u.clock.id = __WASI_CLOCKID_MONOTONIC;
-	in.u.u.clock.timeout = time;
-	in.u.u.clock.precision = SI_NANOSECOND;
+SIDEF
+SI_ERROR_PROC(si_systemErrorLog) {
+	siPrintColor red = si_printColor3bitEx(siPrintColor3bit_Red, true, false);
 
-	__wasi_event_t events;
-	size_t nevents;
+#ifndef SI_NO_ERROR_STRUCT
+	si_fprintf(
+		si_stderr, SI_STR("%CSystem error at \"%L\"%C: %s: %s\n"),
+		red, error->location, si_systemErrorName(error->code), si_systemErrorDesc(error->code)
+	);
 
-	__wasi_errno_t result = __wasi_poll_oneoff(&in, &events, 1, &nevents);
-	SI_UNUSED(result);
-#elif SI_SYSTEM_EMSCRIPTEN
-	if (time < SI_MILLISECOND) { return; }
-	emscripten_sleep((unsigned int)(time / SI_MILLISECOND));
+#else
+	si_fprintf(
+		si_stderr, SI_STR("%CSystem error%C: %s: %s\n"),
+		red, si_systemErrorName(error->code), si_systemErrorDesc(error->code)
+	);
 #endif
-}
 
+	return true;
+	SI_UNUSED(data);
+}
 
-SIDEF
-siTime si_timeNowUTC(void) {
-#if SI_SYSTEM_IS_WINDOWS
-	FILETIME time;
-	GetSystemTimePreciseAsFileTime(&time);
-
-	return si__win32ToSili((i64)time.dwHighDateTime << 32 | (i64)time.dwLowDateTime);
+inline
+siString si_systemErrorName(siErrorSystem error) {
+	SI_ASSERT_NOT_NEG(error);
+	SI_ASSERT(error < siErrorSystem_Length);
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	struct timespec spec;
-	i32 res = clock_gettime(CLOCK_REALTIME, &spec);
+	static const siString names[siErrorSystem_Length] = {
+		SI_STRC("siErrorSystem_None"),
 
-	return (res == 0) ? SI_TIME_S(spec.tv_sec) + spec.tv_nsec : 0;
+		SI_STRC("siErrorSystem_Exists"),
+		SI_STRC("siErrorSystem_NotExists"),
+		SI_STRC("siErrorSystem_Invalid"),
+		SI_STRC("siErrorSystem_InvalidFilename"),
+		SI_STRC("siErrorSystem_Permission"),
+		SI_STRC("siErrorSystem_NoMemory"),
+		SI_STRC("siErrorSystem_TruncationFail"),
+		SI_STRC("siErrorSystem_Unavailable"),
+		SI_STRC("siErrorSystem_Deadlock"),
 
-#else
-	return 0;
+		SI_STRC("siErrorSystem_Generic"),
+	};
 
-#endif
+	return names[error];
 }
 
 inline
-siTime si_timeNowLocal(void) {
-#if SI_SYSTEM_IS_WINDOWS
-	FILETIME utc;
-	GetSystemTimePreciseAsFileTime(&utc);
-	FILETIME time;
-	int res = FileTimeToLocalFileTime(&utc, &time);
+siString si_systemErrorDesc(siErrorSystem error) {
+	SI_ASSERT_NOT_NEG(error);
+	SI_ASSERT(error < siErrorSystem_Length);
 
-	return (res)
-		? si__win32ToSili((i64)time.dwHighDateTime << 32 | (i64)time.dwLowDateTime)
-		: 0;
+	static const siString descriptions[siErrorSystem_Length] = {
+		SI_STRC("No error has been encountered."),
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	i64 timeNow = si_timeNowUTC();
-	if (timezone == 0) {
-		tzset();
-	}
+		SI_STRC("File or directory already exists."),
+		SI_STRC("File or directory doesn't exist."),
+		SI_STRC("Provided value is invalid."),
+		SI_STRC("Invalid filename."),
+		SI_STRC("User doesn't have sufficient permissions."),
+		SI_STRC("Out of memory."),
+		SI_STRC("Failed to truncate the file."),
+		SI_STRC("System has insufficient resources to complete the action."),
+		SI_STRC("A thread deadlock occurred."),
 
-	return (timezone != 0)
-		? timeNow - SI_TIME_S(timezone) + daylight * SI_HOUR
-		: 0;
-#else
-	return 0;
+		SI_STRC("An unspecified, platform-specific error occurred."),
+	};
+	return descriptions[error];
+}
+
+#ifdef SI_SYSTEM_IS_WASM
 
-#endif
-}
+/* TODO(EimaMei): Add mutexes to this. */
+__wasi_errno_t si__wasmError;
 
-SIDEF
-bool si_timeYearIsLeap(i32 year) {
-	return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+siIntern
+__wasi_errno_t si__wasmGetLastError(void) {
+	return si__wasmError;
 }
 
-SIDEF
-i32 si_timeGetDayOfWeek(i32 year, i32 month, i32 day) {
-	static i8 t[] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
-	if (month < 3 ) {
-		year -= 1;
-	}
-	return (year + year / 4 - year / 100 + year / 400 + t[month - 1] + day) % 7;
+siIntern
+void si__wasmSetLastError(__wasi_errno_t error) {
+	si__wasmError = error;
 }
 
-static i8 SI__LUT_DAYS_IN_MONTH[2][12] = {
-	{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
-	{31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
-};
+#endif
 
 SIDEF
-siTimeCalendar si_timeToCalendar(i64 time) {
-	/* TODO(EimaMei): Add leap second support??? */
-	siTimeCalendar calendar;
+siErrorSystem si_systemGetError(void) {
+#if SI_SYSTEM_IS_WINDOWS
+	switch (GetLastError()) {
+		case ERROR_ACCESS_DENIED: return siErrorSystem_Permission;
 
-	i32 daysSinceEpoch = (i32)(time / SI_DAY);
+		case ERROR_NO_MORE_FILES:
+		case ERROR_SUCCESS:
+			return siErrorSystem_None;
 
-	{
-		const i32 DAYS_IN_400_YEARS = (400 * 365) + 97;
-		const i32 DAYS_IN_100_YEARS = (100 * 365) + 24;
-		const i32 DAYS_IN_4_YEARS   = (  4 * 365) + 1;
+		case ERROR_ALREADY_EXISTS:
+		case ERROR_FILE_EXISTS:
+			return siErrorSystem_Exists;
 
-		calendar.years = 1970;
-		calendar.years += 400 * (daysSinceEpoch / DAYS_IN_400_YEARS);
-		daysSinceEpoch %= DAYS_IN_400_YEARS;
+		case ERROR_INVALID_NAME:
+		case ERROR_BAD_PATHNAME:
+			return siErrorSystem_InvalidFilename;
 
-		calendar.years += 100 * (daysSinceEpoch / DAYS_IN_100_YEARS);
-		daysSinceEpoch %= DAYS_IN_100_YEARS;
+		case ERROR_BAD_FORMAT:
+		case ERROR_INVALID_DATA:
+		case ERROR_DIRECTORY:
+		case ERROR_INVALID_ADDRESS:
+			return siErrorSystem_Invalid;
 
-		calendar.years += 4 * (daysSinceEpoch / DAYS_IN_4_YEARS);
-		daysSinceEpoch %= DAYS_IN_4_YEARS;
+		case ERROR_PATH_NOT_FOUND:
+		case ERROR_FILE_NOT_FOUND:
+			return siErrorSystem_NotExists;
 
-		calendar.years += daysSinceEpoch / 365;
-		daysSinceEpoch %= 365;
+		case ERROR_OUTOFMEMORY:
+		case ERROR_NOT_ENOUGH_MEMORY:
+			return siErrorSystem_NoMemory;
 	}
 
-	{
-		i8* daysInMonths = SI__LUT_DAYS_IN_MONTH[si_timeYearIsLeap(calendar.years)];
-
-		daysSinceEpoch = si_abs(i32, daysSinceEpoch);
-		for_rangeRef (calendar.months, 0, 12) {
-			i32 days = daysInMonths[calendar.months];
-			SI_STOPIF(daysSinceEpoch < days, break);
+	return siErrorSystem_Generic;
 
-			daysSinceEpoch -= days;
-		}
-		calendar.months += 1;
-		calendar.days = daysSinceEpoch;
-	}
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	switch (errno) {
+		case 0:       return siErrorSystem_None;
+		case EEXIST:  return siErrorSystem_Exists;
+		case EINVAL:  return siErrorSystem_Invalid;
+		case ENOMEM:  return siErrorSystem_NoMemory;
+		case EAGAIN:  return siErrorSystem_Unavailable;
+		case EDEADLK: return siErrorSystem_Deadlock;
+		case ENOENT:  return siErrorSystem_NotExists;
 
-	{
-		i64 nanoseconds = time % SI_DAY;
+		case EISDIR:
+		case ENAMETOOLONG:
+			return siErrorSystem_InvalidFilename;
 
-		calendar.hours = (i32)(nanoseconds / SI_HOUR);
-		nanoseconds %= SI_HOUR;
+		case EPERM:
+		case EACCES:
+			return siErrorSystem_Permission;
+	}
 
-		calendar.minutes = (i32)(nanoseconds / SI_MINUTE);
-		nanoseconds %= SI_MINUTE;
+	return siErrorSystem_Generic;
 
-		calendar.seconds = (i32)(nanoseconds / SI_SECOND);
-		nanoseconds %= SI_SECOND;
+#elif SI_SYSTEM_IS_WASM
+	switch (si__wasmGetLastError()) {
+		case __WASI_ERRNO_SUCCESS: return siErrorSystem_None;
+		case __WASI_ERRNO_EXIST: return siErrorSystem_Exists;
+		case __WASI_ERRNO_NOENT: return siErrorSystem_NotExists;
+		case __WASI_ERRNO_NOBUFS: return siErrorSystem_NoMemory;
+		case __WASI_ERRNO_DEADLK: return siErrorSystem_Deadlock;
 
-		calendar.nanoseconds = (i32)nanoseconds;
-	}
+		case __WASI_ERRNO_INVAL:
+		case __WASI_ERRNO_BADF:
+			return siErrorSystem_Invalid;
 
-	return calendar;
-}
+		case __WASI_ERRNO_ISDIR:
+		case __WASI_ERRNO_NAMETOOLONG:
+			return siErrorSystem_InvalidFilename;
 
+		case __WASI_ERRNO_PERM:
+		case __WASI_ERRNO_ACCES:
+			return siErrorSystem_Permission;
 
-SIDEF
-siTime si_calendarToTime(siTimeCalendar calendar) {
-	SI_ASSERT(si_between(i32, calendar.years, 1677, 2262));
-	SI_ASSERT(si_between(i32, calendar.months, 1, 12));
-	SI_ASSERT(si_between(i32, calendar.days, 1, SI__LUT_DAYS_IN_MONTH[si_timeYearIsLeap(calendar.years)][calendar.months]));
-	SI_ASSERT(si_between(i32, calendar.hours, 0, 23));
-	SI_ASSERT(si_between(i32, calendar.minutes, 0, 59));
-	SI_ASSERT(si_between(i32, calendar.seconds, 0, 59));
-	SI_ASSERT(si_between(i32, calendar.nanoseconds, 0, SI_SECOND - 1));
+		case __WASI_ERRNO_AGAIN:
+		case __WASI_ERRNO_BUSY:
+			return siErrorSystem_Unavailable;
+	}
 
-	/* TODO(EimaMei): Add leap second support??? */
-	siTime res = 0;
-	res += calendar.nanoseconds;
-	res += calendar.seconds * SI_SECOND;
-	res += calendar.minutes * SI_MINUTE;
-	res += calendar.hours * SI_HOUR;
-	res += calendar.days * SI_DAY;
+	return siErrorSystem_Generic;
 
-	i8* daysInMonths = SI__LUT_DAYS_IN_MONTH[si_timeYearIsLeap(calendar.years)];
-	for_range (i, 0, calendar.months - 1) {
-		res += daysInMonths[i] * SI_DAY;
-	}
+#else
+	return 0;
+#endif
 
-	isize amountOfYears = si_abs(i32, calendar.years - 1970);
-	i32 direction = (calendar.years > 1970) ? 1 : -1;
-	i32 year = 1970;
-	for_range (i, 0, amountOfYears) {
-		res += (365 + si_timeYearIsLeap(year - 1)) * SI_DAY;
-		year += direction;
-	}
+}
 
-	return res;
+siNoreturn inline
+void si_exit(i32 code) {
+#if SI_SYSTEM_IS_WINDOWS
+	ExitProcess((u32)code);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	exit(code);
+#elif SI_SYSTEM_IS_WASM
+	__wasi_proc_exit((u32)code);
+#endif
 }
 
-siIntern
-isize si__timeToStr(siString fmt, isize* i, char letter, siArray(u8) out, isize len, i32 time) {
-	if (*i < fmt.len - 1 && fmt.data[1 + *i] == letter) {
-		*i += 1;
-		if (time < 10) {
-			si_arraySet(out, len, "0");
-			return 1 + si_stringFromUInt((u32)time, si_sliceFrom(out, len + 1)).len;
-		}
-	}
 
-	return si_stringFromUInt((u32)time, si_sliceFrom(out, len)).len;
-}
+SIDEF
+bool si_envVarSet(siString name, siString value) {
+	siOsChar stack[SI_PATH_MAX];
+	siOsString_2x strs = si_pathToOSMul(name, value, stack, countof(stack));
+	siOsString* paths = strs.v;
 
-siIntern
-void si__timeTimezone(bool check, siTimeCalendar* calendar) {
-	SI_STOPIF(check == false, return);
 
-	if (calendar->hours != 12 && calendar->hours != 0) {
-		calendar->hours %= 12;
-	}
-	else if (calendar->hours == 0) {
-		calendar->hours = 12;
-	}
+#if SI_SYSTEM_IS_WINDOWS
+	return SetEnvironmentVariableW(paths[0], paths[1]) != 0;
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	return setenv(paths[0], paths[1], 1) == 0;
+#else
+	return false;
+	SI_UNUSED(paths);
+#endif
 }
 
 SIDEF
-siString si_timeToString(siTimeCalendar calendar, siString fmt, siArray(u8) out) {
-	SI_ASSERT_STR(fmt);
-	SI_ASSERT_ARR_TYPE(out, u8);
-
-	bool AMwasChecked = false;
-	i32 ogHour = calendar.hours;
-	isize len = 0;
+bool si_envVarUnset(siString name) {
+	siOsChar path[SI_PATH_MAX];
+	si_pathToOS(name, path, countof(path));
 
-	for_range (i, 0, fmt.len) {
-		SI_STOPIF(len >= out.len, break);
+#if SI_SYSTEM_IS_WINDOWS
+	return SetEnvironmentVariableW(path, nil) != 0;
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	return unsetenv(path) == 0;
+#else
+	return false;
+#endif
+}
 
-		switch (fmt.data[i]) {
-			case 'y': {
-				isize ogI = i;
-				while (i < fmt.len - 1 && fmt.data[i + 1] == 'y' && (i - ogI) != 4) { i += 1; }
 
-				u32 year = (i - ogI != 1) ? (u32)calendar.years : (u32)calendar.years % 100u;
-				len += si_stringFromUInt(year, si_sliceFrom(out, len)).len;
-			} break;
+SIDEF
+isize si_envVarGetLength(siString name) {
+	siOsChar path[SI_PATH_MAX * 2];
+	isize pathLen = si_pathToOS(name, path, countof(path));
 
-			case 'M': {
-				SI_ASSERT(si_between(i32, calendar.months, 0, 12));
+#if SI_SYSTEM_IS_WINDOWS
+	u32 len = GetEnvironmentVariableW(path, &path[pathLen], (u32)(countof(path) - pathLen));
+	SI_STOPIF(len == 0, return 0);
 
-				isize ogI = i;
-				while (i < fmt.len - 1 && fmt.data[i + 1] == 'M' && (i - ogI) != 2) { i += 1; }
+	return si_utf16ToUtf8StrLen(SI_ARR_LEN(&path[pathLen], len));
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	return si_cstrLen(getenv(path));
+	SI_UNUSED(pathLen);
+#else
+	return -1;
+	SI_UNUSED(pathLen);
+#endif
+}
 
-				switch (i - ogI) {
-					case 0: {
-						len += si_stringFromUInt((u32)calendar.months, si_sliceFrom(out, len)).len;
-					} break;
+SIDEF
+siString si_envVarGetData(siString name, siArray(u8) out) {
+	SI_ASSERT(out.typeSize == sizeof(u8));
 
-					case 1: {
-						if (calendar.months < 10) {
-							si_arraySet(out, len, "0");
-							len += 1;
-						}
+	siOsChar path[SI_PATH_MAX * 2];
+	isize pathLen = si_pathToOS(name, path, countof(path));
 
-						len += si_stringFromUInt((u32)calendar.months, si_sliceFrom(out, len)).len;
-					} break;
-				}
-			} break;
+#if SI_SYSTEM_IS_WINDOWS
+	u32 len = GetEnvironmentVariableW(path, &path[pathLen], (u32)(countof(path) - pathLen));
+	SI_STOPIF(len == 0, return SI_STR_NIL);
 
-			case 'd': {
-				isize ogI = i;
-				while (i < fmt.len - 1 && fmt.data[i + 1] == 'd' && (i - ogI) != 4) { i += 1; }
+	return si_utf16ToUtf8Str(SI_ARR_LEN(&path[pathLen], len), out);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	char* data = getenv(path);
+	SI_STOPIF(data == nil, return SI_STR_NIL);
 
-				switch (i - ogI) {
-					case 0: {
-						len += si_stringFromUInt((u32)calendar.days, si_sliceFrom(out, len)).len;
-					} break;
+	isize len = si_memcopyStr_s(out, SI_CSTR(data));
 
-					case 1: {
-						if (calendar.days < 10) {
-							si_arraySet(out, len, "0");
-							len += 1;
-						}
+	return SI_STR_LEN(out.data, len);
+	SI_UNUSED(pathLen);
 
-						len += si_stringFromUInt((u32)calendar.days, si_sliceFrom(out, len)).len;
-					} break;
+#else
+	return SI_STR_NIL;
+	SI_UNUSED(pathLen);
+#endif
+}
 
-					case 2: {
-						i32 wd = si_timeGetDayOfWeek(calendar.years, calendar.months, calendar.days);
-						siString* str = &SI_NAMES_DAYS_SHRT[wd];
-						len += si_memcopyStr_s(si_sliceFrom(out, len), *str);
-					} break;
+SIDEF
+bool si_systemRandomBytes(void* out, isize len) {
+	SI_ASSERT(out != nil || len == 0);
+	SI_ASSERT_NOT_NEG(len);
 
-					case 4: {
-						i32 wd = si_timeGetDayOfWeek(calendar.years, calendar.months, calendar.days);
-						siString* str = &SI_NAMES_DAYS_FULL[wd];
-						len += si_memcopyStr_s(si_sliceFrom(out, len), *str);
-					} break;
-				}
-			} break;
+#if SI_SYSTEM_IS_WINDOWS
+	/* NOTE(EimaMei): advapi32 is loaded on the first call and kept loaded. Two
+	 * threads racing here resolve the same pointer, so the only cost is an extra
+	 * reference on the DLL. */
+	typedef BOOLEAN(WINAPI* siDllProcType(SystemFunction036))(PVOID, ULONG);
+	static siDllProcType(SystemFunction036) _RtlGenRandom = nil;
+
+	if (_RtlGenRandom == nil) {
+		siDllHandle advapi = si_dllLoad(SI_STR("advapi32.dll"));
+		SI_STOPIF(advapi == nil, return false);
+
+		_RtlGenRandom = si_dllProcAddressFunc(advapi, SystemFunction036);
+		SI_STOPIF(_RtlGenRandom == nil, si_dllUnload(advapi); return false);
+	}
 
-			case 'h': {
-				if (!AMwasChecked) {
-					for_range (j, i + 1, fmt.len) {
-						if (j + 1 < fmt.len &&
-							((fmt.data[j] == 'a' && fmt.data[j + 1] == 'p')
-							|| (fmt.data[j] == 'A' && fmt.data[j + 1] == 'P'))
-						) {
-							si__timeTimezone(AMwasChecked, &calendar);
-							break;
-						}
-					}
-					AMwasChecked = true;
-				}
+	for (isize i = 0; i < len; i += UINT32_MAX) {
+		ULONG chunk = (ULONG)si_min(isize, len - i, UINT32_MAX);
+		SI_STOPIF(_RtlGenRandom(si_pointerAdd(out, i), chunk) == 0, return false);
+	}
 
-				len += si__timeToStr(fmt, &i, 'h', out, len, calendar.hours);
-			} break;
+	return true;
 
-			case 'm': {
-				len += si__timeToStr(fmt, &i, 'm', out, len, calendar.minutes);
-			} break;
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	/* NOTE(EimaMei): 'getentropy' only accepts up to 256 bytes at a time. */
+	for (isize i = 0; i < len; i += 256) {
+		usize chunk = (usize)si_min(isize, len - i, 256);
+		SI_STOPIF(getentropy(si_pointerAdd(out, i), chunk) != 0, return false);
+	}
 
-			case 's': {
-				len += si__timeToStr(fmt, &i, 's', out, len, calendar.seconds);
-			} break;
+	return true;
 
-			case 'n': {
-				len += si__timeToStr(fmt, &i, 'n', out, len, calendar.nanoseconds);
-			} break;
+#elif SI_SYSTEM_EMSCRIPTEN || SI_SYSTEM_WASI
+	return __wasi_random_get((u8*)out, (__wasi_size_t)len) == 0;
 
-			case 'A': {
-				SI_STOPIF(i < fmt.len - 1 && fmt.data[1 + i] == 'P', break);
-				goto AM_code;
-			} break;
+#else
+	SI_UNUSED(out); SI_UNUSED(len);
+	return false;
+#endif
+}
 
-			case 'a': {
-				SI_STOPIF(i < fmt.len - 1 && fmt.data[1 + i] == 'p', break);
-AM_code:
-				i += 1;
+SIDEF
+siWindowsVersion si_windowsGetVersion(void) {
+#if SI_SYSTEM_IS_WINDOWS
+	OSVERSIONINFOEXW info = SI_STRUCT_ZERO;
+	{
+		siDllHandle ntdll = si_dllLoad(SI_STR("ntdll.dll"));
 
-				siString* str = &SI_NAMES_AM_PM[2 * (fmt.data[i] == 'p') + (ogHour >= 12)];
-				len += si_memcopyStr_s(si_sliceFrom(out, len), *str);
+		typedef LONG(WINAPI* siDllProcType(RtlGetVersion))(POSVERSIONINFOEXW);
+		siDllProcType(RtlGetVersion) _RtlGetVersion = si_dllProcAddressFunc(ntdll, RtlGetVersion);
 
-				si__timeTimezone(AMwasChecked, &calendar);
-				AMwasChecked = true;
-			} break;
+		info.dwOSVersionInfoSize = si_sizeof(OSVERSIONINFOEXW);
+		_RtlGetVersion(&info);
+		si_dllUnload(ntdll);
+	}
 
-			default:
-				si_arraySet(out, len, &fmt.data[i]);
-				len += 1;
-		}
+	/* Windows 10 and 11. */
+	if (info.dwMajorVersion == 10 && info.dwMinorVersion == 0) {
+		return (info.dwBuildNumber >= 22000) ? siWindowsVersion_11 : siWindowsVersion_10;
+	}
+	/* Windows 8.1, 8, 7 and Vista. */
+	else if (info.dwMajorVersion == 6) {
+		return siWindowsVersion_Vista + (i32)info.dwMinorVersion;
 	}
 
-	return SI_STR_LEN(out.data, len);
+	return (info.dwMajorVersion == 5 && (info.dwMinorVersion == 1 || info.dwMinorVersion == 2))
+		? siWindowsVersion_XP
+		: 0;
+
+#else
+	return -1;
+#endif
 }
 
 SIDEF
-siTimeUnitScale si_timeGetUnit(i64 time) {
-	static const siTimeUnitScale arr[] = {
-		{siTimeUnit_Nanosecond, SI_NANOSECOND},
-		{siTimeUnit_Microsecond, SI_MICROSECOND},
-		{siTimeUnit_Millisecond, SI_MILLISECOND},
-		{siTimeUnit_Second, SI_SECOND},
-		{siTimeUnit_Minute, SI_MINUTE},
-		{siTimeUnit_Hour, SI_HOUR},
-		{siTimeUnit_Day, SI_DAY},
-		{siTimeUnit_Month, SI_DAY * 30},
-		{siTimeUnit_Year, SI_DAY * 365},
-	};
-	SI_STOPIF(time <= 0, return SI_COMP_LIT(siTimeUnitScale, -1, 0));
+bool si_unixIsWayland(void) {
+#if SI_SYSTEM_IS_UNIX
+	static b8 isWayland = UINT8_MAX;
+	SI_STOPIF(isWayland != UINT8_MAX, return (bool)isWayland);
 
-	for_range (i, 1, countof(arr)) {
-		siTime converted = time / arr[i].threshold;
-		if (converted == 0) {
-			return arr[i - 1];
-		}
-	}
+	siString res = si_envVarGetData(SI_STR("WAYLAND_DISPLAY"), SI_ARR_STACK(1));
+	isWayland = (res.data != nil);
 
-	return arr[countof(arr) - 1];
+	return isWayland;
+#else
+	return false;
+#endif
 }
 
 inline
-siString si_timeUnitStr(siTimeUnit type) {
-	SI_ASSERT(si_between(i32, type, 0, siTimeUnit_Year));
-	return SI_NAMES_TIME_UNITS[type];
+bool si_unixIsX11(void) {
+#if SI_SYSTEM_IS_UNIX
+	return !si_unixIsWayland();
+#else
+	return false;
+#endif
 }
 
+SIDEF
+siUnixDE si_unixGetDE(void) {
+#if SI_SYSTEM_IS_UNIX
+	static siUnixDE de = -1;
+	SI_STOPIF(de != -1, return de);
 
-#endif /* SI_IMPLEMENTATION_TIME */
+	siString res = si_envVarGetData(SI_STR("XDG_CURRENT_DESKTOP"), SI_ARR_STACK(16));
+	SI_STOPIF(res.data == nil, return 0);
 
-#ifdef SI_IMPLEMENTATION_PRINT
+	siArena arena = si_arenaMakePtr(si_stackAlloc(SI_KILO(1)), SI_DEFAULT_MEMORY_ALIGNMENT);
+	siMap(i32) map = si_mapMake(
+		si_allocatorArena(&arena), i32,
+		{SI_STR("KDE"), siUnixDE_KDE}, {SI_STR("GNOME"), siUnixDE_GNOME},
+		{SI_STR("XFCE"), siUnixDE_Xfce}, {SI_STR("LXQt"), siUnixDE_LXQt},
+		{SI_STR("LXDE"), siUnixDE_LXDE}, {SI_STR("MATE"), siUnixDE_MATE},
+		{SI_STR("Cinnamon"), siUnixDE_Cinnamon}
+	);
 
-siIntern bool SI__COLOR_MODE = true;
+	i32* result = (i32*)si_mapGet(map, res);
+	de = result ? *result : siUnixDE_Custom;
+
+	return de;
+#else
+	return -1;
+#endif
 
-SIDEF
-isize si_print(cstring str) {
-	return si_fprint(si_stdout, SI_CSTR(str));
 }
+
+#endif /* SI_IMPLEMENTATION_SYSTEM */
+
+#ifdef SI_IMPLEMENTATION_VIRTUAL_MEMORY
+
 SIDEF
-isize si_printLn(cstring str) {
-	return si_fprintLn(si_stdout, SI_CSTR(str));
+siResult(siVirtualMemory) si_vmAlloc(void* address, isize size) {
+	SI_ASSERT_NOT_NEG(size);
+
+	siVirtualMemory vm;
+	vm.size = size;
+
+#if SI_SYSTEM_IS_WINDOWS
+	vm.data = VirtualAlloc(address, (usize)size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+	SI_OPTION_SYS_CHECK(vm.data == nil, siVirtualMemory);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	vm.data = mmap(address, (usize)size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
+	SI_OPTION_SYS_CHECK(vm.data == MAP_FAILED, siVirtualMemory);
+#else
+	vm.data = nil;
+	SI_UNUSED(address);
+#endif
+
+	return SI_OPT(siVirtualMemory, vm);
 }
 
 SIDEF
-isize si_printf(cstring fmt, ...) {
-	va_list va;
-	va_start(va, fmt);
-	isize res = si_printfVa(fmt, va);
-	va_end(va);
+siError si_vmFree(siVirtualMemory vm) {
+	SI_ASSERT_NOT_NIL(vm.data);
 
-	return res;
-}
-inline
-isize si_printfVa(cstring fmt, va_list va) {
-	return si_printfVaStr(SI_CSTR(fmt), va);
+#if SI_SYSTEM_IS_WINDOWS
+	MEMORY_BASIC_INFORMATION info;
+	while (vm.size > 0) {
+		isize res = (isize)VirtualQuery(vm.data, &info, si_sizeof(info));
+		SI_ERROR_SYS_CHECK_RET(res == 0);
+
+		if (info.BaseAddress != vm.data || info.AllocationBase != vm.data ||
+			info.State != MEM_COMMIT || info.RegionSize > (usize)vm.size) {
+			break;
+		}
+
+		res = VirtualFree(vm.data, 0, MEM_RELEASE);
+		SI_ERROR_SYS_CHECK_RET(res == 0);
+
+		vm.data = si_pointerAdd(vm.data, (isize)info.RegionSize);
+		vm.size -= (isize)info.RegionSize;
+	}
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	int res = munmap(vm.data, (usize)vm.size);
+	SI_ERROR_SYS_CHECK_RET(res != 0);
+#endif
+
+	return SI_ERROR_NIL;
 }
 
 SIDEF
-isize si_printfStr(siString fmt, ...) {
-	va_list va;
-	va_start(va, fmt);
-	isize res = si_printfVaStr(fmt, va);
-	va_end(va);
+siError si_vmDiscard(siVirtualMemory vm) {
+	SI_ASSERT_NOT_NIL(vm.data);
 
-	return res;
-}
+#if SI_SYSTEM_IS_WINDOWS
+	void* res = VirtualAlloc(vm.data, (usize)vm.size, MEM_RESET, PAGE_READWRITE);
+	SI_ERROR_SYS_CHECK_RET(res == nil);
 
-SIDEF
-isize si_printfVaStr(siString fmt, va_list va) {
-	return si_fprintfVa(si_stdout, fmt, va);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	int res = madvise(vm.data, (usize)vm.size, MADV_DONTNEED);
+	SI_ERROR_SYS_CHECK_RET(res != 0);
+#endif
+
+	return SI_ERROR_NIL;
 }
 
-SIDEF
-isize si_printfLn(cstring fmt, ...) {
-	va_list va;
-	va_start(va, fmt);
-	isize res = si_printfLnVa(fmt, va);
-	va_end(va);
 
+#endif /* SI_IMPLEMENTATION_VIRTUAL_MEMORY */
+
+#if defined(SI_IMPLEMENTATION_IO) || defined(SI_IMPLEMENTATION_LOG)
+
+#if SI_COMPILER_MSVC
+/* NOTE(EimaMei): Volatile accesses on MSVC have acquire/release semantics by
+ * default on x86, so only the compiler has to be stopped from reordering them. */
+force_inline
+isize si__atomicLoad(volatile isize* ptr) {
+	isize res = *ptr;
+	_ReadWriteBarrier();
 	return res;
 }
-SIDEF
-isize si_printfLnVa(cstring fmt, va_list va) {
-	return si_fprintfLnVa(si_stdout, SI_CSTR(fmt), va);
+force_inline
+void si__atomicStore(volatile isize* ptr, isize value) {
+	_ReadWriteBarrier();
+	*ptr = value;
+}
+force_inline
+isize si__atomicAdd(volatile isize* ptr, isize value) {
+	#if SI_ARCH_IS_64BIT
+	return _InterlockedExchangeAdd64((volatile __int64*)ptr, value) + value;
+	#else
+	return _InterlockedExchangeAdd((volatile long*)ptr, value) + value;
+	#endif
 }
 
-
-inline
-isize si_fprint(siFile* file, siString str) {
-	return si_fileWriteStr(file, str);
+#else
+force_inline
+isize si__atomicLoad(volatile isize* ptr) {
+	return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
 }
-SIDEF
-isize si_fprintLn(siFile* file, siString str) {
-	isize n = si_fprint(file, str);
-	n += si_fileWriteByte(file, '\n');
-	return n;
+force_inline
+void si__atomicStore(volatile isize* ptr, isize value) {
+	__atomic_store_n(ptr, value, __ATOMIC_RELEASE);
 }
-
-SIDEF
-isize si_fprintf(siFile* file, siString fmt, ...) {
-	va_list va;
-	va_start(va, fmt);
-	isize res = si_fprintfVa(file, fmt, va);
-	va_end(va);
-
-	return res;
+force_inline
+isize si__atomicAdd(volatile isize* ptr, isize value) {
+	return __atomic_add_fetch(ptr, value, __ATOMIC_ACQ_REL);
 }
+#endif
 
-SIDEF
-isize si_fprintfVa(siFile* file, siString fmt, va_list va) {
-	return si_fileWriteStr(file, si_bprintfVa(SI_ARR_STACK(SI_KILO(8)), fmt, va));
+#endif
 
-}
+#ifdef SI_IMPLEMENTATION_IO
 
-SIDEF
-isize si_fprintfLn(siFile* file, siString fmt, ...) {
-	va_list va;
-	va_start(va, fmt);
-	isize res = si_fprintfLnVa(file, fmt, va);
-	va_end(va);
+#if SI_COMPILER_MSVC
+	#pragma comment(lib, "shell32")
+	#pragma comment(lib, "Advapi32")
+#endif
 
-	return res;
+#if SI_SYSTEM_IS_WINDOWS
+	const u8 SI_PATH_SEPARATOR = '\\';
+#else
+	const u8 SI_PATH_SEPARATOR = '/';
+#endif
+
+inline
+bool si_pathExists(siString path) {
+	siOsChar stack[SI_PATH_MAX];
+	si_pathToOS(path, stack, countof(stack));
+	return si_pathExistsOS(stack);
 }
-SIDEF
-isize si_fprintfLnVa(siFile* file, siString fmt, va_list va) {
-	return si_fileWriteStr(file, si_bprintfLnVa(SI_ARR_STACK(SI_KILO(8)), fmt, va));
+inline
+bool si_pathExistsOS(siOsString path) {
+#if SI_SYSTEM_IS_WINDOWS
+	return GetFileAttributesW(path) != INVALID_FILE_ATTRIBUTES;
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	struct stat tmp;
+	return stat(path, &tmp) == 0;
+#else
+	return false;
+	SI_UNUSED(path);
+#endif
 }
+#if SI_SYSTEM_IS_WINDOWS
+typedef struct si__pathCopyContext {
+	siPathCopyProc* progress;
+	void* data;
+	isize copied;
+} si__pathCopyContext;
 
+siIntern
+DWORD CALLBACK si__pathCopyProgress(LARGE_INTEGER total, LARGE_INTEGER transferred,
+		LARGE_INTEGER streamSize, LARGE_INTEGER streamTransferred, DWORD stream,
+		DWORD reason, HANDLE src, HANDLE dst, LPVOID data) {
+	si__pathCopyContext* ctx = (si__pathCopyContext*)data;
+	ctx->copied = (isize)transferred.QuadPart;
+	if (ctx->progress) {
+		ctx->progress(ctx->copied, (isize)total.QuadPart, ctx->data);
+	}
 
-SIDEF
-siString si_bprintf(siArray(u8) out, siString fmt, ...) {
-	va_list va;
-	va_start(va, fmt);
-	siString res = si_bprintfVa(out, fmt, va);
-	va_end(va);
-
-	return res;
+	SI_UNUSED(streamSize); SI_UNUSED(streamTransferred); SI_UNUSED(stream);
+	SI_UNUSED(reason); SI_UNUSED(src); SI_UNUSED(dst);
+	return PROGRESS_CONTINUE;
 }
 
-#if 1
-
-struct si__printfInfoStruct {
-	u8* data;
-	isize index;
-
-	i32 padSize;
-	u8 padLetter;
-
-	siString str;
-	isize capacity;
-};
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+/* The amount of bytes the kernel gets asked to copy at once, which is also how
+ * often the progress callback gets called. */
+#define SI__PATH_COPY_CHUNK SI_MEGA(8)
 
+/* Copies everything from 'src' to 'dst', returning the amount of copied bytes
+ * or -1 if it failed. */
 siIntern
-void si__printStrToBuf(struct si__printfInfoStruct* info) {
-	SI_ASSERT_STR(info->str);
-
-	u8* base = &info->data[info->index];
+isize si__pathCopyFd(int src, int dst, isize total, siPathCopyProc* progress, void* data) {
+	isize copied = 0;
+
+	#if SI_SYSTEM_LINUX
+	/* NOTE(EimaMei): A reflink makes the destination share the source's blocks,
+	 * which is instant but only supported by some file systems (e.g. Btrfs, XFS). */
+	#ifndef FICLONE
+	#define FICLONE _IOW(0x94, 9, int)
+	#endif
+	if (ioctl(dst, FICLONE, src) == 0) {
+		if (progress) {
+			progress(total, total, data);
+		}
+		return total;
+	}
 
-	siString str = (info->capacity > info->str.len)
-		? info->str
-		: si_substrTo(info->str, info->capacity);
+	/* NOTE(EimaMei): Both methods stay inside the kernel. 'copy_file_range'
+	 * fails across file systems on older kernels, while some pseudo files (e.g.
+	 * in /proc) report a size of 0 and copy no data at all, in which case the
+	 * next method is tried. A truly empty file ends up in the buffered loop,
+	 * which reads nothing. */
+	for_range (method, 0, 2) {
+		isize res;
+		while (true) {
+			res = (method == 0)
+				? copy_file_range(src, nil, dst, nil, SI__PATH_COPY_CHUNK, 0)
+				: sendfile(dst, src, nil, SI__PATH_COPY_CHUNK);
+			SI_STOPIF(res == -1 && errno == EINTR, continue);
+			SI_STOPIF(res <= 0, break);
+
+			copied += res;
+			if (progress) {
+				progress(copied, total, data);
+			}
+		}
 
-	if (info->padSize == 0) {
-		si_memcopyStr(base, str);
+		SI_STOPIF(copied != 0, return (res == 0) ? copied : -1);
 	}
-	else if (info->padSize < 0) {
-		isize padLen = str.len + info->padSize;
-		bool padNeeded = (padLen < 0);
+	#endif
 
-		si_memcopyStr(base, str);
-		if (padNeeded) {
-			isize padding = -padLen;
-			si_memset(&base[str.len], info->padLetter, padding);
-			info->index += padding;
-			info->capacity -= padding;
+	u8 buffer[SI_KILO(64)];
+	while (true) {
+		isize len = read(src, buffer, sizeof(buffer));
+		SI_STOPIF(len == -1 && errno == EINTR, continue);
+		SI_STOPIF(len == -1, return -1);
+		SI_STOPIF(len == 0, break);
+
+		isize written = 0;
+		while (written < len) {
+			isize res = write(dst, &buffer[written], (usize)(len - written));
+			SI_STOPIF(res == -1 && errno == EINTR, continue);
+			SI_STOPIF(res == -1, return -1);
+			written += res;
 		}
-		info->padSize = 0;
-	}
-	else {
-		isize padLen = info->padSize - str.len;
-		bool padNeeded = (padLen > 0);
 
-		if (padNeeded) {
-			si_memset(base, info->padLetter, padLen);
-			info->index += padLen;
-			info->capacity -= padLen;
+		copied += len;
+		if (progress) {
+			progress(copied, total, data);
 		}
-		si_memcopyStr(&info->data[info->index], info->str);
-		info->padSize = 0;
 	}
 
-	info->index += str.len;
-	info->capacity -= str.len;
+	return copied;
 }
-force_inline
-void si__printStrCpy(struct si__printfInfoStruct* info) {
-	siString str = (info->capacity > info->str.len)
-		? info->str
-		: si_substrTo(info->str, info->capacity);
+#endif
 
-	info->index += si_memcopyStr(&info->data[info->index], str);
+inline
+siResult(isize) si_pathCopy(siString pathSrc, siString pathDst) {
+	return si_pathCopyEx(pathSrc, pathDst, nil, nil);
 }
 
-force_inline
-isize SI_SET_FMT_PTR(siRune* x, const u8** fmtPtr) {
-	siUtf32Char res = si_utf8Decode(*fmtPtr);
-	*x = res.codepoint;
-	*fmtPtr += res.len;
+SIDEF
+siResult(isize) si_pathCopyEx(siString pathSrc, siString pathDst,
+		siPathCopyProc* progress, void* data) {
+	siOsChar stack[SI_PATH_MAX * 2];
+	siOsString_2x strs = si_pathToOSMul(pathSrc, pathDst, stack, countof(stack));
+	siOsString* paths = strs.v;
 
-	return res.len;
-}
+#if SI_SYSTEM_IS_WINDOWS
+	si__pathCopyContext ctx;
+	ctx.progress = progress;
+	ctx.data = data;
+	ctx.copied = 0;
 
-#define SI_CHECK_AFTERPOINT_INT(info, afterPointIsSet, afterPoint) \
-	if (afterPointIsSet) { \
-		SI_STOPIF(afterPoint == 0, break); \
-		info.padLetter = '0'; \
-		info.padSize = afterPoint; \
-	} \
-	do {} while (0)
+	i32 res = CopyFileExW(paths[0], paths[1], si__pathCopyProgress, &ctx, nil, 0);
+	SI_OPTION_SYS_CHECK(res == 0, isize);
 
+	return SI_OPT(isize, ctx.copied);
 
-force_inline
-u64 si__pow10(i32 exponent) {
-	static const u64 allPossibleValues[] = {
-		1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
-		10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
-		100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL
-	};
-	SI_ASSERT_NOT_NEG(exponent);
-	SI_ASSERT_MSG(exponent < countof(allPossibleValues), "Exponent must be in range from 0 to 18 to not overflow.");
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	int src = open(paths[0], O_RDONLY | O_CLOEXEC, 0);
+	SI_OPTION_SYS_CHECK(src == -1, isize);
 
-	return allPossibleValues[exponent];
-}
+	struct stat info;
+	int res = fstat(src, &info);
+	SI_ERROR_SYS_CHECK(res == -1, close(src); return SI_OPT_ERR(isize, SI_ERROR_RES));
+
+	/* NOTE(EimaMei): Truncating the destination would destroy the source if
+	 * they're the same file. */
+	struct stat dstInfo;
+	if (stat(paths[1], &dstInfo) == 0 && dstInfo.st_dev == info.st_dev && dstInfo.st_ino == info.st_ino) {
+		close(src);
+		siError error = SI_ERROR_SYS_EX(siErrorSystem_Invalid);
+		return SI_OPT_ERR(isize, error);
+	}
 
-force_inline
-f64 si__pow10F64(i32 exponent) {
-	static const f64 allPossibleValues[] = {
-		1e-18, 1e-17, 1e-16, 1e-15, 1e-14, 1e-13,
-		1e-12, 1e-11, 1e-10, 1e-09, 1e-08, 1e-07,
-		1e-06, 1e-05, 1e-04, 1e-03, 1e-02, 1e-01,
+	int dst = open(paths[1], O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, info.st_mode & 0777);
+	SI_ERROR_SYS_CHECK(dst == -1, close(src); return SI_OPT_ERR(isize, SI_ERROR_RES));
 
-		1e+0,
+	isize copied = si__pathCopyFd(src, dst, (isize)info.st_size, progress, data);
+	SI_ERROR_SYS_CHECK(copied == -1, close(src); close(dst); return SI_OPT_ERR(isize, SI_ERROR_RES));
 
-		1e+01, 1e+02, 1e+03, 1e+04, 1e+05, 1e+06,
-		1e+07, 1e+08, 1e+09, 1e+10, 1e+11, 1e+12,
-		1e+13, 1e+14, 1e+15, 1e+16, 1e+17, 1e+18
-	};
-	SI_ASSERT_MSG(si_between(i32, exponent, -18, 18), "Exponent must be in range from -18 to 18 to not overflow.");
+	close(src);
+	close(dst);
 
-	return allPossibleValues[exponent + 18];
-}
+	return SI_OPT(isize, copied);
 
+#else
+	SI_UNUSED(paths); SI_UNUSED(progress); SI_UNUSED(data);
+	return SI_OPT_NIL(isize);
 
 #endif
+}
 
-SIDEF
-siString si_bprintfVa(siArray(u8) out, siString fmt, va_list va) {
-	SI_ASSERT_ARR_TYPE(out, u8);
-	SI_STOPIF(out.len == 0, return SI_STR_EMPTY);
+typedef struct si__pathCopyJob {
+	isize src, srcLen;
+	isize dst, dstLen;
+} si__pathCopyJob;
 
-	union {
-		i32 I32; u32 U32;
-		u64 U64; i64 I64; f64 F64;
-		usize USIZE; isize ISIZE;
-		cstring STR; u8* PTR;
-	} vaValue;
+typedef struct si__pathCopyQueue {
+	const si__pathCopyJob* jobs;
+	isize len;
+	const u8* paths;
 
-	struct si__printfInfoStruct info = SI_STRUCT_ZERO;
-	info.data = (u8*)out.data;
-	info.capacity = out.len;
+	volatile isize next;
+	volatile isize failed;
+	siError error;
+} si__pathCopyQueue;
 
-	siArray(u8) stack = SI_ARR_STACK(128);
+typedef struct si__pathItemsCollect {
+	isize srcLen;
+	u8* dst;
+	isize dstLen;
 
-	siRune x;
-	const u8* fmtPtr = fmt.data;
-	i32 base = 10;
-	bool colorPresent = false;
+	siBuilder* paths;
+	siDynamicArray(si__pathCopyJob)* jobs;
+	siError error;
+} si__pathItemsCollect;
 
-	while (info.index < info.capacity) {
-		SI_STOPIF(fmtPtr >= &fmt.data[fmt.len], break);
+/* Recreates every folder inside the destination and adds every file into the jobs. */
+siIntern
+SI_DIRECTORY_WALK_PROC(si__pathItemsCollectProc) {
+	si__pathItemsCollect* ctx = (si__pathItemsCollect*)data;
+
+	siString relative = si_substrFrom(entry->path, ctx->srcLen);
+	isize len = ctx->dstLen + relative.len;
+	if (len > SI_PATH_MAX) {
+		ctx->error = SI_ERROR_SYS_EX(siErrorSystem_InvalidFilename);
+		return siWalkAction_Stop;
+	}
 
-		isize xLen = SI_SET_FMT_PTR(&x, &fmtPtr);
-		if (x != '%') {
-			if (info.index + xLen <= info.capacity) {
-				info.index += si_memcopy(&info.data[info.index], fmtPtr - xLen, xLen);
-				continue;
-			}
-			else {
-				SI_PANIC();
-				break;
-			}
+	si_memcopyStr(&ctx->dst[ctx->dstLen], relative);
+	siString dstStr = SI_STR_LEN(ctx->dst, len);
+
+	if (entry->type == siIoType_Directory) {
+		siError error = si_pathCreateFolder(dstStr);
+		if (error.code != 0 && error.code != siErrorSystem_Exists) {
+			ctx->error = error;
+			return siWalkAction_Stop;
 		}
+		return siWalkAction_Continue;
+	}
 
-		xLen = SI_SET_FMT_PTR(&x, &fmtPtr);
-		vaValue.U64 = 0;
-		info.padLetter = ' ';
+	si__pathCopyJob job;
+	job.src = ctx->paths->len;
+	job.srcLen = entry->path.len;
+	si_builderWriteStr(ctx->paths, entry->path);
 
-		i32 afterPoint = 6;
-		bool afterPointIsSet = false;
-		i32 typeSize = 0;
-		i32* ptrToVar = &info.padSize;
+	job.dst = ctx->paths->len;
+	job.dstLen = len;
+	si_builderWriteStr(ctx->paths, dstStr);
 
-GOTO_PRINT_SWITCH:
-		switch (x) {
-			case 'n': {
-				(void)va_arg(va, signed int*);
-				break;
-			}
-			case '%': {
-				info.data[info.index] = '%';
-				info.index += 1;
-				break;
-			}
+	si_dynamicArrayAppend(ctx->jobs, &job);
+	return siWalkAction_Continue;
+}
 
-			case 'h': {
-				SI_STOPIF(typeSize != 0, continue);
-				if (*fmtPtr == 'h') {
-					fmtPtr += 1;
-					typeSize = 1;
-				}
-				else {
-					typeSize = 2;
-				}
+siIntern
+void* si__pathCopyWorker(void* data) {
+	si__pathCopyQueue* queue = (si__pathCopyQueue*)data;
 
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				goto GOTO_PRINT_SWITCH;
-			}
+	while (true) {
+		isize index = si__atomicAdd(&queue->next, 1) - 1;
+		SI_STOPIF(index >= queue->len, break);
 
-			case 'l': {
-				SI_STOPIF(typeSize != 0, continue);
-				SI_STOPIF(*fmtPtr == 'l', fmtPtr += 1);
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				typeSize = 8;
-				goto GOTO_PRINT_SWITCH;
-			}
+		si__pathCopyJob job = queue->jobs[index];
+		siResult(isize) res = si_pathCopy(
+			SI_STR_LEN(&queue->paths[job.src], job.srcLen),
+			SI_STR_LEN(&queue->paths[job.dst], job.dstLen)
+		);
 
-			case 'z': {
-				SI_STOPIF(typeSize != 0, continue);
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				typeSize = si_sizeof(usize);
-				goto GOTO_PRINT_SWITCH;
-			}
+		if (!res.hasValue && si__atomicAdd(&queue->failed, 1) == 1) {
+			queue->error = res.data.error;
+		}
+	}
 
-			case 'j': {
-				SI_STOPIF(typeSize != 0, continue);
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				typeSize = 8;
-				goto GOTO_PRINT_SWITCH;
-			}
+	return nil;
+}
 
-			case '#': {
-				const u8* beforeAlt = fmtPtr;
-				do {
-					SI_SET_FMT_PTR(&x, &fmtPtr);
-				}
-				while (x != 'x' && x != 'b' && x != 'o' && x != 'X' && x != 'O');
+SIDEF
+siResult(i32) si_pathItemsCopy(siString pathSrc, siString pathDst) {
+	SI_ASSERT(pathDst.len <= SI_PATH_MAX);
+	siAllocator alloc = si_allocatorHeap();
 
-				x |= (siRune)SI_BIT(5);
-				u8 altForm[2] = {'0', (u8)x};
-				info.str = SI_STR_LEN(altForm, si_sizeof(altForm));
+	u8 dst[SI_PATH_MAX];
+	si_memcopyStr(dst, pathDst);
+
+	/* NOTE(EimaMei): The whole tree is walked first, so that the files can be
+	 * copied in parallel afterwards. Every walked path starts with the source
+	 * path, which gets replaced with the destination. */
+	siBuilder paths = si_builderMake(SI_KILO(4), alloc);
+	siDynamicArray(si__pathCopyJob) jobs = si_dynamicArrayMakeReserve(si__pathCopyJob, 64, alloc);
+
+	si__pathItemsCollect ctx;
+	ctx.srcLen = pathSrc.len;
+	ctx.dst = dst;
+	ctx.dstLen = pathDst.len;
+	ctx.paths = &paths;
+	ctx.jobs = &jobs;
+	ctx.error = SI_ERROR_NIL;
+
+	/* NOTE(EimaMei): The walked paths always have a separator after the source
+	 * path, which the destination must not duplicate. */
+	if (pathSrc.len != 0 && si_stringAtBack(pathSrc) == SI_PATH_SEPARATOR) {
+		ctx.srcLen -= 1;
+	}
+	if (pathDst.len != 0 && si_stringAtBack(pathDst) == SI_PATH_SEPARATOR) {
+		ctx.dstLen -= 1;
+	}
 
-				si__printStrCpy(&info);
+	siResult(isize) walked = si_directoryWalk(pathSrc, si__pathItemsCollectProc, &ctx);
+	siError error = (walked.hasValue) ? ctx.error : walked.data.error;
 
-				fmtPtr = beforeAlt + 1;
-				x = *beforeAlt;
+	if (error.code == 0) {
+		si__pathCopyQueue queue = SI_STRUCT_ZERO;
+		queue.jobs = (const si__pathCopyJob*)jobs.data;
+		queue.len = jobs.len;
+		queue.paths = paths.data;
 
-				goto GOTO_PRINT_SWITCH;
-			}
-			case '*': {
-				*ptrToVar = va_arg(va, i32);
+	#ifndef SI_NO_THREAD
+		/* NOTE(EimaMei): The calling thread copies files too. */
+		siThread threads[SI_PATH_COPY_THREAD_COUNT];
+		isize threadCount = 0;
+		for_range (i, 0, si_min(isize, countof(threads), jobs.len) - 1) {
+			siError res = si_threadMakeAndRun(si__pathCopyWorker, &queue, &threads[i]);
+			SI_STOPIF(res.code != 0, break);
+			threadCount += 1;
+		}
+		si__pathCopyWorker(&queue);
 
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				goto GOTO_PRINT_SWITCH;
-			}
-			case '.': {
-				ptrToVar = &afterPoint;
-				afterPointIsSet = true;
+		for_range (i, 0, threadCount) {
+			si_threadJoin(&threads[i]);
+			si_threadDestroy(&threads[i]);
+		}
+	#else
+		si__pathCopyWorker(&queue);
+	#endif
 
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				goto GOTO_PRINT_SWITCH;
-			}
-			case '-': case '+': {
-				if (si_runeIsDigit(si_utf8Decode(fmtPtr).codepoint)) {
-					goto conv_decimal;
-				}
-				siFallthrough; /* NOTE(EimaMei): Go to the ' ' case. */
-			}
-			case ' ': {
-				info.str = SI_STR_LEN(&x, si_sizeof(char));
-				si__printStrCpy(&info);
+		error = queue.error;
+	}
 
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				goto GOTO_PRINT_SWITCH;
-			 }
+	isize count = jobs.len;
+	si_builderFree(&paths);
+	si_dynamicArrayFree(jobs);
+	SI_STOPIF(error.code != 0, return SI_OPT_ERR(i32, error));
 
-			case '0': {
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				if (si_runeIsDigit(x)) {
-					info.padLetter = '0';
-				}
-				else {
-					*ptrToVar = 0;
-				}
+	return SI_OPT(i32, (i32)count);
+}
 
-				goto GOTO_PRINT_SWITCH;
-			}
-			case '1': case '2': case '3': case '4': case '5': case '6': case '7':
-			case '8': case '9': {
-				isize len;
-conv_decimal:
-				/* TODO(EimaMei): Unsafe, this should be patched when printf is
-				 * going to use indexes instead of pointers. */
-				fmtPtr -= 1;
-				i64 count = si_stringToIntEx(SI_STR_LEN(fmtPtr, 64), &len);
-				SI_ASSERT(count <= INT32_MAX);
-				SI_ASSERT(len != -1);
-
-				*ptrToVar = (i32)count;
-				fmtPtr += len;
-
-				SI_SET_FMT_PTR(&x, &fmtPtr);
-				goto GOTO_PRINT_SWITCH;
-			}
+SIDEF
+siError si_pathMove(siString pathSrc, siString pathDst) {
+	siOsChar stack[SI_PATH_MAX * 2];
+	siOsString_2x strs = si_pathToOSMul(pathSrc, pathDst, stack, countof(stack));
+	siOsString* paths = strs.v;
 
-			case 'x': case 'X':
-				base = 16;
-				si_numEnableUpper(x != 'x');
-				goto GOTO_SPECIFIER_U;
-			case 'o':
-				base = 8;
-				goto GOTO_SPECIFIER_U;
-			case 'b':
-				base = 2;
-				goto GOTO_SPECIFIER_U;
-
-			case 'u': {
-				base = 10;
-GOTO_SPECIFIER_U:
-				switch (typeSize) {
-					case 0: vaValue.U32 = va_arg(va, u32); break;
-					case 1: vaValue.U32 = (u8)va_arg(va, u32); break;
-					case 2: vaValue.U32 = (u16)va_arg(va, u32); break;
-					case 4: vaValue.U32 = va_arg(va, u32); break;
-					case 8: vaValue.U64 = va_arg(va, u64); break;
-					default: SI_PANIC();
-				}
-				SI_CHECK_AFTERPOINT_INT(info, afterPointIsSet, afterPoint);
+#if SI_SYSTEM_IS_WINDOWS
+	i32 res = MoveFileW(paths[0], paths[1]);
+	SI_ERROR_SYS_CHECK_RET(res == 0);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	i32 res = link(paths[0], paths[1]);
+	SI_ERROR_SYS_CHECK_RET(res != 0);
 
-				info.str = si_stringFromUIntEx(vaValue.U64, base, stack);
-				si__printStrToBuf(&info);
+	res = unlink(paths[0]);
+	SI_ERROR_SYS_CHECK_RET(res != 0);
+#else
+	SI_UNUSED(paths);
+#endif
 
-				si_numEnableUpper(true);
-			} break;
+	return SI_ERROR_NIL;
+}
 
-			case 'i': case 'd': {
-				switch (typeSize) {
-					case 0: vaValue.I64 = va_arg(va, i32); break;
-					case 1: vaValue.I64 = (i8)va_arg(va, i32); break;
-					case 2: vaValue.I64 = (i16)va_arg(va, i32); break;
-					case 4: vaValue.I64 = va_arg(va, i32); break;
-					case 8: vaValue.I64 = va_arg(va, i64); break;
-					default: SI_DEBUG_TRAP();
-				}
-				SI_CHECK_AFTERPOINT_INT(info, afterPointIsSet, afterPoint);
+inline
+siError si_pathRename(siString path, siString newPath) {
+	return si_pathMove(path, newPath);
+}
 
-				info.str = si_stringFromInt(vaValue.I64, stack);
-				si__printStrToBuf(&info);
-				break;
-			}
+SIDEF
+siError si_pathCreateFolder(siString path) {
+	siOsChar stack[SI_PATH_MAX];
+	si_pathToOS(path, stack, countof(stack));
 
-			case 'c': {
-				vaValue.I32 = va_arg(va, i32);
+	#if SI_SYSTEM_IS_WINDOWS
+		i32 res = CreateDirectoryW(stack, nil);
+		SI_ERROR_SYS_CHECK_RET(res == 0);
+	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+		i32 res = mkdir(stack, 0777);
+		SI_ERROR_SYS_CHECK_RET(res != 0);
+	#endif
 
-				siUtf8Char utf8 = si_utf8Encode(vaValue.I32);
-				info.str = SI_STR_LEN(utf8.codepoint, utf8.len);
+	return SI_ERROR_NIL;
+}
 
-				si__printStrToBuf(&info);
+SIDEF
+siError si_pathRemove(siString path) {
+	/* TODO(EimaMei): Check the performance of this, rewrite it. */
+	siOsChar stack[SI_PATH_MAX];
+	si_pathToOS(path, stack, countof(stack));
 
-			} break;
+	#if SI_SYSTEM_IS_WINDOWS
+		u32 attrs = GetFileAttributesW(stack);
+		SI_ERROR_SYS_CHECK_RET(attrs == INVALID_FILE_ATTRIBUTES);
 
-			case 'S': {
-				vaValue.STR = va_arg(va, char*);
+		i32 res;
+		if (attrs & FILE_ATTRIBUTE_DIRECTORY) {
+			siDirectoryIterator entry;
+			siDirectory dir = si_directoryOpen(path);
+			while (si_directoryIterate(&dir, &entry)) {
+				siError err = si_pathRemove(entry.path);
+				SI_STOPIF(err.code != 0, return err);
+			}
 
-				if (vaValue.STR != nil) {
-					isize len = afterPointIsSet
-						? afterPoint
-						: si_cstrLen(vaValue.STR);
-					info.str = SI_STR_LEN(vaValue.STR, len);
-				}
-				else { info.str = SI_STR("(nil)"); }
+			res = RemoveDirectoryW(stack);
+		}
+		else {
+			res = DeleteFileW(stack);
+		}
+		SI_ERROR_SYS_CHECK_RET(res == 0);
 
-				si__printStrToBuf(&info);
-			} break;
+	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+		struct stat tmp;
+		i32 res = stat(stack, &tmp);
+		SI_ERROR_SYS_CHECK_RET(res != 0);
 
-			case 'A': case 'a': {
-				vaValue.F64 = va_arg(va, f64);
+		if (S_ISDIR(tmp.st_mode)) {
+			siDirectoryIterator entry;
+			siDirectory dir = si_directoryOpen(path);
+			while (si_directoryIterate(&dir, &entry)) {
+				siError err = si_pathRemove(entry.path);
+				SI_STOPIF(err.code != 0, return err);
+			}
 
-				char altForm[2] = {'0', (char)(x + ('X' - 'A'))};
-				info.str = SI_STR_LEN(altForm, si_sizeof(altForm));
-				si__printStrCpy(&info);
+			res = rmdir(stack);
+		}
+		else {
+			res = unlink(stack);
+		}
+		SI_ERROR_SYS_CHECK_RET(res != 0);
 
-				info.str = si_stringFromFloatEx(vaValue.F64, 16, afterPoint, stack);
-				si__printStrToBuf(&info);
-			} break;
+	#endif
 
-			case 'F': case 'f': {
-				vaValue.F64 = va_arg(va, f64);
+	return SI_ERROR_NIL;
+}
 
-				info.str = si_stringFromFloatEx(vaValue.F64, 10, afterPoint, stack);
-				si__printStrToBuf(&info);
-			} break;
+SIDEF
+siError si_pathCreateHardLink(siString path, siString pathLink) {
+	siOsChar stack[SI_PATH_MAX * 2];
+	siOsString_2x strs = si_pathToOSMul(path, pathLink, stack, countof(stack));
+	siOsString* paths = strs.v;
 
-			case 'E': case 'e': {
-				vaValue.F64 = va_arg(va, f64);
-				if (si_float64IsNan(vaValue.F64) || si_float64IsInf(vaValue.F64)) {
-					info.str = si_stringFromFloatEx(vaValue.F64, 10, 0, stack);
-					si__printStrToBuf(&info);
-					break;
-				}
+#if SI_SYSTEM_IS_WINDOWS
+	i32 res = CreateHardLinkW(paths[1], paths[0], nil);
+	SI_ERROR_SYS_CHECK_RET(res == 0);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	i32 res = link(paths[0], paths[1]);
+	SI_ERROR_SYS_CHECK_RET(res != 0);
+#else
+	SI_UNUSED(paths);
+#endif
 
-				i32 exponent;
-GOTO_SCIENTIFIC_NOTATION:
-				exponent = 0;
-				while (vaValue.F64 > 10) {
-					vaValue.F64 /= 10;
-					exponent += 1;
-				}
+	return SI_ERROR_NIL;
+}
 
-				info.str = si_stringFromFloatEx(vaValue.F64, 10, afterPoint, stack);
-				si__printStrToBuf(&info);
+SIDEF
+siError si_pathCreateSoftLink(siString path, siString pathLink) {
+	siOsChar stack[SI_PATH_MAX * 2];
+	siOsString_2x strs = si_pathToOSMul(path, pathLink, stack, countof(stack));
+	siOsString* paths = strs.v;
 
+#if SI_SYSTEM_IS_WINDOWS
+	u32 attrs = GetFileAttributesW(paths[0]);
+	SI_ERROR_SYS_CHECK_RET(attrs == INVALID_FILE_ATTRIBUTES);
 
-				u8 remainder[4];
-				remainder[0] = (u8)x;
-				remainder[1] = '+';
-				if (exponent < 10) {
-					remainder[2] = '0';
-					remainder[3] = (u8)(exponent + '0');
-				}
-				else {
-					remainder[2] = (u8)((exponent / 10) + '0');
-					remainder[3] = (u8)((exponent % 10) + '0');
-				}
+	i32 res = CreateSymbolicLinkW(paths[1], paths[0], attrs & FILE_ATTRIBUTE_DIRECTORY);
+	SI_ERROR_SYS_CHECK_RET(res == 0);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	i32 res = symlink(paths[0], paths[1]);
+	SI_ERROR_SYS_CHECK_RET(res != 0);
+#else
+	SI_UNUSED(paths);
 
-				info.str = SI_STR_LEN(remainder, si_sizeof(remainder));
-				si__printStrCpy(&info);
-			} break;
+#endif
 
-			case 'G': case 'g': {
-				vaValue.F64 = va_arg(va, f64);
+	return SI_ERROR_NIL;
+}
 
-				if (si_float64IsNan(vaValue.F64) || si_float64IsInf(vaValue.F64)) {
-					info.str = si_stringFromFloatEx(vaValue.F64, 10, 0, stack);
-					si__printStrToBuf(&info);
-					break;
-				}
-				if (vaValue.F64 < 0.0001) {
-					x = (u8)('E' + (x - 'G'));
-					goto GOTO_SCIENTIFIC_NOTATION;
-				}
+inline
+siString si_pathBaseName(siString path) {
+	SI_ASSERT_STR(path);
+	SI_ASSERT(path.len <= SI_PATH_MAX);
 
-				u64 pow10Val = si__pow10(afterPoint);
-				u64 intFloat = (u64)vaValue.F64;
+	isize i;
+	for (i = path.len - 1; i >= 0; i -= 1) {
+		if (path.data[i] == SI_PATH_SEPARATOR) {
+			return si_substrFrom(path, i + 1);
+		}
+	}
+	return path;
+}
 
-				if (vaValue.F64 > (f64)pow10Val) {
-					afterPoint -= (i32)(intFloat / pow10Val);
+SIDEF
+siString si_pathUnrooted(siString path) {
+	#if SI_SYSTEM_IS_WINDOWS
+		isize offset = 3 * si_pathIsAbsolute(path);
+	#else
+		isize offset = (isize)si_pathIsAbsolute(path);
+	#endif
 
-					x = (u8)('E' + (x - 'G'));
-					goto GOTO_SCIENTIFIC_NOTATION;
-				}
+	for_range (i, offset, path.len) {
+		if (path.data[i] == SI_PATH_SEPARATOR) {
+			return si_substrFrom(path, i);
+		}
+	}
+	return si_substrFrom(path, offset);
+}
 
-				f64 remainder = vaValue.F64 - (f64)intFloat;
-				f64 maxZeroValue = si__pow10F64(-(i32)afterPoint);
+SIDEF
+siString si_pathExtension(siString path) {
+	SI_ASSERT_STR(path);
+	SI_ASSERT(path.len <= SI_PATH_MAX);
 
-				i32 newAfterPoint = 0;
-				while (newAfterPoint < afterPoint) {
-					remainder *= 10;
-					if (si_between(f64, si_abs(f64, remainder), 0, maxZeroValue)) {
-						break;
-					}
-					f64 digit = remainder + 0.5;
-					remainder -= digit;
-					newAfterPoint += 1;
-				}
+	isize i = si_stringFindLastByte(path, '.');
+	return (i != -1) ? si_substrFrom(path, i) : SI_STR_EMPTY;
 
-				info.str = si_stringFromFloatEx(vaValue.F64, 10, newAfterPoint, stack);
-				si__printStrToBuf(&info);
-			} break;
+}
 
-			case 'p': {
-				info.str = SI_STR("0x");
-				si__printStrCpy(&info);
+SIDEF
+siString si_pathLongExtension(siString path) {
+	SI_ASSERT_STR(path);
+	SI_ASSERT(path.len <= SI_PATH_MAX);
 
-				vaValue.USIZE = (usize)va_arg(va, void*);
-				info.str = si_stringFromUIntEx(vaValue.USIZE, 16, stack);
-				si__printStrCpy(&info);
-			} break;
+	isize i = si_stringFindLastByte(path, SI_PATH_SEPARATOR);
+	if (i != -1) {
+		path = si_substrFrom(path, i + 1);
+	}
 
-			case 's': {
-				info.str = va_arg(va, siString);
-				if (info.str.data == nil) { info.str = SI_STR("(nil)"); }
+	i = si_stringFindByte(path, '.');
+	return (i != -1) ? si_substrFrom(path, i) : SI_STR_EMPTY;
+}
 
-				si__printStrToBuf(&info);
-			} break;
 
-			case 't': { /* Boolean */
-				info.str = si_stringFromBool((bool)va_arg(va, b32));
-				si__printStrCpy(&info);
-			} break;
+SIDEF
+siString si_pathStem(siString path) {
+	SI_ASSERT_STR(path);
+	SI_ASSERT(path.len <= SI_PATH_MAX);
 
-			case 'L': { /* Location */
-				siCallerLoc loc = va_arg(va, siCallerLoc);
-				siArena arena = si_arenaMakePtr(si_stackAlloc(1024), 1);
+	isize i = si_stringFindLastByte(path, SI_PATH_SEPARATOR);
+	if (i != -1) {
+		path = si_substrFrom(path, i + 1);
+	}
 
-				siBuilder b = si_builderMake(loc.filename.len + 20 + loc.function.len + 2, si_allocatorArena(&arena));
-				si_builderWriteStr(&b, loc.filename);
-				si_builderWriteByte(&b, ':');
-				si_builderWriteInt(&b, loc.line);
-				si_builderWriteByte(&b, ':');
-				si_builderWriteStr(&b, loc.function);
+	i = si_stringFindLastByte(path, '.');
+	return (i > 0) ? si_substrTo(path, i) : SI_STR_EMPTY;
+}
 
-				info.str = si_builderToStr(b);
-				si__printStrToBuf(&info);
-			} break;
+SIDEF
+siString si_pathShortStem(siString path) {
+	SI_ASSERT_STR(path);
+	SI_ASSERT(path.len <= SI_PATH_MAX);
 
+	isize i = si_stringFindLastByte(path, SI_PATH_SEPARATOR);
+	if (i != -1) {
+		path = si_substrFrom(path, i + 1);
+	}
 
-			case 'C': {
-				if (colorPresent) {
-					colorPresent = false;
-					info.str = SI_STR("\33[0m");
-					si__printStrCpy(&info);
-					break;
-				}
+	i = si_stringFindByte(path, '.');
+	return (i > 0) ? si_substrTo(path, i) : SI_STR_EMPTY;
+}
 
-				siPrintColor clr = va_arg(va, siPrintColor);
-				if (!SI__COLOR_MODE) { break; }
 
-				colorPresent = true;
-				switch (clr.type) {
-					case siPrintColorType_3bit: {
-						SI_ASSERT(si_between(u8, clr.data.ansi.color, 0, 7));
 
-						char str[] ="\33[\0;\0\0m";
-						str[2] = (!clr.data.ansi.bold) ? '0' : '1';
-						str[4] = (!clr.data.ansi.light) ? '3' : '9';
-						str[5] = (char)('0' + clr.data.ansi.color);
+SIDEF
+siResult(siString) si_pathGetFullName(siString path, siAllocator alloc) {
+	siOsChar stack[SI_PATH_MAX * 2];
+	isize pathLen = si_pathToOS(path, stack, countof(stack));
 
-						info.str = SI_STR(str);
-						si__printStrCpy(&info);
-					} break;
+#if SI_SYSTEM_IS_WINDOWS
+	SI_OPTION_SYS_CHECK(!si_pathExistsOS(stack), siString);
+	DWORD dif = (u32)(countof(stack) - pathLen);
 
-					case siPrintColorType_8bit: {
-						#define _8BIT_STR "\33[38;5;"
+	isize len = (isize)GetFullPathNameW(stack, dif, &stack[pathLen], nil);
+	SI_OPTION_SYS_CHECK(len == 0, siString);
 
-						char str[32] = _8BIT_STR;
-						siArray(char) buf = SI_ARR_LEN(str, countof_str(str));
-						isize trueLen = countof_str(_8BIT_STR);
+	siUtf16String str = SI_ARR_LEN(&stack[pathLen], len);
+	isize utf8Len = si_utf16ToUtf8StrLen(str);
 
-						siString num = si_stringFromInt(
-							clr.data.cube, si_sliceFrom(buf, countof_str(_8BIT_STR))
-						);
-						trueLen += num.len;
+	siString res = si_utf16ToUtf8Str(str, si_arrayMakeReserve(u8, utf8Len, alloc));
+	return SI_OPT(siString, res);
 
-						str[trueLen] = 'm';
-						trueLen += 1;
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	siOsChar* out = &stack[pathLen];
+	out = realpath(stack, out);
+	SI_OPTION_SYS_CHECK(out == nil, siString);
 
-						info.str = SI_STR_LEN(str, trueLen);
-						si__printStrCpy(&info);
+	return SI_OPT(siString, si_stringFromCStr(out, alloc));
+#else
+	return SI_OPT_NIL(siString);
+	SI_UNUSED(pathLen); SI_UNUSED(alloc);
 
-						#undef _8BIT_STR
-					} break;
+#endif
+}
 
-					case siPrintColorType_24bit: {
-						#define _24BIT_STR "\33[38;2;"
+inline
+siString si_pathJoin(siString path, siString subPath, siAllocator alloc) {
+	return si_pathJoinEx(SI_ARR(siString, path, subPath), alloc);
+}
 
-						char str[64] = _24BIT_STR;
-						siArray(char) buf = SI_ARR_LEN(str, countof_str(str));
-						isize trueLen = countof_str(_24BIT_STR);
+inline
+siString si_pathJoinEx(siArray(siString) strs, siAllocator alloc) {
+	return si_stringJoin(strs, SI_STR_LEN(&SI_PATH_SEPARATOR, 1), alloc);
+}
 
-						static char divider[countof(clr.data.rgb)] = {';', ';', 'm'};
-						for_range (j, 0, countof(clr.data.rgb)) {
-							siString num = si_stringFromInt(
-								clr.data.rgb[j], si_sliceFrom(buf, trueLen)
-							);
-							trueLen += num.len;
+inline
+bool si_pathIsAbsolute(siString path) {
+	SI_ASSERT(path.len <= SI_PATH_MAX);
+	u8* data = (u8*)path.data;
 
-							str[trueLen] = divider[j];
-							trueLen += 1;
+#if SI_SYSTEM_IS_WINDOWS
+	return (
+		si_charIsAlpha((char)data[0])
+		&& data[1] == ':'
+		&& data[2] == SI_PATH_SEPARATOR
+		&& data[3] != '\0'
+	);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	return (data[0] == SI_PATH_SEPARATOR && path.len != 1);
+#else
+	return false;
+	SI_UNUSED(data);
+#endif
+}
 
-						}
+inline
+bool si_pathIsRelative(siString path) {
+	return !si_pathIsAbsolute(path);
+}
 
-						info.str = SI_STR_LEN(str, trueLen);
-						si__printStrCpy(&info);
+SIDEF
+isize si_pathToOS(siString path, siOsChar* out, isize capacity) {
+	SI_ASSERT(path.len <= SI_PATH_MAX);
+	SI_ASSERT_NOT_NIL(out);
+	SI_ASSERT_NOT_NEG(capacity);
+	SI_STOPIF(capacity == 0, return 0);
 
-						#undef _24BIT_STR
-					} break;
+	isize copied;
 
-					default: SI_PANIC_MSG("Invalid color type. Most likely a non-color value was given.");
-				}
-			} break;
+#if SI_SYSTEM_IS_WINDOWS
+	if (path.len > 260 && si_pathIsAbsolute(path) && capacity > 4) {
+		out[0] = '\\';
+		out[1] = '\\';
+		out[2] = '?';
+		out[3] = '\\';
 
-			default: {
-				u8 str[5] = {'%'};
-				si_memcopy(&str[1], fmtPtr - xLen, xLen);
-				info.str = SI_STR_LEN(str, 1 + xLen);
-				si__printStrCpy(&info);
-			}
-		}
+		si_stringToOsStrEx(path, SI_ARR_LEN(&out[4], capacity - 4), &copied);
+		return copied + 4;
 	}
+#endif
 
-	return SI_STR_LEN(info.data, info.index);
+	si_stringToOsStrEx(path, SI_ARR_LEN(out, capacity), &copied);
+	return copied;
 }
 
-#undef SI_CHECK_AFTERPOINT_INT
-#undef SI_SET_FMT_PTR
-
+inline
+siOsString_2x si_pathToOSMul(siString first, siString second, siOsChar* out, isize capacity) {
+	siOsString_2x res;
+	res.v[0] = out;
+	res.len[0] = si_pathToOS(first, out, capacity);
 
-SIDEF
-siString si_bprintfLn(siArray(u8) out, siString fmt, ...) {
-	va_list va;
-	va_start(va, fmt);
-	siString res = si_bprintfLnVa(out, fmt, va);
-	va_end(va);
+	res.v[1] = &out[res.len[0]];
+	res.len[1] = si_pathToOS(second, res.v[1], capacity - res.len[0]);
 
 	return res;
 }
+
+
 SIDEF
-siString si_bprintfLnVa(siArray(u8) out, siString fmt, va_list va) {
-	siString str = si_bprintfVa(out, fmt, va);
-	if (out.len != 0) {
-		si_arraySet(out, str.len, "\n");
-		str.len += 1;
-	}
+siTime si_pathLastWriteTime(siString path) {
+	siOsChar stack[SI_PATH_MAX];
+	si_pathToOS(path, stack, countof(stack));
 
-	return str;
-}
+#if SI_SYSTEM_IS_WINDOWS
+	WIN32_FILE_ATTRIBUTE_DATA data;
 
+	i32 res = GetFileAttributesExW(stack, GetFileExInfoStandard, &data);
+	if (!res) { return 0; }
 
-SIDEF
-bool si_printHas24bitColor(void) {
-	siString colorterm = si_envVarGetData(SI_STR("COLORTERM"), SI_ARR_STACK(16));
+	FILETIME time = data.ftLastWriteTime;
+	return si__win32ToSili((i64)time.dwHighDateTime << 32 | (i64)time.dwLowDateTime);
 
-	return si_stringEqual(colorterm, SI_STR("truecolor"));
-}
+#elif SI_SYSTEM_IS_UNIX
+	struct stat fs;
+	int res = stat(stack, &fs);
+	return (res == 0) ? SI_TIME_S(fs.st_mtim.tv_sec) + fs.st_mtim.tv_nsec : 0;
 
-SIDEF
-void si_printEnableColor(bool value) {
-	SI__COLOR_MODE = value & 1;
-}
+#elif SI_SYSTEM_IS_BSD
+	struct stat fs;
+	int res = stat(stack, &fs);
+	return (res == 0) ? SI_TIME_S(fs.st_mtimespec.tv_sec) + fs.st_mtimespec.tv_nsec : 0;
 
 
-inline
-void si_printMemory(const void* ptr, isize amount) {
-	si_printMemoryEx(ptr, amount, 16, 64);
+#else
+	return 0;
+
+#endif
 }
 
 SIDEF
-void si_printMemoryEx(const void* ptr, isize amount, i32 base, i32 stride) {
-	SI_ASSERT_NOT_NIL(ptr);
-	SI_ASSERT_NOT_NEG(amount);
+siString si_pathGetTmp(void) {
+#if SI_SYSTEM_IS_WINDOWS
+	static u8 buffer[256];
+	siOsChar stack[256];
 
-	siString fmt;
-	switch (base) {
-		case 16: fmt = SI_STR("%02X%c"); break;
-		default: SI_PANIC();
-	}
+	u32 len = GetTempPathW(countof(stack), stack);
+	SI_ASSERT(len != 0); /* NOTE(EimaMei): This musn't fail. */
 
-	const u8* buf = (const u8*)ptr;
-	for_range (i, 0, amount) {
-		si_printfStr(fmt, buf[i], ((i + 1) % stride == 0) ? '\n' : ' ');
-	}
-	si_print("\n");
-}
+	return si_utf16ToUtf8Str(SI_ARR_LEN(stack, len), SI_ARR_LEN(buffer, countof(buffer)));
 
-siNoreturn SIDEF
-void si_panic(siString strCondition, siCallerLoc call, siString strMessage, ...) {
-	va_list va;
-	va_start(va, strMessage);
-	si_panicVa(strCondition, call, strMessage, va);
-}
+#else
+	return SI_STR("/tmp");
 
-void si_panicVa(siString strCondition, siCallerLoc call, siString strMessage, va_list va) {
-	siPrintColor red = si_printColor3bitEx(siPrintColor3bit_Red, true, false);
+#endif
+}
 
-	si_fprintf(
-		si_stderr,
-		SI_STR("%CAssertion \"%s\" at \"%L\"%C%s"),
-		red, strCondition, call, (strMessage.len != 0) ? SI_STR(": ") : SI_STR("\n")
-	);
 
-	if (strMessage.len != 0) {
-		si_fprintfLnVa(si_stderr, strMessage, va);
-	}
-	va_end(va);
+inline
+siString si_pathReadContents(siString path, siAllocator alloc) {
+	siFile file = si_fileOpen(path);
+	siString res = si_fileReadContents(file, alloc);
+	si_fileClose(&file);
 
-	SI_DEBUG_TRAP();
+	return res;
 }
+inline
+siString si_pathReadContentsBuf(siString path, siArray(u8) out) {
+	siFile file = si_fileOpen(path);
+	siString res = si_fileReadContentsBuf(file, out);
+	si_fileClose(&file);
 
-#endif /* SI_IMPLEMENTATION_PRINT */
-
-#ifdef SI_IMPLEMENTATION_MATH
+	return res;
+}
 
-SI_MATH_FUNC_DECLARE_2X       (min,     inline, { return (a < b) ? a : b;  })
-SI_MATH_FUNC_DECLARE_2X       (max,     inline, { return (a > b) ? a : b;  })
-SI_MATH_FUNC_DECLARE_3X_bool   (between, inline, { return b <= a && a <= c; })
+static bool SI_STD_FILE_SET = false;
+static siFile SI_STD_FILE_ARR[siStdFile_Count];
 
-#undef SI_MATH_FUNC_DECLARE_2X
-#undef SI_MATH_FUNC_DECLARE_3X_bool
+SIDEF
+siFile* si_fileGetStdFile(siStdFile type) {
+	SI_ASSERT_MSG(si_between(i32, type, siStdFile_Input, siStdFile_Error), "Invalid standard file type.");
 
-inline i8 si__abs_i8(i8 a)    { return a < 0 ?  (i8)-a : (i8)a; }
-inline i16 si__abs_i16(i16 a) { return a < 0 ? (i16)-a : (i16)a; }
-inline i32 si__abs_i32(i32 a) { return a < 0 ? -a : a; }
-inline i64 si__abs_i64(i64 a) { return a < 0 ? -a : a; }
-inline isize si__abs_isize(isize a) { return a < 0 ? -a : a; }
-inline f32 si__abs_f32(f32 a) { return a < 0 ? -a : a; }
-inline f64 si__abs_f64(f64 a) { return a < 0 ? -a : a; }
+	#define SET_STD_FILE(index, type) SI_STD_FILE_ARR[index].handle = type
 
-inline f64 si__round_f64(f64 x) { return (x >= 0.0f) ? si_floor(f64, x + 0.5f) : si_ceil(f64, x - 0.5f); }
-inline f32 si__round_f32(f32 x) { return (x >= 0.0f) ? si_floor(f32, x + 0.5f) : si_ceil(f32, x - 0.5f); }
+	if (!SI_STD_FILE_SET) {
+		#if SI_SYSTEM_IS_WINDOWS
+			SET_STD_FILE(0, (isize)GetStdHandle(STD_INPUT_HANDLE));
+			SET_STD_FILE(1, (isize)GetStdHandle(STD_OUTPUT_HANDLE));
+			SET_STD_FILE(2, (isize)GetStdHandle(STD_ERROR_HANDLE));
 
-inline f32 si__floor_f32(f32 a) { return (f32)((a >= 0.0f) ? (i64)a : (i64)(a - 0.9999999999999999f)); }
-inline f64 si__floor_f64(f64 a) { return (f64)((a >= 0.0) ? (i64)a : (i64)(a - 0.9999999999999999)); }
+			if (IsValidCodePage(CP_UTF8)) {
+				SetConsoleOutputCP(CP_UTF8);
+			}
 
-inline f32 si__ceil_f32(f32 a) { return (f32)((a < 0) ? (i64)a : (i64)a + 1); }
-inline f64 si__ceil_f64(f64 a) { return (f64)((a < 0) ? (i64)a : (i64)a + 1); }
+			#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+				#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+			#endif
 
-inline
-i32 si_float32IsInf(f32 num) {
-	union { f32 f; u32 n; } check;
-	check.f = num;
+			for_range (i, 1, 2) {
+				DWORD mode;
+				GetConsoleMode((HANDLE)SI_STD_FILE_ARR[i].handle, &mode);
+				mode |= ENABLE_PROCESSED_OUTPUT | ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+				SetConsoleMode((HANDLE)SI_STD_FILE_ARR[i].handle, mode);
+			}
+		#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN
+			SET_STD_FILE(0, 0);
+			SET_STD_FILE(1, 1);
+			SET_STD_FILE(2, 2);
 
-	switch (check.n) {
-		case 0x7F800000: return 1;
-		case 0xFF800000: return 2;
+		#else
+			SI_PANIC();
+		#endif
+		SI_STD_FILE_SET = true;
 	}
-
-	return 0;
+	return &SI_STD_FILE_ARR[type];
+	#undef SET_STD_FILE
 }
 
-inline
-bool si_float32IsNan(f32 num) {
-	static const u32 nanV = 0x7FC00000; /* NOTE(EimaMei): Canonical NaN value for 32-bit. */
-
-	union { f32 f; u32 n; } check;
-	check.f = num;
-	check.n &= ~SI_ENDIAN_VALUE((u32)SI_BIT(31), SI_BIT(0)); /* NOTE(EimaMei): A quick way of changing the minus to plus. */
-
-	return check.n == nanV;
-}
 
 inline
-i32 si_float64IsInf(f64 num) {
-	union { f64 f; u64 n; } check;
-	check.f = num;
-
-	switch (check.n) {
-		case 0x7FF0000000000000: return 1; /* NOTE(EimaMei): Positive infinity. */
-		case 0xFFF0000000000000: return 2; /* NOTE(EimaMei): Negative infinity. */
-	}
-
-	return 0;
+siFile si_fileCreate(siString path) {
+	return si_fileOpenMode(path, siFileMode_Write | siFileMode_Plus);
 }
 
 inline
-bool si_float64IsNan(f64 num) {
-	static const u64 nanV = 0x7FF8000000000000; /* NOTE(EimaMei): Canonical NaN value for 64-bit. */
-
-	union { f64 f; u64 n; } check;
-	check.f = num;
-	check.n &= ~SI_ENDIAN_VALUE(SI_BIT(63), SI_BIT(0)); /* NOTE(EimaMei): A quick way of changing the minus to plus. */
-
-	return check.n == nanV;
+siFile si_fileOpen(siString path) {
+	return si_fileOpenMode(path, siFileMode_Read | siFileMode_Plus);
 }
+SIDEF
+siFile si_fileOpenMode(siString path, siFileMode mode) {
+	SI_ASSERT(path.len <= SI_PATH_MAX);
+	SI_ASSERT((mode & ~(u32)siFileMode_All) == 0);
 
-#endif /* SI_IMPLEMENTATION_MATH */
+	siFile res = SI_STRUCT_ZERO;
+	res.handle = -1;
 
-#ifdef SI_IMPLEMENTATION_BENCHMARK
+	/* NOTE(EimaMei): The direct and sync flags can be combined with any mode. */
+	siFileMode openMode = mode & ~(u32)(siFileMode_Direct | siFileMode_Sync);
 
-SIDEF
-void si_benchmarkLoopsAvgPrint(siString name, i64 array[20], isize len, usize range[2]) {
-	si_printf(
-		"====== BENCHMARK DATA ======\n"
-		"General:\n"
-			"\tFunction - '%s'\n"
-		"Runs:\n",
-		name
-	);
+#if SI_SYSTEM_IS_WINDOWS
+	u32 access, disposition;
+	switch (openMode) {
+		case siFileMode_Read:
+			access = GENERIC_READ;
+			disposition = OPEN_EXISTING;
+			break;
+		case siFileMode_Write:
+			access = GENERIC_WRITE;
+			disposition = CREATE_ALWAYS;
+			break;
+		case siFileMode_Append:
+			access = GENERIC_WRITE;
+			disposition = OPEN_ALWAYS;
+			break;
+		case siFileMode_Read | siFileMode_Plus:
+			access = GENERIC_READ | GENERIC_WRITE;
+			disposition = OPEN_EXISTING;
+			break;
+		case siFileMode_Write | siFileMode_Plus:
+			access = GENERIC_READ | GENERIC_WRITE;
+			disposition = CREATE_ALWAYS;
+			break;
+		case siFileMode_Append | siFileMode_Plus:
+			access = GENERIC_READ | GENERIC_WRITE;
+			disposition = OPEN_ALWAYS;
+			break;
+		default:
+			disposition = access = 0;
+			SI_PANIC_MSG("Invalid file mode.");
+	}
 
-	f64 freq = (f64)si_cpuClockSpeed() / 1000.0;
-	isize padRuns = si_numLenUint(range[1]);
+	u32 attributes = FILE_ATTRIBUTE_NORMAL;
+	if (mode & siFileMode_Direct) {
+		attributes |= FILE_FLAG_NO_BUFFERING;
+	}
+	if (mode & siFileMode_Sync) {
+		attributes |= FILE_FLAG_WRITE_THROUGH;
+	}
 
-	usize arrayI = 0, runs;
-	for (runs = range[0]; runs <= range[1]; runs *= 10) {
-		i64 cycles = array[arrayI];
-		f64 time = (f64)cycles / freq;
+	void* handle;
+	{
+		siOsChar stack[SI_PATH_MAX];
+		si_pathToOS(path, stack, countof(stack));
 
-		siTimeUnitScale unit = si_timeGetUnit((i64)time);
-		time /= (f64)unit.threshold;
-		si_printf(
-			"\t%*zu %s - %C%9.4f%C %2s (%lu cycles)\n",
-			padRuns, runs, (runs != 1) ? SI_STR("runs") : SI_STR("run "),
-			si_printColor3bit(siPrintColor3bit_Green), time, si_timeUnitStr(unit.unit), cycles
+		handle = CreateFileW(
+			stack, access, FILE_SHARE_READ | FILE_SHARE_DELETE, nil,
+			disposition, attributes, nil
 		);
+	}
+	SI_ERROR_SYS_CHECK(handle == INVALID_HANDLE_VALUE, res.error = SI_ERROR_RES; return res);
 
-		arrayI += 1;
+	if (mode & siFileMode_Append) {
+		LARGE_INTEGER offset = SI_STRUCT_ZERO;
+
+		i32 status = SetFilePointerEx(handle, offset, nil, FILE_END);
+		if (!status) {
+			CloseHandle(handle);
+			res.error = SI_ERROR_SYS();
+			return res;
+		}
 	}
+	res.handle = (isize)handle;
+	res.size = si_fileSize(res);
 
-	i64 cyclesTotal = 0;
-	for_range (i, 0, len) {
-		cyclesTotal += array[i];
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	i32 flags;
+	switch (openMode) {
+		case siFileMode_Read:
+			flags = O_RDONLY;
+			break;
+		case siFileMode_Write:
+			flags = O_WRONLY | O_CREAT | O_TRUNC;
+			break;
+		case siFileMode_Append:
+			flags = O_WRONLY | O_APPEND | O_CREAT;
+			break;
+		case siFileMode_Read | siFileMode_Plus:
+			flags = O_RDWR;
+			break;
+		case siFileMode_Write | siFileMode_Plus:
+			flags = O_RDWR | O_CREAT | O_TRUNC;
+			break;
+		case siFileMode_Append | siFileMode_Plus:
+			flags = O_RDWR | O_APPEND | O_CREAT;
+			break;
+		default:
+			SI_PANIC_MSG("Invalid file mode.");
+			flags = 0;
 	}
 
-	f64 cyclesMedian = (f64)cyclesTotal / (f64)len;
-	f64 time = cyclesMedian / freq;
+	#if defined(O_DIRECT)
+	if (mode & siFileMode_Direct) {
+		flags |= O_DIRECT;
+	}
+	#endif
+	if (mode & siFileMode_Sync) {
+		flags |= O_DSYNC;
+	}
 
-	siTimeUnitScale unit = si_timeGetUnit((i64)time);
-	time /= (f64)unit.threshold;
+	isize handle;
+	{
+		siOsChar stack[SI_PATH_MAX];
+		si_pathToOS(path, stack, countof(stack));
 
-	isize padCycles = si_numLenUint((u64)cyclesMedian);
-	si_printf(
-		"Final result:\n"
-			"\tTime average   - %C%*.4f%C %2s\n"
-			"\tCycles average - %*lu cycles\n",
-		si_printColor3bit(siPrintColor3bit_Green),
-		padCycles, time, si_timeUnitStr(unit.unit), padCycles, (u64)cyclesMedian
-	);
-}
+		handle = open(stack, flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+	}
+	SI_ERROR_SYS_CHECK(handle == -1, res.error = SI_ERROR_RES; return res);
 
-SIDEF
-void si_benchmarkLoopsAvgCmpPrint(siString names[2], i64 arrays[2][20], isize len,
-		usize range[2]) {
-	si_printf(
-		"====== BENCHMARK DATA ======\n"
-		"General:\n"
-			"\tFunction 1 - '%s'\n"
-			"\tFunction 2 - '%s'\n"
-		"Runs:\n",
-		names[0], names[1]
-	);
-	siTimeUnitScale units[2];
-	f64 freq = (f64)si_cpuClockSpeed() / 1000.0;
+	#if SI_SYSTEM_IS_APPLE
+	/* NOTE(EimaMei): MacOS doesn't have 'O_DIRECT', caching is turned off after
+	 * opening the file instead. */
+	if (mode & siFileMode_Direct) {
+		int status = fcntl((int)handle, F_NOCACHE, 1);
+		if (status == -1) {
+			close((int)handle);
+			res.error = SI_ERROR_SYS();
+			return res;
+		}
+	}
+	#endif
 
-	isize padRuns = si_numLenUint(range[1]);
-	isize padCycles[2] = {
-		si_numLenUint((u64)arrays[0][len - 1]), si_numLenUint((u64)arrays[1][len - 1])
-	};
+	res.handle = handle;
+	res.size = si_fileSize(res);
 
-	usize arrayI = 0, runs;
-	for (runs = range[0]; runs <= range[1]; runs *= 10) {
-		i64 cycles[2] = {arrays[0][arrayI], arrays[1][arrayI]};
-		f64 time[2] = {(f64)cycles[0] / freq, (f64)cycles[1] / freq};
+#endif
 
-		f64 ratio;
-		siPrintColor clr[2];
-		if (time[0] > time[1]){
-			ratio = time[0] / time[1];
-			clr[0] = si_printColor3bit(siPrintColor3bit_Red);
-			clr[1] = si_printColor3bit(siPrintColor3bit_Green);
-		}
-		else if (time[0] < time[1]) {
-			ratio = time[1] / time[0];
-			clr[0] = si_printColor3bit(siPrintColor3bit_Green);
-			clr[1] = si_printColor3bit(siPrintColor3bit_Red);
-		}
-		else {
-			ratio = 1.0;
-			clr[0] = clr[1] = si_printColor3bit(siPrintColor3bit_Yellow);
-		}
+	return res;
+}
 
-		for_range (j, 0, countof(units)) {
-			units[j] = si_timeGetUnit((i64)time[j]);
-			time[j] /= (f64)units[j].threshold;
-		}
+SIDEF
+isize si_fileSize(siFile file) {
+	SI_ASSERT_NOT_NEG(file.handle);
 
-		si_printf(
-			"\t%*zu %s - %C%9.4f%C %2s vs %C%9.4f%C %2s (%4.4f ratio, %*li vs %*li cycles)\n",
-			padRuns, runs, (runs != 1) ? SI_STR("runs") : SI_STR("run "),
-			clr[0], time[0], si_timeUnitStr(units[0].unit), clr[1], time[1], si_timeUnitStr(units[1].unit),
-			ratio, padCycles[0], cycles[0], padCycles[1], cycles[1]
-		);
+#if SI_SYSTEM_IS_WINDOWS
+	ULARGE_INTEGER res = SI_STRUCT_ZERO;
 
-		arrayI += 1;
+	BY_HANDLE_FILE_INFORMATION data;
+	if (GetFileInformationByHandle((HANDLE)file.handle, &data)) {
+		res.HighPart = data.nFileSizeHigh;
+		res.LowPart = data.nFileSizeLow;
 	}
 
-	i64 cyclesTotal[2] = {0, 0};
-	for_range (i, 0, len) {
-		for_range (j, 0, 2) {
-			cyclesTotal[j] += arrays[j][i];
-		}
-	}
+	return (ISIZE_MAX < res.QuadPart) ? ISIZE_MAX : (isize)res.QuadPart;
 
-	f64 cyclesMedian[2] = {
-		(f64)cyclesTotal[0] / (f64)len,
-		(f64)cyclesTotal[1] / (f64)len
-	};
-	f64 time[] = {cyclesMedian[0] / freq, cyclesMedian[1] / freq};
+#else
+	isize prevOffset = si_fileTell(file);
+	isize len = si_fileSeek(file, 0, siSeekWhere_End);
+	si_fileSeek(file, prevOffset, siSeekWhere_Begin);
 
-	for_range (i, 0, countof(padCycles)) {
-		padCycles[i] = si_numLenUint((u64)cyclesMedian[i]);
-	}
+	return len;
 
-	f64 ratio;
-	siPrintColor clr[2];
-	if (time[0] > time[1]){
-		ratio = time[0] / time[1];
-		clr[0] = si_printColor3bit(siPrintColor3bit_Red);
-		clr[1] = si_printColor3bit(siPrintColor3bit_Green);
-	}
-	else if (time[0] < time[1]) {
-		ratio = time[1] / time[0];
-		clr[0] = si_printColor3bit(siPrintColor3bit_Green);
-		clr[1] = si_printColor3bit(siPrintColor3bit_Red);
-	}
-	else {
-		ratio = 1.0;
-		clr[0] = clr[1] = si_printColor3bit(siPrintColor3bit_Yellow);
-	}
+#endif
+}
 
-	for_range (j, 0, countof(units)) {
-		units[j] = si_timeGetUnit((i64)time[j]);
-		time[j] /= (f64)units[j].threshold;
-	}
+inline
+void si_fileSizeUpdate(siFile* file) {
+	SI_ASSERT_NOT_NIL(file);
+	file->size = si_fileSize(*file);
+}
 
-	si_printfLn(
-		"Final result:\n"
-			"\tTime average   - %C%*.4f%C %s vs %C%*.4f%C %s (%4.4f ratio)\n"
-			"\tCycles average - %*lu cycles vs %*lu cycles",
-		clr[0], padCycles[0], time[0], si_timeUnitStr(units[0].unit),
-		clr[1], padCycles[1], time[1], si_timeUnitStr(units[1].unit),
-		ratio,
-		padCycles[0], (u64)cyclesMedian[0], padCycles[1], (u64)cyclesMedian[1]
-	);
+inline
+siArray(u8) si_fileRead(siFile file, isize len, siAllocator alloc) {
+	return si_fileReadAt(file, si_fileTell(file), len, alloc);
 }
+inline
+siArray(u8) si_fileReadAt(siFile file, isize offset, isize len, siAllocator alloc) {
+	u8* data = si_allocArrayNonZeroed(alloc, u8, len);
+	if (data == nil) { return SI_ARR_TYPE(nil, 0, u8); }
 
-void* si__benchmarkThread(void* arg) {
-	si_sleep(*(siTime*)arg);
-	return nil;
+	siResult(siArray(u8)) res = si_fileReadEx(file, offset, len, data);
+	return (res.hasValue) ? res.data.value : SI_ARR_TYPE(nil, 0, u8);
 }
 
+inline
+siArray(u8) si_fileReadBuf(siFile file, isize len, siArray(u8) out) {
+	return si_fileReadAtBuf(file, si_fileTell(file), len, out);
+}
+inline
+siArray(u8) si_fileReadAtBuf(siFile file, isize offset, isize len, siArray(u8) out) {
+	SI_ASSERT_ARR_TYPE(out, u8);
+	isize minLen = si_min(isize, out.len, len);
 
-#endif /* SI_IMPLEMENTATION_BENCHMARK */
-
-#ifdef SI_IMPLEMENTATION_SYSTEM
-/*
-*
-*
-*
-*
-*
-*
-*
-*
-*
-*
-*
-*
-*
-*
-	========================
-	| siSystem             |
-	========================
-*/
+	siResult(siArray(u8)) res = si_fileReadEx(file, offset, minLen, out.data);
+	return (res.hasValue) ? res.data.value : SI_ARR_TYPE(nil, 0, u8);
+}
 
 SIDEF
-SI_ERROR_PROC(si_systemErrorLog) {
-	siPrintColor red = si_printColor3bitEx(siPrintColor3bit_Red, true, false);
+siResult(siArray(u8)) si_fileReadEx(siFile file, isize offset, isize len, void* out) {
+	SI_ASSERT_NOT_NEG(file.handle);
+	SI_ASSERT_NOT_NEG(offset);
+	SI_ASSERT_NOT_NEG(len);
+	SI_ASSERT_NOT_NIL(out);
 
-#ifndef SI_NO_ERROR_STRUCT
-	si_fprintf(
-		si_stderr, SI_STR("%CSystem error at \"%L\"%C: %s: %s\n"),
-		red, error->location, si_systemErrorName(error->code), si_systemErrorDesc(error->code)
+	isize bytesRead;
+
+#if SI_SYSTEM_IS_WINDOWS
+	si_fileSeek(file, offset, siSeekWhere_Begin);
+
+	DWORD read;
+	i32 res = ReadFile(
+		(HANDLE)file.handle, out, (len > UINT32_MAX) ? UINT32_MAX : (u32)len,
+		&read, nil
 	);
+	SI_OPTION_SYS_CHECK(res == 0, siArray(u8));
+
+	bytesRead = read;
+
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	bytesRead = pread((int)file.handle, out, (usize)len, offset);
+	SI_OPTION_SYS_CHECK(bytesRead == -1, siArray(u8));
 
 #else
-	si_fprintf(
-		si_stderr, SI_STR("%CSystem error%C: %s: %s\n"),
-		red, si_systemErrorName(error->code), si_systemErrorDesc(error->code)
-	);
+	bytesRead = 0;
+
 #endif
 
-	return true;
-	SI_UNUSED(data);
+	return SI_OPT(siArray(u8), SI_ARR_TYPE(out, bytesRead, u8));
 }
 
 inline
-siString si_systemErrorName(siErrorSystem error) {
-	SI_ASSERT_NOT_NEG(error);
-	SI_ASSERT(error < siErrorSystem_Length);
-
-	static const siString names[siErrorSystem_Length] = {
-		SI_STRC("siErrorSystem_None"),
-
-		SI_STRC("siErrorSystem_Exists"),
-		SI_STRC("siErrorSystem_NotExists"),
-		SI_STRC("siErrorSystem_Invalid"),
-		SI_STRC("siErrorSystem_InvalidFilename"),
-		SI_STRC("siErrorSystem_Permission"),
-		SI_STRC("siErrorSystem_NoMemory"),
-		SI_STRC("siErrorSystem_TruncationFail"),
-		SI_STRC("siErrorSystem_Unavailable"),
-		SI_STRC("siErrorSystem_Deadlock"),
+siString si_fileReadContents(siFile file, siAllocator alloc) {
+	siArray(u8) res = si_fileReadContentsArr(file, alloc);
+	return SI_STR_LEN(res.data, res.len);
+}
+inline
+siString si_fileReadContentsBuf(siFile file, siArray(u8) out) {
+	siArray(u8) res = si_fileReadContentsArrBuf(file, out);
+	return SI_STR_LEN(res.data, res.len);
+}
 
-		SI_STRC("siErrorSystem_Generic"),
-	};
+SIDEF
+siArray(u8) si_fileReadContentsArr(siFile file, siAllocator alloc) {
+	isize oldOffset = si_fileTell(file);
+	siArray(u8) res = si_fileReadAt(file, 0, file.size, alloc);
+	si_fileSeek(file, oldOffset, siSeekWhere_Begin);
 
-	return names[error];
+	return res;
 }
+SIDEF
+siArray(u8) si_fileReadContentsArrBuf(siFile file, siArray(u8) out) {
+	isize oldOffset = si_fileTell(file);
+	siArray(u8) res = si_fileReadAtBuf(file, 0, file.size, out);
+	si_fileSeek(file, oldOffset, siSeekWhere_Begin);
 
-inline
-siString si_systemErrorDesc(siErrorSystem error) {
-	SI_ASSERT_NOT_NEG(error);
-	SI_ASSERT(error < siErrorSystem_Length);
-
-	static const siString descriptions[siErrorSystem_Length] = {
-		SI_STRC("No error has been encountered."),
+	return res;
+}
 
-		SI_STRC("File or directory already exists."),
-		SI_STRC("File or directory doesn't exist."),
-		SI_STRC("Provided value is invalid."),
-		SI_STRC("Invalid filename."),
-		SI_STRC("User doesn't have sufficient permissions."),
-		SI_STRC("Out of memory."),
-		SI_STRC("Failed to truncate the file."),
-		SI_STRC("System has insufficient resources to complete the action."),
-		SI_STRC("A thread deadlock occurred."),
+SIDEF
+siArray(siString) si_fileReadlines(siFile file, siAllocator alloc) {
+	siString str = si_fileReadContents(file, alloc);
+	siArray(siString) res = si_stringSplitLines(str, alloc);
+	si_free(alloc, (void*)str.data);
 
-		SI_STRC("An unspecified, platform-specific error occurred."),
-	};
-	return descriptions[error];
+	return res;
 }
 
-#ifdef SI_SYSTEM_IS_WASM
+SIDEF
+siResult(isize) si_fileReadChunks(siFile file, isize offset, siArray(u8) buffer,
+		siFileChunkProc* proc, void* userData) {
+	SI_ASSERT_NOT_NEG(offset);
+	SI_ASSERT_ARR_TYPE(buffer, u8);
+	SI_ASSERT(buffer.len > 0);
+	SI_ASSERT_NOT_NIL(proc);
 
-/* TODO(EimaMei): Add mutexes to this. */
-__wasi_errno_t si__wasmError;
+	isize total = 0;
+	while (true) {
+		siResult(siArray(u8)) res = si_fileReadEx(file, offset + total, buffer.len, buffer.data);
+		SI_STOPIF(!res.hasValue, return SI_OPT_ERR(isize, res.data.error));
+		SI_STOPIF(res.data.value.len == 0, break);
 
-siIntern
-__wasi_errno_t si__wasmGetLastError(void) {
-	return si__wasmError;
+		proc(res.data.value, userData);
+		total += res.data.value.len;
+	}
+
+	return SI_OPT(isize, total);
 }
 
+#ifndef SI_NO_HASHING
 siIntern
-void si__wasmSetLastError(__wasi_errno_t error) {
-	si__wasmError = error;
+SI_FILE_CHUNK_PROC(si__fileHashChunk) {
+	si_wyhashUpdate((siWyhashState*)userData, chunk.data, chunk.len);
 }
 
-#endif
-
 SIDEF
-siErrorSystem si_systemGetError(void) {
-#if SI_SYSTEM_IS_WINDOWS
-	switch (GetLastError()) {
-		case ERROR_ACCESS_DENIED: return siErrorSystem_Permission;
-
-		case ERROR_NO_MORE_FILES:
-		case ERROR_SUCCESS:
-			return siErrorSystem_None;
+siResult(u64) si_fileHash64(siFile file, siArray(u8) buffer) {
+	siWyhashState state = si_wyhashInit();
 
-		case ERROR_ALREADY_EXISTS:
-		case ERROR_FILE_EXISTS:
-			return siErrorSystem_Exists;
+	siResult(isize) res = si_fileReadChunks(file, 0, buffer, si__fileHashChunk, &state);
+	SI_STOPIF(!res.hasValue, return SI_OPT_ERR(u64, res.data.error));
 
-		case ERROR_INVALID_NAME:
-		case ERROR_BAD_PATHNAME:
-			return siErrorSystem_InvalidFilename;
+	return SI_OPT(u64, si_wyhash64Final(state));
+}
+#endif
 
-		case ERROR_BAD_FORMAT:
-		case ERROR_INVALID_DATA:
-		case ERROR_DIRECTORY:
-		case ERROR_INVALID_ADDRESS:
-			return siErrorSystem_Invalid;
+inline
+isize si_fileWrite(siFile* file, siArray(u8) data) {
+	return si_fileWriteAt(file, data, si_fileTell(*file));
+}
 
-		case ERROR_PATH_NOT_FOUND:
-		case ERROR_FILE_NOT_FOUND:
-			return siErrorSystem_NotExists;
+SIDEF
+isize si_fileWriteAt(siFile* file, siArray(u8) content, isize offset) {
+	SI_ASSERT_NOT_NIL(file);
+	SI_ASSERT_NOT_NEG(file->handle);
+	SI_ASSERT_ARR_TYPE(content, u8);
 
-		case ERROR_OUTOFMEMORY:
-		case ERROR_NOT_ENOUGH_MEMORY:
-			return siErrorSystem_NoMemory;
-	}
+	isize bytesWritten;
+#if SI_SYSTEM_IS_WINDOWS
+	si_fileSeek(*file, offset, siSeekWhere_Begin);
 
-	return siErrorSystem_Generic;
+	DWORD count;
+	i32 res = WriteFile(
+		(HANDLE)file->handle, content.data, (content.len > UINT32_MAX) ? UINT32_MAX : (u32)content.len,
+		&count, nil
+	);
+	SI_ERROR_SYS_CHECK(res == 0, file->error = SI_ERROR_RES; return -1);
+	bytesWritten = count;
 
 #elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	switch (errno) {
-		case 0:       return siErrorSystem_None;
-		case EEXIST:  return siErrorSystem_Exists;
-		case EINVAL:  return siErrorSystem_Invalid;
-		case ENOMEM:  return siErrorSystem_NoMemory;
-		case EAGAIN:  return siErrorSystem_Unavailable;
-		case EDEADLK: return siErrorSystem_Deadlock;
-		case ENOENT:  return siErrorSystem_NotExists;
+	isize curOffset = si_fileSeek(*file, 0, siSeekWhere_Current);
+	bytesWritten = (curOffset == offset)
+		? write((int)file->handle, content.data, (usize)content.len)
+		: pwrite((int)file->handle, content.data, (usize)content.len, offset);
+	SI_ERROR_SYS_CHECK(bytesWritten == -1, file->error = SI_ERROR_RES; return -1);
 
-		case EISDIR:
-		case ENAMETOOLONG:
-			return siErrorSystem_InvalidFilename;
+#elif SI_SYSTEM_IS_WASM
+	struct __wasi_ciovec_t iov;
+	iov.buf = content.data;
+	iov.buf_len = (__wasi_size_t)content.len;
 
-		case EPERM:
-		case EACCES:
-			return siErrorSystem_Permission;
-	}
+	__wasi_size_t count;
+	__wasi_errno_t err = __wasi_fd_write((__wasi_fd_t)file->handle, &iov, 1, &count);
+	si__wasmSetLastError(err);
+	SI_ERROR_SYS_CHECK(err != 0, file->error = SI_ERROR_RES; return -1);
 
-	return siErrorSystem_Generic;
 
-#elif SI_SYSTEM_IS_WASM
-	switch (si__wasmGetLastError()) {
-		case __WASI_ERRNO_SUCCESS: return siErrorSystem_None;
-		case __WASI_ERRNO_EXIST: return siErrorSystem_Exists;
-		case __WASI_ERRNO_NOENT: return siErrorSystem_NotExists;
-		case __WASI_ERRNO_NOBUFS: return siErrorSystem_NoMemory;
-		case __WASI_ERRNO_DEADLK: return siErrorSystem_Deadlock;
+	bytesWritten = (isize)count;
+
+#else
+	bytesWritten = 0;
+
+#endif
+
+	/* TODO(EimaMei): Have a test on this. */
+	file->size += (offset - file->size) + bytesWritten;
+	return bytesWritten;
+}
 
-		case __WASI_ERRNO_INVAL:
-		case __WASI_ERRNO_BADF:
-			return siErrorSystem_Invalid;
+inline
+isize si_fileWriteByte(siFile* file, u8 byte) {
+	return si_fileWritePtr(file, &byte, 1);
+}
 
-		case __WASI_ERRNO_ISDIR:
-		case __WASI_ERRNO_NAMETOOLONG:
-			return siErrorSystem_InvalidFilename;
 
-		case __WASI_ERRNO_PERM:
-		case __WASI_ERRNO_ACCES:
-			return siErrorSystem_Permission;
+inline
+isize si_fileWritePtr(siFile* file, const void* ptr, isize len) {
+	return si_fileWrite(file, SI_ARR_LEN((u8*)ptr, len));
 
-		case __WASI_ERRNO_AGAIN:
-		case __WASI_ERRNO_BUSY:
-			return siErrorSystem_Unavailable;
-	}
+}
 
-	return siErrorSystem_Generic;
+inline
+isize si_fileWriteStr(siFile* file, siString str) {
+	return si_fileWritePtr(file, str.data, str.len);
+}
 
-#else
-	return 0;
-#endif
+#if SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+/* Transfers every buffer with 'readv'/'writev' (or 'preadv'/'pwritev' if the
+ * offset isn't negative), resuming from where a partial transfer left off.
+ * Returns the amount of transferred bytes or -1 on failure. */
+siIntern
+isize si__fileVec(isize handle, siArray(siArray(u8)) buffers, isize offset, bool isWrite) {
+	const siArray(u8)* arrays = (const siArray(u8)*)buffers.data;
+	struct iovec iov[64];
+
+	isize index = 0,
+		  partial = 0,
+		  total = 0;
+	while (index < buffers.len) {
+		isize count = 0;
+		for (isize i = index; i < buffers.len && count < countof(iov); i += 1) {
+			isize skip = (i == index) ? partial : 0;
+			SI_STOPIF(arrays[i].len == skip, continue);
+
+			iov[count].iov_base = (u8*)arrays[i].data + skip;
+			iov[count].iov_len = (usize)(arrays[i].len - skip);
+			count += 1;
+		}
+		SI_STOPIF(count == 0, break);
 
-}
+		isize res;
+		if (isWrite) {
+			res = (offset < 0)
+				? writev((int)handle, iov, (int)count)
+				: pwritev((int)handle, iov, (int)count, offset + total);
+		}
+		else {
+			res = (offset < 0)
+				? readv((int)handle, iov, (int)count)
+				: preadv((int)handle, iov, (int)count, offset + total);
+		}
 
-siNoreturn inline
-void si_exit(i32 code) {
-#if SI_SYSTEM_IS_WINDOWS
-	ExitProcess((u32)code);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	exit(code);
-#elif SI_SYSTEM_IS_WASM
-	__wasi_proc_exit((u32)code);
-#endif
+		if (res == -1) {
+			SI_STOPIF(errno == EINTR, continue);
+			return -1;
+		}
+		/* NOTE(EimaMei): Reached the end of the file. */
+		SI_STOPIF(res == 0, break);
+
+		total += res;
+		while (index < buffers.len && res >= arrays[index].len - partial) {
+			res -= arrays[index].len - partial;
+			partial = 0;
+			index += 1;
+		}
+		partial += res;
+	}
+
+	return total;
 }
+#endif
 
+inline
+isize si_fileWriteVec(siFile* file, siArray(siArray(u8)) buffers) {
+#if SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	SI_ASSERT_NOT_NIL(file);
+	SI_ASSERT_ARR_TYPE(buffers, siArrayAny);
 
-SIDEF
-bool si_envVarSet(siString name, siString value) {
-	siOsChar stack[SI_PATH_MAX];
-	siOsString_2x strs = si_pathToOSMul(name, value, stack, countof(stack));
-	siOsString* paths = strs.v;
+	isize bytesWritten = si__fileVec(file->handle, buffers, -1, true);
+	SI_ERROR_SYS_CHECK(bytesWritten == -1, file->error = SI_ERROR_RES; return -1);
 
+	file->size = si_max(isize, file->size, si_fileTell(*file));
+	return bytesWritten;
 
-#if SI_SYSTEM_IS_WINDOWS
-	return SetEnvironmentVariableW(paths[0], paths[1]) != 0;
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	return setenv(paths[0], paths[1], 1) == 0;
 #else
-	return false;
-	SI_UNUSED(paths);
+	return si_fileWriteVecAt(file, buffers, si_fileTell(*file));
+
 #endif
 }
 
 SIDEF
-bool si_envVarUnset(siString name) {
-	siOsChar path[SI_PATH_MAX];
-	si_pathToOS(name, path, countof(path));
+isize si_fileWriteVecAt(siFile* file, siArray(siArray(u8)) buffers, isize offset) {
+	SI_ASSERT_NOT_NIL(file);
+	SI_ASSERT_NOT_NEG(file->handle);
+	SI_ASSERT_NOT_NEG(offset);
+	SI_ASSERT_ARR_TYPE(buffers, siArrayAny);
+
+	isize bytesWritten = 0;
+#if SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	bytesWritten = si__fileVec(file->handle, buffers, offset, true);
+	SI_ERROR_SYS_CHECK(bytesWritten == -1, file->error = SI_ERROR_RES; return -1);
 
-#if SI_SYSTEM_IS_WINDOWS
-	return SetEnvironmentVariableW(path, nil) != 0;
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	return unsetenv(path) == 0;
 #else
-	return false;
+	/* NOTE(EimaMei): Every buffer gets written separately, since the other
+	 * systems either lack vectored I/O for regular files or have unusual
+	 * restrictions on it (e.g. 'WriteFileGather'). */
+	siArray(u8) buffer;
+	for_eachArr (buffer, buffers) {
+		isize done = 0;
+		while (done < buffer.len) {
+			isize res = si_fileWriteAt(file, si_sliceFrom(buffer, done), offset + bytesWritten);
+			SI_STOPIF(res == -1, return -1);
+			SI_STOPIF(res == 0, return bytesWritten);
+
+			done += res;
+			bytesWritten += res;
+		}
+	}
+
 #endif
-}
 
+	file->size = si_max(isize, file->size, offset + bytesWritten);
+	return bytesWritten;
+}
 
 SIDEF
-isize si_envVarGetLength(siString name) {
-	siOsChar path[SI_PATH_MAX * 2];
-	isize pathLen = si_pathToOS(name, path, countof(path));
+siResult(isize) si_fileReadVec(siFile file, isize offset, siArray(siArray(u8)) buffers) {
+	SI_ASSERT_NOT_NEG(file.handle);
+	SI_ASSERT_NOT_NEG(offset);
+	SI_ASSERT_ARR_TYPE(buffers, siArrayAny);
 
-#if SI_SYSTEM_IS_WINDOWS
-	u32 len = GetEnvironmentVariableW(path, &path[pathLen], (u32)(countof(path) - pathLen));
-	SI_STOPIF(len == 0, return 0);
+	isize bytesRead = 0;
+#if SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	bytesRead = si__fileVec(file.handle, buffers, offset, false);
+	SI_OPTION_SYS_CHECK(bytesRead == -1, isize);
 
-	return si_utf16ToUtf8StrLen(SI_ARR_LEN(&path[pathLen], len));
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	return si_cstrLen(getenv(path));
-	SI_UNUSED(pathLen);
 #else
-	return -1;
-	SI_UNUSED(pathLen);
+	siArray(u8) buffer;
+	for_eachArr (buffer, buffers) {
+		isize done = 0;
+		while (done < buffer.len) {
+			siResult(siArray(u8)) res = si_fileReadEx(
+				file, offset + bytesRead, buffer.len - done, (u8*)buffer.data + done
+			);
+			SI_STOPIF(!res.hasValue, return SI_OPT_ERR(isize, res.data.error));
+			SI_STOPIF(res.data.value.len == 0, return SI_OPT(isize, bytesRead));
+
+			done += res.data.value.len;
+			bytesRead += res.data.value.len;
+		}
+	}
+
 #endif
+
+	return SI_OPT(isize, bytesRead);
 }
 
-SIDEF
-siString si_envVarGetData(siString name, siArray(u8) out) {
-	SI_ASSERT(out.typeSize == sizeof(u8));
 
-	siOsChar path[SI_PATH_MAX * 2];
-	isize pathLen = si_pathToOS(name, path, countof(path));
+
+inline
+isize si_fileTell(siFile file) {
+	return si_fileSeek(file, 0, siSeekWhere_Current);
+}
+
+inline
+isize si_fileSeek(siFile file, isize offset, siSeekWhere method) {
+	SI_ASSERT_NOT_NEG(file.handle);
 
 #if SI_SYSTEM_IS_WINDOWS
-	u32 len = GetEnvironmentVariableW(path, &path[pathLen], (u32)(countof(path) - pathLen));
-	SI_STOPIF(len == 0, return SI_STR_NIL);
+	LARGE_INTEGER res;
+	res.QuadPart = offset;
 
-	return si_utf16ToUtf8Str(SI_ARR_LEN(&path[pathLen], len), out);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	char* data = getenv(path);
-	SI_STOPIF(data == nil, return SI_STR_NIL);
+	SetFilePointerEx((HANDLE)file.handle, res, &res, (u32)method);
+	return (ISIZE_MAX < res.QuadPart)
+		? ISIZE_MAX
+		: (isize)res.QuadPart;
 
-	isize len = si_memcopyStr_s(out, SI_CSTR(data));
+#elif SI_SYSTEM_IS_APPLE
+	return lseek((int)file.handle, offset, method);
 
-	return SI_STR_LEN(out.data, len);
-	SI_UNUSED(pathLen);
+#elif SI_SYSTEM_IS_UNIX
+	return lseek64((int)file.handle, offset, method);
 
 #else
-	return SI_STR_NIL;
-	SI_UNUSED(pathLen);
+	return 0;
+	SI_UNUSED(offset); SI_UNUSED(method);
+
 #endif
 }
 
-SIDEF
-siWindowsVersion si_windowsGetVersion(void) {
-#if SI_SYSTEM_IS_WINDOWS
-	OSVERSIONINFOEXW info = SI_STRUCT_ZERO;
-	{
-		siDllHandle ntdll = si_dllLoad(SI_STR("ntdll.dll"));
-
-		typedef LONG(WINAPI* siDllProcType(RtlGetVersion))(POSVERSIONINFOEXW);
-		siDllProcType(RtlGetVersion) _RtlGetVersion = si_dllProcAddressFunc(ntdll, RtlGetVersion);
+inline
+bool si_fileSeekFront(siFile file) {
+	return si_fileSeek(file, 0, siSeekWhere_Begin) != 0;
+}
 
-		info.dwOSVersionInfoSize = si_sizeof(OSVERSIONINFOEXW);
-		_RtlGetVersion(&info);
-		si_dllUnload(ntdll);
-	}
+inline
+bool si_fileSeekBack(siFile file) {
+	return si_fileSeek(file, 0, siSeekWhere_End) != 0;
+}
+SIDEF
+bool si_fileTruncate(siFile* file, isize size) {
+	SI_ASSERT_NOT_NIL(file);
+	SI_ASSERT_NOT_NEG(file->handle);
+	SI_ASSERT_NOT_NEG(size);
 
-	/* Windows 10 and 11. */
-	if (info.dwMajorVersion == 10 && info.dwMinorVersion == 0) {
-		return (info.dwBuildNumber >= 22000) ? siWindowsVersion_11 : siWindowsVersion_10;
-	}
-	/* Windows 8.1, 8, 7 and Vista. */
-	else if (info.dwMajorVersion == 6) {
-		return siWindowsVersion_Vista + (i32)info.dwMinorVersion;
-	}
+#if SI_SYSTEM_IS_WINDOWS
+	isize prevOffset = si_fileTell(*file);
+	isize res = si_fileSeek(*file, size, siSeekWhere_Begin);
+	SI_STOPIF(res == 0, return false);
 
-	return (info.dwMajorVersion == 5 && (info.dwMinorVersion == 1 || info.dwMinorVersion == 2))
-		? siWindowsVersion_XP
-		: 0;
+	res = SetEndOfFile((HANDLE)file->handle);
+	SI_ERROR_SYS_CHECK(res == 0, file->error = SI_ERROR_SYS_EX(siErrorSystem_TruncationFail); return false);
 
+	si_fileSeek(*file, prevOffset, siSeekWhere_Begin);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	int res = ftruncate((int)file->handle, size);
+	SI_ERROR_SYS_CHECK(res == -1, file->error = SI_ERROR_SYS_EX(siErrorSystem_TruncationFail); return false);
 #else
-	return -1;
+	return false;
+
 #endif
+
+	return true;
 }
 
 SIDEF
-bool si_unixIsWayland(void) {
-#if SI_SYSTEM_IS_UNIX
-	static b8 isWayland = UINT8_MAX;
-	SI_STOPIF(isWayland != UINT8_MAX, return (bool)isWayland);
+bool si_fileSync(siFile* file, bool dataOnly) {
+	SI_ASSERT_NOT_NIL(file);
+	SI_ASSERT_NOT_NEG(file->handle);
 
-	siString res = si_envVarGetData(SI_STR("WAYLAND_DISPLAY"), SI_ARR_STACK(1));
-	isWayland = (res.data != nil);
+#if SI_SYSTEM_IS_WINDOWS
+	SI_UNUSED(dataOnly);
+	i32 res = FlushFileBuffers((HANDLE)file->handle);
+	SI_ERROR_SYS_CHECK(res == 0, file->error = SI_ERROR_RES; return false);
 
-	return isWayland;
-#else
-	return false;
-#endif
-}
+#elif SI_SYSTEM_IS_APPLE
+	SI_UNUSED(dataOnly);
+	int res = fsync((int)file->handle);
+	SI_ERROR_SYS_CHECK(res == -1, file->error = SI_ERROR_RES; return false);
+
+#elif SI_SYSTEM_IS_UNIX
+	int res = dataOnly ? fdatasync((int)file->handle) : fsync((int)file->handle);
+	SI_ERROR_SYS_CHECK(res == -1, file->error = SI_ERROR_RES; return false);
+
+#elif SI_SYSTEM_IS_WASM
+	__wasi_errno_t err = dataOnly
+		? __wasi_fd_datasync((__wasi_fd_t)file->handle)
+		: __wasi_fd_sync((__wasi_fd_t)file->handle);
+	si__wasmSetLastError(err);
+	SI_ERROR_SYS_CHECK(err != 0, file->error = SI_ERROR_RES; return false);
 
-inline
-bool si_unixIsX11(void) {
-#if SI_SYSTEM_IS_UNIX
-	return !si_unixIsWayland();
 #else
+	SI_UNUSED(dataOnly);
 	return false;
+
 #endif
+
+	return true;
 }
 
 SIDEF
-siUnixDE si_unixGetDE(void) {
-#if SI_SYSTEM_IS_UNIX
-	static siUnixDE de = -1;
-	SI_STOPIF(de != -1, return de);
+siTime si_fileLastWriteTime(siFile file) {
+#if SI_SYSTEM_IS_WINDOWS
+	BY_HANDLE_FILE_INFORMATION data;
 
-	siString res = si_envVarGetData(SI_STR("XDG_CURRENT_DESKTOP"), SI_ARR_STACK(16));
-	SI_STOPIF(res.data == nil, return 0);
+	i32 res = GetFileInformationByHandle((HANDLE)file.handle, &data);
+	if (!res) { return 0; }
 
-	siArena arena = si_arenaMakePtr(si_stackAlloc(SI_KILO(1)), SI_DEFAULT_MEMORY_ALIGNMENT);
-	siMap(i32) map = si_mapMake(
-		si_allocatorArena(&arena), i32,
-		{SI_STR("KDE"), siUnixDE_KDE}, {SI_STR("GNOME"), siUnixDE_GNOME},
-		{SI_STR("XFCE"), siUnixDE_Xfce}, {SI_STR("LXQt"), siUnixDE_LXQt},
-		{SI_STR("LXDE"), siUnixDE_LXDE}, {SI_STR("MATE"), siUnixDE_MATE},
-		{SI_STR("Cinnamon"), siUnixDE_Cinnamon}
-	);
+	FILETIME time = data.ftLastWriteTime;
+	return si__win32ToSili((i64)time.dwHighDateTime << 32 | (i64)time.dwLowDateTime);
 
-	i32* result = (i32*)si_mapGet(map, res);
-	de = result ? *result : siUnixDE_Custom;
+#elif SI_SYSTEM_IS_UNIX
+	struct stat fs;
+	int res = fstat((int)file.handle, &fs);
+	return (res == 0) ? SI_TIME_S(fs.st_mtim.tv_sec) + fs.st_mtim.tv_nsec : 0;
 
-	return de;
-#else
-	return -1;
-#endif
+#elif SI_SYSTEM_IS_BSD
+	struct stat fs;
+	int res = fstat((int)file.handle, &fs);
+	return (res == 0) ? SI_TIME_S(fs.st_mtimespec.tv_sec) + fs.st_mtimespec.tv_nsec : 0;
 
-}
+#else
+	return 0;
+	SI_UNUSED(file);
 
-#endif /* SI_IMPLEMENTATION_SYSTEM */
+#endif
 
-#ifdef SI_IMPLEMENTATION_VIRTUAL_MEMORY
 
-SIDEF
-siResult(siVirtualMemory) si_vmAlloc(void* address, isize size) {
-	SI_ASSERT_NOT_NEG(size);
+}
 
-	siVirtualMemory vm;
-	vm.size = size;
+inline
+void si_fileClose(siFile* file) {
+	SI_ASSERT_NOT_NIL(file);
+	SI_ASSERT_NOT_NEG(file->handle);
 
 #if SI_SYSTEM_IS_WINDOWS
-	vm.data = VirtualAlloc(address, (usize)size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
-	SI_OPTION_SYS_CHECK(vm.data == nil, siVirtualMemory);
+	CloseHandle((HANDLE)file->handle);
 #elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	vm.data = mmap(address, (usize)size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
-	SI_OPTION_SYS_CHECK(vm.data == MAP_FAILED, siVirtualMemory);
-#else
-	vm.data = nil;
-	SI_UNUSED(address);
+	close((int)file->handle);
 #endif
-
-	return SI_OPT(siVirtualMemory, vm);
 }
 
-SIDEF
-siError si_vmFree(siVirtualMemory vm) {
-	SI_ASSERT_NOT_NIL(vm.data);
-
-#if SI_SYSTEM_IS_WINDOWS
-	MEMORY_BASIC_INFORMATION info;
-	while (vm.size > 0) {
-		isize res = (isize)VirtualQuery(vm.data, &info, si_sizeof(info));
-		SI_ERROR_SYS_CHECK_RET(res == 0);
-
-		if (info.BaseAddress != vm.data || info.AllocationBase != vm.data ||
-			info.State != MEM_COMMIT || info.RegionSize > (usize)vm.size) {
-			break;
-		}
-
-		res = VirtualFree(vm.data, 0, MEM_RELEASE);
-		SI_ERROR_SYS_CHECK_RET(res == 0);
+#if SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+/* Converts a 'd_type' value into an IO type, 0 meaning that the type is unknown. */
+force_inline
+siIoType si__directoryType(u8 type) {
+	static const u8 IO_types[15] = {
+		0,
+		siIoType_Fifo,
+		siIoType_Device, 0,
+		siIoType_Directory, 0,
+		siIoType_Block, 0,
+		siIoType_File, 0,
+		siIoType_Link, 0,
+		siIoType_Socket, 0, 0
+	};
+	return (type < countof(IO_types)) ? IO_types[type] : 0;
+}
 
-		vm.data = si_pointerAdd(vm.data, (isize)info.RegionSize);
-		vm.size -= (isize)info.RegionSize;
+/* NOTE(EimaMei): Some file systems (e.g. older XFS) don't fill out 'd_type', in
+ * which case the type has to be queried separately. */
+siIntern
+siIoType si__directoryStatType(int dirFd, const char* name) {
+	struct stat info;
+	SI_STOPIF(fstatat(dirFd, name, &info, AT_SYMLINK_NOFOLLOW) != 0, return 0);
+
+	switch (info.st_mode & S_IFMT) {
+		case S_IFREG:  return siIoType_File;
+		case S_IFDIR:  return siIoType_Directory;
+		case S_IFLNK:  return siIoType_Link;
+		case S_IFSOCK: return siIoType_Socket;
+		case S_IFCHR:  return siIoType_Device;
+		case S_IFBLK:  return siIoType_Block;
+		case S_IFIFO:  return siIoType_Fifo;
 	}
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	int res = munmap(vm.data, (usize)vm.size);
-	SI_ERROR_SYS_CHECK_RET(res != 0);
-#endif
 
-	return SI_ERROR_NIL;
+	return 0;
+}
+
+force_inline
+bool si__directoryIsDot(const char* name, isize len) {
+	return (len == 1 && name[0] == '.') || (len == 2 && name[0] == '.' && name[1] == '.');
 }
+#endif
 
 SIDEF
-siError si_vmDiscard(siVirtualMemory vm) {
-	SI_ASSERT_NOT_NIL(vm.data);
+siDirectory si_directoryOpen(siString path) {
+	SI_ASSERT_NOT_NIL(path.data);
+	SI_ASSERT(path.len <= SI_PATH_MAX);
 
-#if SI_SYSTEM_IS_WINDOWS
-	void* res = VirtualAlloc(vm.data, (usize)vm.size, MEM_RESET, PAGE_READWRITE);
-	SI_ERROR_SYS_CHECK_RET(res == nil);
+	siDirectory dir;
+	dir.error = SI_ERROR_NIL;
+	dir.handle = nil;
+	dir.directoryLen = path.len;
+	si_memcopyStr(dir.buffer, path);
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	int res = madvise(vm.data, (usize)vm.size, MADV_DONTNEED);
-	SI_ERROR_SYS_CHECK_RET(res != 0);
-#endif
+	if (si_stringAtBack(path) != SI_PATH_SEPARATOR) {
+		dir.buffer[dir.directoryLen] = SI_PATH_SEPARATOR;
+		dir.directoryLen += 1;
+	}
 
-	return SI_ERROR_NIL;
-}
+#if SI_SYSTEM_IS_WINDOWS
+	siOsChar stack[SI_PATH_MAX];
+	siUtf16String pathWide = si_utf8ToUtf16Str(
+		SI_STR_LEN(dir.buffer, dir.directoryLen),
+		SI_ARR_LEN(stack, countof(stack) - 2)
+	);
 
+	stack[pathWide.len + 0] = '*';
+	stack[pathWide.len + 1] = '\0';
 
-#endif /* SI_IMPLEMENTATION_VIRTUAL_MEMORY */
+	WIN32_FIND_DATAW tmp;
+	HANDLE handle = FindFirstFileW(stack, &tmp);
+	SI_ERROR_SYS_CHECK(handle == INVALID_HANDLE_VALUE, dir.error = SI_ERROR_RES; return dir);
 
-#ifdef SI_IMPLEMENTATION_IO
+	dir.handle = handle;
+	SI_DISCARD(FindNextFileW(handle, &tmp));
 
-#if SI_COMPILER_MSVC
-	#pragma comment(lib, "shell32")
-	#pragma comment(lib, "Advapi32")
-#endif
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	/* NOTE(EimaMei): We do this because opendir only takes NULL-terminated C-strings. */
+	dir.buffer[dir.directoryLen] = '\0';
+
+	dir.handle = opendir((char*)dir.buffer);
+	SI_ERROR_SYS_CHECK(dir.handle == nil, dir.error = SI_ERROR_RES; return dir);
 
-#if SI_SYSTEM_IS_WINDOWS
-	const u8 SI_PATH_SEPARATOR = '\\';
-#else
-	const u8 SI_PATH_SEPARATOR = '/';
 #endif
 
-inline
-bool si_pathExists(siString path) {
-	siOsChar stack[SI_PATH_MAX];
-	si_pathToOS(path, stack, countof(stack));
-	return si_pathExistsOS(stack);
+	return dir;
 }
+
 inline
-bool si_pathExistsOS(siOsString path) {
-#if SI_SYSTEM_IS_WINDOWS
-	return GetFileAttributesW(path) != INVALID_FILE_ATTRIBUTES;
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	struct stat tmp;
-	return stat(path, &tmp) == 0;
-#else
-	return false;
-	SI_UNUSED(path);
-#endif
+bool si_directoryIterate(siDirectory* dir, siDirectoryIterator* out) {
+	return si_directoryIterateEx(dir, true, out);
 }
-SIDEF
-siResult(isize) si_pathCopy(siString pathSrc, siString pathDst) {
-	siOsChar stack[SI_PATH_MAX * 2];
-	siOsString_2x strs = si_pathToOSMul(pathSrc, pathDst, stack, countof(stack));
-	siOsString* paths = strs.v;
 
+SIDEF
+bool si_directoryIterateEx(siDirectory* dir, bool fullPath, siDirectoryIterator* out) {
+	SI_ASSERT_NOT_NIL(dir);
+	SI_ASSERT_NOT_NIL(out);
+	SI_ASSERT_NOT_NIL(dir->handle);
 
 #if SI_SYSTEM_IS_WINDOWS
-	isize size = CopyFileW(paths[0], paths[1], true);
-	SI_OPTION_SYS_CHECK(size == 0, isize);
+	WIN32_FIND_DATAW file;
+	if (FindNextFileW(dir->handle, &file) == 0) {
+		siErrorSystem code = si_systemGetError();
+		si_directoryClose(dir);
+
+		SI_ERROR_SYS_CHECK(code != 0, dir->error = SI_ERROR_RES; return false);
+		return false;
+	}
+
+	if ((file.dwFileAttributes & (FILE_ATTRIBUTE_DIRECTORY | FILE_ATTRIBUTE_REPARSE_POINT)) == 0) {
+		out->type = siIoType_File;
+	}
+	else if (file.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+		out->type = siIoType_Directory;
+	}
+	else {
+		out->type = siIoType_Link;
+	}
+
+	siString data = si_utf16ToUtf8Str(
+		SI_ARR_LEN(file.cFileName, SI_PATH_MAX),
+		SI_ARR_LEN(&dir->buffer[dir->directoryLen], si_sizeof(dir->buffer) - dir->directoryLen)
+	);
+
+	out->path = (fullPath)
+		? SI_STR_LEN(dir->buffer, dir->directoryLen + data.len)
+		: data;
+
+	return true;
 
-	return SI_OPT(isize, size);
 
 #elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	int src = open(paths[0], O_RDONLY, 0);
-	SI_OPTION_SYS_CHECK(src == -1, isize);
+	struct dirent* dirEntry;
+	isize len;
+	while (true) {
+		errno = 0;
+		dirEntry = readdir((DIR*)dir->handle);
+		if (dirEntry == nil) {
+			siErrorSystem code = si_systemGetError();
+			si_directoryClose(dir);
 
-	int dst = open(paths[1], O_WRONLY | O_CREAT, 0666);
-	SI_OPTION_SYS_CHECK(dst == -1, isize);
+			SI_ERROR_SYS_CHECK(code != 0, dir->error = SI_ERROR_RES; return false);
+			return false;
+		}
 
-	struct stat stat;
-	int res = fstat(src, &stat);
-	SI_OPTION_SYS_CHECK(res == -1, isize);
+		len = si_cstrLen(dirEntry->d_name);
+		SI_STOPIF(!si__directoryIsDot(dirEntry->d_name, len), break);
+	}
 
-	#if SI_SYSTEM_IS_UNIX
-		isize size = sendfile64(dst, src, 0, (usize)stat.st_size);
-	#else
-		isize size = sendfile(dst, src, 0, &stat.st_size, nil, 0);
-	#endif
-	SI_OPTION_SYS_CHECK(size == -1, isize);
+	out->type = si__directoryType(dirEntry->d_type);
+	if (out->type == 0) {
+		out->type = si__directoryStatType(dirfd((DIR*)dir->handle), dirEntry->d_name);
+	}
 
-	close(src);
-	close(dst);
+	u8* data = &dir->buffer[dir->directoryLen];
+	len = si_memcopy_s(
+		SI_ARR_LEN(data, si_sizeof(dir->buffer) - dir->directoryLen),
+		dirEntry->d_name, len
+	);
+
+	out->path = (fullPath)
+		? SI_STR_LEN(dir->buffer, dir->directoryLen + len)
+		: SI_STR_LEN(data, len);
 
-	return SI_OPT(isize, size);
+	return true;
 #else
-	return SI_OPT_NIL(isize);
-	SI_UNUSED(paths);
+	return false;
 
 #endif
-
 }
-SIDEF
-siResult(i32) si_pathItemsCopy(siString pathSrc, siString pathDst) {
-	/* TODO(EimaMei): Rework this mess one day. */
-	SI_ASSERT(pathDst.len <= SI_PATH_MAX);
 
-	siDirectory dir = si_directoryOpen(pathSrc);
-	i32 itemsCopied = 0;
+inline
+void si_directoryClose(siDirectory* dir) {
+	SI_ASSERT_NOT_NIL(dir);
+	SI_STOPIF(dir->handle == nil, return);
 
-	u8 dst[SI_PATH_MAX];
-	u8* dstBuffer;
-	siString dstStr = SI_STR_LEN(dst, pathDst.len + 1);
+#if SI_SYSTEM_IS_WINDOWS
+	CloseHandle(dir->handle);
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	closedir((DIR*)dir->handle);
+#endif
+	dir->handle = nil;
+}
 
-	si_memcopy(dst, pathDst.data, pathDst.len);
-	dst[pathDst.len] = SI_PATH_SEPARATOR;
-	dstBuffer = &dst[pathDst.len + 1];
+/* NOTE(EimaMei): The walk goes level by level. Every worker claims folders of the
+ * current level and writes the subfolders it finds into its own buffers, which
+ * then become the next level's work. The workers have two generations of buffers,
+ * as the current level's paths point into the previous generation. */
+typedef struct si__directoryWalk {
+	siDirectoryWalkProc* proc;
+	void* data;
 
-	siDirectoryIterator entry;
-	while (si_directoryIterateEx(&dir, false, &entry)) {
-		siString path = si_pathBaseName(entry.path);
-		si_memcopyStr(dstBuffer, path);
+	const siString* folders;
+	isize len;
+	i32 depth;
 
-		if (entry.type == siIoType_Directory) {
-			siError err = si_pathCreateFolder(dstStr);
-			SI_STOPIF(err.code != 0, return SI_OPT_ERR(i32, err));
+	volatile isize next;
+	volatile isize stop;
+	volatile isize failed;
+	siError error;
+} si__directoryWalk;
 
-			siResult(i32) res = si_pathItemsCopy(entry.path, dstStr);
-			SI_STOPIF(!res.hasValue, return res);
-			itemsCopied += res.data.value;
-			continue;
-		}
+typedef struct si__directoryFolder {
+	isize offset;
+	isize len;
+} si__directoryFolder;
+
+typedef struct si__directoryWalker {
+	si__directoryWalk* walk;
+	siBuilder paths;
+	siDynamicArray(si__directoryFolder) folders;
+	isize count;
+
+	u8 path[SI_PATH_MAX];
+} si__directoryWalker;
+
+#if SI_SYSTEM_LINUX
+/* NOTE(EimaMei): The offsets inside 'struct linux_dirent64', which starts with
+ * 'u64 d_ino' and 'i64 d_off', followed by the fields below. The name is
+ * NULL-terminated. */
+#define SI__DIRENT64_RECLEN 16
+#define SI__DIRENT64_TYPE   18
+#define SI__DIRENT64_NAME   19
+#endif
+
+/* Reports the entry, whose name has already been written after the folder's
+ * path. Returns false if the walk should stop. */
+siIntern
+bool si__directoryWalkVisit(si__directoryWalker* worker, isize folderLen, isize nameLen,
+		siIoType type) {
+	si__directoryWalk* walk = worker->walk;
+
+	siDirectoryEntry entry;
+	entry.path = SI_STR_LEN(worker->path, folderLen + nameLen);
+	entry.name = SI_STR_LEN(&worker->path[folderLen], nameLen);
+	entry.type = type;
+	entry.depth = walk->depth;
+	worker->count += 1;
+
+	siWalkAction action = walk->proc(&entry, walk->data);
+	if (action == siWalkAction_Stop) {
+		si__atomicStore(&walk->stop, true);
+		return false;
+	}
 
-		si_pathCopy(entry.path, dstStr);
-		itemsCopied += 1;
+	if (action == siWalkAction_Continue && type == siIoType_Directory) {
+		si__directoryFolder folder;
+		folder.offset = worker->paths.len;
+		folder.len = entry.path.len;
+		si_builderWriteStr(&worker->paths, entry.path);
+		si_dynamicArrayAppend(&worker->folders, &folder);
 	}
 
-	return SI_OPT(i32, itemsCopied);
+	return si__atomicLoad(&walk->stop) == 0;
 }
 
-SIDEF
-siError si_pathMove(siString pathSrc, siString pathDst) {
-	siOsChar stack[SI_PATH_MAX * 2];
-	siOsString_2x strs = si_pathToOSMul(pathSrc, pathDst, stack, countof(stack));
-	siOsString* paths = strs.v;
+siIntern
+siError si__directoryWalkRead(si__directoryWalker* worker, siString folder) {
+	isize folderLen = folder.len;
+	SI_STOPIF(folderLen >= SI_PATH_MAX, return SI_ERROR_SYS_EX(siErrorSystem_InvalidFilename));
+
+	si_memcopyStr(worker->path, folder);
+	if (folderLen == 0 || worker->path[folderLen - 1] != SI_PATH_SEPARATOR) {
+		worker->path[folderLen] = SI_PATH_SEPARATOR;
+		folderLen += 1;
+	}
 
-#if SI_SYSTEM_IS_WINDOWS
-	i32 res = MoveFileW(paths[0], paths[1]);
-	SI_ERROR_SYS_CHECK_RET(res == 0);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	i32 res = link(paths[0], paths[1]);
-	SI_ERROR_SYS_CHECK_RET(res != 0);
+#if SI_SYSTEM_LINUX
+	/* NOTE(EimaMei): One 'getdents64' call returns as many entries as fit into the
+	 * buffer, whereas 'readdir' copies them out one at a time. */
+	worker->path[folderLen] = '\0';
+	int fd = open((char*)worker->path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	SI_ERROR_SYS_CHECK_RET(fd == -1);
+
+	u64 buffer[SI_KILO(32) / si_sizeof(u64)];
+	while (true) {
+		isize len = syscall(SYS_getdents64, fd, buffer, si_sizeof(buffer));
+		SI_STOPIF(len == -1 && errno == EINTR, continue);
+		SI_ERROR_SYS_CHECK(len == -1, close(fd); return SI_ERROR_RES);
+		SI_STOPIF(len == 0, break);
+
+		for (isize offset = 0; offset < len; ) {
+			const u8* dirEntry = (const u8*)buffer + offset;
+			const char* name = (const char*)&dirEntry[SI__DIRENT64_NAME];
+
+			u16 reclen;
+			si_memcopy(&reclen, &dirEntry[SI__DIRENT64_RECLEN], si_sizeof(reclen));
+			offset += reclen;
+
+			isize nameLen = si_cstrLen(name);
+			SI_STOPIF(si__directoryIsDot(name, nameLen), continue);
+			if (folderLen + nameLen > SI_PATH_MAX) {
+				close(fd);
+				return SI_ERROR_SYS_EX(siErrorSystem_InvalidFilename);
+			}
+
+			siIoType type = si__directoryType(dirEntry[SI__DIRENT64_TYPE]);
+			if (type == 0) {
+				type = si__directoryStatType(fd, name);
+			}
+
+			si_memcopy(&worker->path[folderLen], name, nameLen);
+			if (!si__directoryWalkVisit(worker, folderLen, nameLen, type)) {
+				close(fd);
+				return SI_ERROR_NIL;
+			}
+		}
+	}
+	close(fd);
 
-	res = unlink(paths[0]);
-	SI_ERROR_SYS_CHECK_RET(res != 0);
 #else
-	SI_UNUSED(paths);
+	siDirectory dir = si_directoryOpen(folder);
+	SI_STOPIF(dir.error.code != 0, return dir.error);
+
+	siDirectoryIterator entry;
+	while (si_directoryIterateEx(&dir, false, &entry)) {
+		if (folderLen + entry.path.len > SI_PATH_MAX) {
+			si_directoryClose(&dir);
+			return SI_ERROR_SYS_EX(siErrorSystem_InvalidFilename);
+		}
+
+		si_memcopyStr(&worker->path[folderLen], entry.path);
+		if (!si__directoryWalkVisit(worker, folderLen, entry.path.len, entry.type)) {
+			si_directoryClose(&dir);
+			return SI_ERROR_NIL;
+		}
+	}
+	SI_STOPIF(dir.error.code != 0, return dir.error);
+
 #endif
 
 	return SI_ERROR_NIL;
 }
 
+siIntern
+void* si__directoryWalkWorker(void* data) {
+	si__directoryWalker* worker = (si__directoryWalker*)data;
+	si__directoryWalk* walk = worker->walk;
+
+	while (si__atomicLoad(&walk->stop) == 0) {
+		isize index = si__atomicAdd(&walk->next, 1) - 1;
+		SI_STOPIF(index >= walk->len, break);
+
+		siError error = si__directoryWalkRead(worker, walk->folders[index]);
+		if (error.code != 0) {
+			if (si__atomicAdd(&walk->failed, 1) == 1) {
+				walk->error = error;
+			}
+			si__atomicStore(&walk->stop, true);
+		}
+	}
+
+	return nil;
+}
+
 inline
-siError si_pathRename(siString path, siString newPath) {
-	return si_pathMove(path, newPath);
+siResult(isize) si_directoryWalk(siString path, siDirectoryWalkProc* proc, void* data) {
+	return si_directoryWalkEx(path, 1, proc, data);
 }
 
 SIDEF
-siError si_pathCreateFolder(siString path) {
-	siOsChar stack[SI_PATH_MAX];
-	si_pathToOS(path, stack, countof(stack));
-
-	#if SI_SYSTEM_IS_WINDOWS
-		i32 res = CreateDirectoryW(stack, nil);
-		SI_ERROR_SYS_CHECK_RET(res == 0);
-	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-		i32 res = mkdir(stack, 0777);
-		SI_ERROR_SYS_CHECK_RET(res != 0);
-	#endif
+siResult(isize) si_directoryWalkEx(siString path, isize threadCount,
+		siDirectoryWalkProc* proc, void* data) {
+	SI_ASSERT_NOT_NIL(proc);
+	SI_ASSERT(path.len <= SI_PATH_MAX);
+	siAllocator alloc = si_allocatorHeap();
 
-	return SI_ERROR_NIL;
-}
+#ifdef SI_NO_THREAD
+	threadCount = 1;
+#else
+	threadCount = si_max(isize, threadCount, 1);
+	siThread* threads = si_allocArray(alloc, siThread, threadCount);
+#endif
 
-SIDEF
-siError si_pathRemove(siString path) {
-	/* TODO(EimaMei): Check the performance of this, rewrite it. */
-	siOsChar stack[SI_PATH_MAX];
-	si_pathToOS(path, stack, countof(stack));
+	si__directoryWalk walk = SI_STRUCT_ZERO;
+	walk.proc = proc;
+	walk.data = data;
 
-	#if SI_SYSTEM_IS_WINDOWS
-		u32 attrs = GetFileAttributesW(stack);
-		SI_ERROR_SYS_CHECK_RET(attrs == INVALID_FILE_ATTRIBUTES);
+	si__directoryWalker* workers = si_allocArray(alloc, si__directoryWalker, threadCount * 2);
+	for_range (i, 0, threadCount * 2) {
+		workers[i].walk = &walk;
+		workers[i].paths = si_builderMake(SI_KILO(4), alloc);
+		workers[i].folders = si_dynamicArrayMakeReserve(si__directoryFolder, 64, alloc);
+		workers[i].count = 0;
+	}
 
-		i32 res;
-		if (attrs & FILE_ATTRIBUTE_DIRECTORY) {
-			siDirectoryIterator entry;
-			siDirectory dir = si_directoryOpen(path);
-			while (si_directoryIterate(&dir, &entry)) {
-				siError err = si_pathRemove(entry.path);
-				SI_STOPIF(err.code != 0, return err);
-			}
+	siDynamicArray(siString) level = si_dynamicArrayMakeReserve(siString, 64, alloc);
+	si_dynamicArrayAppend(&level, &path);
 
-			res = RemoveDirectoryW(stack);
-		}
-		else {
-			res = DeleteFileW(stack);
+	isize generation = 0;
+	while (level.len != 0 && walk.stop == 0) {
+		si__directoryWalker* current = &workers[generation * threadCount];
+		for_range (i, 0, threadCount) {
+			current[i].paths.len = 0;
+			current[i].folders.len = 0;
 		}
-		SI_ERROR_SYS_CHECK_RET(res == 0);
 
-	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-		struct stat tmp;
-		i32 res = stat(stack, &tmp);
-		SI_ERROR_SYS_CHECK_RET(res != 0);
+		walk.folders = (const siString*)level.data;
+		walk.len = level.len;
+		walk.next = 0;
 
-		if (S_ISDIR(tmp.st_mode)) {
-			siDirectoryIterator entry;
-			siDirectory dir = si_directoryOpen(path);
-			while (si_directoryIterate(&dir, &entry)) {
-				siError err = si_pathRemove(entry.path);
-				SI_STOPIF(err.code != 0, return err);
-			}
+	#ifndef SI_NO_THREAD
+		/* NOTE(EimaMei): The calling thread walks folders too. */
+		isize threadLen = 1;
+		for_range (i, 1, si_min(isize, threadCount, level.len)) {
+			siError res = si_threadMakeAndRun(si__directoryWalkWorker, &current[i], &threads[i]);
+			SI_STOPIF(res.code != 0, break);
+			threadLen += 1;
+		}
+		si__directoryWalkWorker(&current[0]);
 
-			res = rmdir(stack);
+		for_range (i, 1, threadLen) {
+			si_threadJoin(&threads[i]);
+			si_threadDestroy(&threads[i]);
 		}
-		else {
-			res = unlink(stack);
+	#else
+		si__directoryWalkWorker(&current[0]);
+	#endif
+
+		level.len = 0;
+		for_range (i, 0, threadCount) {
+			const si__directoryFolder* folders = (const si__directoryFolder*)current[i].folders.data;
+			for_range (j, 0, current[i].folders.len) {
+				siString folder = SI_STR_LEN(&current[i].paths.data[folders[j].offset], folders[j].len);
+				si_dynamicArrayAppend(&level, &folder);
+			}
 		}
-		SI_ERROR_SYS_CHECK_RET(res != 0);
 
-	#endif
+		generation ^= 1;
+		walk.depth += 1;
+	}
 
-	return SI_ERROR_NIL;
+	isize count = 0;
+	for_range (i, 0, threadCount * 2) {
+		count += workers[i].count;
+		si_builderFree(&workers[i].paths);
+		si_dynamicArrayFree(workers[i].folders);
+	}
+	si_dynamicArrayFree(level);
+	si_free(alloc, workers);
+#ifndef SI_NO_THREAD
+	si_free(alloc, threads);
+#endif
+
+	SI_STOPIF(walk.failed != 0, return SI_OPT_ERR(isize, walk.error));
+	return SI_OPT(isize, count);
 }
 
-SIDEF
-siError si_pathCreateHardLink(siString path, siString pathLink) {
-	siOsChar stack[SI_PATH_MAX * 2];
-	siOsString_2x strs = si_pathToOSMul(path, pathLink, stack, countof(stack));
-	siOsString* paths = strs.v;
+
+#endif /* SI_IMPLEMENTATION_IO */
+
+#ifdef SI_IMPLEMENTATION_THREAD
 
 #if SI_SYSTEM_IS_WINDOWS
-	i32 res = CreateHardLinkW(paths[1], paths[0], nil);
-	SI_ERROR_SYS_CHECK_RET(res == 0);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	i32 res = link(paths[0], paths[1]);
-	SI_ERROR_SYS_CHECK_RET(res != 0);
-#else
-	SI_UNUSED(paths);
-#endif
 
-	return SI_ERROR_NIL;
+siIntern
+DWORD WINAPI si__threadProc(LPVOID arg) {
+	siThread* t = (siThread*)arg;
+	t->returnValue = t->func(t->arg);
+	t->state = siThreadState_Initialized;
+
+	return 0;
 }
 
-SIDEF
-siError si_pathCreateSoftLink(siString path, siString pathLink) {
-	siOsChar stack[SI_PATH_MAX * 2];
-	siOsString_2x strs = si_pathToOSMul(path, pathLink, stack, countof(stack));
-	siOsString* paths = strs.v;
+#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN
 
-#if SI_SYSTEM_IS_WINDOWS
-	u32 attrs = GetFileAttributesW(paths[0]);
-	SI_ERROR_SYS_CHECK_RET(attrs == INVALID_FILE_ATTRIBUTES);
+siIntern
+void* si__threadProc(void* arg) {
+	#if SI_SYSTEM_EMSCRIPTEN
+	si_sleep(SI_TIME_MS(1));
+	#endif
 
-	i32 res = CreateSymbolicLinkW(paths[1], paths[0], attrs & FILE_ATTRIBUTE_DIRECTORY);
-	SI_ERROR_SYS_CHECK_RET(res == 0);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	i32 res = symlink(paths[0], paths[1]);
-	SI_ERROR_SYS_CHECK_RET(res != 0);
-#else
-	SI_UNUSED(paths);
+	siThread* t = (siThread*)arg;
+	t->returnValue = t->func(t->arg);
+	t->state = siThreadState_Initialized;
 
+	return nil;
+}
 #endif
 
-	return SI_ERROR_NIL;
+
+inline
+siThread si_threadMake(siThreadFunction function, void* arg) {
+	return si_threadMakeEx(function, arg, 0);
 }
 
 inline
-siString si_pathBaseName(siString path) {
-	SI_ASSERT_STR(path);
-	SI_ASSERT(path.len <= SI_PATH_MAX);
+siThread si_threadMakeEx(siThreadFunction function, void* arg, usize stackSize) {
+	SI_ASSERT_NOT_NIL(function);
 
-	isize i;
-	for (i = path.len - 1; i >= 0; i -= 1) {
-		if (path.data[i] == SI_PATH_SEPARATOR) {
-			return si_substrFrom(path, i + 1);
-		}
-	}
-	return path;
+	siThread thread = SI_STRUCT_ZERO;
+	thread.func = function;
+	thread.arg = arg;
+	thread.stackSize = stackSize;
+	thread.state = siThreadState_Initialized;
+
+	return thread;
 }
 
 SIDEF
-siString si_pathUnrooted(siString path) {
+siError si_threadMakeAndRun(siThreadFunction function, void* arg, siThread* out) {
+	*out = si_threadMake(function, arg);
+	return si_threadRun(out);
+}
+
+SIDEF
+siError si_threadRun(siThread* thread) {
+	SI_ASSERT_NOT_NIL(thread);
+	SI_ASSERT(thread->state == siThreadState_Initialized);
+
 	#if SI_SYSTEM_IS_WINDOWS
-		isize offset = 3 * si_pathIsAbsolute(path);
+		thread->id = CreateThread(nil, thread->stackSize, si__threadProc, thread, 0, nil);
+		SI_ERROR_SYS_CHECK_RET(thread->id == nil);
+
+	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN
+		pthread_attr_t attr;
+		pthread_attr_t* attrPtr = nil;
+		if (thread->stackSize != 0) {
+			int res = pthread_attr_init(&attr);
+			if (res != 0) {
+				pthread_attr_setstacksize(&attr, thread->stackSize);
+				attrPtr = &attr;
+			}
+		}
+
+		pthread_t id;
+		{
+			int res = pthread_create(&id, attrPtr, si__threadProc, thread);
+			SI_ERROR_SYS_CHECK_RET(res != 0);
+		}
+		thread->id = id;
+
+		if (attrPtr) {
+			pthread_attr_destroy(&attr);
+		}
 	#else
-		isize offset = (isize)si_pathIsAbsolute(path);
+		return SI_ERROR_NIL;
 	#endif
 
-	for_range (i, offset, path.len) {
-		if (path.data[i] == SI_PATH_SEPARATOR) {
-			return si_substrFrom(path, i);
-		}
-	}
-	return si_substrFrom(path, offset);
+	thread->state = siThreadState_Running;
+	return SI_ERROR_NIL;
 }
 
 SIDEF
-siString si_pathExtension(siString path) {
-	SI_ASSERT_STR(path);
-	SI_ASSERT(path.len <= SI_PATH_MAX);
+siError si_threadJoin(siThread* thread) {
+	SI_ASSERT_NOT_NIL(thread);
+	SI_ASSERT_NOT_NIL((void*)thread->id);
 
-	isize i = si_stringFindLastByte(path, '.');
-	return (i != -1) ? si_substrFrom(path, i) : SI_STR_EMPTY;
+	#if SI_SYSTEM_IS_WINDOWS
+		DWORD res = WaitForSingleObject(thread->id, INFINITE);
+		SI_ERROR_SYS_CHECK_RET(res != 0);
+	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN
+		int res = pthread_join(thread->id, nil);
+		SI_ERROR_SYS_CHECK_RET(res != 0);
+	#endif
 
+	return SI_ERROR_NIL;
 }
 
 SIDEF
-siString si_pathLongExtension(siString path) {
-	SI_ASSERT_STR(path);
-	SI_ASSERT(path.len <= SI_PATH_MAX);
+siError si_threadDestroy(siThread* thread) {
+	SI_ASSERT_NOT_NIL(thread);
+	SI_STOPIF(thread->id == 0, return SI_ERROR_NIL);
 
-	isize i = si_stringFindLastByte(path, SI_PATH_SEPARATOR);
-	if (i != -1) {
-		path = si_substrFrom(path, i + 1);
-	}
+#if SI_SYSTEM_IS_WINDOWS
+	i32 res = CloseHandle(thread->id);
+	SI_ERROR_SYS_CHECK_RET(!res);
+#endif
+	thread->id = 0;
+	thread->state = siThreadState_Closed;
 
-	i = si_stringFindByte(path, '.');
-	return (i != -1) ? si_substrFrom(path, i) : SI_STR_EMPTY;
+	return SI_ERROR_NIL;
 }
 
+#endif /* SI_IMPLEMENTATION_THREAD */
 
-SIDEF
-siString si_pathStem(siString path) {
-	SI_ASSERT_STR(path);
-	SI_ASSERT(path.len <= SI_PATH_MAX);
+#ifdef SI_IMPLEMENTATION_LOG
 
-	isize i = si_stringFindLastByte(path, SI_PATH_SEPARATOR);
-	if (i != -1) {
-		path = si_substrFrom(path, i + 1);
-	}
+/* NOTE(EimaMei): Every thread gets its own single-producer single-consumer ring,
+ * meaning logging never has to take a lock or contend with other threads. Only
+ * the producer writes 'head' and only the flusher thread writes 'tail', both of
+ * which are kept on separate cache lines. */
+typedef struct si__logRing {
+	volatile isize head;
+	u8 padHead[64 - sizeof(isize)];
+	volatile isize tail;
+	u8 padTail[64 - sizeof(isize)];
+
+	isize readPos;
+	isize size;
+	const void* owner;
+	struct si__logRing* next;
+	u8* data;
+} si__logRing;
+
+typedef struct si__logRecord {
+	siTime time;
+	siCallerLoc loc;
+	/* The length of the message (or the captured arguments) that follows the
+	 * record. A negative length marks that the rest of the ring is unused and
+	 * reading continues from the start. */
+	isize len;
+	/* The length of the format string that follows the captured arguments, only
+	 * used by binary records that weren't logged from a call site. */
+	isize fmtLen;
+	/* The ID of the call site and its format, 0 and empty if there's none. */
+	u64 site;
+	siString format;
+	siLogLevel level;
+} si__logRecord;
+
+typedef struct si__logIdEntry {
+	u64 id;
+	isize value;
+} si__logIdEntry;
+
+typedef struct si__logDefinition {
+	siString filename;
+	i32 line;
+	siFormat format;
+} si__logDefinition;
+
+/* NOTE(EimaMei): A binary log starts with the magic, a version and a value to
+ * check the endianness with. After that come the entries, each starting with a
+ * tag:
+ * - 'D' - u64 ID, i32 line, i32 length + the filename, i32 length + the format.
+ *   Defines a call site, written before the first record that uses it.
+ * - 'R' - u64 ID, i64 time, u8 level, i32 length + the captured arguments.
+ * - 'M' - i32 length + text. A message from the logger itself.
+ *
+ * The arguments are captured in the order of the specifiers. Integers, floats
+ * and pointers take 8 bytes, strings are an i32 length (-1 for nil) followed by
+ * the bytes. */
+#define SI__LOG_MAGIC "sili-log"
+#define SI__LOG_VERSION 1
+#define SI__LOG_PREFIX "%04i-%02i-%02i %02i:%02i:%02i.%03i %-5s %s:%i: "
 
-	i = si_stringFindLastByte(path, '.');
-	return (i > 0) ? si_substrTo(path, i) : SI_STR_EMPTY;
-}
+typedef struct si__logThreadCache {
+	isize loggerId;
+	si__logRing* ring;
+} si__logThreadCache;
 
-SIDEF
-siString si_pathShortStem(siString path) {
-	SI_ASSERT_STR(path);
-	SI_ASSERT(path.len <= SI_PATH_MAX);
+siIntern siThreadLocal si__logThreadCache si__logCache;
+siIntern volatile isize si__logIdCounter = 0;
+siIntern volatile isize si__logSiteCounter = 0;
 
-	isize i = si_stringFindLastByte(path, SI_PATH_SEPARATOR);
-	if (i != -1) {
-		path = si_substrFrom(path, i + 1);
-	}
 
-	i = si_stringFindByte(path, '.');
-	return (i > 0) ? si_substrTo(path, i) : SI_STR_EMPTY;
+#if SI_COMPILER_MSVC
+force_inline
+si__logRing* si__logRingLoad(si__logRing* volatile* ptr) {
+	si__logRing* res = *ptr;
+	_ReadWriteBarrier();
+	return res;
+}
+force_inline
+bool si__logRingSwap(si__logRing* volatile* ptr, si__logRing* expected, si__logRing* desired) {
+	return _InterlockedCompareExchangePointer((void* volatile*)ptr, desired, expected) == expected;
 }
 
+#else
+force_inline
+si__logRing* si__logRingLoad(si__logRing* volatile* ptr) {
+	return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+force_inline
+bool si__logRingSwap(si__logRing* volatile* ptr, si__logRing* expected, si__logRing* desired) {
+	return __atomic_compare_exchange_n(
+		ptr, &expected, desired, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED
+	);
+}
+#endif
 
 
-SIDEF
-siResult(siString) si_pathGetFullName(siString path, siAllocator alloc) {
-	siOsChar stack[SI_PATH_MAX * 2];
-	isize pathLen = si_pathToOS(path, stack, countof(stack));
+/* Returns the entry of the ID. New IDs get inserted with a value of -1. Returns
+ * nil if the table couldn't be grown. */
+siIntern
+si__logIdEntry* si__logIdTableGet(si__logIdTable* table, u64 id, siAllocator alloc) {
+	SI_ASSERT(id != 0);
 
-#if SI_SYSTEM_IS_WINDOWS
-	SI_OPTION_SYS_CHECK(!si_pathExistsOS(stack), siString);
-	DWORD dif = (u32)(countof(stack) - pathLen);
+	if ((table->len + 1) * 2 > table->capacity) {
+		isize capacity = si_max(isize, 64, table->capacity * 2);
+		si__logIdEntry* entries = si_allocArray(alloc, si__logIdEntry, capacity);
+		SI_STOPIF(entries == nil, return nil);
 
-	isize len = (isize)GetFullPathNameW(stack, dif, &stack[pathLen], nil);
-	SI_OPTION_SYS_CHECK(len == 0, siString);
+		for_range (i, 0, table->capacity) {
+			si__logIdEntry entry = table->entries[i];
+			SI_STOPIF(entry.id == 0, continue);
 
-	siUtf16String str = SI_ARR_LEN(&stack[pathLen], len);
-	isize utf8Len = si_utf16ToUtf8StrLen(str);
+			isize j = (isize)(entry.id & (u64)(capacity - 1));
+			while (entries[j].id != 0) { j = (j + 1) & (capacity - 1); }
+			entries[j] = entry;
+		}
 
-	siString res = si_utf16ToUtf8Str(str, si_arrayMakeReserve(u8, utf8Len, alloc));
-	return SI_OPT(siString, res);
+		if (table->entries != nil) { si_free(alloc, table->entries); }
+		table->entries = entries;
+		table->capacity = capacity;
+	}
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	siOsChar* out = &stack[pathLen];
-	out = realpath(stack, out);
-	SI_OPTION_SYS_CHECK(out == nil, siString);
+	isize mask = table->capacity - 1;
+	isize i = (isize)(id & (u64)mask);
+	while (table->entries[i].id != id) {
+		if (table->entries[i].id == 0) {
+			table->entries[i].id = id;
+			table->entries[i].value = -1;
+			table->len += 1;
+			break;
+		}
+		i = (i + 1) & mask;
+	}
 
-	return SI_OPT(siString, si_stringFromCStr(out, alloc));
-#else
-	return SI_OPT_NIL(siString);
-	SI_UNUSED(pathLen); SI_UNUSED(alloc);
+	return &table->entries[i];
+}
 
-#endif
+force_inline
+bool si__logPut(u8* out, isize capacity, isize* len, const void* data, isize size) {
+	SI_STOPIF(*len + size > capacity, return false);
+	*len += si_memcopy(&out[*len], data, size);
+	return true;
 }
 
-inline
-siString si_pathJoin(siString path, siString subPath, siAllocator alloc) {
-	return si_pathJoinEx(SI_ARR(siString, path, subPath), alloc);
+siIntern
+bool si__logPutStr(u8* out, isize capacity, isize* len, siString str) {
+	isize available = capacity - *len - si_sizeof(i32);
+	SI_STOPIF(available < 0, return false);
+
+	i32 strLen = (str.data != nil) ? (i32)si_min(isize, str.len, available) : -1;
+	si__logPut(out, capacity, len, &strLen, si_sizeof(strLen));
+	if (strLen > 0) {
+		si__logPut(out, capacity, len, str.data, strLen);
+	}
+	return true;
 }
 
-inline
-siString si_pathJoinEx(siArray(siString) strs, siAllocator alloc) {
-	return si_stringJoin(strs, SI_STR_LEN(&SI_PATH_SEPARATOR, 1), alloc);
+force_inline
+bool si__logGet(const u8* data, isize len, isize* pos, void* out, isize size) {
+	SI_STOPIF(*pos + size > len, return false);
+	*pos += si_memcopy(out, &data[*pos], size);
+	return true;
 }
 
-inline
-bool si_pathIsAbsolute(siString path) {
-	SI_ASSERT(path.len <= SI_PATH_MAX);
-	u8* data = (u8*)path.data;
+siIntern
+bool si__logGetStr(const u8* data, isize len, isize* pos, siString* out) {
+	i32 strLen;
+	SI_STOPIF(!si__logGet(data, len, pos, &strLen, si_sizeof(strLen)), return false);
 
-#if SI_SYSTEM_IS_WINDOWS
-	return (
-		si_charIsAlpha((char)data[0])
-		&& data[1] == ':'
-		&& data[2] == SI_PATH_SEPARATOR
-		&& data[3] != '\0'
-	);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	return (data[0] == SI_PATH_SEPARATOR && path.len != 1);
-#else
-	return false;
-	SI_UNUSED(data);
-#endif
-}
+	if (strLen < 0) {
+		*out = SI_STR_NIL;
+		return true;
+	}
+	SI_STOPIF(*pos + strLen > len, return false);
 
-inline
-bool si_pathIsRelative(siString path) {
-	return !si_pathIsAbsolute(path);
+	*out = SI_STR_LEN(&data[*pos], strLen);
+	*pos += strLen;
+	return true;
 }
 
-SIDEF
-isize si_pathToOS(siString path, siOsChar* out, isize capacity) {
-	SI_ASSERT(path.len <= SI_PATH_MAX);
-	SI_ASSERT_NOT_NIL(out);
-	SI_ASSERT_NOT_NEG(capacity);
-	SI_STOPIF(capacity == 0, return 0);
+/* Copies the arguments of every specifier into 'out' without formatting them.
+ * Stops at the first argument that doesn't fit. */
+siIntern
+isize si__logCapture(u8* out, isize capacity, siString fmt, va_list va) {
+	va_list args;
+	va_copy(args, va);
 
-	isize copied;
+	isize len = 0;
+	bool fits = true,
+		 colorPresent = false;
+
+	const u8* ptr = fmt.data;
+	const u8* end = &fmt.data[fmt.len];
+	while (ptr < end && fits) {
+		siFormatSpec spec;
+		ptr = si__formatParse(ptr, end, &spec);
+
+		i32 precision = spec.precision;
+		if (spec.width == SI_FORMAT_ARG) {
+			i32 width = va_arg(args, i32);
+			fits &= si__logPut(out, capacity, &len, &width, si_sizeof(width));
+		}
+		if (spec.precision == SI_FORMAT_ARG) {
+			precision = va_arg(args, i32);
+			fits &= si__logPut(out, capacity, &len, &precision, si_sizeof(precision));
+		}
 
-#if SI_SYSTEM_IS_WINDOWS
-	if (path.len > 260 && si_pathIsAbsolute(path) && capacity > 4) {
-		out[0] = '\\';
-		out[1] = '\\';
-		out[2] = '?';
-		out[3] = '\\';
+		u64 value;
+		switch (spec.specifier) {
+			case 'u': case 'x': case 'X': case 'o': case 'b': {
+				value = (spec.typeSize == 8) ? va_arg(args, u64) : va_arg(args, u32);
+				fits &= si__logPut(out, capacity, &len, &value, si_sizeof(value));
+			} break;
 
-		si_stringToOsStrEx(path, SI_ARR_LEN(&out[4], capacity - 4), &copied);
-		return copied + 4;
-	}
-#endif
+			case 'i': case 'd': case 'c': case 't': {
+				bool isLong = (spec.typeSize == 8 && (spec.specifier == 'i' || spec.specifier == 'd'));
+				value = (u64)(isLong ? va_arg(args, i64) : va_arg(args, i32));
+				fits &= si__logPut(out, capacity, &len, &value, si_sizeof(value));
+			} break;
 
-	si_stringToOsStrEx(path, SI_ARR_LEN(out, capacity), &copied);
-	return copied;
-}
+			case 'p': {
+				value = (usize)va_arg(args, void*);
+				fits &= si__logPut(out, capacity, &len, &value, si_sizeof(value));
+			} break;
 
-inline
-siOsString_2x si_pathToOSMul(siString first, siString second, siOsChar* out, isize capacity) {
-	siOsString_2x res;
-	res.v[0] = out;
-	res.len[0] = si_pathToOS(first, out, capacity);
+			case 'F': case 'f': case 'E': case 'e':
+			case 'G': case 'g': case 'A': case 'a': {
+				f64 num = va_arg(args, f64);
+				fits &= si__logPut(out, capacity, &len, &num, si_sizeof(num));
+			} break;
 
-	res.v[1] = &out[res.len[0]];
-	res.len[1] = si_pathToOS(second, res.v[1], capacity - res.len[0]);
+			case 's': {
+				fits &= si__logPutStr(out, capacity, &len, va_arg(args, siString));
+			} break;
 
-	return res;
-}
+			case 'S': {
+				cstring str = va_arg(args, char*);
+				siString res = SI_STR_NIL;
+				if (str != nil) {
+					res = SI_STR_LEN(str, spec.hasPrecision ? precision : si_cstrLen(str));
+				}
+				fits &= si__logPutStr(out, capacity, &len, res);
+			} break;
 
+			case 'L': {
+				siCallerLoc loc = va_arg(args, siCallerLoc);
+				fits &= si__logPutStr(out, capacity, &len, loc.filename)
+					&& si__logPutStr(out, capacity, &len, loc.function)
+					&& si__logPut(out, capacity, &len, &loc.line, si_sizeof(loc.line));
+			} break;
 
-SIDEF
-siTime si_pathLastWriteTime(siString path) {
-	siOsChar stack[SI_PATH_MAX];
-	si_pathToOS(path, stack, countof(stack));
+			case 'C': {
+				/* NOTE(EimaMei): Every other '%C' resets the color and doesn't
+				 * take an argument, just like in 'si__formatExecute'. */
+				u8 isColor = !colorPresent;
+				fits &= si__logPut(out, capacity, &len, &isColor, si_sizeof(isColor));
+
+				if (isColor) {
+					siPrintColor clr = va_arg(args, siPrintColor);
+					fits &= si__logPut(out, capacity, &len, &clr, si_sizeof(clr));
+					colorPresent = SI__COLOR_MODE;
+				}
+				else {
+					colorPresent = false;
+				}
+			} break;
 
-#if SI_SYSTEM_IS_WINDOWS
-	WIN32_FILE_ATTRIBUTE_DATA data;
+			case 'n': {
+				(void)va_arg(args, signed int*);
+			} break;
 
-	i32 res = GetFileAttributesExW(stack, GetFileExInfoStandard, &data);
-	if (!res) { return 0; }
+			default: break;
+		}
+	}
+	va_end(args);
 
-	FILETIME time = data.ftLastWriteTime;
-	return si__win32ToSili((i64)time.dwHighDateTime << 32 | (i64)time.dwLowDateTime);
+	return len;
+}
 
-#elif SI_SYSTEM_IS_UNIX
-	struct stat fs;
-	int res = stat(stack, &fs);
-	return (res == 0) ? SI_TIME_S(fs.st_mtim.tv_sec) + fs.st_mtim.tv_nsec : 0;
+/* Checks that a format read from a binary log is safe to parse: every digit run
+ * must fit into an 'i16' and every specifier must be a whole UTF-8 character. */
+siIntern
+bool si__logFormatValid(siString fmt) {
+	const u8* ptr = fmt.data;
+	const u8* end = &fmt.data[fmt.len];
+
+	while (ptr < end) {
+		u8 c = *ptr;
+		ptr += 1;
+		SI_STOPIF(c != '%', continue);
+
+		i32 value = 0;
+		while (ptr < end) {
+			c = *ptr;
+			if (si_charIsDigit((char)c)) {
+				value = value * 10 + (c - '0');
+				SI_STOPIF(value > INT16_MAX, return false);
+				ptr += 1;
+				continue;
+			}
 
-#elif SI_SYSTEM_IS_BSD
-	struct stat fs;
-	int res = stat(stack, &fs);
-	return (res == 0) ? SI_TIME_S(fs.st_mtimespec.tv_sec) + fs.st_mtimespec.tv_nsec : 0;
+			bool isFlag = (c == 'h' || c == 'l' || c == 'z' || c == 'j' || c == '*'
+				|| c == '.' || c == '-' || c == '+' || c == ' ' || c == '#');
+			SI_STOPIF(!isFlag, break);
+			value = 0;
+			ptr += 1;
+		}
+		SI_STOPIF(ptr == end, break);
 
+		/* NOTE(EimaMei): 'si_utf8Decode' reads up to the length of the sequence,
+		 * or returns an invalid character with a length of 3. */
+		isize remaining = end - ptr;
+		isize len = (c < 0xC0) ? 1 : (c < 0xE0) ? 2 : (c < 0xF0) ? 3 : 4;
+		SI_STOPIF(len > remaining, return false);
 
-#else
-	return 0;
+		siUtf32Char x = si_utf8Decode(ptr);
+		SI_STOPIF(x.len > remaining, return false);
+		ptr += x.len;
+	}
 
-#endif
+	return true;
 }
 
-SIDEF
-siString si_pathGetTmp(void) {
-#if SI_SYSTEM_IS_WINDOWS
-	static u8 buffer[256];
-	siOsChar stack[256];
+/* Formats the captured arguments by running every specifier on its own. Stops
+ * once the arguments run out and returns -1 if they're invalid. */
+siIntern
+isize si__logRender(u8* out, isize capacity, siFormat format, const u8* args, isize argsLen) {
+	isize len = 0,
+		  pos = 0;
+	bool colorPresent = false;
 
-	u32 len = GetTempPathW(countof(stack), stack);
-	SI_ASSERT(len != 0); /* NOTE(EimaMei): This musn't fail. */
+	const siFormatSpec* specs = (const siFormatSpec*)format.data;
+	for_range (i, 0, format.len) {
+		siFormatSpec spec = specs[i];
+		len += si_memcopy(&out[len], spec.literal.data, si_min(isize, spec.literal.len, capacity - len));
+		SI_STOPIF(spec.specifier == 0, continue);
+		spec.literal = SI_STR_EMPTY;
 
-	return si_utf16ToUtf8Str(SI_ARR_LEN(stack, len), SI_ARR_LEN(buffer, countof(buffer)));
+		if (spec.width == SI_FORMAT_ARG) {
+			SI_STOPIF(!si__logGet(args, argsLen, &pos, &spec.width, si_sizeof(spec.width)), break);
+			SI_STOPIF(!si_between(i32, spec.width, -INT16_MAX, INT16_MAX), return -1);
+		}
+		if (spec.precision == SI_FORMAT_ARG) {
+			SI_STOPIF(!si__logGet(args, argsLen, &pos, &spec.precision, si_sizeof(spec.precision)), break);
+			SI_STOPIF(!si_between(i32, spec.precision, 0, INT16_MAX), return -1);
+		}
 
-#else
-	return SI_STR("/tmp");
+		siArray(u8) buf = SI_ARR_LEN(&out[len], capacity - len);
+		siFormat single = SI_ARR_LEN(&spec, 1);
+		siString res = SI_STR_EMPTY;
+
+		u64 value;
+		switch (spec.specifier) {
+			case 'u': case 'x': case 'X': case 'o': case 'b': {
+				SI_STOPIF(!si__logGet(args, argsLen, &pos, &value, si_sizeof(value)), return len);
+				res = (spec.typeSize == 8)
+					? si_bprintfFormat(buf, single, value)
+					: si_bprintfFormat(buf, single, (u32)value);
+			} break;
 
-#endif
-}
+			case 'i': case 'd': case 'c': case 't': {
+				SI_STOPIF(!si__logGet(args, argsLen, &pos, &value, si_sizeof(value)), return len);
+				bool isLong = (spec.typeSize == 8 && (spec.specifier == 'i' || spec.specifier == 'd'));
+				res = isLong
+					? si_bprintfFormat(buf, single, (i64)value)
+					: si_bprintfFormat(buf, single, (i32)value);
+			} break;
 
+			case 'p': {
+				SI_STOPIF(!si__logGet(args, argsLen, &pos, &value, si_sizeof(value)), return len);
+				res = si_bprintfFormat(buf, single, (void*)(usize)value);
+			} break;
 
-inline
-siString si_pathReadContents(siString path, siAllocator alloc) {
-	siFile file = si_fileOpen(path);
-	siString res = si_fileReadContents(file, alloc);
-	si_fileClose(&file);
+			case 'F': case 'f': case 'E': case 'e':
+			case 'G': case 'g': case 'A': case 'a': {
+				f64 num;
+				SI_STOPIF(!si__logGet(args, argsLen, &pos, &num, si_sizeof(num)), return len);
+				res = si_bprintfFormat(buf, single, num);
+			} break;
 
-	return res;
-}
-inline
-siString si_pathReadContentsBuf(siString path, siArray(u8) out) {
-	siFile file = si_fileOpen(path);
-	siString res = si_fileReadContentsBuf(file, out);
-	si_fileClose(&file);
+			case 's': case 'S': {
+				siString str;
+				SI_STOPIF(!si__logGetStr(args, argsLen, &pos, &str), return len);
 
-	return res;
-}
+				/* NOTE(EimaMei): The C-string was already cut to its precision. */
+				spec.specifier = 's';
+				res = si_bprintfFormat(buf, single, str);
+			} break;
 
-static bool SI_STD_FILE_SET = false;
-static siFile SI_STD_FILE_ARR[siStdFile_Count];
+			case 'L': {
+				siCallerLoc loc;
+				SI_STOPIF(!si__logGetStr(args, argsLen, &pos, &loc.filename), return len);
+				SI_STOPIF(!si__logGetStr(args, argsLen, &pos, &loc.function), return len);
+				SI_STOPIF(!si__logGet(args, argsLen, &pos, &loc.line, si_sizeof(loc.line)), return len);
+
+				/* NOTE(EimaMei): '%L' gets built in a 1024 byte stack buffer. */
+				SI_STOPIF(loc.filename.len + loc.function.len > 1000, return -1);
+				if (loc.filename.data == nil) { loc.filename = SI_STR_EMPTY; }
+				if (loc.function.data == nil) { loc.function = SI_STR_EMPTY; }
+				res = si_bprintfFormat(buf, single, loc);
+			} break;
 
-SIDEF
-siFile* si_fileGetStdFile(siStdFile type) {
-	SI_ASSERT_MSG(si_between(i32, type, siStdFile_Input, siStdFile_Error), "Invalid standard file type.");
+			case 'C': {
+				u8 isColor;
+				SI_STOPIF(!si__logGet(args, argsLen, &pos, &isColor, si_sizeof(isColor)), return len);
+
+				if (isColor) {
+					siPrintColor clr;
+					SI_STOPIF(!si__logGet(args, argsLen, &pos, &clr, si_sizeof(clr)), return len);
+
+					bool valid = (clr.type == siPrintColorType_3bit)
+						? clr.data.ansi.color <= siPrintColor3bit_White
+						: (clr.type == siPrintColorType_8bit || clr.type == siPrintColorType_24bit);
+					SI_STOPIF(!valid, return -1);
+					res = si_bprintfFormat(buf, single, clr);
+					colorPresent = SI__COLOR_MODE;
+				}
+				else if (colorPresent) {
+					res = si_bprintf(buf, SI_STR("%S"), "\33[0m");
+					colorPresent = false;
+				}
+			} break;
 
-	#define SET_STD_FILE(index, type) SI_STD_FILE_ARR[index].handle = type
+			case 'n': break;
+			default: res = si_bprintfFormat(buf, single, 0); break;
+		}
 
-	if (!SI_STD_FILE_SET) {
-		#if SI_SYSTEM_IS_WINDOWS
-			SET_STD_FILE(0, (isize)GetStdHandle(STD_INPUT_HANDLE));
-			SET_STD_FILE(1, (isize)GetStdHandle(STD_OUTPUT_HANDLE));
-			SET_STD_FILE(2, (isize)GetStdHandle(STD_ERROR_HANDLE));
+		len += res.len;
+	}
 
-			if (IsValidCodePage(CP_UTF8)) {
-				SetConsoleOutputCP(CP_UTF8);
-			}
+	return len;
+}
 
-			#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
-				#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
-			#endif
+/* Returns the format string that was copied after the record's arguments. */
+force_inline
+siString si__logRecordFmt(const si__logRecord* record) {
+	return SI_STR_LEN((const u8*)(record + 1) + record->len, record->fmtLen);
+}
 
-			for_range (i, 1, 2) {
-				DWORD mode;
-				GetConsoleMode((HANDLE)SI_STD_FILE_ARR[i].handle, &mode);
-				mode |= ENABLE_PROCESSED_OUTPUT | ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-				SetConsoleMode((HANDLE)SI_STD_FILE_ARR[i].handle, mode);
-			}
-		#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN
-			SET_STD_FILE(0, 0);
-			SET_STD_FILE(1, 1);
-			SET_STD_FILE(2, 2);
+siIntern
+si__logRing* si__logThreadRing(siLogger* logger) {
+	SI_STOPIF(si__logCache.loggerId == logger->id, return si__logCache.ring);
+
+	/* NOTE(EimaMei): The address of a thread-local variable is unique to each
+	 * living thread, which makes it a portable thread identifier. */
+	const void* owner = &si__logCache;
+	si__logRing* ring = si__logRingLoad(&logger->rings);
+	while (ring != nil && ring->owner != owner) {
+		ring = ring->next;
+	}
+
+	if (ring == nil) {
+		ring = (si__logRing*)si_alloc(logger->alloc, si_sizeof(si__logRing) + logger->ringSize);
+		SI_STOPIF(ring == nil, return nil);
 
-		#else
-			SI_PANIC();
-		#endif
-		SI_STD_FILE_SET = true;
+		ring->size = logger->ringSize;
+		ring->owner = owner;
+		ring->data = (u8*)(ring + 1);
+
+		do {
+			ring->next = si__logRingLoad(&logger->rings);
+		} while (!si__logRingSwap(&logger->rings, ring->next, ring));
 	}
-	return &SI_STD_FILE_ARR[type];
-	#undef SET_STD_FILE
-}
 
+	si__logCache.loggerId = logger->id;
+	si__logCache.ring = ring;
+	return ring;
+}
 
-inline
-siFile si_fileCreate(siString path) {
-	return si_fileOpenMode(path, siFileMode_Write | siFileMode_Plus);
+siIntern
+void si__logBatchWrite(siLogger* logger, isize len) {
+	SI_STOPIF(len == 0, return);
+	si_fileWriteStr(logger->file, SI_STR_LEN(logger->batch, len));
+
+	/* NOTE(EimaMei): The space in the rings only gets released after the records
+	 * are written, so that 'si_loggerFlush' knows when they hit the file. */
+	for (si__logRing* ring = si__logRingLoad(&logger->rings); ring != nil; ring = ring->next) {
+		si__atomicStore(&ring->tail, ring->readPos);
+	}
 }
 
-inline
-siFile si_fileOpen(siString path) {
-	return si_fileOpenMode(path, siFileMode_Read | siFileMode_Plus);
+siIntern
+isize si__logFormatLine(siFormat prefix, u8* out, isize capacity, siTime time,
+		siLogLevel level, siString filename, i32 line, siString message) {
+	siTimeCalendar calendar = si_timeToCalendar(time);
+	siString str = si_bprintfFormat(
+		SI_ARR_LEN(out, capacity), prefix,
+		calendar.years, calendar.months, calendar.days,
+		calendar.hours, calendar.minutes, calendar.seconds, calendar.nanoseconds / 1000000,
+		si_logLevelStr(level), filename, line
+	);
+
+	isize len = si_min(isize, str.len, capacity - 1);
+	len += si_memcopy(&out[len], message.data, si_min(isize, message.len, capacity - len - 1));
+	out[len] = '\n';
+
+	return len + 1;
 }
-SIDEF
-siFile si_fileOpenMode(siString path, siFileMode mode) {
-	SI_ASSERT(path.len <= SI_PATH_MAX);
-	SI_ASSERT((mode & ~(u32)siFileMode_All) == 0);
 
-	siFile res = SI_STRUCT_ZERO;
-	res.handle = -1;
+/* Writes the record in the binary format, along with the definition of its call
+ * site if it's the first time the site is seen. */
+siIntern
+isize si__logWriteBinary(siLogger* logger, u8* out, isize capacity,
+		const si__logRecord* record) {
+	isize len = 0;
+	bool fits = true;
 
-#if SI_SYSTEM_IS_WINDOWS
-	u32 access, disposition;
-	switch (mode) {
-		case siFileMode_Read:
-			access = GENERIC_READ;
-			disposition = OPEN_EXISTING;
-			break;
-		case siFileMode_Write:
-			access = GENERIC_WRITE;
-			disposition = CREATE_ALWAYS;
-			break;
-		case siFileMode_Append:
-			access = GENERIC_WRITE;
-			disposition = OPEN_ALWAYS;
-			break;
-		case siFileMode_Read | siFileMode_Plus:
-			access = GENERIC_READ | GENERIC_WRITE;
-			disposition = OPEN_EXISTING;
-			break;
-		case siFileMode_Write | siFileMode_Plus:
-			access = GENERIC_READ | GENERIC_WRITE;
-			disposition = CREATE_ALWAYS;
-			break;
-		case siFileMode_Append | siFileMode_Plus:
-			access = GENERIC_READ | GENERIC_WRITE;
-			disposition = OPEN_ALWAYS;
-			break;
-		default:
-			disposition = access = 0;
-			SI_PANIC_MSG("Invalid file mode.");
+	u64 id = record->site;
+	siString format = record->format;
+	si__logIdEntry* entry = nil;
+	if (id != 0) {
+		entry = si__logIdTableGet(&logger->ids, id, logger->alloc);
+	}
+	else {
+		/* NOTE(EimaMei): Records without a call site bring a copy of their format,
+		 * which gets defined again under a new ID each time. */
+		logger->lastId += 1;
+		id = SI_BIT(63) | logger->lastId;
+		format = si__logRecordFmt(record);
 	}
 
-	void* handle;
-	{
-		siOsChar stack[SI_PATH_MAX];
-		si_pathToOS(path, stack, countof(stack));
+	if (entry == nil || entry->value == -1) {
+		u8 tag = 'D';
+		i32 line = record->loc.line;
+		fits &= si__logPut(out, capacity, &len, &tag, si_sizeof(tag))
+			&& si__logPut(out, capacity, &len, &id, si_sizeof(id))
+			&& si__logPut(out, capacity, &len, &line, si_sizeof(line))
+			&& si__logPutStr(out, capacity, &len, record->loc.filename)
+			&& si__logPutStr(out, capacity, &len, format);
+	}
 
-		handle = CreateFileW(
-			stack, access, FILE_SHARE_READ | FILE_SHARE_DELETE, nil,
-			disposition, FILE_ATTRIBUTE_NORMAL, nil
+	u8 tag = 'R';
+	i64 time = record->time;
+	u8 level = record->level;
+	fits &= si__logPut(out, capacity, &len, &tag, si_sizeof(tag))
+		&& si__logPut(out, capacity, &len, &id, si_sizeof(id))
+		&& si__logPut(out, capacity, &len, &time, si_sizeof(time))
+		&& si__logPut(out, capacity, &len, &level, si_sizeof(level))
+		&& si__logPutStr(out, capacity, &len, SI_STR_LEN((const u8*)(record + 1), record->len));
+
+	SI_STOPIF(!fits, return 0);
+	if (entry != nil) { entry->value = 0; }
+
+	return len;
+}
+
+siIntern
+isize si__logDrain(siLogger* logger) {
+	isize len = 0,
+		  count = 0;
+
+	isize dropped = si__atomicLoad(&logger->dropped);
+	if (dropped != logger->droppedReported) {
+		/* NOTE(EimaMei): Binary logs store the message as an 'M' entry. */
+		isize offset = (logger->format == siLogFormat_Binary) ? 1 + si_sizeof(i32) : 0;
+		siString str = si_bprintf(
+			SI_ARR_LEN(&logger->batch[offset], SI_LOG_BATCH_SIZE - offset),
+			SI_STR("%zi log records were dropped because of a full ring\n"),
+			dropped - logger->droppedReported
 		);
+
+		if (offset != 0) {
+			i32 strLen = (i32)str.len;
+			logger->batch[0] = 'M';
+			si_memcopy(&logger->batch[1], &strLen, si_sizeof(strLen));
+		}
+		len += offset + str.len;
+		logger->droppedReported = dropped;
 	}
-	SI_ERROR_SYS_CHECK(handle == INVALID_HANDLE_VALUE, res.error = SI_ERROR_RES; return res);
 
-	if (mode & siFileMode_Append) {
-		LARGE_INTEGER offset = SI_STRUCT_ZERO;
+	for (si__logRing* ring = si__logRingLoad(&logger->rings); ring != nil; ring = ring->next) {
+		isize mask = ring->size - 1;
+		isize head = si__atomicLoad(&ring->head);
 
-		i32 status = SetFilePointerEx(handle, offset, nil, FILE_END);
-		if (!status) {
-			CloseHandle(handle);
-			res.error = SI_ERROR_SYS();
-			return res;
+		while (ring->readPos < head) {
+			isize pos = ring->readPos & mask;
+			isize contiguous = ring->size - pos;
+
+			const si__logRecord* record = (const si__logRecord*)si_pointerAdd(ring->data, pos);
+			if (contiguous < si_sizeof(si__logRecord) || record->len < 0) {
+				ring->readPos += contiguous;
+				continue;
+			}
+
+			isize needed = 64 + record->loc.filename.len + record->format.len + 2 * record->fmtLen + record->len;
+			if (len + needed > SI_LOG_BATCH_SIZE) {
+				si__logBatchWrite(logger, len);
+				len = 0;
+			}
+
+			u8* out = &logger->batch[len];
+			isize capacity = SI_LOG_BATCH_SIZE - len;
+			if (logger->format == siLogFormat_Binary) {
+				len += si__logWriteBinary(logger, out, capacity, record);
+			}
+			else {
+				len += si__logFormatLine(
+					logger->prefix, out, capacity, record->time, record->level,
+					record->loc.filename, record->loc.line, SI_STR_LEN((const u8*)(record + 1), record->len)
+				);
+			}
+			ring->readPos += si_alignForward(si_sizeof(si__logRecord) + record->len + record->fmtLen, 8);
+			count += 1;
 		}
 	}
-	res.handle = (isize)handle;
-	res.size = si_fileSize(res);
+	si__logBatchWrite(logger, len);
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	i32 flags;
-	switch (mode) {
-		case siFileMode_Read:
-			flags = O_RDONLY;
-			break;
-		case siFileMode_Write:
-			flags = O_WRONLY | O_CREAT | O_TRUNC;
-			break;
-		case siFileMode_Append:
-			flags = O_WRONLY | O_APPEND | O_CREAT;
-			break;
-		case siFileMode_Read | siFileMode_Plus:
-			flags = O_RDWR;
-			break;
-		case siFileMode_Write | siFileMode_Plus:
-			flags = O_RDWR | O_CREAT | O_TRUNC;
-			break;
-		case siFileMode_Append | siFileMode_Plus:
-			flags = O_RDWR | O_APPEND | O_CREAT;
-			break;
-		default:
-			SI_PANIC_MSG("Invalid file mode.");
-			flags = 0;
-	}
+	return count;
+}
 
-	isize handle;
-	{
-		siOsChar stack[SI_PATH_MAX];
-		si_pathToOS(path, stack, countof(stack));
+#ifndef SI_NO_THREAD
+siIntern
+SI_THREAD_PROC(si__logThread) {
+	siLogger* logger = (siLogger*)data;
 
-		handle = open(stack, flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+	while (si__atomicLoad(&logger->running)) {
+		if (si__logDrain(logger) == 0) {
+			si_sleep(logger->flushInterval);
+		}
 	}
-	SI_ERROR_SYS_CHECK(handle == -1, res.error = SI_ERROR_RES; return res);
-
-	res.handle = handle;
-	res.size = si_fileSize(res);
 
+	return nil;
+}
 #endif
 
-	return res;
-}
 
 SIDEF
-isize si_fileSize(siFile file) {
-	SI_ASSERT_NOT_NEG(file.handle);
+siLogger si_loggerMake(siFile* file, siLogLevel level, siAllocator alloc) {
+	SI_ASSERT_NOT_NIL(file);
 
-#if SI_SYSTEM_IS_WINDOWS
-	ULARGE_INTEGER res = SI_STRUCT_ZERO;
+	siLogger logger = SI_STRUCT_ZERO;
+	logger.file = file;
+	logger.level = level;
+	logger.policy = siLogPolicy_Drop;
+	logger.ringSize = SI_LOG_RING_SIZE;
+	logger.flushInterval = SI_TIME_MS(1);
+	logger.alloc = alloc;
+	logger.id = si__atomicAdd(&si__logIdCounter, 1);
 
-	BY_HANDLE_FILE_INFORMATION data;
-	if (GetFileInformationByHandle((HANDLE)file.handle, &data)) {
-		res.HighPart = data.nFileSizeHigh;
-		res.LowPart = data.nFileSizeLow;
-	}
+	return logger;
+}
 
-	return (ISIZE_MAX < res.QuadPart) ? ISIZE_MAX : (isize)res.QuadPart;
+SIDEF
+siError si_loggerStart(siLogger* logger) {
+	SI_ASSERT_NOT_NIL(logger);
+	SI_ASSERT(si_isPowerOfTwo(logger->ringSize));
+	SI_ASSERT(logger->ringSize >= 2 * (si_sizeof(si__logRecord) + 2 * SI_LOG_MESSAGE_MAX));
+
+	logger->batch = si_allocArrayNonZeroed(logger->alloc, u8, SI_LOG_BATCH_SIZE);
+	logger->prefix = si_formatMake(SI_STR(SI__LOG_PREFIX), logger->alloc);
+
+	if (logger->format == siLogFormat_Binary) {
+		u8 header[countof_str(SI__LOG_MAGIC) + 2 * si_sizeof(u32)];
+		u32 version = SI__LOG_VERSION,
+			endian = 0x01020304;
+
+		isize len = si_memcopy(header, SI__LOG_MAGIC, countof_str(SI__LOG_MAGIC));
+		len += si_memcopy(&header[len], &version, si_sizeof(version));
+		len += si_memcopy(&header[len], &endian, si_sizeof(endian));
+		si_fileWriteStr(logger->file, SI_STR_LEN(header, len));
+	}
 
+	logger->running = true;
+#ifndef SI_NO_THREAD
+	siError error = si_threadMakeAndRun(si__logThread, logger, &logger->thread);
+	if (error.code != 0) {
+		logger->running = false;
+	}
 #else
-	isize prevOffset = si_fileTell(file);
-	isize len = si_fileSeek(file, 0, siSeekWhere_End);
-	si_fileSeek(file, prevOffset, siSeekWhere_Begin);
+	siError error = SI_ERROR_NIL;
+#endif
 
-	return len;
+	return error;
+}
 
+SIDEF
+void si_loggerFlush(siLogger* logger) {
+	SI_ASSERT_NOT_NIL(logger);
+
+#ifndef SI_NO_THREAD
+	if (!si__atomicLoad(&logger->running)) {
+		si__logDrain(logger);
+		return;
+	}
+
+	for (si__logRing* ring = si__logRingLoad(&logger->rings); ring != nil; ring = ring->next) {
+		isize head = si__atomicLoad(&ring->head);
+		while (si__atomicLoad(&ring->tail) < head) {
+			si_sleep(logger->flushInterval);
+		}
+	}
+#else
+	si__logDrain(logger);
 #endif
 }
 
-inline
-void si_fileSizeUpdate(siFile* file) {
-	SI_ASSERT_NOT_NIL(file);
-	file->size = si_fileSize(*file);
-}
+SIDEF
+void si_loggerDestroy(siLogger* logger) {
+	SI_ASSERT_NOT_NIL(logger);
 
-inline
-siArray(u8) si_fileRead(siFile file, isize len, siAllocator alloc) {
-	return si_fileReadAt(file, si_fileTell(file), len, alloc);
-}
-inline
-siArray(u8) si_fileReadAt(siFile file, isize offset, isize len, siAllocator alloc) {
-	u8* data = si_allocArrayNonZeroed(alloc, u8, len);
-	if (data == nil) { return SI_ARR_TYPE(nil, 0, u8); }
+	if (si__atomicLoad(&logger->running)) {
+		si__atomicStore(&logger->running, false);
+	#ifndef SI_NO_THREAD
+		si_threadJoin(&logger->thread);
+		si_threadDestroy(&logger->thread);
+	#endif
+	}
+	if (logger->batch != nil) {
+		si__logDrain(logger);
+		si_free(logger->alloc, logger->batch);
+		si_arrayFree(logger->prefix, logger->alloc);
+	}
+	if (logger->ids.entries != nil) {
+		si_free(logger->alloc, logger->ids.entries);
+		logger->ids = SI_TYPE_ZERO(si__logIdTable);
+	}
 
-	siResult(siArray(u8)) res = si_fileReadEx(file, offset, len, data);
-	return (res.hasValue) ? res.data.value : SI_ARR_TYPE(nil, 0, u8);
-}
+	si__logRing* ring = logger->rings;
+	while (ring != nil) {
+		si__logRing* next = ring->next;
+		si_free(logger->alloc, ring);
+		ring = next;
+	}
 
-inline
-siArray(u8) si_fileReadBuf(siFile file, isize len, siArray(u8) out) {
-	return si_fileReadAtBuf(file, si_fileTell(file), len, out);
+	logger->rings = nil;
+	logger->batch = nil;
+	logger->id = 0;
 }
-inline
-siArray(u8) si_fileReadAtBuf(siFile file, isize offset, isize len, siArray(u8) out) {
-	SI_ASSERT_ARR_TYPE(out, u8);
-	isize minLen = si_min(isize, out.len, len);
 
-	siResult(siArray(u8)) res = si_fileReadEx(file, offset, minLen, out.data);
-	return (res.hasValue) ? res.data.value : SI_ARR_TYPE(nil, 0, u8);
-}
 
-SIDEF
-siResult(siArray(u8)) si_fileReadEx(siFile file, isize offset, isize len, void* out) {
-	SI_ASSERT_NOT_NEG(file.handle);
-	SI_ASSERT_NOT_NEG(offset);
-	SI_ASSERT_NOT_NEG(len);
-	SI_ASSERT_NOT_NIL(out);
+siIntern
+bool si__logfVa(siLogger* logger, siLogLevel level, siCallerLoc loc, u64 site,
+		siString fmt, va_list va) {
+	SI_ASSERT_NOT_NIL(logger);
+	SI_STOPIF(level < logger->level, return false);
+
+	si__logRing* ring = si__logThreadRing(logger);
+	if (ring == nil) {
+		si__atomicAdd(&logger->dropped, 1);
+		return false;
+	}
 
-	isize bytesRead;
+	/* NOTE(EimaMei): Binary records without a call site also store a copy of the
+	 * format, since the string is only guaranteed to live until the call returns. */
+	isize fmtLen = 0;
+	if (logger->format == siLogFormat_Binary && site == 0) {
+		if (fmt.len > SI_LOG_MESSAGE_MAX) {
+			si__atomicAdd(&logger->dropped, 1);
+			return false;
+		}
+		fmtLen = fmt.len;
+	}
 
-#if SI_SYSTEM_IS_WINDOWS
-	si_fileSeek(file, offset, siSeekWhere_Begin);
+	/* NOTE(EimaMei): The message gets formatted straight into the ring, so the
+	 * largest possible record must fit contiguously. If it doesn't, the rest of
+	 * the ring is skipped. */
+	isize mask = ring->size - 1;
+	isize head = ring->head;
+	isize contiguous = ring->size - (head & mask);
+	isize needed = si_sizeof(si__logRecord) + SI_LOG_MESSAGE_MAX + fmtLen;
+	isize total = (contiguous < needed) ? contiguous + needed : needed;
 
-	DWORD read;
-	i32 res = ReadFile(
-		(HANDLE)file.handle, out, (len > UINT32_MAX) ? UINT32_MAX : (u32)len,
-		&read, nil
-	);
-	SI_OPTION_SYS_CHECK(res == 0, siArray(u8));
+	while (head + total - si__atomicLoad(&ring->tail) > ring->size) {
+	#ifndef SI_NO_THREAD
+		if (logger->policy == siLogPolicy_Drop || !si__atomicLoad(&logger->running)) {
+			si__atomicAdd(&logger->dropped, 1);
+			return false;
+		}
+		si_sleep(logger->flushInterval);
+	#else
+		/* NOTE(EimaMei): Without a flusher thread the producer empties the ring
+		 * itself, so no policy has to drop anything. */
+		if (!si__atomicLoad(&logger->running)) {
+			si__atomicAdd(&logger->dropped, 1);
+			return false;
+		}
+		si__logDrain(logger);
+	#endif
+	}
 
-	bytesRead = read;
+	if (contiguous < needed) {
+		if (contiguous >= si_sizeof(si__logRecord)) {
+			si__logRecord* wrap = (si__logRecord*)si_pointerAdd(ring->data, head & mask);
+			wrap->len = -1;
+		}
+		head += contiguous;
+	}
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	bytesRead = pread((int)file.handle, out, (usize)len, offset);
-	SI_OPTION_SYS_CHECK(bytesRead == -1, siArray(u8));
+	si__logRecord* record = (si__logRecord*)si_pointerAdd(ring->data, head & mask);
+	u8* msg = (u8*)(record + 1);
+	isize len = (logger->format == siLogFormat_Binary)
+		? si__logCapture(msg, SI_LOG_MESSAGE_MAX, fmt, va)
+		: si_bprintfVa(SI_ARR_LEN(msg, SI_LOG_MESSAGE_MAX), fmt, va).len;
 
-#else
-	bytesRead = 0;
+	if (fmtLen != 0) {
+		si_memcopy(&msg[len], fmt.data, fmtLen);
+	}
 
-#endif
+	record->time = si_timeNowUTC();
+	record->loc = loc;
+	record->len = len;
+	record->fmtLen = fmtLen;
+	record->site = site;
+	record->format = (site != 0) ? fmt : SI_STR_EMPTY;
+	record->level = level;
 
-	return SI_OPT(siArray(u8), SI_ARR_TYPE(out, bytesRead, u8));
+	head += si_alignForward(si_sizeof(si__logRecord) + len + fmtLen, 8);
+	si__atomicStore(&ring->head, head);
+
+	return true;
 }
 
-inline
-siString si_fileReadContents(siFile file, siAllocator alloc) {
-	siArray(u8) res = si_fileReadContentsArr(file, alloc);
-	return SI_STR_LEN(res.data, res.len);
+SIDEF
+bool si_logf(siLogger* logger, siLogLevel level, siCallerLoc loc, cstring fmt, ...) {
+	va_list va;
+	va_start(va, fmt);
+	bool res = si_logfVaStr(logger, level, loc, SI_CSTR(fmt), va);
+	va_end(va);
+
+	return res;
 }
-inline
-siString si_fileReadContentsBuf(siFile file, siArray(u8) out) {
-	siArray(u8) res = si_fileReadContentsArrBuf(file, out);
-	return SI_STR_LEN(res.data, res.len);
+
+inline
+bool si_logfVa(siLogger* logger, siLogLevel level, siCallerLoc loc, cstring fmt,
+		va_list va) {
+	return si_logfVaStr(logger, level, loc, SI_CSTR(fmt), va);
 }
 
 SIDEF
-siArray(u8) si_fileReadContentsArr(siFile file, siAllocator alloc) {
-	isize oldOffset = si_fileTell(file);
-	siArray(u8) res = si_fileReadAt(file, 0, file.size, alloc);
-	si_fileSeek(file, oldOffset, siSeekWhere_Begin);
-
-	return res;
+bool si_logfVaStr(siLogger* logger, siLogLevel level, siCallerLoc loc,
+		siString fmt, va_list va) {
+	return si__logfVa(logger, level, loc, 0, fmt, va);
 }
+
 SIDEF
-siArray(u8) si_fileReadContentsArrBuf(siFile file, siArray(u8) out) {
-	isize oldOffset = si_fileTell(file);
-	siArray(u8) res = si_fileReadAtBuf(file, 0, file.size, out);
-	si_fileSeek(file, oldOffset, siSeekWhere_Begin);
+bool si_logfSite(siLogger* logger, siLogLevel level, siLogSite* site, cstring fmt, ...) {
+	SI_ASSERT_NOT_NIL(site);
+	SI_UNUSED(fmt);
+
+	isize id = si__atomicLoad(&site->id);
+	if (id == 0) {
+		/* NOTE(EimaMei): Threads that race here each get their own ID, which only
+		 * costs an extra definition in binary logs. */
+		id = si__atomicAdd(&si__logSiteCounter, 1);
+		si__atomicStore(&site->id, id);
+	}
+
+	siCallerLoc loc;
+	loc.filename = site->filename;
+	loc.function = SI_STR_EMPTY;
+	loc.line = site->line;
+
+	va_list va;
+	va_start(va, fmt);
+	bool res = si__logfVa(logger, level, loc, (u64)id, site->format, va);
+	va_end(va);
 
 	return res;
 }
 
+
 SIDEF
-siArray(siString) si_fileReadlines(siFile file, siAllocator alloc) {
-	siString str = si_fileReadContents(file, alloc);
-	siArray(siString) res = si_stringSplitLines(str, alloc);
-	si_free(alloc, (void*)str.data);
+siString si_logLevelStr(siLogLevel level) {
+	static const siString names[siLogLevel_Len] = {
+		SI_STRC("TRACE"), SI_STRC("DEBUG"), SI_STRC("INFO"),
+		SI_STRC("WARN"), SI_STRC("ERROR"), SI_STRC("FATAL")
+	};
 
-	return res;
+	SI_ASSERT(level < siLogLevel_Len);
+	return names[level];
 }
 
-inline
-isize si_fileWrite(siFile* file, siArray(u8) data) {
-	return si_fileWriteAt(file, data, si_fileTell(*file));
-}
 
 SIDEF
-isize si_fileWriteAt(siFile* file, siArray(u8) content, isize offset) {
-	SI_ASSERT_NOT_NIL(file);
-	SI_ASSERT_NOT_NEG(file->handle);
-	SI_ASSERT_ARR_TYPE(content, u8);
+bool si_logDecode(siArray(u8) data, siFile* out, siAllocator alloc) {
+	SI_ASSERT_ARR_TYPE(data, u8);
+	SI_ASSERT_NOT_NIL(out);
 
-	isize bytesWritten;
-#if SI_SYSTEM_IS_WINDOWS
-	si_fileSeek(*file, offset, siSeekWhere_Begin);
+	const u8* ptr = (const u8*)data.data;
+	isize pos = 0;
+	{
+		u8 magic[countof_str(SI__LOG_MAGIC)];
+		u32 version, endian;
+		bool valid = si__logGet(ptr, data.len, &pos, magic, si_sizeof(magic))
+			&& si__logGet(ptr, data.len, &pos, &version, si_sizeof(version))
+			&& si__logGet(ptr, data.len, &pos, &endian, si_sizeof(endian));
+
+		SI_STOPIF(!valid || si_memcompare(magic, SI__LOG_MAGIC, si_sizeof(magic)) != 0, return false);
+		SI_STOPIF(version != SI__LOG_VERSION || endian != 0x01020304, return false);
+	}
 
-	DWORD count;
-	i32 res = WriteFile(
-		(HANDLE)file->handle, content.data, (content.len > UINT32_MAX) ? UINT32_MAX : (u32)content.len,
-		&count, nil
-	);
-	SI_ERROR_SYS_CHECK(res == 0, file->error = SI_ERROR_RES; return -1);
-	bytesWritten = count;
+	siFormat prefix = si_formatMake(SI_STR(SI__LOG_PREFIX), alloc);
+	u8* batch = si_allocArrayNonZeroed(alloc, u8, SI_LOG_BATCH_SIZE);
+	siDynamicArray(si__logDefinition) definitions = si_dynamicArrayMakeReserve(si__logDefinition, 64, alloc);
+	si__logIdTable ids = SI_STRUCT_ZERO;
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	isize curOffset = si_fileSeek(*file, 0, siSeekWhere_Current);
-	bytesWritten = (curOffset == offset)
-		? write((int)file->handle, content.data, (usize)content.len)
-		: pwrite((int)file->handle, content.data, (usize)content.len, offset);
-	SI_ERROR_SYS_CHECK(bytesWritten == -1, file->error = SI_ERROR_RES; return -1);
+	isize len = 0;
+	bool valid = (batch != nil);
+	while (valid && pos < data.len) {
+		u8 tag = ptr[pos];
+		pos += 1;
+
+		siString message = SI_STR_NIL;
+		si__logDefinition* def = nil;
+		i64 time = 0;
+		u8 level = siLogLevel_Info;
+
+		switch (tag) {
+			case 'D': {
+				u64 id;
+				siString fmt;
+				si__logDefinition definition;
+				valid = si__logGet(ptr, data.len, &pos, &id, si_sizeof(id)) && id != 0
+					&& si__logGet(ptr, data.len, &pos, &definition.line, si_sizeof(definition.line))
+					&& si__logGetStr(ptr, data.len, &pos, &definition.filename)
+					&& si__logGetStr(ptr, data.len, &pos, &fmt)
+					&& fmt.data != nil && si__logFormatValid(fmt);
+				SI_STOPIF(!valid, break);
+
+				si__logIdEntry* entry = si__logIdTableGet(&ids, id, alloc);
+				valid = (entry != nil);
+				SI_STOPIF(!valid, break);
+
+				definition.format = si_formatMake(fmt, alloc);
+				entry->value = definitions.len;
+				si_dynamicArrayAppend(&definitions, &definition);
+			} continue;
+
+			case 'R': {
+				u64 id;
+				valid = si__logGet(ptr, data.len, &pos, &id, si_sizeof(id)) && id != 0
+					&& si__logGet(ptr, data.len, &pos, &time, si_sizeof(time))
+					&& si__logGet(ptr, data.len, &pos, &level, si_sizeof(level))
+					&& si__logGetStr(ptr, data.len, &pos, &message)
+					&& message.data != nil && level < siLogLevel_Len;
+				SI_STOPIF(!valid, break);
+
+				si__logIdEntry* entry = si__logIdTableGet(&ids, id, alloc);
+				valid = (entry != nil && entry->value != -1);
+				SI_STOPIF(!valid, break);
+
+				def = (si__logDefinition*)si_dynamicArrayGet(definitions, entry->value);
+			} break;
 
-#elif SI_SYSTEM_IS_WASM
-	struct __wasi_ciovec_t iov;
-	iov.buf = content.data;
-	iov.buf_len = (__wasi_size_t)content.len;
+			case 'M': {
+				valid = si__logGetStr(ptr, data.len, &pos, &message) && message.data != nil;
+			} break;
 
-	__wasi_size_t count;
-	__wasi_errno_t err = __wasi_fd_write((__wasi_fd_t)file->handle, &iov, 1, &count);
-	si__wasmSetLastError(err);
-	SI_ERROR_SYS_CHECK(err != 0, file->error = SI_ERROR_RES; return -1);
+			default: valid = false;
+		}
+		SI_STOPIF(!valid, break);
+
+		isize needed = (def != nil)
+			? 64 + def->filename.len + SI_LOG_MESSAGE_MAX
+			: message.len;
+		if (len + needed > SI_LOG_BATCH_SIZE) {
+			si_fileWriteStr(out, SI_STR_LEN(batch, len));
+			len = 0;
+		}
 
+		if (def != nil) {
+			u8 text[SI_LOG_MESSAGE_MAX];
+			isize textLen = si__logRender(text, countof(text), def->format, message.data, message.len);
+			valid = (textLen >= 0);
+			SI_STOPIF(!valid, break);
 
-	bytesWritten = (isize)count;
+			len += si__logFormatLine(
+				prefix, &batch[len], SI_LOG_BATCH_SIZE - len, time, level,
+				def->filename, def->line, SI_STR_LEN(text, textLen)
+			);
+		}
+		else {
+			len += si_memcopy(&batch[len], message.data, si_min(isize, message.len, SI_LOG_BATCH_SIZE - len));
+		}
+	}
 
-#else
-	bytesWritten = 0;
+	if (batch != nil) {
+		si_fileWriteStr(out, SI_STR_LEN(batch, len));
+		si_free(alloc, batch);
+	}
 
-#endif
+	for_range (i, 0, definitions.len) {
+		si__logDefinition* def = (si__logDefinition*)si_dynamicArrayGet(definitions, i);
+		si_arrayFree(def->format, alloc);
+	}
+	si_dynamicArrayFree(definitions);
+	si_arrayFree(prefix, alloc);
+	if (ids.entries != nil) { si_free(alloc, ids.entries); }
 
-	/* TODO(EimaMei): Have a test on this. */
-	file->size += (offset - file->size) + bytesWritten;
-	return bytesWritten;
+	return valid;
 }
 
-inline
-isize si_fileWriteByte(siFile* file, u8 byte) {
-	return si_fileWritePtr(file, &byte, 1);
-}
+#endif /* SI_IMPLEMENTATION_LOG */
 
+#ifdef SI_IMPLEMENTATION_AIO
 
-inline
-isize si_fileWritePtr(siFile* file, const void* ptr, isize len) {
-	return si_fileWrite(file, SI_ARR_LEN((u8*)ptr, len));
+#if defined(SI_SYSTEM_LINUX) && defined(IORING_FEAT_RW_CUR_POS)
+	#define SI__AIO_IO_URING 1
+#endif
 
-}
+#if !defined(SI_NO_THREAD) && (SI_SYSTEM_IS_WINDOWS || SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN)
+	#define SI__AIO_THREADS 1
+#else
+	/* NOTE(EimaMei): Systems without threads (or builds with 'SI_NO_THREAD')
+	 * always execute the requests inside 'si_aioSubmit'. */
+	#define SI__AIO_THREADS 0
+#endif
 
-inline
-isize si_fileWriteStr(siFile* file, siString str) {
-	return si_fileWritePtr(file, str.data, str.len);
-}
+/* NOTE(EimaMei): Every submitted request is copied into a slot, whose index is
+ * what both backends pass around instead of the request itself. The slot gets
+ * freed once its completion is polled, which is also when the file's size is
+ * updated, as only the polling thread is allowed to touch the 'siFile'. */
+typedef struct si__aioDone {
+	isize slot;
+	isize len;
+	siErrorSystem error;
+} si__aioDone;
+
+#if SI__AIO_IO_URING
+/* NOTE(EimaMei): The rings are shared with the kernel, which writes the SQ head
+ * and the CQ tail, while we write the SQ tail and the CQ head. liburing isn't
+ * used to not require another dependency. */
+typedef struct si__aioRing {
+	int fd;
+	u32 sqMask;
+	u32 cqMask;
+
+	u32* sqHead;
+	u32* sqTail;
+	u32* sqArray;
+	struct io_uring_sqe* sqes;
+
+	u32* cqHead;
+	u32* cqTail;
+	struct io_uring_cqe* cqes;
+
+	void* sqPtr;
+	usize sqSize;
+	void* cqPtr;
+	usize cqSize;
+	usize sqesSize;
+} si__aioRing;
 
+#else
+typedef struct si__aioRing {
+	int fd;
+} si__aioRing;
 
+#endif
 
-inline
-isize si_fileTell(siFile file) {
-	return si_fileSeek(file, 0, siSeekWhere_Current);
-}
+typedef struct si__aioPool {
+#if SI_SYSTEM_IS_WINDOWS
+	SRWLOCK lock;
+	CONDITION_VARIABLE work;
+	CONDITION_VARIABLE done;
+#elif SI__AIO_THREADS
+	pthread_mutex_t lock;
+	pthread_cond_t work;
+	pthread_cond_t done;
+#endif
+	bool running;
+	isize capacity;
+	const siAioRequest* slots;
+	const siFile* files;
+
+	/* Slots waiting for a worker. */
+	isize* queue;
+	isize queueHead;
+	isize queueLen;
+
+	/* Finished slots waiting to be polled. */
+	si__aioDone* completed;
+	isize completedHead;
+	isize completedLen;
+
+#if SI__AIO_THREADS
+	siThread* threads;
+#endif
+	isize threadCount;
+} si__aioPool;
 
-inline
-isize si_fileSeek(siFile file, isize offset, siSeekWhere method) {
-	SI_ASSERT_NOT_NEG(file.handle);
 
 #if SI_SYSTEM_IS_WINDOWS
-	LARGE_INTEGER res;
-	res.QuadPart = offset;
+force_inline void si__aioLock(si__aioPool* pool) { AcquireSRWLockExclusive(&pool->lock); }
+force_inline void si__aioUnlock(si__aioPool* pool) { ReleaseSRWLockExclusive(&pool->lock); }
+force_inline void si__aioWait(si__aioPool* pool, CONDITION_VARIABLE* cond) { SleepConditionVariableSRW(cond, &pool->lock, INFINITE, 0); }
+force_inline void si__aioSignal(CONDITION_VARIABLE* cond) { WakeConditionVariable(cond); }
+force_inline void si__aioBroadcast(CONDITION_VARIABLE* cond) { WakeAllConditionVariable(cond); }
+
+#elif SI__AIO_THREADS
+force_inline void si__aioLock(si__aioPool* pool) { pthread_mutex_lock(&pool->lock); }
+force_inline void si__aioUnlock(si__aioPool* pool) { pthread_mutex_unlock(&pool->lock); }
+force_inline void si__aioWait(si__aioPool* pool, pthread_cond_t* cond) { pthread_cond_wait(cond, &pool->lock); }
+force_inline void si__aioSignal(pthread_cond_t* cond) { pthread_cond_signal(cond); }
+force_inline void si__aioBroadcast(pthread_cond_t* cond) { pthread_cond_broadcast(cond); }
 
-	SetFilePointerEx((HANDLE)file.handle, res, &res, (u32)method);
-	return (ISIZE_MAX < res.QuadPart)
-		? ISIZE_MAX
-		: (isize)res.QuadPart;
+#endif
 
-#elif SI_SYSTEM_IS_APPLE
-	return lseek((int)file.handle, offset, method);
 
-#elif SI_SYSTEM_IS_UNIX
-	return lseek64((int)file.handle, offset, method);
+/* NOTE(EimaMei): 'file' is the slot's copy of the request's file, since the
+ * original one can only be touched by the polling thread. */
+siIntern
+si__aioDone si__aioExecute(siAioRequest req, siFile file) {
+	si__aioDone res = SI_STRUCT_ZERO;
 
-#else
-	return 0;
-	SI_UNUSED(offset); SI_UNUSED(method);
+	switch (req.op) {
+		case siAioOp_Read: {
+		#if SI_SYSTEM_IS_WINDOWS
+			/* NOTE(EimaMei): 'si_fileReadEx' seeks before reading on Windows,
+			 * which would race with the other workers. */
+			OVERLAPPED overlapped = SI_STRUCT_ZERO;
+			overlapped.Offset = (DWORD)((u64)req.offset & 0xFFFFFFFF);
+			overlapped.OffsetHigh = (DWORD)((u64)req.offset >> 32);
+
+			DWORD read;
+			BOOL ok = ReadFile(
+				(HANDLE)file.handle, req.buffer.data,
+				(req.buffer.len > UINT32_MAX) ? UINT32_MAX : (u32)req.buffer.len,
+				&read, &overlapped
+			);
+			if (!ok && GetLastError() != ERROR_HANDLE_EOF) {
+				res.len = -1;
+				res.error = si_systemGetError();
+				break;
+			}
+			res.len = ok ? (isize)read : 0;
 
-#endif
-}
+		#else
+			siResult(siArray(u8)) data = si_fileReadEx(file, req.offset, req.buffer.len, req.buffer.data);
+			if (!data.hasValue) {
+				res.len = -1;
+				res.error = (siErrorSystem)data.data.error.code;
+				break;
+			}
+			res.len = data.data.value.len;
 
-inline
-bool si_fileSeekFront(siFile file) {
-	return si_fileSeek(file, 0, siSeekWhere_Begin) != 0;
-}
+		#endif
+		} break;
 
-inline
-bool si_fileSeekBack(siFile file) {
-	return si_fileSeek(file, 0, siSeekWhere_End) != 0;
-}
-SIDEF
-bool si_fileTruncate(siFile* file, isize size) {
-	SI_ASSERT_NOT_NIL(file);
-	SI_ASSERT_NOT_NEG(file->handle);
-	SI_ASSERT_NOT_NEG(size);
+		case siAioOp_Write: {
+		#if SI_SYSTEM_IS_WINDOWS
+			OVERLAPPED overlapped = SI_STRUCT_ZERO;
+			overlapped.Offset = (DWORD)((u64)req.offset & 0xFFFFFFFF);
+			overlapped.OffsetHigh = (DWORD)((u64)req.offset >> 32);
+
+			DWORD written;
+			BOOL ok = WriteFile(
+				(HANDLE)file.handle, req.buffer.data,
+				(req.buffer.len > UINT32_MAX) ? UINT32_MAX : (u32)req.buffer.len,
+				&written, &overlapped
+			);
+			if (!ok) {
+				res.len = -1;
+				res.error = si_systemGetError();
+				break;
+			}
+			res.len = (isize)written;
 
-#if SI_SYSTEM_IS_WINDOWS
-	isize prevOffset = si_fileTell(*file);
-	isize res = si_fileSeek(*file, size, siSeekWhere_Begin);
-	SI_STOPIF(res == 0, return false);
+		#else
+			res.len = si_fileWriteAt(&file, req.buffer, req.offset);
+			if (res.len == -1) {
+				res.error = (siErrorSystem)file.error.code;
+			}
 
-	res = SetEndOfFile((HANDLE)file->handle);
-	SI_ERROR_SYS_CHECK(res == 0, file->error = SI_ERROR_SYS_EX(siErrorSystem_TruncationFail); return false);
+		#endif
+		} break;
 
-	si_fileSeek(*file, prevOffset, siSeekWhere_Begin);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	int res = ftruncate((int)file->handle, size);
-	SI_ERROR_SYS_CHECK(res == -1, file->error = SI_ERROR_SYS_EX(siErrorSystem_TruncationFail); return false);
-#else
-	return false;
+		case siAioOp_Sync:
+		case siAioOp_SyncData: {
+			if (!si_fileSync(&file, req.op == siAioOp_SyncData)) {
+				res.len = -1;
+				res.error = (siErrorSystem)file.error.code;
+			}
+		} break;
 
-#endif
+		default: SI_PANIC();
+	}
 
-	return true;
+	return res;
 }
 
-SIDEF
-siTime si_fileLastWriteTime(siFile file) {
-#if SI_SYSTEM_IS_WINDOWS
-	BY_HANDLE_FILE_INFORMATION data;
+siIntern
+void si__aioPoolComplete(si__aioPool* pool, si__aioDone done) {
+	isize index = (pool->completedHead + pool->completedLen) % pool->capacity;
+	pool->completed[index] = done;
+	pool->completedLen += 1;
+}
 
-	i32 res = GetFileInformationByHandle((HANDLE)file.handle, &data);
-	if (!res) { return 0; }
+#if SI__AIO_THREADS
+siIntern
+SI_THREAD_PROC(si__aioWorker) {
+	si__aioPool* pool = (si__aioPool*)data;
 
-	FILETIME time = data.ftLastWriteTime;
-	return si__win32ToSili((i64)time.dwHighDateTime << 32 | (i64)time.dwLowDateTime);
+	si__aioLock(pool);
+	while (true) {
+		while (pool->queueLen == 0 && pool->running) {
+			si__aioWait(pool, &pool->work);
+		}
+		SI_STOPIF(pool->queueLen == 0, break);
 
-#elif SI_SYSTEM_IS_UNIX
-	struct stat fs;
-	int res = fstat((int)file.handle, &fs);
-	return (res == 0) ? SI_TIME_S(fs.st_mtim.tv_sec) + fs.st_mtim.tv_nsec : 0;
+		isize slot = pool->queue[pool->queueHead];
+		pool->queueHead = (pool->queueHead + 1) % pool->capacity;
+		pool->queueLen -= 1;
+		si__aioUnlock(pool);
 
-#elif SI_SYSTEM_IS_BSD
-	struct stat fs;
-	int res = fstat((int)file.handle, &fs);
-	return (res == 0) ? SI_TIME_S(fs.st_mtimespec.tv_sec) + fs.st_mtimespec.tv_nsec : 0;
+		si__aioDone done = si__aioExecute(pool->slots[slot], pool->files[slot]);
+		done.slot = slot;
 
-#else
-	return 0;
-	SI_UNUSED(file);
+		si__aioLock(pool);
+		si__aioPoolComplete(pool, done);
+		si__aioSignal(&pool->done);
+	}
+	si__aioUnlock(pool);
 
+	return nil;
+}
 #endif
 
+siIntern
+bool si__aioPoolMake(siAio* aio, isize threadCount) {
+	si__aioPool* pool = si_allocItem(aio->alloc, si__aioPool);
+	pool->running = true;
+	pool->capacity = aio->capacity;
+	pool->slots = aio->slots;
+	pool->files = aio->files;
+	pool->queue = si_allocArrayNonZeroed(aio->alloc, isize, aio->capacity);
+	pool->completed = si_allocArrayNonZeroed(aio->alloc, si__aioDone, aio->capacity);
+	aio->pool = pool;
 
-}
+#if SI_SYSTEM_IS_WINDOWS
+	InitializeSRWLock(&pool->lock);
+	InitializeConditionVariable(&pool->work);
+	InitializeConditionVariable(&pool->done);
 
-inline
-void si_fileClose(siFile* file) {
-	SI_ASSERT_NOT_NIL(file);
-	SI_ASSERT_NOT_NEG(file->handle);
+#elif SI__AIO_THREADS
+	pthread_mutex_init(&pool->lock, nil);
+	pthread_cond_init(&pool->work, nil);
+	pthread_cond_init(&pool->done, nil);
 
-#if SI_SYSTEM_IS_WINDOWS
-	CloseHandle((HANDLE)file->handle);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	close((int)file->handle);
 #endif
-}
 
-SIDEF
-siDirectory si_directoryOpen(siString path) {
-	SI_ASSERT_NOT_NIL(path.data);
-	SI_ASSERT(path.len <= SI_PATH_MAX);
+#if SI__AIO_THREADS
+	SI_STOPIF(threadCount == 0, return true);
+	pool->threads = si_allocArray(aio->alloc, siThread, threadCount);
 
-	siDirectory dir;
-	dir.error = SI_ERROR_NIL;
-	dir.handle = nil;
-	dir.directoryLen = path.len;
-	si_memcopyStr(dir.buffer, path);
+	for_range (i, 0, threadCount) {
+		siError error = si_threadMakeAndRun(si__aioWorker, pool, &pool->threads[i]);
+		SI_STOPIF(error.code != 0, return false);
+		pool->threadCount += 1;
+	}
 
-	if (si_stringAtBack(path) != SI_PATH_SEPARATOR) {
-		dir.buffer[dir.directoryLen] = SI_PATH_SEPARATOR;
-		dir.directoryLen += 1;
+#else
+	SI_UNUSED(threadCount);
+
+#endif
+
+	return true;
+}
+
+siIntern
+void si__aioPoolFree(siAio* aio) {
+	si__aioPool* pool = aio->pool;
+	SI_STOPIF(pool == nil, return);
+
+#if SI__AIO_THREADS
+	si__aioLock(pool);
+	pool->running = false;
+	si__aioBroadcast(&pool->work);
+	si__aioUnlock(pool);
+
+	for_range (i, 0, pool->threadCount) {
+		si_threadJoin(&pool->threads[i]);
+		si_threadDestroy(&pool->threads[i]);
 	}
 
-#if SI_SYSTEM_IS_WINDOWS
-	siOsChar stack[SI_PATH_MAX];
-	siUtf16String pathWide = si_utf8ToUtf16Str(
-		SI_STR_LEN(dir.buffer, dir.directoryLen),
-		SI_ARR_LEN(stack, countof(stack) - 2)
-	);
+	#if !SI_SYSTEM_IS_WINDOWS
+	pthread_cond_destroy(&pool->done);
+	pthread_cond_destroy(&pool->work);
+	pthread_mutex_destroy(&pool->lock);
+	#endif
+	si_free(aio->alloc, pool->threads);
+#endif
 
-	stack[pathWide.len + 0] = '*';
-	stack[pathWide.len + 1] = '\0';
+	si_free(aio->alloc, pool->completed);
+	si_free(aio->alloc, pool->queue);
+	si_free(aio->alloc, pool);
+	aio->pool = nil;
+}
 
-	WIN32_FIND_DATAW tmp;
-	HANDLE handle = FindFirstFileW(stack, &tmp);
-	SI_ERROR_SYS_CHECK(handle == INVALID_HANDLE_VALUE, dir.error = SI_ERROR_RES; return dir);
+siIntern
+void si__aioPoolSubmit(siAio* aio, const isize* slots, isize count) {
+	si__aioPool* pool = aio->pool;
+
+	if (pool->threadCount == 0) {
+		for_range (i, 0, count) {
+			si__aioDone done = si__aioExecute(aio->slots[slots[i]], aio->files[slots[i]]);
+			done.slot = slots[i];
+			si__aioPoolComplete(pool, done);
+		}
+		return;
+	}
 
-	dir.handle = handle;
-	SI_DISCARD(FindNextFileW(handle, &tmp));
+#if SI__AIO_THREADS
+	si__aioLock(pool);
+	for_range (i, 0, count) {
+		isize index = (pool->queueHead + pool->queueLen) % pool->capacity;
+		pool->queue[index] = slots[i];
+		pool->queueLen += 1;
+	}
+	si__aioBroadcast(&pool->work);
+	si__aioUnlock(pool);
+#endif
+}
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	/* NOTE(EimaMei): We do this because opendir only takes NULL-terminated C-strings. */
-	dir.buffer[dir.directoryLen] = '\0';
+siIntern
+isize si__aioPoolPoll(siAio* aio, si__aioDone* out, isize len, isize minCount) {
+	si__aioPool* pool = aio->pool;
 
-	dir.handle = opendir((char*)dir.buffer);
-	SI_ERROR_SYS_CHECK(dir.handle == nil, dir.error = SI_ERROR_RES; return dir);
+#if SI__AIO_THREADS
+	si__aioLock(pool);
+	while (pool->completedLen < minCount) {
+		si__aioWait(pool, &pool->done);
+	}
+#else
+	SI_UNUSED(minCount);
+#endif
 
+	isize count = si_min(isize, pool->completedLen, len);
+	for_range (i, 0, count) {
+		out[i] = pool->completed[pool->completedHead];
+		pool->completedHead = (pool->completedHead + 1) % pool->capacity;
+	}
+	pool->completedLen -= count;
+#if SI__AIO_THREADS
+	si__aioUnlock(pool);
 #endif
 
-	return dir;
+	return count;
 }
 
-inline
-bool si_directoryIterate(siDirectory* dir, siDirectoryIterator* out) {
-	return si_directoryIterateEx(dir, true, out);
-}
 
-SIDEF
-bool si_directoryIterateEx(siDirectory* dir, bool fullPath, siDirectoryIterator* out) {
-	SI_ASSERT_NOT_NIL(dir);
-	SI_ASSERT_NOT_NIL(out);
-	SI_ASSERT_NOT_NIL(dir->handle);
+#if SI__AIO_IO_URING
+siIntern
+bool si__aioRingMake(siAio* aio) {
+	struct io_uring_params params;
+	si_memset(&params, 0, si_sizeof(params));
+
+	int fd = (int)syscall(__NR_io_uring_setup, (u32)aio->capacity, &params);
+	SI_STOPIF(fd < 0, return false);
+
+	/* NOTE(EimaMei): 'IORING_OP_READ' and 'IORING_OP_WRITE' were added in the
+	 * same version as this feature. */
+	if ((params.features & IORING_FEAT_RW_CUR_POS) == 0) {
+		close(fd);
+		errno = ENOSYS;
+		return false;
+	}
 
-#if SI_SYSTEM_IS_WINDOWS
-	WIN32_FIND_DATAW file;
-	if (FindNextFileW(dir->handle, &file) == 0) {
-		siErrorSystem code = si_systemGetError();
-		si_directoryClose(dir);
+	si__aioRing* ring = si_allocItem(aio->alloc, si__aioRing);
+	ring->fd = fd;
+	ring->sqSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+	ring->cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
 
-		SI_ERROR_SYS_CHECK(code != 0, dir->error = SI_ERROR_RES; return false);
-		return false;
+	bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+	if (singleMap) {
+		ring->sqSize = ring->cqSize = si_max(usize, ring->sqSize, ring->cqSize);
 	}
 
-	if ((file.dwFileAttributes & (FILE_ATTRIBUTE_DIRECTORY | FILE_ATTRIBUTE_REPARSE_POINT)) == 0) {
-		out->type = siIoType_File;
+	ring->sqPtr = mmap(nil, ring->sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	ring->cqPtr = singleMap
+		? ring->sqPtr
+		: mmap(nil, ring->cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+	ring->sqes = (struct io_uring_sqe*)mmap(nil, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	aio->ring = ring;
+
+	SI_STOPIF(ring->sqPtr == MAP_FAILED || ring->cqPtr == MAP_FAILED || ring->sqes == MAP_FAILED, return false);
+
+	/* NOTE(EimaMei): The kernel places every field at a suitably aligned offset. */
+	void* sq = ring->sqPtr;
+	ring->sqHead = (u32*)si_pointerAdd(sq, params.sq_off.head);
+	ring->sqTail = (u32*)si_pointerAdd(sq, params.sq_off.tail);
+	ring->sqMask = *(u32*)si_pointerAdd(sq, params.sq_off.ring_mask);
+	ring->sqArray = (u32*)si_pointerAdd(sq, params.sq_off.array);
+
+	void* cq = ring->cqPtr;
+	ring->cqHead = (u32*)si_pointerAdd(cq, params.cq_off.head);
+	ring->cqTail = (u32*)si_pointerAdd(cq, params.cq_off.tail);
+	ring->cqMask = *(u32*)si_pointerAdd(cq, params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe*)si_pointerAdd(cq, params.cq_off.cqes);
+
+	return true;
+}
+
+siIntern
+void si__aioRingFree(siAio* aio) {
+	si__aioRing* ring = aio->ring;
+	SI_STOPIF(ring == nil, return);
+
+	if (ring->sqes != nil && ring->sqes != MAP_FAILED) {
+		munmap(ring->sqes, ring->sqesSize);
 	}
-	else if (file.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
-		out->type = siIoType_Directory;
+	if (ring->cqPtr != nil && ring->cqPtr != MAP_FAILED && ring->cqPtr != ring->sqPtr) {
+		munmap(ring->cqPtr, ring->cqSize);
 	}
-	else {
-		out->type = siIoType_Link;
+	if (ring->sqPtr != nil && ring->sqPtr != MAP_FAILED) {
+		munmap(ring->sqPtr, ring->sqSize);
 	}
+	close(ring->fd);
 
-	siString data = si_utf16ToUtf8Str(
-		SI_ARR_LEN(file.cFileName, SI_PATH_MAX),
-		SI_ARR_LEN(&dir->buffer[dir->directoryLen], si_sizeof(dir->buffer) - dir->directoryLen)
-	);
+	si_free(aio->alloc, ring);
+	aio->ring = nil;
+}
 
-	out->path = (fullPath)
-		? SI_STR_LEN(dir->buffer, dir->directoryLen + data.len)
-		: data;
+/* Submits the queued entries that the kernel hasn't consumed yet, waiting for
+ * 'minComplete' completions if it isn't zero. */
+siIntern
+bool si__aioRingEnter(si__aioRing* ring, u32 minComplete) {
+	u32 toSubmit = *ring->sqTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+	u32 flags = (minComplete != 0) ? IORING_ENTER_GETEVENTS : 0;
+	SI_STOPIF(toSubmit == 0 && minComplete == 0, return true);
+
+	while (true) {
+		long res = syscall(__NR_io_uring_enter, ring->fd, toSubmit, minComplete, flags, nil, 0);
+		SI_STOPIF(res >= 0, return true);
+		SI_STOPIF(errno == EINTR, continue);
+
+		/* NOTE(EimaMei): The kernel is out of resources for the moment, the
+		 * entries stay in the queue and get submitted with the next call. */
+		return (errno == EAGAIN || errno == EBUSY) && minComplete == 0;
+	}
+}
 
-	return true;
+siIntern
+void si__aioRingSubmit(siAio* aio, const isize* slots, isize count) {
+	si__aioRing* ring = aio->ring;
+	u32 tail = *ring->sqTail;
 
+	for_range (i, 0, count) {
+		const siAioRequest* req = &aio->slots[slots[i]];
+		u32 index = tail & ring->sqMask;
+
+		struct io_uring_sqe* sqe = &ring->sqes[index];
+		si_memset(sqe, 0, si_sizeof(*sqe));
+		sqe->fd = (i32)aio->files[slots[i]].handle;
+		sqe->user_data = (u64)slots[i];
+
+		switch (req->op) {
+			case siAioOp_Read:
+			case siAioOp_Write: {
+				bool fixed = (req->bufferIndex >= 0);
+				if (req->op == siAioOp_Read) {
+					sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+				}
+				else {
+					sqe->opcode = fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+				}
+				sqe->off = (u64)req->offset;
+				sqe->addr = (u64)(usize)req->buffer.data;
+				sqe->len = (u32)si_min(isize, req->buffer.len, INT32_MAX);
+				sqe->buf_index = fixed ? (u16)req->bufferIndex : 0;
+			} break;
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	struct dirent* dirEntry = readdir((DIR*)dir->handle);
-	if (dirEntry == nil) {
-		errno = 0;
-		siErrorSystem code = si_systemGetError();
-		si_directoryClose(dir);
+			case siAioOp_Sync:
+			case siAioOp_SyncData: {
+				sqe->opcode = IORING_OP_FSYNC;
+				sqe->fsync_flags = (req->op == siAioOp_SyncData) ? IORING_FSYNC_DATASYNC : 0;
+			} break;
 
-		SI_ERROR_SYS_CHECK(code != 0, dir->error = SI_ERROR_RES; return false);
-		return false;
+			default: SI_PANIC();
+		}
+
+		ring->sqArray[index] = index;
+		tail += 1;
 	}
+	__atomic_store_n(ring->sqTail, tail, __ATOMIC_RELEASE);
 
-	static const u8 IO_types[15] = {
-		0,
-		siIoType_Fifo,
-		siIoType_Device, 0,
-		siIoType_Directory, 0,
-		siIoType_Block, 0,
-		siIoType_File, 0,
-		siIoType_Link, 0,
-		siIoType_Socket, 0, 0
-	};
-	out->type = IO_types[dirEntry->d_type];
+	/* NOTE(EimaMei): If this fails, the entries stay queued and the error gets
+	 * reported by the next 'si_aioPoll'. */
+	si__aioRingEnter(ring, 0);
+}
 
-	isize len = si_cstrLen(dirEntry->d_name);
-	switch (len) {
-		case 1:
-			if (dirEntry->d_name[0] == '.') { return si_directoryIterateEx(dir, fullPath, out); }
-			break;
-		case 2:
-			if (dirEntry->d_name[0] == '.' && dirEntry->d_name[1] == '.') { return si_directoryIterateEx(dir, fullPath, out); }
-			break;
-	}
+siIntern
+isize si__aioRingPoll(siAio* aio, si__aioDone* out, isize len, isize minCount) {
+	si__aioRing* ring = aio->ring;
 
-	u8* data = &dir->buffer[dir->directoryLen];
-	len = si_memcopy_s(
-		SI_ARR_LEN(data, si_sizeof(dir->buffer) - dir->directoryLen),
-		dirEntry->d_name, len
-	);
+	isize count = 0;
+	while (true) {
+		u32 head = *ring->cqHead,
+			tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+
+		while (head != tail && count < len) {
+			const struct io_uring_cqe* cqe = &ring->cqes[head & ring->cqMask];
+			out[count].slot = (isize)cqe->user_data;
+			out[count].len = (cqe->res < 0) ? -1 : cqe->res;
+			out[count].error = siErrorSystem_None;
+
+			if (cqe->res < 0) {
+				/* NOTE(EimaMei): The result is a negated errno value. */
+				errno = -cqe->res;
+				out[count].error = si_systemGetError();
+			}
 
-	out->path = (fullPath)
-		? SI_STR_LEN(dir->buffer, dir->directoryLen + len)
-		: SI_STR_LEN(data, len);
+			head += 1;
+			count += 1;
+		}
+		__atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+		SI_STOPIF(count >= minCount, break);
 
-	return true;
-#else
-	return false;
+		bool res = si__aioRingEnter(ring, (u32)(minCount - count));
+		SI_ERROR_SYS_CHECK(!res, return (count != 0) ? count : -1);
+	}
 
-#endif
+	return count;
 }
 
-inline
-void si_directoryClose(siDirectory* dir) {
-	SI_ASSERT_NOT_NIL(dir);
-	SI_STOPIF(dir->handle == nil, return);
+#else
+siIntern bool si__aioRingMake(siAio* aio) { SI_UNUSED(aio); return false; }
+siIntern void si__aioRingFree(siAio* aio) { SI_UNUSED(aio); }
+siIntern void si__aioRingSubmit(siAio* aio, const isize* slots, isize count) { SI_UNUSED(aio); SI_UNUSED(slots); SI_UNUSED(count); }
+siIntern isize si__aioRingPoll(siAio* aio, si__aioDone* out, isize len, isize minCount) { SI_UNUSED(aio); SI_UNUSED(out); SI_UNUSED(len); SI_UNUSED(minCount); return -1; }
 
-#if SI_SYSTEM_IS_WINDOWS
-	CloseHandle(dir->handle);
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
-	closedir((DIR*)dir->handle);
 #endif
-	dir->handle = nil;
-}
 
 
-#endif /* SI_IMPLEMENTATION_IO */
+inline
+siAioRequest si_aioRead(siFile* file, isize offset, siArray(u8) buffer, void* userData) {
+	SI_ASSERT_NOT_NIL(file);
+	SI_ASSERT_NOT_NEG(offset);
+	SI_ASSERT_ARR_TYPE(buffer, u8);
 
-#ifdef SI_IMPLEMENTATION_THREAD
+	siAioRequest req = SI_STRUCT_ZERO;
+	req.op = siAioOp_Read;
+	req.bufferIndex = -1;
+	req.file = file;
+	req.offset = offset;
+	req.buffer = buffer;
+	req.userData = userData;
 
-#if SI_SYSTEM_IS_WINDOWS
+	return req;
+}
 
-siIntern
-DWORD WINAPI si__threadProc(LPVOID arg) {
-	siThread* t = (siThread*)arg;
-	t->returnValue = t->func(t->arg);
-	t->state = siThreadState_Initialized;
+inline
+siAioRequest si_aioWrite(siFile* file, isize offset, siArray(u8) buffer, void* userData) {
+	siAioRequest req = si_aioRead(file, offset, buffer, userData);
+	req.op = siAioOp_Write;
 
-	return 0;
+	return req;
 }
 
-#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN
+inline
+siAioRequest si_aioSync(siFile* file, bool dataOnly, void* userData) {
+	SI_ASSERT_NOT_NIL(file);
+
+	siAioRequest req = SI_STRUCT_ZERO;
+	req.op = dataOnly ? siAioOp_SyncData : siAioOp_Sync;
+	req.bufferIndex = -1;
+	req.file = file;
+	req.userData = userData;
+
+	return req;
+}
 
 siIntern
-void* si__threadProc(void* arg) {
-	#if SI_SYSTEM_EMSCRIPTEN
-	si_sleep(SI_TIME_MS(1));
-	#endif
+siErrorSystem si__aioMake(isize capacity, siAioBackend backend, isize threadCount,
+		siAllocator alloc, siAio* out) {
+#if !SI__AIO_IO_URING
+	SI_STOPIF(backend == siAioBackend_IoUring, return siErrorSystem_Unavailable);
+#endif
 
-	siThread* t = (siThread*)arg;
-	t->returnValue = t->func(t->arg);
-	t->state = siThreadState_Initialized;
+	siAio aio = SI_STRUCT_ZERO;
+	aio.backend = backend;
+	aio.capacity = capacity;
+	aio.alloc = alloc;
+	aio.slots = si_allocArray(alloc, siAioRequest, capacity);
+	aio.files = si_allocArray(alloc, siFile, capacity);
+	aio.freeSlots = si_allocArrayNonZeroed(alloc, isize, capacity);
+	for_range (i, 0, capacity) {
+		aio.freeSlots[i] = capacity - i - 1;
+	}
 
-	return nil;
+	bool res = (backend == siAioBackend_IoUring)
+		? si__aioRingMake(&aio)
+		: si__aioPoolMake(&aio, threadCount);
+	if (!res) {
+		siErrorSystem error = si_systemGetError();
+		si_aioDestroy(&aio);
+		return (error != siErrorSystem_None) ? error : siErrorSystem_Unavailable;
+	}
+
+	*out = aio;
+	return siErrorSystem_None;
 }
-#endif
 
+SIDEF
+siError si_aioMake(isize capacity, siAllocator alloc, siAio* out) {
+	/* NOTE(EimaMei): io_uring might be unavailable even on Linux (e.g. disabled
+	 * by a seccomp filter), which isn't worth reporting as an error. */
+	siErrorSystem error = si__aioMake(capacity, siAioBackend_IoUring, 0, alloc, out);
+	SI_STOPIF(error == siErrorSystem_None, return SI_ERROR_NIL);
 
-inline
-siThread si_threadMake(siThreadFunction function, void* arg) {
-	return si_threadMakeEx(function, arg, 0);
+	return si_aioMakeEx(capacity, siAioBackend_Threads, SI_AIO_THREAD_COUNT, alloc, out);
 }
 
-inline
-siThread si_threadMakeEx(siThreadFunction function, void* arg, usize stackSize) {
-	SI_ASSERT_NOT_NIL(function);
+SIDEF
+siError si_aioMakeEx(isize capacity, siAioBackend backend, isize threadCount,
+		siAllocator alloc, siAio* out) {
+	SI_ASSERT_NOT_NIL(out);
+	SI_ASSERT(capacity > 0 && capacity <= SI_KILO(32));
+	SI_ASSERT_NOT_NEG(threadCount);
 
-	siThread thread = SI_STRUCT_ZERO;
-	thread.func = function;
-	thread.arg = arg;
-	thread.stackSize = stackSize;
-	thread.state = siThreadState_Initialized;
+	siErrorSystem error = si__aioMake(capacity, backend, threadCount, alloc, out);
+	SI_ERROR_CHECK_EX_RET(error != siErrorSystem_None, error, si_systemErrorLog, nil);
 
-	return thread;
+	return SI_ERROR_NIL;
 }
 
 SIDEF
-siError si_threadMakeAndRun(siThreadFunction function, void* arg, siThread* out) {
-	*out = si_threadMake(function, arg);
-	return si_threadRun(out);
+siError si_aioRegisterBuffers(siAio* aio, siArray(siArray(u8)) buffers) {
+	SI_ASSERT_NOT_NIL(aio);
+	SI_ASSERT_ARR_TYPE(buffers, siArrayAny);
+	SI_ASSERT(aio->inFlight == 0);
+	SI_STOPIF(aio->backend != siAioBackend_IoUring, return SI_ERROR_NIL);
+
+#if SI__AIO_IO_URING
+	struct iovec* iov = si_allocArrayNonZeroed(aio->alloc, struct iovec, buffers.len);
+	const siArray(u8)* arrays = (const siArray(u8)*)buffers.data;
+	for_range (i, 0, buffers.len) {
+		iov[i].iov_base = (void*)arrays[i].data;
+		iov[i].iov_len = (usize)arrays[i].len;
+	}
+
+	/* NOTE(EimaMei): Buffers that were registered before have to be
+	 * unregistered first. */
+	syscall(__NR_io_uring_register, aio->ring->fd, IORING_UNREGISTER_BUFFERS, nil, 0);
+	long res = syscall(__NR_io_uring_register, aio->ring->fd, IORING_REGISTER_BUFFERS, iov, (u32)buffers.len);
+	si_free(aio->alloc, iov);
+	SI_ERROR_SYS_CHECK_RET(res < 0);
+
+#endif
+
+	return SI_ERROR_NIL;
 }
 
 SIDEF
-siError si_threadRun(siThread* thread) {
-	SI_ASSERT_NOT_NIL(thread);
-	SI_ASSERT(thread->state == siThreadState_Initialized);
-
-	#if SI_SYSTEM_IS_WINDOWS
-		thread->id = CreateThread(nil, thread->stackSize, si__threadProc, thread, 0, nil);
-		SI_ERROR_SYS_CHECK_RET(thread->id == nil);
+isize si_aioSubmit(siAio* aio, siArray(siAioRequest) requests) {
+	SI_ASSERT_NOT_NIL(aio);
+	SI_ASSERT_ARR_TYPE(requests, siAioRequest);
 
-	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN
-		pthread_attr_t attr;
-		pthread_attr_t* attrPtr = nil;
-		if (thread->stackSize != 0) {
-			int res = pthread_attr_init(&attr);
-			if (res != 0) {
-				pthread_attr_setstacksize(&attr, thread->stackSize);
-				attrPtr = &attr;
-			}
-		}
+	isize count = si_min(isize, requests.len, aio->capacity - aio->inFlight);
+	SI_STOPIF(count == 0, return 0);
 
-		pthread_t id;
-		{
-			int res = pthread_create(&id, attrPtr, si__threadProc, thread);
-			SI_ERROR_SYS_CHECK_RET(res != 0);
-		}
-		thread->id = id;
+	const siAioRequest* reqs = (const siAioRequest*)requests.data;
+	isize* slots = &aio->freeSlots[aio->capacity - aio->inFlight - count];
+	for_range (i, 0, count) {
+		SI_ASSERT_NOT_NIL(reqs[i].file);
+		aio->slots[slots[i]] = reqs[i];
+		aio->files[slots[i]] = *reqs[i].file;
+	}
 
-		if (attrPtr) {
-			pthread_attr_destroy(&attr);
-		}
-	#else
-		return SI_ERROR_NIL;
-	#endif
+	if (aio->backend == siAioBackend_IoUring) {
+		si__aioRingSubmit(aio, slots, count);
+	}
+	else {
+		si__aioPoolSubmit(aio, slots, count);
+	}
+	aio->inFlight += count;
 
-	thread->state = siThreadState_Running;
-	return SI_ERROR_NIL;
+	return count;
 }
 
 SIDEF
-siError si_threadJoin(siThread* thread) {
-	SI_ASSERT_NOT_NIL(thread);
-	SI_ASSERT_NOT_NIL((void*)thread->id);
+isize si_aioPoll(siAio* aio, siArray(siAioCompletion) out, isize minCount) {
+	SI_ASSERT_NOT_NIL(aio);
+	SI_ASSERT_ARR_TYPE(out, siAioCompletion);
+	SI_ASSERT_NOT_NEG(minCount);
 
-	#if SI_SYSTEM_IS_WINDOWS
-		DWORD res = WaitForSingleObject(thread->id, INFINITE);
-		SI_ERROR_SYS_CHECK_RET(res != 0);
-	#elif SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE || SI_SYSTEM_EMSCRIPTEN
-		int res = pthread_join(thread->id, nil);
-		SI_ERROR_SYS_CHECK_RET(res != 0);
-	#endif
+	minCount = si_min(isize, minCount, si_min(isize, out.len, aio->inFlight));
 
-	return SI_ERROR_NIL;
+	si__aioDone done[64];
+	siAioCompletion* completions = (siAioCompletion*)out.data;
+
+	isize count = 0;
+	while (count < out.len && aio->inFlight != 0) {
+		isize len = si_min(isize, out.len - count, countof(done)),
+			  min = si_clamp(isize, minCount - count, 0, len);
+
+		len = (aio->backend == siAioBackend_IoUring)
+			? si__aioRingPoll(aio, done, len, min)
+			: si__aioPoolPoll(aio, done, len, min);
+		SI_STOPIF(len == -1, return (count != 0) ? count : -1);
+
+		for_range (i, 0, len) {
+			const siAioRequest* req = &aio->slots[done[i].slot];
+			if (req->op == siAioOp_Write && done[i].len > 0) {
+				req->file->size = si_max(isize, req->file->size, req->offset + done[i].len);
+			}
+
+			siAioCompletion* completion = &completions[count];
+			completion->userData = req->userData;
+			completion->file = req->file;
+			completion->op = req->op;
+			completion->len = done[i].len;
+			completion->error = done[i].error;
+
+			aio->freeSlots[aio->capacity - aio->inFlight] = done[i].slot;
+			aio->inFlight -= 1;
+			count += 1;
+		}
+		SI_STOPIF(len < countof(done), break);
+	}
+
+	return count;
 }
 
 SIDEF
-siError si_threadDestroy(siThread* thread) {
-	SI_ASSERT_NOT_NIL(thread);
-	SI_STOPIF(thread->id == 0, return SI_ERROR_NIL);
+void si_aioDestroy(siAio* aio) {
+	SI_ASSERT_NOT_NIL(aio);
 
-#if SI_SYSTEM_IS_WINDOWS
-	i32 res = CloseHandle(thread->id);
-	SI_ERROR_SYS_CHECK_RET(!res);
-#endif
-	thread->id = 0;
-	thread->state = siThreadState_Closed;
+	siAioCompletion buffer[16];
+	while (aio->inFlight != 0) {
+		isize res = si_aioPoll(aio, SI_ARR_LEN(buffer, countof(buffer)), 1);
+		SI_STOPIF(res == -1, break);
+	}
 
-	return SI_ERROR_NIL;
+	if (aio->backend == siAioBackend_IoUring) {
+		si__aioRingFree(aio);
+	}
+	else {
+		si__aioPoolFree(aio);
+	}
+	si_free(aio->alloc, aio->freeSlots);
+	si_free(aio->alloc, aio->files);
+	si_free(aio->alloc, aio->slots);
+
+	aio->slots = nil;
+	aio->files = nil;
+	aio->freeSlots = nil;
+	aio->inFlight = 0;
 }
 
-#endif /* SI_IMPLEMENTATION_THREAD */
+#endif /* SI_IMPLEMENTATION_AIO */
 
 #ifdef SI_IMPLEMENTATION_CPU
 
@@ -4,10 +4,12 @@
 
 
 void test_bit(void);
+void test_bitset(void);
 void test_overflow(void);
 
 int main(void) {
 	test_bit();
+	test_bitset();
 	test_overflow();
 }
 
@@ -85,6 +87,103 @@ void test_bit(void) {
 	BIT_TEST(countLeading);
 	BIT_TEST(countTrailing);
 
+	{
+		u64 power = 10;
+		for_range (i, 1, 20) {
+			TEST_EQ_ISIZE(si_numLenUint(power - 1), i);
+			TEST_EQ_ISIZE(si_numLenUint(power), i + 1);
+			power *= 10;
+		}
+
+		TEST_EQ_ISIZE(si_numLenUint(0), 1);
+		TEST_EQ_ISIZE(si_numLenUint(UINT64_MAX), 20);
+		TEST_EQ_ISIZE(si_numLenInt(-1), 2);
+		TEST_EQ_ISIZE(si_numLenInt(INT64_MIN), 20);
+		TEST_EQ_ISIZE(si_numLenUintEx(0xFF, 16), 2);
+		TEST_EQ_ISIZE(si_numLenUintEx(0x100, 16), 3);
+		TEST_EQ_ISIZE(si_numLenUintEx(SI_BIT(63), 2), 64);
+		TEST_EQ_ISIZE(si_numLenUintEx(UINT64_MAX, 8), 22);
+		TEST_EQ_ISIZE(si_numLenUintEx(UINT64_MAX, 32), 13);
+		TEST_EQ_ISIZE(si_numLenUintEx(143, 12), 2);
+	} SUCCEEDED();
+
+	TEST_COMPLETE();
+}
+
+void test_bitset(void) {
+	TEST_START();
+
+	{
+		siBitset set = si_bitsetMake(1000, si_allocatorHeap());
+		TEST_EQ_ISIZE(si_bitsetCount(set), 0);
+		TEST_EQ_ISIZE(si_bitsetFindFirst(set, 0), -1);
+
+		for (isize i = 0; i < set.len; i += 3) {
+			si_bitsetSet(set, i);
+		}
+		TEST_EQ_TRUE(si_bitsetTest(set, 999));
+		TEST_EQ_FALSE(si_bitsetTest(set, 998));
+		TEST_EQ_ISIZE(si_bitsetCount(set), 334);
+		TEST_EQ_ISIZE(si_bitsetFindFirst(set, 1), 3);
+		TEST_EQ_ISIZE(si_bitsetFindFirstZero(set, 0), 1);
+
+		isize expected = 0;
+		for_eachBit (index, set) {
+			TEST_EQ_ISIZE(index, expected);
+			expected += 3;
+		}
+		TEST_EQ_ISIZE(expected, 1002);
+
+		siBitsetRank rank = si_bitsetRankMake(set, si_allocatorHeap());
+		for (isize i = 0; i <= set.len; i += 1) {
+			TEST_EQ_ISIZE(si_bitsetRank(set, rank, i), (i + 2) / 3);
+		}
+		for_range (n, 0, 334) {
+			TEST_EQ_ISIZE(si_bitsetSelect(set, rank, n), n * 3);
+		}
+		TEST_EQ_ISIZE(si_bitsetSelect(set, rank, 334), -1);
+		si_bitsetRankFree(rank);
+
+		si_bitsetNot(set);
+		TEST_EQ_ISIZE(si_bitsetCount(set), 666);
+		si_bitsetClear(set, 1);
+		si_bitsetFlip(set, 0);
+		TEST_EQ_ISIZE(si_bitsetFindFirst(set, 0), 0);
+		TEST_EQ_ISIZE(si_bitsetFindFirstZero(set, 0), 1);
+
+		TEST_EQ_TRUE(si_bitsetResize(&set, 5000));
+		TEST_EQ_ISIZE(si_bitsetCount(set), 666);
+		TEST_EQ_FALSE(si_bitsetTest(set, 4999));
+		TEST_EQ_TRUE(si_bitsetResize(&set, 10));
+		TEST_EQ_ISIZE(si_bitsetCount(set), 6);
+		si_bitsetFree(set);
+	}
+
+	{
+		siBitset a = si_bitsetMakeFixed(100),
+				 b = si_bitsetMakeFixed(70);
+		si_bitsetFill(a, true);
+		TEST_EQ_ISIZE(si_bitsetCount(a), 100);
+		TEST_EQ_ISIZE(si_bitsetFindFirstZero(a, 0), -1);
+		TEST_EQ_FALSE(si_bitsetResize(&a, 200));
+
+		si_bitsetSet(b, 5);
+		si_bitsetSet(b, 69);
+		si_bitsetAnd(a, b);
+		TEST_EQ_ISIZE(si_bitsetCount(a), 32);
+		TEST_EQ_TRUE(si_bitsetTest(a, 69));
+		TEST_EQ_FALSE(si_bitsetTest(a, 64));
+
+		si_bitsetFill(b, true);
+		si_bitsetXor(a, b);
+		TEST_EQ_ISIZE(si_bitsetCount(a), 98);
+		si_bitsetFill(a, false);
+		si_bitsetOr(a, b);
+		TEST_EQ_ISIZE(si_bitsetCount(a), 70);
+		si_bitsetFree(a);
+	}
+	SUCCEEDED();
+
 	TEST_COMPLETE();
 }
 
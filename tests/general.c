@@ -13,6 +13,11 @@ typedef struct randomStruct {
 	f32 three;
 } randomStruct;
 
+SI_HEAP_COMPARE_PROC(test_i64Less);
+SI_HEAP_COMPARE_PROC(test_i64Less) {
+	SI_UNUSED(userData);
+	return *(const i64*)lhs < *(const i64*)rhs;
+}
 
 
 int main(void) {
@@ -225,6 +230,437 @@ int main(void) {
 	}
 	si_print("Test 7 has been completed.\n");
 
+	{
+		u8 bytes[67];
+		u16 shorts[41];
+		u32 ints[37];
+		u64 longs[19];
+		randomStruct structs[7];
+		for_range (i, 0, countof(bytes)) { bytes[i] = (u8)(i % 7); }
+		for_range (i, 0, countof(shorts)) { shorts[i] = (u16)(i % 7); }
+		for_range (i, 0, countof(ints)) { ints[i] = (u32)(i % 7); }
+		for_range (i, 0, countof(longs)) { longs[i] = (u64)(i % 7) << 32; }
+		si_memset(structs, 0, si_sizeof(structs));
+		for_range (i, 0, countof(structs)) { structs[i].one = (usize)(i % 3); }
+
+		siArray(u8) arr8 = SI_ARR_LEN(bytes, countof(bytes));
+		TEST_EQ_ISIZE(si_arrayFindItem(arr8, 6, u8), 6);
+		TEST_EQ_ISIZE(si_arrayFindLastItem(arr8, 6, u8), 62);
+		TEST_EQ_ISIZE(si_arrayFindCountItem(arr8, 6, u8), 9);
+		TEST_EQ_ISIZE(si_arrayFindItem(arr8, 7, u8), -1);
+		TEST_EQ_ISIZE(si_arrayFindLastItem(arr8, 7, u8), -1);
+
+		siArray(u16) arr16 = SI_ARR_LEN(shorts, countof(shorts));
+		TEST_EQ_ISIZE(si_arrayFindItem(arr16, 5, u16), 5);
+		TEST_EQ_ISIZE(si_arrayFindLastItem(arr16, 5, u16), 40);
+		TEST_EQ_ISIZE(si_arrayFindCountItem(arr16, 5, u16), 6);
+
+		siArray(u32) arr32 = SI_ARR_LEN(ints, countof(ints));
+		TEST_EQ_ISIZE(si_arrayFindItem(arr32, 1, u32), 1);
+		TEST_EQ_ISIZE(si_arrayFindLastItem(arr32, 1, u32), 36);
+		TEST_EQ_ISIZE(si_arrayFindCountItem(arr32, 1, u32), 6);
+		TEST_EQ_ISIZE(si_arrayFindItem(arr32, 0x100, u32), -1);
+
+		siArray(u64) arr64 = SI_ARR_LEN(longs, countof(longs));
+		TEST_EQ_ISIZE(si_arrayFindItem(arr64, 4ULL << 32, u64), 4);
+		TEST_EQ_ISIZE(si_arrayFindLastItem(arr64, 4ULL << 32, u64), 18);
+		TEST_EQ_ISIZE(si_arrayFindCountItem(arr64, 4ULL << 32, u64), 3);
+		TEST_EQ_ISIZE(si_arrayFindItem(arr64, 4, u64), -1);
+
+		siArray(randomStruct) arrStruct = SI_ARR_LEN(structs, countof(structs));
+		TEST_EQ_ISIZE(si_arrayFind(arrStruct, &structs[2]), 2);
+		TEST_EQ_ISIZE(si_arrayFindLast(arrStruct, &structs[2]), 5);
+		TEST_EQ_ISIZE(si_arrayFindCount(arrStruct, &structs[1]), 2);
+	}
+	si_print("Test 8 has been completed.\n");
+
+	{
+		siDeque(i32) deque = si_dequeMakeReserve(i32, 3, si_allocatorHeap());
+		TEST_EQ_ISIZE(deque.capacity, 4);
+		TEST_EQ_NIL(si_dequeFront(deque));
+
+		for_range (i, 0, 3) {
+			i32 value = (i32)i;
+			si_dequePushBack(&deque, &value);
+		}
+		si_dequePushFrontItem(&deque, -1, i32);
+		si_dequePushFrontItem(&deque, -2, i32);
+		TEST_EQ_ISIZE(deque.len, 5);
+		TEST_EQ_ISIZE(deque.capacity, 8);
+
+		i32 expected = -2, x;
+		for_eachDeque (x, deque) {
+			TEST_EQ_I64(x, expected);
+			expected += 1;
+		}
+		TEST_EQ_I64(*(i32*)si_dequeFront(deque), -2);
+		TEST_EQ_I64(*(i32*)si_dequeBack(deque), 2);
+
+		TEST_EQ_TRUE(si_dequePopFront(&deque, &x));
+		TEST_EQ_I64(x, -2);
+		TEST_EQ_TRUE(si_dequePopBack(&deque, &x));
+		TEST_EQ_I64(x, 2);
+		TEST_EQ_I64(*(i32*)si_dequeGet(deque, 1), 0);
+
+		for_range (i, 0, 100) {
+			i32 value = (i32)i;
+			si_dequePushFront(&deque, &value);
+			si_dequePopBack(&deque, nil);
+		}
+		TEST_EQ_ISIZE(deque.len, 3);
+		TEST_EQ_I64(*(i32*)si_dequeFront(deque), 99);
+		TEST_EQ_I64(*(i32*)si_dequeBack(deque), 97);
+
+		i32* ref;
+		for_eachRefDeque (ref, deque) { *ref *= 2; }
+		TEST_EQ_I64(*(i32*)si_dequeGet(deque, 1), 196);
+
+		si_dequeClear(&deque);
+		TEST_EQ_FALSE(si_dequePopFront(&deque, &x));
+		si_dequeFree(deque);
+	}
+	si_print("Test 9 has been completed.\n");
+
+	{
+		i64 list[] = {50, 30, 90, 10, 70, 20, 80, 60, 40};
+		siHeap(i64) heap = si_heapMakeEx(list, si_sizeof(i64), countof(list), test_i64Less, nil, si_allocatorHeap());
+		TEST_EQ_I64(*(i64*)si_heapTop(heap), 10);
+		TEST_EQ_I64(*(i64*)si_heapGet(heap, 2), 90);
+
+		i64 value = 5;
+		si_heapUpdate(&heap, 2, &value);
+		TEST_EQ_I64(*(i64*)si_heapTop(heap), 5);
+		si_heapErase(&heap, 3);
+
+		value = 15;
+		isize handle = si_heapPush(&heap, &value);
+		TEST_EQ_ISIZE(handle, 3);
+
+		i64 expected[] = {5, 15, 20, 30, 40, 50, 60, 70, 80}, x;
+		for_range (i, 0, countof(expected)) {
+			TEST_EQ_TRUE(si_heapPop(&heap, &x));
+			TEST_EQ_I64(x, expected[i]);
+		}
+		TEST_EQ_FALSE(si_heapPop(&heap, &x));
+		si_heapFree(heap);
+
+		siDynamicArray(siHeapNodeF64) nodes = si_dynamicArrayMakeReserve(siHeapNodeF64, 2, si_allocatorHeap());
+		si_heapPushF64(&nodes, 2.5, 1);
+		si_heapPushF64(&nodes, -1.0, 2);
+		si_heapPushF64(&nodes, 0.5, 3);
+
+		siHeapNodeF64 node;
+		TEST_EQ_TRUE(si_heapPopF64(&nodes, &node));
+		TEST_EQ_U64(node.value, 2);
+		TEST_EQ_TRUE(si_heapPopF64(&nodes, &node));
+		TEST_EQ_U64(node.value, 3);
+		si_dynamicArrayFree(nodes);
+	}
+	si_print("Test 10 has been completed.\n");
+
+	{
+		siDynamicArray(i32) array = si_dynamicArrayMakeSmall(i32, 4, si_allocatorHeap());
+		TEST_EQ_ISIZE(array.capacity, 4);
+
+		for_range (i, 0, 4) {
+			i32 value = (i32)i * 10;
+			si_dynamicArrayAppend(&array, &value);
+		}
+		TEST_EQ_PTR(array.data, array.buffer);
+
+		for_range (i, 4, 100) {
+			i32 value = (i32)i * 10;
+			si_dynamicArrayAppend(&array, &value);
+		}
+		TEST_NEQ_PTR(array.data, array.buffer);
+		TEST_EQ_ISIZE(array.len, 100);
+
+		for_range (i, 0, array.len) {
+			TEST_EQ_I64(*(i32*)si_dynamicArrayGet(array, i), (i32)i * 10);
+		}
+		si_dynamicArrayFree(array);
+
+		siDynamicArray(u8) inlined = si_dynamicArrayMakeBuffer(SI_ARR_STACK(16), 1, si_allocatorHeap());
+		si_dynamicArrayAppendItem(&inlined, 'A', u8);
+		TEST_EQ_PTR(inlined.data, inlined.buffer);
+		si_dynamicArrayFree(inlined);
+	}
+	si_print("Test 11 has been completed.\n");
+
+	{
+		/* NOTE(EimaMei): The official wyhash test vectors. */
+		siString strings[] = {
+			SI_STRC(""), SI_STRC("a"), SI_STRC("abc"), SI_STRC("message digest"),
+			SI_STRC("abcdefghijklmnopqrstuvwxyz"),
+			SI_STRC("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789"),
+			SI_STRC("12345678901234567890123456789012345678901234567890123456789012345678901234567890")
+		};
+		u64 expected[] = {
+			0x42BC986DC5EEC4D3, 0x84508DC903C31551, 0x0BC54887CFC9ECB1, 0x6E2FF3298208A67C,
+			0x9A64E42E897195B9, 0x9199383239C32554, 0x7C1CCF6BBA30F5A5
+		};
+
+		for_range (i, 0, countof(strings)) {
+			TEST_EQ_H64(si_wyhash64Ex(strings[i].data, strings[i].len, (u64)i), expected[i]);
+
+			siHash128 hash = si_wyhash128Ex(strings[i].data, strings[i].len, (u64)i);
+			TEST_EQ_H64(hash.low, expected[i]);
+			TEST_NEQ_U64(hash.low, hash.high);
+		}
+
+		/* NOTE(EimaMei): Vectors from the reference MurmurHash3_x86_32 and
+		 * MurmurHash64A/64B implementations. */
+		siString murmurStrings[] = {
+			SI_STRC(""), SI_STRC("a"), SI_STRC("abc"), SI_STRC("0123456"),
+			SI_STRC("Hello, world!"), SI_STRC("The quick brown fox jumps over the lazy dog")
+		};
+		u32 murmur32[] = {0xEBB6C228, 0x7FA09EA6, 0xC84A62DD, 0xAB2513B7, 0x24884CBA, 0x2FA826CD};
+#if SI_ARCH_IS_64BIT
+		u64 murmur64[] = {
+			0x8397626CD6895052, 0xE96B6245652273AE, 0xA9316C8740C81414,
+			0xC33F26FD7EAAA76B, 0x710583FA7F802A84, 0x029A7747A564BD84
+		};
+#else
+		u64 murmur64[] = {
+			0x053E2018F75660A9, 0x6D027B24F3BE26E3, 0x98C163DAABD1E077,
+			0x4E2F9043238C86D2, 0x78195C0263D5AB27, 0x1E109A5DD452072D
+		};
+#endif
+
+		for_range (i, 0, countof(murmurStrings)) {
+			TEST_EQ_U32(si_murmur32(murmurStrings[i].data, murmurStrings[i].len), murmur32[i]);
+			TEST_EQ_H64(si_murmur64(murmurStrings[i].data, murmurStrings[i].len), murmur64[i]);
+		}
+		TEST_EQ_U32(si_murmur32Ex("hello", 5, 0), 0x248BFA47);
+
+		/* NOTE(EimaMei): A full map, so that most keys share their bucket with
+		 * another one. */
+		siString keys[] = {
+			SI_STRC("alpha"), SI_STRC("beta"), SI_STRC("gamma"), SI_STRC("delta"),
+			SI_STRC("epsilon"), SI_STRC("zeta"), SI_STRC("eta"), SI_STRC("theta"),
+			SI_STRC("iota"), SI_STRC("kappa"), SI_STRC("lambda"), SI_STRC("mu"),
+			SI_STRC("nu"), SI_STRC("xi"), SI_STRC("omicron"), SI_STRC("pi")
+		};
+		siMap(i32) map = si_mapMakeReserve(i32, countof(keys), si_allocatorHeap());
+		for_range (i, 0, countof(keys)) {
+			i32 value = (i32)i;
+			si_mapSet(&map, keys[i], &value);
+		}
+
+		for (isize i = 0; i < countof(keys); i += 3) {
+			si_mapErase(&map, keys[i]);
+		}
+		for_range (i, 0, countof(keys)) {
+			i32* value = (i32*)si_mapGet(map, keys[i]);
+			if (i % 3 == 0) {
+				TEST_EQ_PTR(value, nil);
+			}
+			else {
+				TEST_NEQ_PTR(value, nil);
+				TEST_EQ_I64(*value, i);
+			}
+		}
+
+		si_mapClear(&map);
+		TEST_EQ_ISIZE(map.len, 0);
+		for_range (i, 0, countof(keys)) {
+			TEST_EQ_PTR(si_mapGet(map, keys[i]), nil);
+		}
+
+		si_mapSetItem(&map, keys[5], 50, i32);
+		TEST_EQ_I64(si_mapGetItem(map, keys[5], i32), 50);
+		TEST_EQ_ISIZE(map.len, 1);
+		si_mapFree(map);
+	}
+	si_print("Test 12 has been completed.\n");
+
+	{
+		u8 data[300];
+		for_range (i, 0, countof(data)) {
+			data[i] = (u8)(i * 7 + 3);
+		}
+
+		isize chunkSizes[] = {1, 3, 7, 16, 47, 48, 49, 100};
+		for_range (i, 0, countof(chunkSizes)) {
+			siFnv32State fnv32 = si_fnv32aInit();
+			siFnv64State fnv64 = si_fnv64Init();
+			siMurmur32State murmur32 = si_murmur32Init();
+			siMurmur64State murmur64 = si_murmur64Init(countof(data));
+			siWyhashState wyhash = si_wyhashInit();
+
+			for (isize offset = 0; offset < countof(data); offset += chunkSizes[i]) {
+				isize len = si_min(isize, chunkSizes[i], countof(data) - offset);
+				si_fnv32Update(&fnv32, &data[offset], len);
+				si_fnv64Update(&fnv64, &data[offset], len);
+				si_murmur32Update(&murmur32, &data[offset], len);
+				si_murmur64Update(&murmur64, &data[offset], len);
+				si_wyhashUpdate(&wyhash, &data[offset], len);
+			}
+
+			TEST_EQ_U32(si_fnv32Final(fnv32), si_fnv32a(data, countof(data)));
+			TEST_EQ_H64(si_fnv64Final(fnv64), si_fnv64(data, countof(data)));
+			TEST_EQ_U32(si_murmur32Final(murmur32), si_murmur32(data, countof(data)));
+			TEST_EQ_H64(si_murmur64Final(murmur64), si_murmur64(data, countof(data)));
+			TEST_EQ_H64(si_wyhash64Final(wyhash), si_wyhash64(data, countof(data)));
+			TEST_EQ_H64(si_wyhash128Final(wyhash).high, si_wyhash128(data, countof(data)).high);
+		}
+	}
+	si_print("Test 13 has been completed.\n");
+
+	{
+		siString str = SI_STRC("123456789");
+		TEST_EQ_H64(si_crc32c(str.data, str.len), 0xE3069283);
+		TEST_EQ_H64(si_crc32c(str.data, 0), 0);
+		TEST_EQ_H64(si_crc32cEx(&str.data[4], str.len - 4, si_crc32c(str.data, 4)), 0xE3069283);
+
+		str = SI_STR("Wikipedia");
+		TEST_EQ_H64(si_adler32(str.data, str.len), 0x11E60398);
+		TEST_EQ_H64(si_adler32Ex(&str.data[3], str.len - 3, si_adler32(str.data, 3)), 0x11E60398);
+
+		u8 zeroes[32] = {0};
+		TEST_EQ_H64(si_crc32c(zeroes, countof(zeroes)), 0x8A9136AA);
+		TEST_EQ_H64(si_adler32(zeroes, 0), 1);
+	}
+	si_print("Test 14 has been completed.\n");
+
+	{
+		siString keys[] = {
+			SI_STRC("CPU"), SI_STRC("GPU"), SI_STRC("RAM"), SI_STRC("SSD"),
+			SI_STRC("PSU"), SI_STRC("motherboard"), SI_STRC(""),
+			SI_STRC("a key that is longer than forty eight bytes, so it takes the block path")
+		};
+		siArray(siString) names = SI_ARR_LEN(keys, countof(keys));
+
+		u64 hashes[countof(keys)];
+		si_wyhash64Batch(names, hashes);
+		for_range (i, 0, countof(keys)) {
+			TEST_EQ_H64(hashes[i], si_wyhash64(keys[i].data, keys[i].len));
+		}
+
+		i32 values[countof(keys)];
+		for_range (i, 0, countof(keys)) { values[i] = (i32)i * 10; }
+
+		siMap(i32) map = si_mapMakeReserve(i32, countof(keys), si_allocatorHeap());
+		si_mapSetBatch(&map, names, values);
+		TEST_EQ_ISIZE(map.len, countof(keys));
+
+		void* found[countof(keys)];
+		si_mapGetBatch(map, names, found);
+		for_range (i, 0, countof(keys)) {
+			TEST_EQ_PTR(found[i], si_mapGet(map, keys[i]));
+			TEST_EQ_I64(*(i32*)found[i], values[i]);
+		}
+
+		siString missing[] = {SI_STRC("HDD"), SI_STRC("CPU")};
+		si_mapGetBatch(map, SI_ARR_LEN(missing, countof(missing)), found);
+		TEST_EQ_PTR(found[0], nil);
+		TEST_EQ_I64(*(i32*)found[1], 0);
+
+		/* NOTE(EimaMei): Enough keys to go through several batches. */
+		u8 storage[64][8];
+		siString many[64];
+		i32 manyValues[64];
+		void* manyFound[64];
+		for_range (i, 0, countof(many)) {
+			many[i] = si_bprintf(SI_ARR_LEN(storage[i], countof(storage[i])), SI_STR("key%zi"), i);
+			manyValues[i] = (i32)i;
+		}
+
+		siMap(i32) large = si_mapMakeReserve(i32, countof(many), si_allocatorHeap());
+		si_mapSetBatch(&large, SI_ARR_LEN(many, countof(many)), manyValues);
+		TEST_EQ_ISIZE(large.len, countof(many));
+
+		si_mapGetBatch(large, SI_ARR_LEN(many, countof(many)), manyFound);
+		for_range (i, 0, countof(many)) {
+			TEST_EQ_PTR(manyFound[i], si_mapGet(large, many[i]));
+			TEST_EQ_I64(*(i32*)manyFound[i], manyValues[i]);
+		}
+
+		si_mapFree(large);
+		si_mapFree(map);
+	}
+	si_print("Test 15 has been completed.\n");
+
+	{
+		u8 data[15];
+		for_range (i, 0, countof(data)) { data[i] = (u8)i; }
+		siHash128 key = {0x0706050403020100, 0x0F0E0D0C0B0A0908};
+
+		TEST_EQ_H64(si_siphash24(data, 0, key), 0x726FDB47DD0E0E31);
+		TEST_EQ_H64(si_siphash24(data, countof(data), key), 0xA129CA6149BE45E5);
+		TEST_EQ_H64(si_siphash13(data, 0, key), 0xABAC0158050FC4DC);
+
+		siMap(i32) fast = si_mapMakeReserve(i32, 8, si_allocatorHeap());
+		siMap(i32) keyed = si_mapMakeReserveKeyed(i32, 8, si_allocatorHeap());
+		siMap(i32) fixed = si_mapReserveKeyedEx(si_sizeof(i32), 8, key, si_allocatorHeap());
+		TEST_EQ_FALSE(fast.keyed);
+		TEST_EQ_TRUE(keyed.keyed);
+
+		siString name = SI_STRC("Content-Type");
+		TEST_EQ_U32(si_mapHash(fast, name), (u32)si_wyhash64(name.data, name.len) & 0x7FFFFFFF);
+		TEST_EQ_U32(si_mapHash(fixed, name), (u32)si_siphash13(name.data, name.len, key) & 0x7FFFFFFF);
+
+		siString names[] = {SI_STRC("Host"), SI_STRC("Accept"), SI_STRC("Content-Type"), SI_STRC("Cookie")};
+		i32 values[] = {1, 2, 3, 4};
+		si_mapSetBatch(&keyed, SI_ARR_LEN(names, countof(names)), values);
+		for_range (i, 0, countof(names)) {
+			si_mapSet(&fixed, names[i], &values[i]);
+		}
+
+		for_range (i, 0, countof(names)) {
+			TEST_EQ_I64(*(i32*)si_mapGet(keyed, names[i]), values[i]);
+			TEST_EQ_I64(*(i32*)si_mapGet(fixed, names[i]), values[i]);
+		}
+		si_mapErase(&keyed, names[1]);
+		TEST_EQ_PTR(si_mapGet(keyed, names[1]), nil);
+		TEST_EQ_ISIZE(keyed.len, countof(names) - 1);
+
+		si_mapFree(fixed);
+		si_mapFree(keyed);
+		si_mapFree(fast);
+	}
+	si_print("Test 16 has been completed.\n");
+
+	{
+		siRandom xoshiro = si_randomMake(0);
+		xoshiro.state.xoshiro[0] = 1;
+		xoshiro.state.xoshiro[1] = 2;
+		xoshiro.state.xoshiro[2] = 3;
+		xoshiro.state.xoshiro[3] = 4;
+		TEST_EQ_U64(si_randomNext(&xoshiro), 11520);
+		TEST_EQ_U64(si_randomNext(&xoshiro), 0);
+		TEST_EQ_U64(si_randomNext(&xoshiro), 1509978240);
+		TEST_EQ_U64(si_randomNext(&xoshiro), 1215971899390074240);
+
+		siRandom pcg = si_randomMakePcg(42, 54);
+		TEST_EQ_H64(si_randomNext(&pcg), 0x86B1DA1D72062B68);
+		TEST_EQ_H64(si_randomNext(&pcg), 0x1304AA46C9853D39);
+		TEST_EQ_H64(si_randomNext(&pcg), 0xA3670E9E0DD50358);
+
+		siRandom stepped = si_randomMakePcg(7, 9), jumped = stepped;
+		si_randomJump(&jumped);
+		TEST_EQ_H64(jumped.state.pcg.state[0], 0xDB98B0383AD10315);
+		TEST_EQ_H64(jumped.state.pcg.state[1], 0x5989E755D66F7587);
+		TEST_NEQ_U64(si_randomNext(&stepped), si_randomNext(&jumped));
+
+		siRandom rng = si_randomMake(1);
+		for_range (i, 0, 1000) {
+			i64 num = si_randomRange(&rng, -3, 3);
+			TEST_EQ_TRUE(num >= -3 && num <= 3);
+
+			f64 f = si_randomF64(&rng);
+			TEST_EQ_TRUE(f >= 0.0 && f < 1.0);
+		}
+		TEST_EQ_U64(si_randomBounded(&rng, 1), 0);
+
+		u8 buffer[1027] = {0};
+		si_randomFill(&rng, buffer, countof(buffer));
+		isize zeroes = 0;
+		for_range (i, 0, countof(buffer)) { zeroes += (buffer[i] == 0); }
+		TEST_EQ_TRUE(zeroes < 32);
+	}
+	si_print("Test 17 has been completed.\n");
+
 
 	TEST_COMPLETE();
 }
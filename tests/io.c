@@ -0,0 +1,166 @@
+#define SI_IMPLEMENTATION 1
+#include <sili.h>
+#include <tests/test.h>
+
+
+#if SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+/* Writes the alphabet into the pipe a few bytes at a time, so that the reader
+ * only ever gets partial transfers. */
+siIntern
+SI_THREAD_PROC(test_pipeWriter) {
+	int fd = *(int*)data;
+
+	for (isize i = 0; i < 26; i += 5) {
+		si_sleep(SI_TIME_MS(5));
+		ssize_t res = write(fd, &"abcdefghijklmnopqrstuvwxyz"[i], (usize)si_min(isize, 26 - i, 5));
+		SI_UNUSED(res);
+	}
+	close(fd);
+
+	return nil;
+}
+#endif
+
+typedef struct test_walkCount {
+	isize dots;
+	isize types[siIoType_Fifo + 1];
+} test_walkCount;
+
+siIntern
+SI_DIRECTORY_WALK_PROC(test_walkProc) {
+	test_walkCount* count = (test_walkCount*)data;
+	count->dots += si_stringEqual(entry->name, SI_STR(".")) || si_stringEqual(entry->name, SI_STR(".."));
+	count->types[entry->type] += 1;
+
+	return siWalkAction_Continue;
+}
+
+
+int main(void) {
+	TEST_START();
+
+	{
+		/* NOTE(EimaMei): More buffers than fit into a single call, with empty
+		 * ones in between. */
+		u8 data[100], out[100];
+		siArray(u8) buffers[150], outBuffers[150];
+		isize len = 0;
+		for_range (i, 0, countof(buffers)) {
+			isize size = (i % 3 == 2) ? 0 : 1;
+			buffers[i] = SI_ARR_LEN(&data[len], size);
+			outBuffers[i] = SI_ARR_LEN(&out[len], size);
+			len += size;
+		}
+		TEST_EQ_ISIZE(len, countof(data));
+		for_range (i, 0, countof(data)) { data[i] = (u8)i; }
+
+		siFile file = si_fileCreate(SI_STR("io_vec.bin"));
+		isize res = si_fileWriteVecAt(&file, SI_ARR_LEN(buffers, countof(buffers)), 10);
+		TEST_EQ_ISIZE(res, countof(data));
+		TEST_EQ_ISIZE(file.size, 10 + countof(data));
+
+		siResult(isize) read = si_fileReadVec(file, 10, SI_ARR_LEN(outBuffers, countof(outBuffers)));
+		TEST_EQ_TRUE(read.hasValue);
+		TEST_EQ_ISIZE(read.data.value, countof(out));
+		TEST_EQ_TRUE(si_memcompare(data, out, countof(out)) == 0);
+
+		/* NOTE(EimaMei): Reading past the end stops at the end of the file. */
+		read = si_fileReadVec(file, 60, SI_ARR_LEN(outBuffers, countof(outBuffers)));
+		TEST_EQ_TRUE(read.hasValue);
+		TEST_EQ_ISIZE(read.data.value, 50);
+
+		si_fileClose(&file);
+		si_pathRemove(SI_STR("io_vec.bin"));
+	} SUCCEEDED();
+
+#if SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	{
+		int fds[2];
+		TEST_EQ_ISIZE(pipe(fds), 0);
+
+		siThread thread;
+		siError error = si_threadMakeAndRun(test_pipeWriter, &fds[1], &thread);
+		TEST_EQ_U32(error.code, 0);
+
+		u8 out[32];
+		siArray(u8) buffers[] = {
+			SI_ARR_LEN(&out[0], 3), SI_ARR_LEN(&out[3], 0), SI_ARR_LEN(&out[3], 4),
+			SI_ARR_LEN(&out[7], 1), SI_ARR_LEN(&out[8], 11), SI_ARR_LEN(&out[19], 13)
+		};
+		isize res = si__fileVec(fds[0], SI_ARR_LEN(buffers, countof(buffers)), -1, false);
+		TEST_EQ_ISIZE(res, 26);
+		TEST_EQ_STR(SI_STR_LEN(out, res), SI_STR("abcdefghijklmnopqrstuvwxyz"));
+
+		si_threadJoin(&thread);
+		si_threadDestroy(&thread);
+		close(fds[0]);
+	} SUCCEEDED();
+#endif
+
+#if SI_SYSTEM_IS_UNIX || SI_SYSTEM_IS_APPLE
+	{
+		TEST_EQ_TRUE(si__directoryIsDot(".", 1));
+		TEST_EQ_TRUE(si__directoryIsDot("..", 2));
+		TEST_EQ_FALSE(si__directoryIsDot("...", 3));
+		TEST_EQ_FALSE(si__directoryIsDot(".a", 2));
+		TEST_EQ_FALSE(si__directoryIsDot("a.", 2));
+		TEST_EQ_FALSE(si__directoryIsDot(".", 0));
+
+		TEST_EQ_U32(si__directoryType(DT_REG), siIoType_File);
+		TEST_EQ_U32(si__directoryType(DT_DIR), siIoType_Directory);
+		TEST_EQ_U32(si__directoryType(DT_LNK), siIoType_Link);
+		TEST_EQ_U32(si__directoryType(DT_SOCK), siIoType_Socket);
+		TEST_EQ_U32(si__directoryType(DT_CHR), siIoType_Device);
+		TEST_EQ_U32(si__directoryType(DT_BLK), siIoType_Block);
+		TEST_EQ_U32(si__directoryType(DT_FIFO), siIoType_Fifo);
+		TEST_EQ_U32(si__directoryType(DT_UNKNOWN), 0);
+		TEST_EQ_U32(si__directoryType(DT_WHT), 0);
+		TEST_EQ_U32(si__directoryType(UINT8_MAX), 0);
+
+		TEST_EQ_U32(si__directoryStatType(AT_FDCWD, "tests"), siIoType_Directory);
+		TEST_EQ_U32(si__directoryStatType(AT_FDCWD, "tests/io.c"), siIoType_File);
+		TEST_EQ_U32(si__directoryStatType(AT_FDCWD, "/dev/null"), siIoType_Device);
+		TEST_EQ_U32(si__directoryStatType(AT_FDCWD, "io_missing"), 0);
+	} SUCCEEDED();
+#endif
+
+	{
+		/* NOTE(EimaMei): Names that start with dots must not be mistaken for
+		 * '.' and '..'. */
+		siString files[] = {SI_STRC("io_dir/..."), SI_STRC("io_dir/.hidden"), SI_STRC("io_dir/sub/file")};
+		si_pathCreateFolder(SI_STR("io_dir"));
+		si_pathCreateFolder(SI_STR("io_dir/sub"));
+		for_range (i, 0, countof(files)) {
+			siFile file = si_fileCreate(files[i]);
+			si_fileClose(&file);
+		}
+		siError error = si_pathCreateSoftLink(SI_STR("../tests/io.c"), SI_STR("io_dir/link"));
+		TEST_EQ_U32(error.code, 0);
+
+		test_walkCount count = SI_STRUCT_ZERO;
+		siDirectory dir = si_directoryOpen(SI_STR("io_dir"));
+		siDirectoryIterator entry;
+		while (si_directoryIterate(&dir, &entry)) {
+			count.dots += si_stringEqual(entry.path, SI_STR(".")) || si_stringEqual(entry.path, SI_STR(".."));
+			count.types[entry.type] += 1;
+		}
+		TEST_EQ_U32(dir.error.code, 0);
+		TEST_EQ_ISIZE(count.dots, 0);
+		TEST_EQ_ISIZE(count.types[siIoType_File], 2);
+		TEST_EQ_ISIZE(count.types[siIoType_Directory], 1);
+		TEST_EQ_ISIZE(count.types[siIoType_Link], 1);
+
+		count = SI_TYPE_ZERO(test_walkCount);
+		siResult(isize) res = si_directoryWalk(SI_STR("io_dir"), test_walkProc, &count);
+		TEST_EQ_TRUE(res.hasValue);
+		TEST_EQ_ISIZE(res.data.value, 5);
+		TEST_EQ_ISIZE(count.dots, 0);
+		TEST_EQ_ISIZE(count.types[siIoType_File], 3);
+		TEST_EQ_ISIZE(count.types[siIoType_Directory], 1);
+		TEST_EQ_ISIZE(count.types[siIoType_Link], 1);
+
+		si_pathRemove(SI_STR("io_dir"));
+	} SUCCEEDED();
+
+	TEST_COMPLETE();
+}
@@ -0,0 +1,211 @@
+#define SI_IMPLEMENTATION 1
+#include <sili.h>
+#include <tests/test.h>
+
+
+/* Captures the arguments like a binary logger does and checks that rendering
+ * them gives the same text as 'si_bprintf'. */
+siIntern
+void test_logRoundTrip(siCallerLoc loc, cstring fmt, ...) {
+	u8 args[SI_LOG_MESSAGE_MAX], text[SI_LOG_MESSAGE_MAX];
+	siFormat format = si_formatMake(SI_CSTR(fmt), si_allocatorHeap());
+
+	va_list va;
+	va_start(va, fmt);
+	isize argsLen = si__logCapture(args, countof(args), SI_CSTR(fmt), va);
+	va_end(va);
+
+	va_start(va, fmt);
+	siString expected = si_bprintfVa(SI_ARR_STACK(SI_LOG_MESSAGE_MAX), SI_CSTR(fmt), va);
+	va_end(va);
+
+	isize len = si__logRender(text, countof(text), format, args, argsLen);
+	ASSERT_FMT(
+		si_stringEqual(SI_STR_LEN(text, len), expected),
+		SI_STR("'%s' != '%s' (%L)"), SI_STR_LEN(text, len), expected, loc
+	);
+
+	si_arrayFree(format, si_allocatorHeap());
+}
+#define TEST_LOG_ROUND_TRIP(...) test_logRoundTrip(SI_CALLER_LOC, __VA_ARGS__)
+
+/* Decodes the binary log into a file and reads the text back into 'out'. */
+siIntern
+bool test_logDecode(u8* data, isize len, siArray(u8) out, siString* text) {
+	siFile file = si_fileCreate(SI_STR("log_decoded.txt"));
+	bool res = si_logDecode(SI_ARR_LEN(data, len), &file, si_allocatorHeap());
+
+	si_fileSizeUpdate(&file);
+	*text = si_fileReadContentsBuf(file, out);
+	si_fileClose(&file);
+
+	return res;
+}
+
+siIntern
+isize test_logHeader(u8* out, isize capacity) {
+	u32 version = SI__LOG_VERSION,
+		endian = 0x01020304;
+
+	isize len = 0;
+	si__logPut(out, capacity, &len, SI__LOG_MAGIC, countof_str(SI__LOG_MAGIC));
+	si__logPut(out, capacity, &len, &version, si_sizeof(version));
+	si__logPut(out, capacity, &len, &endian, si_sizeof(endian));
+	return len;
+}
+
+siIntern
+void test_logDefine(u8* out, isize capacity, isize* len, u64 id, siString fmt) {
+	u8 tag = 'D';
+	i32 line = 3;
+	si__logPut(out, capacity, len, &tag, si_sizeof(tag));
+	si__logPut(out, capacity, len, &id, si_sizeof(id));
+	si__logPut(out, capacity, len, &line, si_sizeof(line));
+	si__logPutStr(out, capacity, len, SI_STR("a.c"));
+	si__logPutStr(out, capacity, len, fmt);
+}
+
+siIntern
+void test_logRecord(u8* out, isize capacity, isize* len, u64 id, siString args) {
+	u8 tag = 'R',
+	   level = siLogLevel_Info;
+	i64 time = 0;
+	si__logPut(out, capacity, len, &tag, si_sizeof(tag));
+	si__logPut(out, capacity, len, &id, si_sizeof(id));
+	si__logPut(out, capacity, len, &time, si_sizeof(time));
+	si__logPut(out, capacity, len, &level, si_sizeof(level));
+	si__logPutStr(out, capacity, len, args);
+}
+
+/* Writes a log with a single call site and record into 'out'. */
+siIntern
+isize test_logMake(u8* out, isize capacity, siString fmt, siString args) {
+	isize len = test_logHeader(out, capacity);
+	test_logDefine(out, capacity, &len, 1, fmt);
+	test_logRecord(out, capacity, &len, 1, args);
+	return len;
+}
+
+
+int main(void) {
+	TEST_START();
+	u8 log[2048];
+	siArray(u8) textBuf = SI_ARR_STACK(4096);
+	siString text;
+
+	{
+		siCallerLoc loc = SI_CALLER_LOC;
+		TEST_LOG_ROUND_TRIP("%i %u %x %lli %c %t", -42, 42u, 0xABCu, INT64_MIN, 'c', true);
+		TEST_LOG_ROUND_TRIP("%s|%S|%.3S|%10s|%s", SI_STR("sili"), "cstr", "cstring", SI_STR("pad"), SI_STR_NIL);
+		TEST_LOG_ROUND_TRIP("%.2f %e %g %a", 3.14159, 1e300, 0.0001, 1.5);
+		TEST_LOG_ROUND_TRIP("%*i|%-*i|%.*f", 6, 7, 6, 7, 3, 2.5);
+		TEST_LOG_ROUND_TRIP("%L %p %% %n", loc, (void*)&loc, (signed int*)nil);
+		TEST_LOG_ROUND_TRIP("%C%i%C", si_printColor8bit(42), 1);
+	} SUCCEEDED();
+
+	{
+		u64 value = 5;
+		isize header = test_logHeader(log, countof(log));
+		isize len = header;
+		test_logDefine(log, countof(log), &len, 1, SI_STR("x=%i"));
+		isize defined = len;
+		test_logRecord(log, countof(log), &len, 1, SI_STR_LEN(&value, si_sizeof(value)));
+
+		bool res = test_logDecode(log, len, textBuf, &text);
+		TEST_EQ_TRUE(res);
+		TEST_EQ_TRUE(si_stringHasSuffix(text, SI_STR(" INFO  a.c:3: x=5\n")));
+
+		/* NOTE(EimaMei): A log that got cut off between entries is still valid. */
+		for_range (i, 0, len) {
+			res = test_logDecode(log, i, textBuf, &text);
+			TEST_EQ_U32(res, (i == header || i == defined));
+		}
+	} SUCCEEDED();
+
+	{
+		i32 width[3] = {INT32_MIN, 5, 0};
+		siPrintColor clr[2] = {si_printColor3bit(siPrintColor3bit_Red), si_printColor8bit(42)};
+		u8 colorArgs[1 + si_sizeof(siPrintColor)] = {true};
+		clr[0].data.ansi.color = (siPrintColor3bit)12;
+		clr[1].type = (siPrintColorType)7;
+
+		isize len = test_logMake(log, countof(log), SI_STR("%99999i"), SI_STR_EMPTY);
+		TEST_EQ_FALSE(test_logDecode(log, len, textBuf, &text));
+
+		len = test_logMake(log, countof(log), SI_STR("x=%\xE2\x82"), SI_STR_EMPTY);
+		TEST_EQ_FALSE(test_logDecode(log, len, textBuf, &text));
+
+		len = test_logMake(log, countof(log), SI_STR("%*i"), SI_STR_LEN(width, si_sizeof(width)));
+		TEST_EQ_FALSE(test_logDecode(log, len, textBuf, &text));
+
+		for_range (i, 0, countof(clr)) {
+			si_memcopy(&colorArgs[1], &clr[i], si_sizeof(clr[i]));
+			len = test_logMake(log, countof(log), SI_STR("%C"), SI_STR_LEN(colorArgs, countof(colorArgs)));
+			TEST_EQ_FALSE(test_logDecode(log, len, textBuf, &text));
+		}
+
+		u8 locArgs[] = {
+			0xFF, 0xFF, 0xFF, 0xFF,  1, 0, 0, 0, 'f',  7, 0, 0, 0
+		};
+		len = test_logMake(log, countof(log), SI_STR("%L"), SI_STR_LEN(locArgs, countof(locArgs)));
+		TEST_EQ_TRUE(test_logDecode(log, len, textBuf, &text));
+		TEST_EQ_TRUE(si_stringHasSuffix(text, SI_STR("a.c:3: :7:f\n")));
+
+		u8 longLoc[1024];
+		isize longLen = 0;
+		si_memset(log, 'a', 1001);
+		si__logPutStr(longLoc, countof(longLoc), &longLen, SI_STR_LEN(log, 1001));
+		si__logPutStr(longLoc, countof(longLoc), &longLen, SI_STR_EMPTY);
+		si__logPut(longLoc, countof(longLoc), &longLen, &locArgs[9], si_sizeof(i32));
+		len = test_logMake(log, countof(log), SI_STR("%L"), SI_STR_LEN(longLoc, longLen));
+		TEST_EQ_FALSE(test_logDecode(log, len, textBuf, &text));
+
+		len = test_logHeader(log, countof(log));
+		test_logRecord(log, countof(log), &len, 2, SI_STR_EMPTY);
+		TEST_EQ_FALSE(test_logDecode(log, len, textBuf, &text));
+
+		len = test_logMake(log, countof(log), SI_STR("x"), SI_STR_EMPTY);
+		log[len] = 'X';
+		TEST_EQ_FALSE(test_logDecode(log, len + 1, textBuf, &text));
+
+		log[countof_str(SI__LOG_MAGIC)] = SI__LOG_VERSION + 1;
+		TEST_EQ_FALSE(test_logDecode(log, len, textBuf, &text));
+	} SUCCEEDED();
+
+	{
+		siFile file = si_fileCreate(SI_STR("log.bin"));
+		siLogger logger = si_loggerMake(&file, siLogLevel_Info, si_allocatorHeap());
+		logger.policy = siLogPolicy_Block;
+		logger.format = siLogFormat_Binary;
+		siError error = si_loggerStart(&logger);
+		TEST_EQ_U32(error.code, 0);
+
+		for_range (i, 0, 3) {
+			si_logInfo(&logger, "Record %zi of %s", i, SI_STR("sili"));
+			si_logDebug(&logger, "Filtered out");
+		}
+		bool res = si_logf(&logger, siLogLevel_Warn, SI_CALLER_LOC, "Runtime %i", 7);
+		TEST_EQ_TRUE(res);
+		si_loggerDestroy(&logger);
+
+		/* NOTE(EimaMei): The call site's format only gets written once. */
+		si_fileSizeUpdate(&file);
+		siString contents = si_fileReadContents(file, si_allocatorHeap());
+		TEST_EQ_ISIZE(si_stringFindCount(contents, SI_STR("Record %zi of %s")), 1);
+		TEST_EQ_ISIZE(si_stringFindCount(contents, SI_STR("Filtered out")), 0);
+
+		res = test_logDecode((u8*)contents.data, contents.len, textBuf, &text);
+		TEST_EQ_TRUE(res);
+		TEST_EQ_ISIZE(si_stringFindCount(text, SI_STR("INFO  tests/log.c:")), 3);
+		TEST_NEQ_U64((u64)si_stringFind(text, SI_STR(": Record 2 of sili\n")), (u64)-1);
+		TEST_NEQ_U64((u64)si_stringFind(text, SI_STR("WARN  tests/log.c:")), (u64)-1);
+		TEST_EQ_TRUE(si_stringHasSuffix(text, SI_STR(": Runtime 7\n")));
+
+		si_free(si_allocatorHeap(), (void*)contents.data);
+		si_fileClose(&file);
+		si_pathRemove(SI_STR("log.bin"));
+	} SUCCEEDED();
+
+	si_pathRemove(SI_STR("log_decoded.txt"));
+	TEST_COMPLETE();
+}
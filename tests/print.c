@@ -41,6 +41,8 @@ int main(void) {
 	TEST_PRINT("\tHel\n", "\t%.*S\n", 3, str);
 
 	TEST_PRINT("Characters:\tA % ė\n", "Characters:\t%c %% %c\n", 'A', 0x0117);
+	TEST_PRINT_REG("Unfinished specifiers: %");
+	TEST_PRINT_REG("Unfinished specifiers: %-5.2");
 
 	TEST_PRINT_REG("Integers:\n");
 	TEST_PRINT(
@@ -52,9 +54,12 @@ int main(void) {
 	TEST_PRINT("\tHexadecimal:\t5 a A 0x6\n", "\tHexadecimal:\t%x %x %X %#x\n", 5, 10, 10, 6);
 	TEST_PRINT("\tOctal:\t\t12 0o12 0o4\n","\tOctal:\t\t%o %#o %#o\n", 10, 10, 4);
 	TEST_PRINT_REG("Floating-point:\n");
-	TEST_PRINT("\tRounding:\t1.500000 2 1.30000000000000000000000000000000\n", "\tRounding:\t%f %.0f %.32f\n", 1.5, 1.5, 1.3);
+	TEST_PRINT("\tRounding:\t1.500000 2 1.30000000000000004440892098500626\n", "\tRounding:\t%f %.0f %.32f\n", 1.5, 1.5, 1.3);
+	TEST_PRINT("\tExact digits:\t2.67 0 0.10000000000000000555\n", "\tExact digits:\t%.2f %.0f %.20f\n", 2.675, 0.5, 0.1);
+	TEST_PRINT("\tExact digits:\t4.940656e-324 1 1\n", "\tExact digits:\t%e %g %.3g\n", 5e-324, 1.0000001, 1.0000001);
 	TEST_PRINT("\tPadding:\t01.50 1.50  1.50\n", "\tPadding:\t%05.2f %.2f %5.2f\n", 1.5, 1.5, 1.5);
 	TEST_PRINT("\tScientific:\t1.500000E+00 1.500000e+00\n", "\tScientific:\t%E %e\n", 1.5, 1.5);
+	TEST_PRINT("\tNegative exponents:\t1.230000e-03 0.0001 1e+06 1.5E-07\n", "\tNegative exponents:\t%e %g %g %G\n", 0.00123, 0.0001, 1e6, 1.5e-7);
 	/* TEST_PRINT("\t0x1.8p+0 0X1.8P+0\n", "\tHexadecimal:\t%a %A\n", 1.5, 1.5); */
 	{
 		const f64 nan = NAN;
@@ -68,6 +73,108 @@ int main(void) {
 	TEST_PRINT("true false 0b1 0b0\n", "%t %t %#b %#b\n", true, false, 1, 0);
 	TEST_PRINT("qwertyuiop\n", "%s\n", SI_STR("qwertyuiop"));
 
+	TEST_PRINT_REG("Long floats:\n");
+	{
+		siArray(u8) buffer = si_arrayMakeReserve(u8, 1024, si_allocatorHeap());
+		siString out = si_bprintf(buffer, SI_STR("%600.500f"), 0.5);
+		TEST_EQ_ISIZE(out.len, 600);
+		TEST_EQ_STR(si_substr(out, 97, 103), SI_STR(" 0.500"));
+		TEST_EQ_STR(si_substrFrom(out, 597), SI_STR("000"));
+
+		out = si_bprintf(buffer, SI_STR("%-500e"), 2.0);
+		TEST_EQ_ISIZE(out.len, 500);
+		TEST_EQ_STR(si_substrTo(out, 13), SI_STR("2.000000e+00 "));
+		si_arrayFree(buffer, si_allocatorHeap());
+	} SUCCEEDED();
+
+	TEST_PRINT_REG("Truncation:\n");
+	{
+		siString out = si_bprintf(SI_ARR_STACK(6), SI_STR("abc %s"), SI_STR("0123"));
+		TEST_EQ_STR(out, SI_STR("abc 01"));
+
+		out = si_bprintf(SI_ARR_STACK(8), SI_STR("%5i|%i"), 1, 234);
+		TEST_EQ_STR(out, SI_STR("    1|23"));
+	} SUCCEEDED();
+
+	TEST_PRINT_REG("Preparsed formats:\n");
+	{
+		siFormat format = si_formatMake(SI_STR("\t[%-6s] %05i %.2f %#x%%\n"), si_allocatorHeap());
+		TEST_EQ_ISIZE(format.len, 6);
+
+		siString out = si_bprintfFormat(SI_ARR_STACK(64), format, SI_STR("log"), 42, 3.14159, 255);
+		TEST_EQ_STR(out, SI_STR("\t[log   ] 00042 3.14 0xff%\n"));
+
+		out = si_bprintfFormat(SI_ARR_STACK(8), format, SI_STR("x"), 1, 1.0, 1);
+		TEST_EQ_STR(out, SI_STR("\t[x     "));
+
+		si_arrayFree(format, si_allocatorHeap());
+	} SUCCEEDED();
+
+	TEST_PRINT_REG("Required length:\n");
+	{
+		isize len;
+		siString out = si_bprintfEx(SI_ARR_STACK(8), &len, SI_STR("%5i|%s"), 1, SI_STR("0123456789"));
+		TEST_EQ_STR(out, SI_STR("    1|01"));
+		TEST_EQ_ISIZE(len, 16);
+
+		out = si_bprintfEx(SI_ARR_STACK(32), &len, SI_STR("%-4s|"), SI_STR("ab"));
+		TEST_EQ_STR(out, SI_STR("ab  |"));
+		TEST_EQ_ISIZE(len, 5);
+
+		out = si_bprintfEx(SI_ARR_STACK(8), &len, SI_STR("%.400f|%-500e|"), 0.25, 2.0);
+		TEST_EQ_STR(out, SI_STR("0.250000"));
+		TEST_EQ_ISIZE(len, 402 + 1 + 500 + 1);
+
+		siArray(u8) buffer = si_arrayMakeReserve(u8, 1024, si_allocatorHeap());
+		out = si_bprintfEx(buffer, &len, SI_STR("%600.500f|"), 0.5);
+		TEST_EQ_ISIZE(out.len, 601);
+		TEST_EQ_ISIZE(len, 601);
+		TEST_EQ_STR(si_substr(out, 97, 103), SI_STR(" 0.500"));
+		TEST_EQ_STR(si_substrFrom(out, 597), SI_STR("000|"));
+		si_arrayFree(buffer, si_allocatorHeap());
+	} SUCCEEDED();
+
+	TEST_PRINT_REG("Builder output:\n");
+	{
+		siBuilder b = si_builderMake(4, si_allocatorHeap());
+		si_builderWriteStr(&b, SI_STR("{"));
+
+		siAllocationError error = si_builderPrintf(&b, SI_STR("\"id\": %i, \"name\": \"%s\", \"pad\": \"%10S\""), 42, SI_STR("sili"), "x");
+		TEST_EQ_U32(error, siAllocationError_None);
+		si_builderWriteStr(&b, SI_STR("}"));
+		TEST_EQ_STR(si_builderToStr(b), SI_STR("{\"id\": 42, \"name\": \"sili\", \"pad\": \"         x\"}"));
+
+		isize capacity = b.capacity;
+		si_builderClear(&b);
+		error = si_builderPrintf(&b, SI_STR("%i"), 7);
+		TEST_EQ_U32(error, siAllocationError_None);
+		TEST_EQ_STR(si_builderToStr(b), SI_STR("7"));
+		TEST_EQ_ISIZE(b.capacity, capacity);
+
+		si_builderFree(&b);
+	} SUCCEEDED();
+
+	TEST_PRINT_REG("Streamed file output:\n");
+	{
+		siArray(u8) long_str = si_arrayMakeReserve(u8, SI_KILO(12), si_allocatorHeap());
+		si_memset(long_str.data, 'a', long_str.len);
+
+		siFile file = si_fileCreate(SI_STR("print_stream.txt"));
+		isize len = si_fprintfLn(&file, SI_STR("%10000i|%s|"), 42, SI_STR_LEN(long_str.data, long_str.len));
+		TEST_EQ_ISIZE(len, 10000 + 1 + SI_KILO(12) + 1 + 1);
+
+		si_fileSizeUpdate(&file);
+		siString contents = si_fileReadContents(file, si_allocatorHeap());
+		TEST_EQ_ISIZE(contents.len, len);
+		TEST_EQ_STR(si_substr(contents, 9998, 10001), SI_STR("42|"));
+		TEST_EQ_STR(si_substrFrom(contents, len - 3), SI_STR("a|\n"));
+
+		si_free(si_allocatorHeap(), (void*)contents.data);
+		si_arrayFree(long_str, si_allocatorHeap());
+		si_fileClose(&file);
+		si_pathRemove(SI_STR("print_stream.txt"));
+	} SUCCEEDED();
+
 	si_printLn("================\nPrint colour tests:\nANSI/3-bit colour:");
 	for_rangeEx (u8, id, siPrintColor3bit_Black, siPrintColor3bit_White + 1) {
 		siPrintColor clr = si_printColor3bit(id),
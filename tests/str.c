@@ -1,5 +1,6 @@
 #define SI_IMPLEMENTATION 1
 #include <sili.h>
+#include <math.h>
 #include <tests/test.h>
 
 
@@ -593,6 +594,22 @@ void TEST_UINT_BASE(siString str, i32 base, u64 expectedNum, isize expectedIndex
 		} \
 	} while (0)
 
+#define TEST_FLOAT(str, expectedNum) \
+	TEST_FLOAT_EX(str, expectedNum, -2)
+
+#define TEST_FLOAT_EX(str, expectedNum, expectedIndex) \
+	do { \
+		isize invalidIndex; \
+		union { f64 f; u64 n; } num, expected; \
+		\
+		num.f = si_stringToFloatEx(str, &invalidIndex); \
+		expected.f = expectedNum; \
+		TEST_EQ_H64(num.n, expected.n); \
+		if (expectedIndex != -2) { \
+			TEST_EQ_ISIZE(invalidIndex, expectedIndex); \
+		} \
+	} while (0)
+
 void test_conv(void) {
 	TEST_START();
 
@@ -635,6 +652,9 @@ void test_conv(void) {
 		TEST_UINT_BASE(SI_STR("0xFFAA"), -1, 0xFFAA, -1);
 		TEST_UINT_BASE(SI_STR("0xFF!AA"), -1, 0xFF, 4);
 		TEST_UINT_BASE(SI_STR("   FFFFFFFFFFFFFFFF   "), 16, UINT64_MAX, -1);
+		TEST_UINT_BASE(SI_STR("deadBEEFcafeF00D"), 16, 0xDEADBEEFCAFEF00D, -1);
+		TEST_UINT_BASE(SI_STR("0123456789abcdef"), 16, 0x0123456789ABCDEF, -1);
+		TEST_UINT_BASE(SI_STR("89abcdeg"), 16, 0x89ABCDE, 7);
 
 		TEST_UINT_BASE(SI_STR("0z123"), -1, 171, -1);
 		TEST_UINT_BASE(SI_STR("123"), 12, 171, -1);
@@ -644,6 +664,9 @@ void test_conv(void) {
 		TEST_UINT_BASE(SI_STR("0d98!76"), -1, 98, 4);
 		TEST_UINT_BASE(SI_STR("12345"), 10, 12345, -1);
 		TEST_UINT_BASE(SI_STR("18446744073709551615"), 10, UINT64_MAX, -1);
+		TEST_UINT_BASE(SI_STR("1234567812345678"), 10, 1234567812345678, -1);
+		TEST_UINT_BASE(SI_STR("12345678_12345678"), 10, 1234567812345678, -1);
+		TEST_UINT_BASE(SI_STR("1234567x12345678"), 10, 1234567, 7);
 
 		TEST_UINT_BASE(SI_STR("0o755"), -1, 0755, -1);
 		TEST_UINT_BASE(SI_STR("0o75!5"), -1, 075, 4);
@@ -705,6 +728,36 @@ void test_conv(void) {
 		TEST_INT_BASE(SI_STR("-1000000000000000000000000000000000000000000000000000000000000000"), 2, INT64_MIN, -1);
 	} SUCCEEDED();
 
+	{
+		TEST_FLOAT(SI_STR("0"), 0.0);
+		TEST_FLOAT(SI_STR("-0"), -0.0);
+		TEST_FLOAT(SI_STR("3.14"), 3.14);
+		TEST_FLOAT(SI_STR("  -1.5e-3  "), -1.5e-3);
+		TEST_FLOAT(SI_STR(".5"), 0.5);
+		TEST_FLOAT(SI_STR("1e23"), 1e23);
+		TEST_FLOAT(SI_STR("9007199254740993"), 9007199254740992.0);
+		TEST_FLOAT(SI_STR("1.7976931348623157e308"), FLOAT64_MAX);
+		TEST_FLOAT(SI_STR("1e309"), INFINITY);
+		TEST_FLOAT(SI_STR("4.9406564584124654e-324"), 5e-324);
+		TEST_FLOAT(SI_STR("2.4703282292062327e-324"), 0.0);
+		TEST_FLOAT(SI_STR("2.4703282292062328e-324"), 5e-324);
+		TEST_FLOAT(SI_STR("2.2250738585072011e-308"), 2.2250738585072011e-308);
+		TEST_FLOAT(SI_STR("0.1000000000000000055511151231257827021181583404541015625"), 0.1);
+		TEST_FLOAT(SI_STR("-Infinity"), -INFINITY);
+		TEST_FLOAT(SI_STR("inf"), INFINITY);
+
+		TEST_FLOAT_EX(SI_STR("1.25xyz"), 1.25, 4);
+		TEST_FLOAT_EX(SI_STR_LEN("1.25xyz", 4), 1.25, -1);
+		TEST_FLOAT_EX(SI_STR("2e+"), 2.0, 1);
+		TEST_FLOAT_EX(SI_STR("12 34"), 12.0, 2);
+		TEST_FLOAT_EX(SI_STR("-abc"), 0.0, 1);
+
+		isize invalidIndex;
+		f64 nan = si_stringToFloatEx(SI_STR("NaN"), &invalidIndex);
+		TEST_EQ_TRUE(si_float64IsNan(nan));
+		TEST_EQ_ISIZE(invalidIndex, -1);
+	} SUCCEEDED();
+
 	{
 		siString str;
 
@@ -728,5 +781,26 @@ void test_conv(void) {
 		TEST_EQ_U32(res, UINT32_MAX);
 	} SUCCEEDED();
 
+	{
+		siString str;
+		str = si_stringFromFloatShortest(0.1, SI_ARR_STACK(32));
+		TEST_EQ_STR(str, SI_STR("0.1"));
+		str = si_stringFromFloatShortest(123456.789, SI_ARR_STACK(32));
+		TEST_EQ_STR(str, SI_STR("123456.789"));
+		str = si_stringFromFloatShortest(-0.0, SI_ARR_STACK(32));
+		TEST_EQ_STR(str, SI_STR("-0"));
+		str = si_stringFromFloatShortest(1e21, SI_ARR_STACK(32));
+		TEST_EQ_STR(str, SI_STR("1e+21"));
+		str = si_stringFromFloatShortest(5e-324, SI_ARR_STACK(32));
+		TEST_EQ_STR(str, SI_STR("5e-324"));
+		str = si_stringFromFloatShortest(FLOAT64_MAX, SI_ARR_STACK(32));
+		TEST_EQ_STR(str, SI_STR("1.7976931348623157e+308"));
+
+		str = si_stringFromFloat32Shortest(0.1f, SI_ARR_STACK(32));
+		TEST_EQ_STR(str, SI_STR("0.1"));
+		str = si_stringFromFloat32Shortest(FLOAT32_MAX, SI_ARR_STACK(32));
+		TEST_EQ_STR(str, SI_STR("3.4028235e+38"));
+	} SUCCEEDED();
+
 	TEST_COMPLETE();
 }